@@ -0,0 +1,39 @@
+#include "Core/Public/Algorithm/Hash/ConstStringHash.h"
+
+#if defined(FORGE_BUILD_DEBUG)
+	#include <mutex>
+	#include <stdio.h>
+	#include <string.h>
+
+	#include "Core/Public/Containers/THashMap.h"
+	#include "Core/Public/Types/String/String.h"
+#endif
+
+namespace Forge {
+	namespace Algorithms
+	{
+		Bool ConstStringHash::Register(ConstStringHash hash, ConstCharPtr str)
+		{
+#if defined(FORGE_BUILD_DEBUG)
+			static std::mutex s_mutex;
+			static Containers::THashMap<ConstStringHash, Type::String> s_strings;
+
+			std::lock_guard<std::mutex> lock(s_mutex);
+
+			if (const Type::String* registered = s_strings.Find(hash))
+			{
+				if (strcmp(registered->GetRawData(), str) == 0)
+					return true;
+
+				fprintf(stderr, "string hash collision: \"%s\" and \"%s\" both hash to 0x%016llx\n",
+					registered->GetRawData(), str, static_cast<unsigned long long>(hash.GetValue()));
+
+				return false;
+			}
+
+			s_strings.Insert(hash, Type::String(str));
+#endif
+			return true;
+		}
+	}
+}
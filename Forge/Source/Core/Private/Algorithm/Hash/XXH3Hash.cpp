@@ -0,0 +1,700 @@
+#include <string.h>
+
+#include "Core/Public/Algorithm/Hash/XXH3Hash.h"
+
+#if defined(FORGE_SIMD_AVX2)
+	#include <immintrin.h>
+#elif defined(FORGE_SIMD_SSE2)
+	#include <emmintrin.h>
+#endif
+
+#if defined(FORGE_COMPILER_MSVC)
+	#include <intrin.h>
+	#include <stdlib.h>
+#endif
+
+namespace Forge {
+	namespace Algorithms
+	{
+		namespace
+		{
+			const U32 PRIME32_1 = 0x9E3779B1U;
+			const U32 PRIME32_2 = 0x85EBCA77U;
+			const U32 PRIME32_3 = 0xC2B2AE3DU;
+
+			const U64 PRIME64_1 = 0x9E3779B185EBCA87ULL;
+			const U64 PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+			const U64 PRIME64_3 = 0x165667B19E3779F9ULL;
+			const U64 PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+			const U64 PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+			const U64 PRIME_MX1 = 0x165667919E3779F9ULL;
+			const U64 PRIME_MX2 = 0x9FB21C651E98DF25ULL;
+
+			const Size SECRET_SIZE         = Internal::XXH3State::SECRET_SIZE;
+			const Size STRIPE_SIZE         = Internal::XXH3State::STRIPE_SIZE;
+			const Size BUFFER_SIZE         = Internal::XXH3State::BUFFER_SIZE;
+			const Size SECRET_CONSUME_RATE = 8;
+			const Size STRIPES_PER_BLOCK   = (SECRET_SIZE - STRIPE_SIZE) / SECRET_CONSUME_RATE;
+			const Size BLOCK_SIZE          = STRIPE_SIZE * STRIPES_PER_BLOCK;
+
+			// Offsets into the secret defined by the XXH3 specification.
+			const Size SECRET_LAST_ACCUMULATE = SECRET_SIZE - STRIPE_SIZE - 7;
+			const Size SECRET_MERGE_LOW       = 11;
+			const Size SECRET_MERGE_HIGH      = SECRET_SIZE - STRIPE_SIZE - 11;
+			const Size SECRET_SCRAMBLE        = SECRET_SIZE - STRIPE_SIZE;
+			const Size MID_SIZE_MAX           = 240;
+			const Size MID_SIZE_START         = 3;
+			const Size MID_SIZE_LAST          = 136 - 17;
+
+			FORGE_ALIGN(64) const U8 s_default_secret[SECRET_SIZE] = {
+				0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+				0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+				0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+				0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+				0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+				0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+				0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+				0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+				0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+				0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+				0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+				0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+			};
+
+			FORGE_FORCE_INLINE U32 Read32(const U8* address)
+			{
+				U32 value;
+				memcpy(&value, address, sizeof(U32));
+
+				return value;
+			}
+
+			FORGE_FORCE_INLINE U64 Read64(const U8* address)
+			{
+				U64 value;
+				memcpy(&value, address, sizeof(U64));
+
+				return value;
+			}
+
+			FORGE_FORCE_INLINE Void Write64(U8* address, U64 value)
+			{
+				memcpy(address, &value, sizeof(U64));
+			}
+
+			FORGE_FORCE_INLINE U32 Swap32(U32 value)
+			{
+				return ((value << 24) & 0xFF000000U) | ((value << 8) & 0x00FF0000U) |
+					   ((value >> 8) & 0x0000FF00U)  | ((value >> 24) & 0x000000FFU);
+			}
+
+			FORGE_FORCE_INLINE U64 Swap64(U64 value)
+			{
+				return (static_cast<U64>(Swap32(static_cast<U32>(value))) << 32) | Swap32(static_cast<U32>(value >> 32));
+			}
+
+			FORGE_FORCE_INLINE U32 RotateLeft32(U32 value, U32 bits) { return (value << bits) | (value >> (32 - bits)); }
+			FORGE_FORCE_INLINE U64 RotateLeft64(U64 value, U32 bits) { return (value << bits) | (value >> (64 - bits)); }
+
+			FORGE_FORCE_INLINE U64 XorShift64(U64 value, U32 shift) { return value ^ (value >> shift); }
+
+			FORGE_FORCE_INLINE HashResult Multiply64To128(U64 lhs, U64 rhs)
+			{
+#if defined(FORGE_COMPILER_GCC) && defined(FORGE_ARCHITECTURE_64BIT)
+				__uint128_t product = static_cast<__uint128_t>(lhs) * rhs;
+
+				return HashResult(static_cast<U64>(product), static_cast<U64>(product >> 64));
+#elif defined(FORGE_COMPILER_MSVC) && defined(_M_X64)
+				U64 high;
+				U64 low = _umul128(lhs, rhs, &high);
+
+				return HashResult(low, high);
+#else
+				U64 lo_lo = (lhs & 0xFFFFFFFF) * (rhs & 0xFFFFFFFF);
+				U64 hi_lo = (lhs >> 32)        * (rhs & 0xFFFFFFFF);
+				U64 lo_hi = (lhs & 0xFFFFFFFF) * (rhs >> 32);
+				U64 hi_hi = (lhs >> 32)        * (rhs >> 32);
+
+				U64 cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+				U64 upper = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+				U64 lower = (cross << 32) | (lo_lo & 0xFFFFFFFF);
+
+				return HashResult(lower, upper);
+#endif
+			}
+
+			FORGE_FORCE_INLINE U64 MultiplyFold64(U64 lhs, U64 rhs)
+			{
+				HashResult product = Multiply64To128(lhs, rhs);
+
+				return product.m_low ^ product.m_high;
+			}
+
+			FORGE_FORCE_INLINE U64 AvalancheXXH64(U64 hash)
+			{
+				hash ^= hash >> 33;
+				hash *= PRIME64_2;
+				hash ^= hash >> 29;
+				hash *= PRIME64_3;
+				hash ^= hash >> 32;
+
+				return hash;
+			}
+
+			FORGE_FORCE_INLINE U64 Avalanche(U64 hash)
+			{
+				hash = XorShift64(hash, 37);
+				hash *= PRIME_MX1;
+				hash = XorShift64(hash, 32);
+
+				return hash;
+			}
+
+			FORGE_FORCE_INLINE U64 RRMXMX(U64 hash, U64 size)
+			{
+				hash ^= RotateLeft64(hash, 49) ^ RotateLeft64(hash, 24);
+				hash *= PRIME_MX2;
+				hash ^= (hash >> 35) + size;
+				hash *= PRIME_MX2;
+
+				return XorShift64(hash, 28);
+			}
+
+			FORGE_FORCE_INLINE U64 Mix16Bytes(const U8* input, const U8* secret, U64 seed)
+			{
+				return MultiplyFold64(Read64(input)     ^ (Read64(secret)     + seed),
+									  Read64(input + 8) ^ (Read64(secret + 8) - seed));
+			}
+
+			FORGE_FORCE_INLINE HashResult Mix32Bytes(HashResult accumulator, const U8* input_1, const U8* input_2, const U8* secret, U64 seed)
+			{
+				accumulator.m_low  += Mix16Bytes(input_1, secret, seed);
+				accumulator.m_low  ^= Read64(input_2) + Read64(input_2 + 8);
+				accumulator.m_high += Mix16Bytes(input_2, secret + 16, seed);
+				accumulator.m_high ^= Read64(input_1) + Read64(input_1 + 8);
+
+				return accumulator;
+			}
+
+			/**
+			 * Accumulates one 64 byte stripe, each accumulator lane adds the
+			 * product of the low and high halves of its keyed input and the
+			 * raw input of its neighbouring lane.
+			 */
+			FORGE_FORCE_INLINE Void Accumulate512(U64* FORGE_RESTRICT accumulators, const U8* FORGE_RESTRICT input, const U8* FORGE_RESTRICT secret)
+			{
+#if defined(FORGE_SIMD_AVX2)
+				__m256i* lanes = reinterpret_cast<__m256i*>(accumulators);
+
+				for (Size i = 0; i < 2; i++)
+				{
+					__m256i data     = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input) + i);
+					__m256i key      = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret) + i);
+					__m256i data_key = _mm256_xor_si256(data, key);
+					__m256i product  = _mm256_mul_epu32(data_key, _mm256_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1)));
+					__m256i swapped  = _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+
+					lanes[i] = _mm256_add_epi64(product, _mm256_add_epi64(lanes[i], swapped));
+				}
+#elif defined(FORGE_SIMD_SSE2)
+				__m128i* lanes = reinterpret_cast<__m128i*>(accumulators);
+
+				for (Size i = 0; i < 4; i++)
+				{
+					__m128i data     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input) + i);
+					__m128i key      = _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i);
+					__m128i data_key = _mm_xor_si128(data, key);
+					__m128i product  = _mm_mul_epu32(data_key, _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1)));
+					__m128i swapped  = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+
+					lanes[i] = _mm_add_epi64(product, _mm_add_epi64(lanes[i], swapped));
+				}
+#else
+				for (Size i = 0; i < Internal::XXH3State::NUM_OF_ACCUMULATORS; i++)
+				{
+					U64 data     = Read64(input + 8 * i);
+					U64 data_key = data ^ Read64(secret + 8 * i);
+
+					accumulators[i ^ 1] += data;
+					accumulators[i]     += (data_key & 0xFFFFFFFF) * (data_key >> 32);
+				}
+#endif
+			}
+
+			/**
+			 * Scrambles the accumulators at the end of every block so that
+			 * their high bits keep influencing the result.
+			 */
+			FORGE_FORCE_INLINE Void ScrambleAccumulators(U64* FORGE_RESTRICT accumulators, const U8* FORGE_RESTRICT secret)
+			{
+#if defined(FORGE_SIMD_AVX2)
+				__m256i* lanes = reinterpret_cast<__m256i*>(accumulators);
+				__m256i prime  = _mm256_set1_epi32(static_cast<I32>(PRIME32_1));
+
+				for (Size i = 0; i < 2; i++)
+				{
+					__m256i data     = _mm256_xor_si256(lanes[i], _mm256_srli_epi64(lanes[i], 47));
+					__m256i data_key = _mm256_xor_si256(data, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret) + i));
+					__m256i low      = _mm256_mul_epu32(data_key, prime);
+					__m256i high     = _mm256_mul_epu32(_mm256_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+
+					lanes[i] = _mm256_add_epi64(low, _mm256_slli_epi64(high, 32));
+				}
+#elif defined(FORGE_SIMD_SSE2)
+				__m128i* lanes = reinterpret_cast<__m128i*>(accumulators);
+				__m128i prime  = _mm_set1_epi32(static_cast<I32>(PRIME32_1));
+
+				for (Size i = 0; i < 4; i++)
+				{
+					__m128i data     = _mm_xor_si128(lanes[i], _mm_srli_epi64(lanes[i], 47));
+					__m128i data_key = _mm_xor_si128(data, _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i));
+					__m128i low      = _mm_mul_epu32(data_key, prime);
+					__m128i high     = _mm_mul_epu32(_mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+
+					lanes[i] = _mm_add_epi64(low, _mm_slli_epi64(high, 32));
+				}
+#else
+				for (Size i = 0; i < Internal::XXH3State::NUM_OF_ACCUMULATORS; i++)
+				{
+					U64 accumulator = XorShift64(accumulators[i], 47) ^ Read64(secret + 8 * i);
+
+					accumulators[i] = accumulator * PRIME32_1;
+				}
+#endif
+			}
+
+			FORGE_FORCE_INLINE Void AccumulateStripes(U64* accumulators, const U8* input, const U8* secret, Size num_of_stripes)
+			{
+				for (Size i = 0; i < num_of_stripes; i++)
+					Accumulate512(accumulators, input + i * STRIPE_SIZE, secret + i * SECRET_CONSUME_RATE);
+			}
+
+			Void InitializeAccumulators(U64* accumulators)
+			{
+				accumulators[0] = PRIME32_3;
+				accumulators[1] = PRIME64_1;
+				accumulators[2] = PRIME64_2;
+				accumulators[3] = PRIME64_3;
+				accumulators[4] = PRIME64_4;
+				accumulators[5] = PRIME32_2;
+				accumulators[6] = PRIME64_5;
+				accumulators[7] = PRIME32_1;
+			}
+
+			Void DeriveSecret(U8* secret, U64 seed)
+			{
+				for (Size i = 0; i < SECRET_SIZE; i += 16)
+				{
+					Write64(secret + i,     Read64(s_default_secret + i)     + seed);
+					Write64(secret + i + 8, Read64(s_default_secret + i + 8) - seed);
+				}
+			}
+
+			U64 MergeAccumulators(const U64* accumulators, const U8* secret, U64 start)
+			{
+				U64 result = start;
+
+				for (Size i = 0; i < 4; i++)
+				{
+					result += MultiplyFold64(accumulators[2 * i]     ^ Read64(secret + 16 * i),
+											 accumulators[2 * i + 1] ^ Read64(secret + 16 * i + 8));
+				}
+
+				return Avalanche(result);
+			}
+
+			/**
+			 * Accumulates an input longer than 240 bytes in blocks of 16
+			 * stripes, the last stripe always covers the final 64 bytes.
+			 */
+			Void HashLong(U64* accumulators, const U8* input, Size size, const U8* secret)
+			{
+				InitializeAccumulators(accumulators);
+
+				Size num_of_blocks = (size - 1) / BLOCK_SIZE;
+
+				for (Size i = 0; i < num_of_blocks; i++)
+				{
+					AccumulateStripes(accumulators, input + i * BLOCK_SIZE, secret, STRIPES_PER_BLOCK);
+					ScrambleAccumulators(accumulators, secret + SECRET_SCRAMBLE);
+				}
+
+				Size num_of_stripes = ((size - 1) - num_of_blocks * BLOCK_SIZE) / STRIPE_SIZE;
+
+				AccumulateStripes(accumulators, input + num_of_blocks * BLOCK_SIZE, secret, num_of_stripes);
+				Accumulate512(accumulators, input + size - STRIPE_SIZE, secret + SECRET_LAST_ACCUMULATE);
+			}
+
+			U64 Hash64Short(const U8* input, Size size, const U8* secret, U64 seed)
+			{
+				if (size > 16)
+				{
+					U64 accumulator = size * PRIME64_1;
+
+					if (size > 128)
+					{
+						Size num_of_rounds = size / 16;
+
+						for (Size i = 0; i < 8; i++)
+							accumulator += Mix16Bytes(input + 16 * i, secret + 16 * i, seed);
+
+						U64 accumulator_end = Mix16Bytes(input + size - 16, secret + MID_SIZE_LAST, seed);
+						accumulator = Avalanche(accumulator);
+
+						for (Size i = 8; i < num_of_rounds; i++)
+							accumulator_end += Mix16Bytes(input + 16 * i, secret + 16 * (i - 8) + MID_SIZE_START, seed);
+
+						return Avalanche(accumulator + accumulator_end);
+					}
+
+					if (size > 32)
+					{
+						if (size > 64)
+						{
+							if (size > 96)
+							{
+								accumulator += Mix16Bytes(input + 48, secret + 96, seed);
+								accumulator += Mix16Bytes(input + size - 64, secret + 112, seed);
+							}
+
+							accumulator += Mix16Bytes(input + 32, secret + 64, seed);
+							accumulator += Mix16Bytes(input + size - 48, secret + 80, seed);
+						}
+
+						accumulator += Mix16Bytes(input + 16, secret + 32, seed);
+						accumulator += Mix16Bytes(input + size - 32, secret + 48, seed);
+					}
+
+					accumulator += Mix16Bytes(input, secret, seed);
+					accumulator += Mix16Bytes(input + size - 16, secret + 16, seed);
+
+					return Avalanche(accumulator);
+				}
+
+				if (size > 8)
+				{
+					U64 bitflip_1 = (Read64(secret + 24) ^ Read64(secret + 32)) + seed;
+					U64 bitflip_2 = (Read64(secret + 40) ^ Read64(secret + 48)) - seed;
+					U64 input_low  = Read64(input) ^ bitflip_1;
+					U64 input_high = Read64(input + size - 8) ^ bitflip_2;
+
+					return Avalanche(size + Swap64(input_low) + input_high + MultiplyFold64(input_low, input_high));
+				}
+
+				if (size >= 4)
+				{
+					seed ^= static_cast<U64>(Swap32(static_cast<U32>(seed))) << 32;
+
+					U64 bitflip = (Read64(secret + 8) ^ Read64(secret + 16)) - seed;
+					U64 input64 = Read32(input + size - 4) + (static_cast<U64>(Read32(input)) << 32);
+
+					return RRMXMX(input64 ^ bitflip, size);
+				}
+
+				if (size)
+				{
+					U32 combined = (static_cast<U32>(input[0]) << 16) | (static_cast<U32>(input[size >> 1]) << 24) |
+								   static_cast<U32>(input[size - 1]) | (static_cast<U32>(size) << 8);
+					U64 bitflip  = (Read32(secret) ^ Read32(secret + 4)) + seed;
+
+					return AvalancheXXH64(combined ^ bitflip);
+				}
+
+				return AvalancheXXH64(seed ^ Read64(secret + 56) ^ Read64(secret + 64));
+			}
+
+			HashResult Hash128Short(const U8* input, Size size, const U8* secret, U64 seed)
+			{
+				if (size > 16)
+				{
+					HashResult accumulator(size * PRIME64_1, 0);
+
+					if (size > 128)
+					{
+						Size num_of_rounds = size / 32;
+
+						for (Size i = 0; i < 4; i++)
+							accumulator = Mix32Bytes(accumulator, input + 32 * i, input + 32 * i + 16, secret + 32 * i, seed);
+
+						accumulator.m_low  = Avalanche(accumulator.m_low);
+						accumulator.m_high = Avalanche(accumulator.m_high);
+
+						for (Size i = 4; i < num_of_rounds; i++)
+							accumulator = Mix32Bytes(accumulator, input + 32 * i, input + 32 * i + 16, secret + MID_SIZE_START + 32 * (i - 4), seed);
+
+						accumulator = Mix32Bytes(accumulator, input + size - 16, input + size - 32, secret + MID_SIZE_LAST - 16, 0 - seed);
+					}
+					else
+					{
+						if (size > 32)
+						{
+							if (size > 64)
+							{
+								if (size > 96)
+									accumulator = Mix32Bytes(accumulator, input + 48, input + size - 64, secret + 96, seed);
+
+								accumulator = Mix32Bytes(accumulator, input + 32, input + size - 48, secret + 64, seed);
+							}
+
+							accumulator = Mix32Bytes(accumulator, input + 16, input + size - 32, secret + 32, seed);
+						}
+
+						accumulator = Mix32Bytes(accumulator, input, input + size - 16, secret, seed);
+					}
+
+					U64 low  = accumulator.m_low + accumulator.m_high;
+					U64 high = accumulator.m_low * PRIME64_1 + accumulator.m_high * PRIME64_4 + (size - seed) * PRIME64_2;
+
+					return HashResult(Avalanche(low), 0 - Avalanche(high));
+				}
+
+				if (size > 8)
+				{
+					U64 bitflip_low  = (Read64(secret + 32) ^ Read64(secret + 40)) - seed;
+					U64 bitflip_high = (Read64(secret + 48) ^ Read64(secret + 56)) + seed;
+					U64 input_low    = Read64(input);
+					U64 input_high   = Read64(input + size - 8);
+
+					HashResult product = Multiply64To128(input_low ^ input_high ^ bitflip_low, PRIME64_1);
+					product.m_low += static_cast<U64>(size - 1) << 54;
+
+					input_high ^= bitflip_high;
+					product.m_high += input_high + (input_high & 0xFFFFFFFF) * (PRIME32_2 - 1);
+					product.m_low  ^= Swap64(product.m_high);
+
+					HashResult result = Multiply64To128(product.m_low, PRIME64_2);
+					result.m_high += product.m_high * PRIME64_2;
+
+					return HashResult(Avalanche(result.m_low), Avalanche(result.m_high));
+				}
+
+				if (size >= 4)
+				{
+					seed ^= static_cast<U64>(Swap32(static_cast<U32>(seed))) << 32;
+
+					U64 input64 = Read32(input) + (static_cast<U64>(Read32(input + size - 4)) << 32);
+					U64 bitflip = (Read64(secret + 16) ^ Read64(secret + 24)) + seed;
+
+					HashResult product = Multiply64To128(input64 ^ bitflip, PRIME64_1 + (size << 2));
+					product.m_high += product.m_low << 1;
+					product.m_low  ^= product.m_high >> 3;
+					product.m_low   = XorShift64(product.m_low, 35);
+					product.m_low  *= PRIME_MX2;
+					product.m_low   = XorShift64(product.m_low, 28);
+
+					return HashResult(product.m_low, Avalanche(product.m_high));
+				}
+
+				if (size)
+				{
+					U32 combined_low  = (static_cast<U32>(input[0]) << 16) | (static_cast<U32>(input[size >> 1]) << 24) |
+										static_cast<U32>(input[size - 1]) | (static_cast<U32>(size) << 8);
+					U32 combined_high = RotateLeft32(Swap32(combined_low), 13);
+
+					U64 bitflip_low  = (Read32(secret)     ^ Read32(secret + 4))  + seed;
+					U64 bitflip_high = (Read32(secret + 8) ^ Read32(secret + 12)) - seed;
+
+					return HashResult(AvalancheXXH64(combined_low ^ bitflip_low), AvalancheXXH64(combined_high ^ bitflip_high));
+				}
+
+				return HashResult(AvalancheXXH64(seed ^ Read64(secret + 64) ^ Read64(secret + 72)),
+								  AvalancheXXH64(seed ^ Read64(secret + 80) ^ Read64(secret + 88)));
+			}
+
+			HashResult MergeLong(const U64* accumulators, const U8* secret, U64 size)
+			{
+				return HashResult(MergeAccumulators(accumulators, secret + SECRET_MERGE_LOW, size * PRIME64_1),
+								  MergeAccumulators(accumulators, secret + SECRET_MERGE_HIGH, ~(size * PRIME64_2)));
+			}
+		}
+
+		namespace Internal
+		{
+			Void XXH3State::Reset(U64 seed)
+			{
+				InitializeAccumulators(m_accumulators);
+				DeriveSecret(m_secret, seed);
+
+				m_buffered_size  = 0;
+				m_num_of_stripes = 0;
+				m_total_size     = 0;
+				m_seed           = seed;
+			}
+
+			Void XXH3State::Update(ConstVoidPtr data, Size size)
+			{
+				const U8* input = static_cast<const U8*>(data);
+				const U8* end   = input + size;
+
+				m_total_size += size;
+
+				if (m_buffered_size + size <= BUFFER_SIZE)
+				{
+					memcpy(m_buffer + m_buffered_size, input, size);
+					m_buffered_size += size;
+
+					return;
+				}
+
+				const Size stripes_per_buffer = BUFFER_SIZE / STRIPE_SIZE;
+
+				// Consumes a chunk of stripes, scrambling the accumulators when
+				// the chunk crosses the end of a block.
+				auto consume = [this](const U8* stripes, Size num_of_stripes)
+				{
+					if (STRIPES_PER_BLOCK - m_num_of_stripes <= num_of_stripes)
+					{
+						Size stripes_to_end = STRIPES_PER_BLOCK - m_num_of_stripes;
+
+						AccumulateStripes(m_accumulators, stripes, m_secret + m_num_of_stripes * SECRET_CONSUME_RATE, stripes_to_end);
+						ScrambleAccumulators(m_accumulators, m_secret + SECRET_SCRAMBLE);
+						AccumulateStripes(m_accumulators, stripes + stripes_to_end * STRIPE_SIZE, m_secret, num_of_stripes - stripes_to_end);
+
+						m_num_of_stripes = num_of_stripes - stripes_to_end;
+					}
+					else
+					{
+						AccumulateStripes(m_accumulators, stripes, m_secret + m_num_of_stripes * SECRET_CONSUME_RATE, num_of_stripes);
+
+						m_num_of_stripes += num_of_stripes;
+					}
+				};
+
+				if (m_buffered_size)
+				{
+					Size fill_size = BUFFER_SIZE - m_buffered_size;
+
+					memcpy(m_buffer + m_buffered_size, input, fill_size);
+					input += fill_size;
+
+					consume(m_buffer, stripes_per_buffer);
+					m_buffered_size = 0;
+				}
+
+				// Input is consumed in place while more than a buffer remains,
+				// the final bytes are always buffered for the digest.
+				if (end - input > static_cast<I64>(BUFFER_SIZE))
+				{
+					do
+					{
+						consume(input, stripes_per_buffer);
+						input += BUFFER_SIZE;
+					}
+					while (end - input > static_cast<I64>(BUFFER_SIZE));
+
+					// The digest may need the bytes preceding the buffered tail
+					// to complete the last stripe.
+					memcpy(m_buffer + BUFFER_SIZE - STRIPE_SIZE, input - STRIPE_SIZE, STRIPE_SIZE);
+				}
+
+				memcpy(m_buffer, input, end - input);
+				m_buffered_size = end - input;
+			}
+
+			Void XXH3State::Digest(U64* accumulators) const
+			{
+				memcpy(accumulators, m_accumulators, sizeof(m_accumulators));
+
+				if (m_buffered_size >= STRIPE_SIZE)
+				{
+					Size num_of_stripes      = (m_buffered_size - 1) / STRIPE_SIZE;
+					Size num_of_stripes_done = m_num_of_stripes;
+
+					if (STRIPES_PER_BLOCK - num_of_stripes_done <= num_of_stripes)
+					{
+						Size stripes_to_end = STRIPES_PER_BLOCK - num_of_stripes_done;
+
+						AccumulateStripes(accumulators, m_buffer, m_secret + num_of_stripes_done * SECRET_CONSUME_RATE, stripes_to_end);
+						ScrambleAccumulators(accumulators, m_secret + SECRET_SCRAMBLE);
+						AccumulateStripes(accumulators, m_buffer + stripes_to_end * STRIPE_SIZE, m_secret, num_of_stripes - stripes_to_end);
+					}
+					else
+					{
+						AccumulateStripes(accumulators, m_buffer, m_secret + num_of_stripes_done * SECRET_CONSUME_RATE, num_of_stripes);
+					}
+
+					Accumulate512(accumulators, m_buffer + m_buffered_size - STRIPE_SIZE, m_secret + SECRET_LAST_ACCUMULATE);
+				}
+				else
+				{
+					U8 last_stripe[STRIPE_SIZE];
+					Size catch_up_size = STRIPE_SIZE - m_buffered_size;
+
+					memcpy(last_stripe, m_buffer + BUFFER_SIZE - catch_up_size, catch_up_size);
+					memcpy(last_stripe + catch_up_size, m_buffer, m_buffered_size);
+
+					Accumulate512(accumulators, last_stripe, m_secret + SECRET_LAST_ACCUMULATE);
+				}
+			}
+		}
+
+		U64 XXH3Hash::Hash(ConstVoidPtr data, Size size, U64 seed)
+		{
+			const U8* input = static_cast<const U8*>(data);
+
+			if (size <= MID_SIZE_MAX)
+				return Hash64Short(input, size, s_default_secret, seed);
+
+			FORGE_ALIGN(64) U64 accumulators[Internal::XXH3State::NUM_OF_ACCUMULATORS];
+			FORGE_ALIGN(64) U8  secret[SECRET_SIZE];
+
+			const U8* active_secret = s_default_secret;
+
+			if (seed)
+			{
+				DeriveSecret(secret, seed);
+				active_secret = secret;
+			}
+
+			HashLong(accumulators, input, size, active_secret);
+
+			return MergeAccumulators(accumulators, active_secret + SECRET_MERGE_LOW, size * PRIME64_1);
+		}
+
+		HashResult XXH3Hash::Finalize(Void) const
+		{
+			if (m_state.m_total_size <= MID_SIZE_MAX)
+				return HashResult(Hash64Short(m_state.m_buffer, m_state.m_buffered_size, s_default_secret, m_state.m_seed));
+
+			FORGE_ALIGN(64) U64 accumulators[Internal::XXH3State::NUM_OF_ACCUMULATORS];
+			m_state.Digest(accumulators);
+
+			return HashResult(MergeAccumulators(accumulators, m_state.m_secret + SECRET_MERGE_LOW, m_state.m_total_size * PRIME64_1));
+		}
+
+		HashResult XXH3Hash128::Hash(ConstVoidPtr data, Size size, U64 seed)
+		{
+			const U8* input = static_cast<const U8*>(data);
+
+			if (size <= MID_SIZE_MAX)
+				return Hash128Short(input, size, s_default_secret, seed);
+
+			FORGE_ALIGN(64) U64 accumulators[Internal::XXH3State::NUM_OF_ACCUMULATORS];
+			FORGE_ALIGN(64) U8  secret[SECRET_SIZE];
+
+			const U8* active_secret = s_default_secret;
+
+			if (seed)
+			{
+				DeriveSecret(secret, seed);
+				active_secret = secret;
+			}
+
+			HashLong(accumulators, input, size, active_secret);
+
+			return MergeLong(accumulators, active_secret, size);
+		}
+
+		HashResult XXH3Hash128::Finalize(Void) const
+		{
+			if (m_state.m_total_size <= MID_SIZE_MAX)
+				return Hash128Short(m_state.m_buffer, m_state.m_buffered_size, s_default_secret, m_state.m_seed);
+
+			FORGE_ALIGN(64) U64 accumulators[Internal::XXH3State::NUM_OF_ACCUMULATORS];
+			m_state.Digest(accumulators);
+
+			return MergeLong(accumulators, m_state.m_secret, m_state.m_total_size);
+		}
+	}
+}
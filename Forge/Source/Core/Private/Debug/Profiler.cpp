@@ -0,0 +1,276 @@
+#include <chrono>
+#include <cstring>
+
+#include "Core/Public/Debug/Profiler.h"
+
+namespace Forge {
+	namespace Debug
+	{
+		namespace
+		{
+			thread_local ProfileThreadBuffer* s_thread_buffer = nullptr;
+
+			template<typename InType>
+			FORGE_FORCE_INLINE Bool WriteValue(FILE* file, const InType& value)
+			{
+				return fwrite(&value, sizeof(InType), 1, file) == 1;
+			}
+
+			Bool WriteString(FILE* file, const Char* string)
+			{
+				U16 length = static_cast<U16>(strlen(string));
+				return WriteValue(file, length) && fwrite(string, 1, length, file) == length;
+			}
+
+			Void WriteJsonString(FILE* file, const Char* string)
+			{
+				fputc('"', file);
+
+				for (; *string; string++)
+				{
+					Char c = *string;
+
+					if (c == '"' || c == '\\')
+						fprintf(file, "\\%c", c);
+					else if (static_cast<U8>(c) < 0x20)
+						fprintf(file, "\\u%04x", static_cast<U32>(c));
+					else
+						fputc(c, file);
+				}
+
+				fputc('"', file);
+			}
+		}
+
+		std::atomic<U32> Profiler::s_num_of_zones(0);
+		std::atomic<const ProfileZone*> Profiler::s_zones(nullptr);
+
+		ProfileZone::ProfileZone(const Char* name, const Char* file, U32 line)
+			: m_name(name), m_file(file), m_line(line), m_id(0), m_next(nullptr)
+		{
+			m_id = Profiler::RegisterZone(this);
+		}
+
+		Profiler::~Profiler()
+		{
+			ProfileThreadBuffer* buffer = m_thread_buffers.exchange(nullptr);
+
+			while (buffer)
+			{
+				ProfileThreadBuffer* next = buffer->m_next;
+				delete buffer;
+				buffer = next;
+			}
+		}
+
+		U64 Profiler::ReadNanoseconds(Void)
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		Size Profiler::DrainThreadBuffer(ProfileThreadBuffer* buffer, ProfileEvent* events)
+		{
+			U64 read_index  = buffer->m_read_index;
+			U64 write_index = buffer->m_write_index.load(std::memory_order_acquire);
+
+			// The writer never waits for the reader, anything older than one
+			// ring has already been overwritten and the oldest slot is the one
+			// the next event goes into.
+			if (write_index - read_index >= ProfileThreadBuffer::CAPACITY)
+			{
+				buffer->m_dropped_events += write_index - (ProfileThreadBuffer::CAPACITY - 1) - read_index;
+				read_index = write_index - (ProfileThreadBuffer::CAPACITY - 1);
+			}
+
+			for (U64 index = read_index; index < write_index; index++)
+				events[index - read_index] = buffer->m_events[index & ProfileThreadBuffer::MASK];
+
+			// Events the writer may have overwritten while they were being
+			// copied are torn and discarded.
+			std::atomic_thread_fence(std::memory_order_acquire);
+			U64 last_write_index = buffer->m_write_index.load(std::memory_order_relaxed);
+			U64 first_safe_index = last_write_index >= ProfileThreadBuffer::CAPACITY ? last_write_index - ProfileThreadBuffer::CAPACITY + 1 : 0;
+
+			Size count = static_cast<Size>(write_index - read_index);
+
+			if (first_safe_index > read_index)
+			{
+				Size torn = static_cast<Size>(first_safe_index - read_index);
+				torn = torn > count ? count : torn;
+
+				memmove(events, events + torn, (count - torn) * sizeof(ProfileEvent));
+
+				buffer->m_dropped_events += torn;
+				count -= torn;
+			}
+
+			buffer->m_read_index = write_index;
+
+			return count;
+		}
+
+		ProfileThreadBuffer* Profiler::GetThreadBuffer(Void)
+		{
+			if (s_thread_buffer)
+				return s_thread_buffer;
+
+			ProfileThreadBuffer* buffer = new ProfileThreadBuffer;
+			buffer->m_write_index.store(0, std::memory_order_relaxed);
+			buffer->m_read_index     = 0;
+			buffer->m_dropped_events = 0;
+			buffer->m_thread_index   = m_num_of_threads.fetch_add(1, std::memory_order_relaxed);
+			buffer->m_depth          = 0;
+			buffer->m_next           = m_thread_buffers.load(std::memory_order_relaxed);
+
+			while (!m_thread_buffers.compare_exchange_weak(buffer->m_next, buffer, std::memory_order_release, std::memory_order_relaxed));
+
+			return s_thread_buffer = buffer;
+		}
+
+		U32 Profiler::RegisterZone(ProfileZone* zone)
+		{
+			U32 id = s_num_of_zones.fetch_add(1, std::memory_order_relaxed);
+
+			zone->m_id   = id;
+			zone->m_next = s_zones.load(std::memory_order_relaxed);
+
+			while (!s_zones.compare_exchange_weak(zone->m_next, zone, std::memory_order_release, std::memory_order_relaxed));
+
+			return id;
+		}
+
+		U64 Profiler::GetCyclesPerSecond(Void)
+		{
+			U64 elapsed_cycles      = ReadCycles() - m_start_cycles;
+			U64 elapsed_nanoseconds = ReadNanoseconds() - m_start_nanoseconds;
+
+			if (elapsed_nanoseconds == 0 || elapsed_cycles == 0)
+				return 1000000000;
+
+			return static_cast<U64>(static_cast<F64>(elapsed_cycles) * 1e9 / static_cast<F64>(elapsed_nanoseconds));
+		}
+
+		U64 Profiler::GetNumOfDroppedEvents(Void) const
+		{
+			U64 dropped_events = 0;
+
+			for (ProfileThreadBuffer* buffer = m_thread_buffers.load(std::memory_order_acquire); buffer; buffer = buffer->m_next)
+				dropped_events += buffer->m_dropped_events;
+
+			return dropped_events;
+		}
+
+		Bool Profiler::WriteChromeTrace(const Char* path)
+		{
+			std::lock_guard<std::mutex> lock(m_flush_mutex);
+
+			FILE* file = fopen(path, "wb");
+
+			if (!file)
+				return false;
+
+			ProfileEvent* events = new ProfileEvent[ProfileThreadBuffer::CAPACITY];
+
+			F64 microseconds_per_cycle = 1e6 / static_cast<F64>(GetCyclesPerSecond());
+			Bool is_first_event = true;
+
+			fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", file);
+
+			for (ProfileThreadBuffer* buffer = m_thread_buffers.load(std::memory_order_acquire); buffer; buffer = buffer->m_next)
+			{
+				Size count = DrainThreadBuffer(buffer, events);
+
+				fprintf(file, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"Thread %u\"}}",
+					is_first_event ? "" : ",", buffer->m_thread_index, buffer->m_thread_index);
+				is_first_event = false;
+
+				for (Size index = 0; index < count; index++)
+				{
+					const ProfileEvent& event = events[index];
+
+					F64 timestamp = static_cast<F64>(event.m_begin_cycles - m_start_cycles) * microseconds_per_cycle;
+					F64 duration  = static_cast<F64>(event.m_end_cycles - event.m_begin_cycles) * microseconds_per_cycle;
+
+					fputs(",\n{\"name\":", file);
+					WriteJsonString(file, event.m_zone->GetName());
+					fprintf(file, ",\"cat\":\"forge\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{\"depth\":%u}}",
+						timestamp, duration, buffer->m_thread_index, event.m_depth);
+				}
+			}
+
+			fputs("\n]}\n", file);
+
+			delete[] events;
+
+			return fclose(file) == 0;
+		}
+
+		Bool Profiler::WriteBinaryTrace(const Char* path)
+		{
+			std::lock_guard<std::mutex> lock(m_flush_mutex);
+
+			FILE* file = fopen(path, "wb");
+
+			if (!file)
+				return false;
+
+			const ProfileZone* zones = s_zones.load(std::memory_order_acquire);
+			ProfileThreadBuffer* buffers = m_thread_buffers.load(std::memory_order_acquire);
+
+			U32 num_of_zones   = 0;
+			U32 num_of_threads = 0;
+
+			for (const ProfileZone* zone = zones; zone; zone = zone->GetNext())
+				num_of_zones++;
+
+			for (ProfileThreadBuffer* buffer = buffers; buffer; buffer = buffer->m_next)
+				num_of_threads++;
+
+			Bool is_written = WriteValue(file, static_cast<U32>(BINARY_MAGIC))   &&
+							  WriteValue(file, static_cast<U32>(BINARY_VERSION)) &&
+							  WriteValue(file, GetCyclesPerSecond())             &&
+							  WriteValue(file, num_of_zones)                     &&
+							  WriteValue(file, num_of_threads);
+
+			for (const ProfileZone* zone = zones; is_written && zone; zone = zone->GetNext())
+			{
+				is_written = WriteValue(file, zone->GetID())     &&
+							 WriteValue(file, zone->GetLine())   &&
+							 WriteString(file, zone->GetName())  &&
+							 WriteString(file, zone->GetFile());
+			}
+
+			ProfileEvent* events = new ProfileEvent[ProfileThreadBuffer::CAPACITY];
+
+			for (ProfileThreadBuffer* buffer = buffers; is_written && buffer; buffer = buffer->m_next)
+			{
+				U32 count = static_cast<U32>(DrainThreadBuffer(buffer, events));
+
+				is_written = WriteValue(file, buffer->m_thread_index) && WriteValue(file, count);
+
+				for (U32 index = 0; is_written && index < count; index++)
+				{
+					const ProfileEvent& event = events[index];
+
+					is_written = WriteValue(file, event.m_zone->GetID()) &&
+								 WriteValue(file, event.m_depth)          &&
+								 WriteValue(file, event.m_begin_cycles)   &&
+								 WriteValue(file, event.m_end_cycles);
+				}
+			}
+
+			delete[] events;
+
+			return (fclose(file) == 0) && is_written;
+		}
+
+		Void Profiler::Clear(Void)
+		{
+			std::lock_guard<std::mutex> lock(m_flush_mutex);
+
+			for (ProfileThreadBuffer* buffer = m_thread_buffers.load(std::memory_order_acquire); buffer; buffer = buffer->m_next)
+				buffer->m_read_index = buffer->m_write_index.load(std::memory_order_acquire);
+		}
+	}
+}
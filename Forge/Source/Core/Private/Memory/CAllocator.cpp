@@ -1,5 +1,9 @@
 #include "Core/Public/Memory/CAllocator.h"
 
+#if !defined(FORGE_PLATFORM_WINDOWS)
+	#include <malloc.h>
+#endif
+
 namespace Forge {
 	namespace Memory
 	{
@@ -34,15 +38,49 @@ namespace Forge {
 		VoidPtr CAllocator::Allocate(Size size, Byte alignment)
 		{
 			m_stats.m_num_of_allocs++;
+
+#if defined(FORGE_PLATFORM_WINDOWS)
 			return _aligned_malloc(size, alignment);
+#else
+			VoidPtr address = nullptr;
+
+			if (posix_memalign(&address, alignment < sizeof(VoidPtr) ? sizeof(VoidPtr) : alignment, size) != 0)
+				return nullptr;
+
+			return address;
+#endif
 		}
 		VoidPtr CAllocator::Reallocate(VoidPtr address, Size size, Byte alignment)
 		{
+#if defined(FORGE_PLATFORM_WINDOWS)
 			return _aligned_realloc(address, size, alignment);
+#else
+			if (!address)
+				return Allocate(size, alignment);
+
+			/// POSIX has no aligned reallocation, the usable size of the old
+			/// block bounds the bytes to copy.
+			Size old_size = malloc_usable_size(address);
+
+			VoidPtr new_address = Allocate(size, alignment);
+
+			if (!new_address)
+				return nullptr;
+
+			MemoryCopy(new_address, address, old_size < size ? old_size : size);
+
+			Deallocate(address);
+
+			return new_address;
+#endif
 		}
 		Void    CAllocator::Deallocate(VoidPtr address)
 		{
+#if defined(FORGE_PLATFORM_WINDOWS)
+			_aligned_free(address);
+#else
 			free(address);
+#endif
 			m_stats.m_num_of_allocs--;
 		}
 
@@ -0,0 +1,152 @@
+#include "Core/Public/Memory/ConcurrentPoolAllocator.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		namespace
+		{
+			FORGE_FORCE_INLINE U64 PackHead(U32 index, U32 tag)
+			{
+				return (static_cast<U64>(tag) << 32) | index;
+			}
+
+			FORGE_FORCE_INLINE U32 GetHeadIndex(U64 head) { return static_cast<U32>(head);       }
+			FORGE_FORCE_INLINE U32 GetHeadTag(U64 head)   { return static_cast<U32>(head >> 32); }
+		}
+
+		ConcurrentPoolAllocator::ConcurrentPoolAllocator(Size chunk_size, Size capacity)
+			: AbstractAllocator(nullptr, capacity), m_used_memory(0), m_num_of_allocs(0), m_num_of_deallocs(0)
+		{
+			if (chunk_size < sizeof(VoidPtr))
+			{
+				/*FORGE_EXCEPT(Debug::Exception::ERR_INVALID_OPERATION_EXCEPTION, "Object Size must be larger than or equal to Void*")*/
+			}
+
+			m_start_ptr = malloc(capacity);
+
+			m_is_mem_owned = true;
+			m_chunk_size = chunk_size;
+
+			InitializeFreeList();
+		}
+		ConcurrentPoolAllocator::ConcurrentPoolAllocator(VoidPtr start, Size chunk_size, Size capacity)
+			: AbstractAllocator(start, capacity), m_used_memory(0), m_num_of_allocs(0), m_num_of_deallocs(0)
+		{
+			if (chunk_size < sizeof(VoidPtr))
+			{
+				/*FORGE_EXCEPT(Debug::Exception::ERR_INVALID_OPERATION_EXCEPTION, "Object Size must be larger than or equal to Void*")*/
+			}
+
+			m_is_mem_owned = false;
+			m_chunk_size = chunk_size;
+
+			InitializeFreeList();
+		}
+
+		ConcurrentPoolAllocator::~ConcurrentPoolAllocator()
+		{
+			if (m_is_mem_owned)
+				free(m_start_ptr);
+		}
+
+		Void ConcurrentPoolAllocator::InitializeFreeList(Void)
+		{
+			Byte adjustment = AlignAddressUpwardAdjustment(m_start_ptr, 4);
+
+			m_first_chunk = AddAddress(m_start_ptr, adjustment);
+			m_num_of_chunks = (m_stats.m_total_size - adjustment) / m_chunk_size;
+
+			if (m_num_of_chunks >= NULL_INDEX)
+				m_num_of_chunks = NULL_INDEX - 1;
+
+			for (Size i = 0; i < m_num_of_chunks; i++)
+				*reinterpret_cast<U32*>(GetChunk(static_cast<U32>(i))) = i + 1 < m_num_of_chunks ? static_cast<U32>(i + 1) : NULL_INDEX;
+
+			m_head.store(PackHead(m_num_of_chunks ? 0 : NULL_INDEX, 0), std::memory_order_release);
+		}
+
+		VoidPtr ConcurrentPoolAllocator::GetChunk(U32 index)
+		{
+			return AddAddress(m_first_chunk, static_cast<Size>(index) * m_chunk_size);
+		}
+		U32 ConcurrentPoolAllocator::GetChunkIndex(VoidPtr address)
+		{
+			return static_cast<U32>(reinterpret_cast<Size>(SubAddress(address, m_first_chunk)) / m_chunk_size);
+		}
+
+		VoidPtr ConcurrentPoolAllocator::Allocate(Size size, Byte alignment)
+		{
+			if (size > m_chunk_size)
+			{
+				/*FORGE_EXCEPT(Debug::Exception::ERR_BAD_ALLOCATION_EXCEPTION, "Requsted size must be equal to allocator's supported object size")*/
+
+				return nullptr;
+			}
+
+			U64 head = m_head.load(std::memory_order_acquire);
+			U64 next_head;
+
+			do
+			{
+				if (GetHeadIndex(head) == NULL_INDEX)
+				{
+					/*FORGE_EXCEPT(Debug::Exception::ERR_BAD_ALLOCATION_EXCEPTION, "No sufficent space for required size")*/
+
+					return nullptr;
+				}
+
+				/// The chunk may be handed out and overwritten by another thread
+				/// before the swap, in which case the tag changed and the swap
+				/// fails, discarding the stale link.
+				U32 next_index = reinterpret_cast<std::atomic<U32>*>(GetChunk(GetHeadIndex(head)))->load(std::memory_order_relaxed);
+
+				next_head = PackHead(next_index, GetHeadTag(head) + 1);
+			}
+			while (!m_head.compare_exchange_weak(head, next_head, std::memory_order_acquire, std::memory_order_acquire));
+
+			m_used_memory.fetch_add(m_chunk_size, std::memory_order_relaxed);
+			m_num_of_allocs.fetch_add(1, std::memory_order_relaxed);
+
+			return GetChunk(GetHeadIndex(head));
+		}
+		VoidPtr ConcurrentPoolAllocator::Reallocate(VoidPtr address, Size size, Byte alignment)
+		{
+			/*FORGE_EXCEPT(Debug::Exception::ERR_INVALID_OPERATION_EXCEPTION, "Pool allocator does not support reallocation of memory addresses")*/
+
+			return nullptr;
+		}
+		Void    ConcurrentPoolAllocator::Deallocate(VoidPtr address)
+		{
+			if (!address)
+				return;
+
+			if (!WithinAddressBounds(m_first_chunk, address, m_num_of_chunks * m_chunk_size))
+			{
+				/*FORGE_EXCEPT(Debug::Exception::ERR_MEMORY_OUT_OF_BOUNDS_EXCEPTION)*/
+
+				return;
+			}
+
+			U32 index = GetChunkIndex(address);
+			std::atomic<U32>* link = reinterpret_cast<std::atomic<U32>*>(address);
+
+			U64 head = m_head.load(std::memory_order_relaxed);
+
+			do
+			{
+				link->store(GetHeadIndex(head), std::memory_order_relaxed);
+			}
+			while (!m_head.compare_exchange_weak(head, PackHead(index, GetHeadTag(head) + 1), std::memory_order_release, std::memory_order_relaxed));
+
+			m_used_memory.fetch_sub(m_chunk_size, std::memory_order_relaxed);
+			m_num_of_deallocs.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		Void ConcurrentPoolAllocator::Reset(Void)
+		{
+			InitializeFreeList();
+
+			m_used_memory.store(0, std::memory_order_relaxed);
+		}
+	}
+}
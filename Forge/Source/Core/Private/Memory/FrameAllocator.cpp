@@ -0,0 +1,168 @@
+#include "Core/Public/Memory/FrameAllocator.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		FrameAllocator::FrameAllocator(Size frame_size, FreeListAllocator* overflow_allocator)
+			: AbstractAllocator(nullptr, frame_size * 2), m_frame_allocators{ { frame_size }, { frame_size } }, m_overflow_allocator(overflow_allocator), m_frame_index(0)
+		{
+			m_is_mem_owned = true;
+
+			m_overflow_heads[0] = m_overflow_heads[1] = nullptr;
+
+			ResetFrameStats(0);
+			ResetFrameStats(1);
+
+			m_last_frame_stats = m_frame_stats[1];
+		}
+		FrameAllocator::FrameAllocator(Platform::AbstractPlatform* platform, Size reserve_size, Size retained_size, FreeListAllocator* overflow_allocator)
+			: AbstractAllocator(nullptr, 0), m_frame_allocators{ { platform, reserve_size, retained_size }, { platform, reserve_size, retained_size } }, 
+			  m_overflow_allocator(overflow_allocator), m_frame_index(0)
+		{
+			m_is_mem_owned = true;
+			m_stats.m_total_size = m_frame_allocators[0].GetTotalSize() + m_frame_allocators[1].GetTotalSize();
+
+			m_overflow_heads[0] = m_overflow_heads[1] = nullptr;
+
+			ResetFrameStats(0);
+			ResetFrameStats(1);
+
+			m_last_frame_stats = m_frame_stats[1];
+		}
+
+		FrameAllocator::~FrameAllocator()
+		{
+			ReleaseOverflow(0);
+			ReleaseOverflow(1);
+		}
+
+		Void FrameAllocator::ReleaseOverflow(Size frame_index)
+		{
+			OverflowHeader* header = m_overflow_heads[frame_index];
+
+			while (header)
+			{
+				OverflowHeader* next = header->m_next;
+
+				m_overflow_allocator->Deallocate(header);
+
+				header = next;
+			}
+
+			m_overflow_heads[frame_index] = nullptr;
+		}
+		Void FrameAllocator::ResetFrameStats(Size frame_index)
+		{
+			FrameStats& stats = m_frame_stats[frame_index];
+
+			stats.m_peak_size = 0;
+			stats.m_total_size = m_frame_allocators[frame_index].GetTotalSize();
+			stats.m_used_memory = 0;
+			stats.m_num_of_allocs = 0;
+			stats.m_num_of_deallocs = 0;
+			stats.m_overflow_memory = 0;
+			stats.m_num_of_overflow_allocs = 0;
+		}
+
+		VoidPtr FrameAllocator::AllocateOverflow(Size size, Byte alignment)
+		{
+			if (!m_overflow_allocator)
+				return nullptr;
+
+			Size extra_space = sizeof(OverflowHeader) + (alignment > sizeof(OverflowHeader) ? alignment : 0);
+
+			OverflowHeader* header = reinterpret_cast<OverflowHeader*>(m_overflow_allocator->Allocate(size + extra_space, sizeof(OverflowHeader)));
+
+			if (!header)
+				return nullptr;
+
+			Size current = m_frame_index & 1;
+
+			header->m_next = m_overflow_heads[current];
+			m_overflow_heads[current] = header;
+
+			return AlignAddressUpward(AddAddress(header, sizeof(OverflowHeader)), alignment);
+		}
+
+		Size FrameAllocator::GetUsedMemory(Void)
+		{
+			return m_frame_stats[0].m_used_memory + m_frame_stats[1].m_used_memory;
+		}
+
+		Void FrameAllocator::NextFrame(Void)
+		{
+			m_last_frame_stats = m_frame_stats[m_frame_index & 1];
+
+			m_frame_index++;
+
+			Size current = m_frame_index & 1;
+
+			m_frame_allocators[current].Reset();
+
+			ReleaseOverflow(current);
+			ResetFrameStats(current);
+		}
+
+		VoidPtr FrameAllocator::Allocate(Size size, Byte alignment)
+		{
+			FrameStats& stats = m_frame_stats[m_frame_index & 1];
+			LinearAllocator& frame_allocator = m_frame_allocators[m_frame_index & 1];
+
+			Size used_memory = frame_allocator.GetUsedMemory();
+
+			VoidPtr address = frame_allocator.Allocate(size, alignment);
+
+			if (address)
+				stats.m_used_memory += frame_allocator.GetUsedMemory() - used_memory;
+			else
+			{
+				address = AllocateOverflow(size, alignment);
+
+				if (!address)
+				{
+					/*FORGE_EXCEPT(Debug::Exception::ERR_BAD_ALLOCATION_EXCEPTION, "No sufficent space for required Size")*/
+
+					return nullptr;
+				}
+
+				stats.m_used_memory += size;
+				stats.m_overflow_memory += size;
+				stats.m_num_of_overflow_allocs++;
+			}
+
+			if (stats.m_peak_size < stats.m_used_memory) { stats.m_peak_size = stats.m_used_memory; }
+
+			stats.m_num_of_allocs++;
+
+			m_stats.m_num_of_allocs++;
+
+			return address;
+		}
+		VoidPtr FrameAllocator::Reallocate(VoidPtr address, Size size, Byte alignment)
+		{
+			/*FORGE_EXCEPT(Debug::Exception::ERR_INVALID_OPERATION_EXCEPTION, "Frame allocator does not support reallocation of memory addresses")*/
+
+			return nullptr;
+		}
+		Void    FrameAllocator::Deallocate(VoidPtr address)
+		{
+			/*FORGE_EXCEPT(Debug::Exception::ERR_INVALID_OPERATION_EXCEPTION,"Frame allocator does not support deallocation of memory addresses")*/
+		}
+
+		Void FrameAllocator::Reset(Void)
+		{
+			for (Size i = 0; i < 2; i++)
+			{
+				m_frame_allocators[i].Reset();
+
+				ReleaseOverflow(i);
+				ResetFrameStats(i);
+			}
+
+			m_frame_index = 0;
+			m_last_frame_stats = m_frame_stats[1];
+
+			m_stats.m_num_of_allocs = 0;
+		}
+	}
+}
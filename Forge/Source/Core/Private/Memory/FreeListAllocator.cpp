@@ -3,8 +3,8 @@
 namespace Forge {
 	namespace Memory
 	{
-		FreeListAllocator::FreeListAllocator(Size capacity)
-			: AbstractAllocator(nullptr, capacity)
+		FreeListAllocator::FreeListAllocator(Size capacity, FreeListPolicy policy)
+			: AbstractAllocator(nullptr, capacity), m_policy(policy)
 		{
 			m_is_mem_owned = true;
 
@@ -12,20 +12,22 @@ namespace Forge {
 
 			MemorySet(m_start_ptr, 0, this->m_stats.m_total_size);
 
-			m_free_list = reinterpret_cast<FreeBlockNode*>(m_start_ptr);
-			m_free_list->m_block_size = this->m_stats.m_total_size;
-			m_free_list->m_link = nullptr;
+			if (m_policy == FreeListPolicy::FORGE_SEGREGATED_FIT)
+				InitializeSegregatedBins();
+			else
+				InitializeFreeList();
 		}
-		FreeListAllocator::FreeListAllocator(VoidPtr start, Size capacity)
-			: AbstractAllocator(start, capacity)
+		FreeListAllocator::FreeListAllocator(VoidPtr start, Size capacity, FreeListPolicy policy)
+			: AbstractAllocator(start, capacity), m_policy(policy)
 		{
 			m_is_mem_owned = false;
 
 			MemorySet(m_start_ptr, 0, this->m_stats.m_total_size);
 
-			m_free_list = reinterpret_cast<FreeBlockNode*>(m_start_ptr);
-			m_free_list->m_block_size = this->m_stats.m_total_size;
-			m_free_list->m_link = nullptr;
+			if (m_policy == FreeListPolicy::FORGE_SEGREGATED_FIT)
+				InitializeSegregatedBins();
+			else
+				InitializeFreeList();
 		}
 
 		FreeListAllocator::~FreeListAllocator()
@@ -36,6 +38,198 @@ namespace Forge {
 				MemorySet(m_start_ptr, 0, this->m_stats.m_total_size);
 		}
 
+		Void FreeListAllocator::InitializeFreeList(Void)
+		{
+			m_free_list = reinterpret_cast<FreeBlockNode*>(m_start_ptr);
+			m_free_list->m_block_size = this->m_stats.m_total_size;
+			m_free_list->m_link = nullptr;
+		}
+		Void FreeListAllocator::InitializeSegregatedBins(Void)
+		{
+			m_bin_bitmap = 0;
+
+			MemorySet(m_bins, 0, sizeof(m_bins));
+
+			Size adjustment = AlignAddressUpwardAdjustment(m_start_ptr, SEGREGATED_GRANULARITY);
+			Size usable_size = (this->m_stats.m_total_size - adjustment) & ~(Size)(SEGREGATED_GRANULARITY - 1);
+
+			SegregatedBlockHeader* block = reinterpret_cast<SegregatedBlockHeader*>(AddAddress(m_start_ptr, adjustment));
+
+			m_end_ptr = AddAddress(block, usable_size);
+
+			block->m_prev_physical = nullptr;
+			block->m_block_size = usable_size | SEGREGATED_FREE_FLAG;
+
+			InsertSegregatedBlock(block);
+		}
+
+		Void FreeListAllocator::InsertSegregatedBlock(SegregatedBlockHeader* block)
+		{
+			U32 bin = Algorithm::FloorLog2(block->m_block_size & ~(Size)SEGREGATED_FREE_FLAG);
+
+			block->m_prev_free = nullptr;
+			block->m_next_free = m_bins[bin];
+
+			if (m_bins[bin])
+				m_bins[bin]->m_prev_free = block;
+
+			m_bins[bin] = block;
+			m_bin_bitmap |= (U64)1 << bin;
+		}
+		Void FreeListAllocator::RemoveSegregatedBlock(SegregatedBlockHeader* block)
+		{
+			U32 bin = Algorithm::FloorLog2(block->m_block_size & ~(Size)SEGREGATED_FREE_FLAG);
+
+			if (block->m_prev_free)
+				block->m_prev_free->m_next_free = block->m_next_free;
+			else
+				m_bins[bin] = block->m_next_free;
+
+			if (block->m_next_free)
+				block->m_next_free->m_prev_free = block->m_prev_free;
+
+			if (!m_bins[bin])
+				m_bin_bitmap &= ~((U64)1 << bin);
+		}
+
+		FreeListAllocator::SegregatedBlockHeader* FreeListAllocator::GetSegregatedBlock(VoidPtr address)
+		{
+			Size tag = *reinterpret_cast<SizePtr>(SubAddress(address, sizeof(Size)));
+
+			if (tag & SEGREGATED_PADDING_FLAG)
+				address = SubAddress(address, tag & ~(Size)SEGREGATED_PADDING_FLAG);
+
+			return reinterpret_cast<SegregatedBlockHeader*>(SubAddress(address, SEGREGATED_HEADER_SIZE));
+		}
+		FreeListAllocator::SegregatedBlockHeader* FreeListAllocator::GetNextPhysicalBlock(SegregatedBlockHeader* block)
+		{
+			VoidPtr next_block = AddAddress(block, block->m_block_size & ~(Size)SEGREGATED_FREE_FLAG);
+
+			return next_block < m_end_ptr ? reinterpret_cast<SegregatedBlockHeader*>(next_block) : nullptr;
+		}
+
+		VoidPtr FreeListAllocator::AllocateSegregated(Size size, Byte alignment)
+		{
+			Size extra_space = alignment > SEGREGATED_GRANULARITY ? alignment : 0;
+			Size required_space = (size + SEGREGATED_HEADER_SIZE + extra_space + SEGREGATED_GRANULARITY - 1) & ~(Size)(SEGREGATED_GRANULARITY - 1);
+
+			if (required_space < SEGREGATED_MIN_BLOCK)
+				required_space = SEGREGATED_MIN_BLOCK;
+
+			/// Any block in a bin above the floor of the required size is
+			/// guaranteed to fit, unless the required size is a power of two.
+			U32 bin = Algorithm::FloorLog2(required_space);
+			U32 fit_bin = (required_space & (required_space - 1)) ? bin + 1 : bin;
+
+			SegregatedBlockHeader* block = nullptr;
+
+			U64 fit_mask = fit_bin < SEGREGATED_BIN_COUNT ? m_bin_bitmap & (~(U64)0 << fit_bin) : 0;
+
+			if (fit_mask)
+				block = m_bins[Algorithm::CountTrailingZeros(fit_mask)];
+			else if (m_bins[bin] && (m_bins[bin]->m_block_size & ~(Size)SEGREGATED_FREE_FLAG) >= required_space)
+				block = m_bins[bin];
+
+			if (!block)
+			{
+				/*FORGE_EXCEPT(Debug::Exception::ERR_BAD_ALLOCATION_EXCEPTION, "No sufficent space for required size")*/
+
+				return nullptr;
+			}
+
+			RemoveSegregatedBlock(block);
+
+			Size block_size = block->m_block_size & ~(Size)SEGREGATED_FREE_FLAG;
+
+			if (block_size - required_space >= SEGREGATED_MIN_BLOCK)
+			{
+				SegregatedBlockHeader* remaining_block = reinterpret_cast<SegregatedBlockHeader*>(AddAddress(block, required_space));
+
+				remaining_block->m_prev_physical = block;
+				remaining_block->m_block_size = (block_size - required_space) | SEGREGATED_FREE_FLAG;
+
+				if (SegregatedBlockHeader* next_block = GetNextPhysicalBlock(remaining_block))
+					next_block->m_prev_physical = remaining_block;
+
+				InsertSegregatedBlock(remaining_block);
+
+				block_size = required_space;
+			}
+
+			block->m_block_size = block_size;
+
+			VoidPtr address = AddAddress(block, SEGREGATED_HEADER_SIZE);
+			VoidPtr aligned_address = AlignAddressUpward(address, alignment);
+
+			Size padding = reinterpret_cast<U64>(SubAddress(aligned_address, address));
+
+			if (padding)
+				*reinterpret_cast<SizePtr>(SubAddress(aligned_address, sizeof(Size))) = padding | SEGREGATED_PADDING_FLAG;
+
+			if (this->m_stats.m_peak_size < size)
+				this->m_stats.m_peak_size = size;
+
+			this->m_stats.m_used_memory += block_size;
+			this->m_stats.m_num_of_allocs++;
+
+			return aligned_address;
+		}
+		VoidPtr FreeListAllocator::ReallocateSegregated(VoidPtr address, Size size, Byte alignment)
+		{
+			SegregatedBlockHeader* block = GetSegregatedBlock(address);
+
+			Size block_size = block->m_block_size;
+			Size usable_size = block_size - reinterpret_cast<U64>(SubAddress(address, block));
+
+			if (size <= usable_size && IsAddressAligned(address, alignment))
+				return address;
+
+			VoidPtr new_address = AllocateSegregated(size, alignment);
+
+			if (!new_address)
+				return nullptr;
+
+			MemoryCopy(new_address, address, Algorithm::Min(size, usable_size));
+
+			DeallocateSegregated(address);
+
+			return new_address;
+		}
+		Void    FreeListAllocator::DeallocateSegregated(VoidPtr address)
+		{
+			SegregatedBlockHeader* block = GetSegregatedBlock(address);
+
+			Size block_size = block->m_block_size;
+
+			this->m_stats.m_used_memory -= block_size;
+			this->m_stats.m_num_of_deallocs++;
+
+			SegregatedBlockHeader* next_block = GetNextPhysicalBlock(block);
+			SegregatedBlockHeader* prev_block = block->m_prev_physical;
+
+			if (next_block && (next_block->m_block_size & SEGREGATED_FREE_FLAG))
+			{
+				RemoveSegregatedBlock(next_block);
+
+				block_size += next_block->m_block_size & ~(Size)SEGREGATED_FREE_FLAG;
+			}
+
+			if (prev_block && (prev_block->m_block_size & SEGREGATED_FREE_FLAG))
+			{
+				RemoveSegregatedBlock(prev_block);
+
+				block_size += prev_block->m_block_size & ~(Size)SEGREGATED_FREE_FLAG;
+				block = prev_block;
+			}
+
+			block->m_block_size = block_size | SEGREGATED_FREE_FLAG;
+
+			if (SegregatedBlockHeader* following_block = GetNextPhysicalBlock(block))
+				following_block->m_prev_physical = block;
+
+			InsertSegregatedBlock(block);
+		}
+
 		VoidPtr FreeListAllocator::Allocate(Size size, Byte alignment)
 		{
 			if (!size)
@@ -43,65 +237,84 @@ namespace Forge {
 				/// Throw Expection
 			}
 
+			if (m_policy == FreeListPolicy::FORGE_SEGREGATED_FIT)
+				return AllocateSegregated(size, alignment);
+
 			FreeBlockNode* prev_block = nullptr;
 			FreeBlockNode* best_block = nullptr;
+			FreeBlockNode* best_prev_block = nullptr;
 			FreeBlockNode* curr_block = this->m_free_list;
 
-			Byte adjustment, required_space;
+			Size adjustment, required_space;
+			Size best_adjustment = 0, best_required_space = 0;
 
 			Size smallest_diff = ~(Size)0;
 
 			while (curr_block)
 			{
-				adjustment = AlignAddressUpwardAdjustment(curr_block, alignment);
-				required_space = size + adjustment + sizeof(AllocationHeader);
+				adjustment = AlignAddressUpwardAdjustment(AddAddress(curr_block, sizeof(AllocationHeader)), alignment);
 
-				if (required_space > this->m_stats.m_total_size)
-				{
-					/// Throw Exception
-				}
+				/// Rounded up so the free block split after the allocation stays
+				/// aligned for its node.
+				required_space = AlignSizeUpward(size + adjustment + sizeof(AllocationHeader), alignof(FreeBlockNode));
 
 				if (curr_block->m_block_size >= required_space &&
 				   (curr_block->m_block_size - required_space) < smallest_diff)
 				{
-					prev_block = best_block;
+					best_prev_block = prev_block;
 					best_block = curr_block;
 
+					best_adjustment = adjustment;
+					best_required_space = required_space;
+
 					smallest_diff = curr_block->m_block_size - required_space;
+
+					if (!smallest_diff)
+						break;
 				}
 
+				prev_block = curr_block;
 				curr_block = curr_block->m_link;
 			}
 
-			Size remaining_size = best_block->m_block_size - required_space;
-			
-			if (remaining_size)
+			if (!best_block)
 			{
-				FreeBlockNode* new_block = reinterpret_cast<FreeBlockNode*>(AddAddress(best_block, required_space));
+				/// Throw Exception
+
+				return nullptr;
+			}
 
-				new_block->m_block_size = remaining_size;
-				new_block->m_link = best_block->m_link;
+			FreeBlockNode* next_block = best_block->m_link;
 
-				if (prev_block)
-					prev_block->m_link = new_block;
-				else
-					m_free_list = new_block;
+			Size remaining_size = best_block->m_block_size - best_required_space;
+			
+			if (remaining_size >= sizeof(FreeBlockNode))
+			{
+				next_block = reinterpret_cast<FreeBlockNode*>(AddAddress(best_block, best_required_space));
+
+				next_block->m_block_size = remaining_size;
+				next_block->m_link = best_block->m_link;
 			}
+			else
+				best_required_space = best_block->m_block_size;
 
-			VoidPtr aligned_address = AddAddress(best_block, adjustment);
+			if (best_prev_block)
+				best_prev_block->m_link = next_block;
+			else
+				m_free_list = next_block;
 
-			AllocationHeader* header = reinterpret_cast<AllocationHeader*>(best_block);
+			AllocationHeader* header = reinterpret_cast<AllocationHeader*>(AddAddress(best_block, best_adjustment));
 
-			header->m_padding = adjustment;
-			header->m_alloc_size = size;
+			header->m_padding = best_adjustment;
+			header->m_alloc_size = best_required_space - best_adjustment - sizeof(AllocationHeader);
 
 			if (this->m_stats.m_peak_size < size)
 				this->m_stats.m_peak_size = size;
 
-			this->m_stats.m_used_memory += required_space;
+			this->m_stats.m_used_memory += best_required_space;
 			this->m_stats.m_num_of_allocs++;
 
-			return AddAddress(aligned_address, sizeof(AllocationHeader));
+			return AddAddress(header, sizeof(AllocationHeader));
 		}
 		VoidPtr FreeListAllocator::Reallocate(VoidPtr address, Size size, Byte alignment)
 		{
@@ -120,39 +333,26 @@ namespace Forge {
 				/// Throw Expection
 			}
 
-			FreeBlockNode* curr_block = this->m_free_list;
-			FreeBlockNode* prev_block = nullptr;
-			FreeBlockNode* next_block = nullptr;
+			if (m_policy == FreeListPolicy::FORGE_SEGREGATED_FIT)
+				return ReallocateSegregated(address, size, alignment);
 
 			AllocationHeader* header = reinterpret_cast<AllocationHeader*>(SubAddress(address, sizeof(AllocationHeader)));
 
-			Size amt_to_shift = size - header->m_alloc_size;
+			Size alloc_size = header->m_alloc_size;
 
-			while (curr_block)
-			{
-				next_block = curr_block->m_link;
+			if (size <= alloc_size && IsAddressAligned(address, alignment))
+				return address;
 
-				if (address < curr_block)
-				{
-					MemorySet(curr_block, 0, curr_block->m_block_size);
-
-					if (!prev_block)
-					{
-						this->m_free_list = reinterpret_cast<FreeBlockNode*>(AddAddress(curr_block, amt_to_shift));
-						this->m_free_list->m_link = next_block;
-					}
-					else
-					{
-						prev_block->m_link = reinterpret_cast<FreeBlockNode*>(AddAddress(curr_block, amt_to_shift));
-						prev_block->m_link->m_link = next_block;
-					}
-				}
+			VoidPtr new_address = Allocate(size, alignment);
 
-				prev_block = curr_block;
-				curr_block = curr_block->m_link;
-			}
+			if (!new_address)
+				return nullptr;
+
+			MemoryCopy(new_address, address, Algorithm::Min(size, alloc_size));
+
+			Deallocate(address);
 
-			return address;
+			return new_address;
 		}
 		Void    FreeListAllocator::Deallocate(VoidPtr address)
 		{
@@ -166,6 +366,12 @@ namespace Forge {
 				/// Throw Expection
 			}
 
+			if (m_policy == FreeListPolicy::FORGE_SEGREGATED_FIT)
+			{
+				DeallocateSegregated(address);
+				return;
+			}
+
 			FreeBlockNode* curr_block = this->m_free_list;
 			FreeBlockNode* prev_block = nullptr;
 
@@ -176,56 +382,47 @@ namespace Forge {
 			Size total_size = padding + alloc_size + sizeof(AllocationHeader);
 
 			FreeBlockNode* free_block = reinterpret_cast<FreeBlockNode*>(SubAddress(header, padding));
-			
-			MemorySet(free_block, 0, total_size);
-
-			free_block->m_block_size = total_size;
-			free_block->m_link = nullptr;
 
-			while (curr_block)
+			while (curr_block && curr_block < free_block)
 			{
-				if (address < curr_block)
-				{
-					if (!prev_block)
-					{
-						this->m_free_list = free_block;
-						break;
-					}
-
-					prev_block->m_link = free_block;
-					free_block->m_link = curr_block;
-				}
-
 				prev_block = curr_block;
 				curr_block = curr_block->m_link;
 			}
 
-			if (free_block->m_link &&
-				AddAddress(free_block, free_block->m_block_size) == free_block->m_link)
-			{
-				free_block->m_block_size += free_block->m_link->m_block_size;
-				free_block->m_link = free_block->m_link->m_link;
+			free_block->m_block_size = total_size;
+			free_block->m_link = curr_block;
 
-				MemorySet(free_block->m_link, 0, free_block->m_block_size);
-			}
+			if (prev_block)
+				prev_block->m_link = free_block;
+			else
+				this->m_free_list = free_block;
 
-			if (prev_block && prev_block->m_link &&
-				AddAddress(prev_block, prev_block->m_block_size) == prev_block->m_link)
+			if (curr_block && AddAddress(free_block, free_block->m_block_size) == curr_block)
 			{
-				prev_block->m_block_size += prev_block->m_link->m_block_size;
-				prev_block->m_link = prev_block->m_link->m_link;
+				free_block->m_block_size += curr_block->m_block_size;
+				free_block->m_link = curr_block->m_link;
+			}
 
-				MemorySet(prev_block->m_link, 0, prev_block->m_block_size);
+			if (prev_block && AddAddress(prev_block, prev_block->m_block_size) == free_block)
+			{
+				prev_block->m_block_size += free_block->m_block_size;
+				prev_block->m_link = free_block->m_link;
 			}
+
+			this->m_stats.m_used_memory -= total_size;
+			this->m_stats.m_num_of_deallocs++;
 		}
 
 		Void FreeListAllocator::Reset(void)
 		{
 			MemorySet(m_start_ptr, 0, this->m_stats.m_total_size);
 
-			m_free_list = reinterpret_cast<FreeBlockNode*>(m_start_ptr);
-			m_free_list->m_block_size = this->m_stats.m_total_size;
-			m_free_list->m_link = nullptr;
+			this->m_stats.m_used_memory = 0;
+
+			if (m_policy == FreeListPolicy::FORGE_SEGREGATED_FIT)
+				InitializeSegregatedBins();
+			else
+				InitializeFreeList();
 		}
 	}
 }
@@ -1,10 +1,12 @@
 #include "Core/Public/Memory/LinearAllocator.h"
 
+#include "Platform/Public/Base/AbstractPlatform.h"
+
 namespace Forge {
 	namespace Memory
 	{
 		LinearAllocator::LinearAllocator(Size total_size)
-			: AbstractAllocator(nullptr, total_size)
+			: AbstractAllocator(nullptr, total_size), m_platform(nullptr), m_page_size(0), m_committed_size(total_size), m_retained_size(total_size)
 		{
 			m_start_ptr = malloc(total_size);
 
@@ -14,22 +16,62 @@ namespace Forge {
 			MemorySet(m_start_ptr, 0, m_stats.m_total_size);
 		}
 		LinearAllocator::LinearAllocator(VoidPtr start, Size total_size)
-			: AbstractAllocator(start, total_size)
+			: AbstractAllocator(start, total_size), m_platform(nullptr), m_page_size(0), m_committed_size(total_size), m_retained_size(total_size)
 		{
 			m_is_mem_owned = false;
 			m_offset_ptr = m_start_ptr;
 
 			MemorySet(m_start_ptr, 0, m_stats.m_total_size);
 		}
+		LinearAllocator::LinearAllocator(Platform::AbstractPlatform* platform, Size reserve_size, Size retained_size)
+			: AbstractAllocator(nullptr, 0), m_platform(platform), m_committed_size(0)
+		{
+			m_page_size = m_platform->GetPageSize();
+
+			m_stats.m_total_size = AlignSizeUpward(reserve_size, m_page_size);
+			m_retained_size = AlignSizeUpward(retained_size, m_page_size);
+
+			m_start_ptr = m_platform->AllocatePages(m_stats.m_total_size / m_page_size, m_page_size);
+
+			if (!m_start_ptr)
+			{
+				/*FORGE_EXCEPT(Debug::Exception::ERR_BAD_ALLOCATION_EXCEPTION, "Failed to reserve virtual address range")*/
+
+				m_stats.m_total_size = 0;
+			}
+
+			m_is_mem_owned = true;
+			m_offset_ptr = m_start_ptr;
+		}
 		
 		LinearAllocator::~LinearAllocator()
 		{
-			if (m_is_mem_owned)
+			if (m_platform)
+			{
+				if (m_start_ptr)
+					m_platform->DeallocatePages(m_start_ptr, m_stats.m_total_size / m_page_size, m_page_size);
+			}
+			else if (m_is_mem_owned)
 				free(m_start_ptr);
 			else
 				MemorySet(m_start_ptr, 0, m_stats.m_total_size);
 		}
 
+		Bool LinearAllocator::CommitUpTo(Size size)
+		{
+			/// Commits in large steps to keep the number of system calls low
+			/// while the allocator warms up.
+			Size commit_size = AlignSizeUpward(Algorithm::Max(size, m_committed_size + MIN_COMMIT_SIZE), m_page_size);
+			commit_size = Algorithm::Min(commit_size, m_stats.m_total_size);
+
+			if (!m_platform->CommitPages(AddAddress(m_start_ptr, m_committed_size), (commit_size - m_committed_size) / m_page_size, m_page_size))
+				return false;
+
+			m_committed_size = commit_size;
+
+			return true;
+		}
+
 		VoidPtr LinearAllocator::Allocate(Size size, Byte alignment)
 		{
 			Byte adjustment = AlignAddressUpwardAdjustment(m_offset_ptr, alignment);
@@ -37,6 +79,15 @@ namespace Forge {
 			if ((m_stats.m_used_memory + size + adjustment) > m_stats.m_total_size)
 			{
 				/*FORGE_EXCEPT(Debug::Exception::ERR_BAD_ALLOCATION_EXCEPTION, "No sufficent space for required Size")*/
+
+				return nullptr;
+			}
+
+			if ((m_stats.m_used_memory + size + adjustment) > m_committed_size && !CommitUpTo(m_stats.m_used_memory + size + adjustment))
+			{
+				/*FORGE_EXCEPT(Debug::Exception::ERR_BAD_ALLOCATION_EXCEPTION, "Failed to commit pages for required Size")*/
+
+				return nullptr;
 			}
 
 			VoidPtr aligned_address = AddAddress(m_offset_ptr, adjustment);
@@ -62,13 +113,27 @@ namespace Forge {
 
 		Void LinearAllocator::Reset(void)
 		{
+			if (m_platform)
+			{
+				/// Decommitted pages are zeroed by the system once committed
+				/// again, so only the retained pages need clearing.
+				MemorySet(m_start_ptr, 0, Algorithm::Min(m_stats.m_used_memory, m_retained_size));
+
+				if (m_committed_size > m_retained_size)
+				{
+					m_platform->DecommitPages(AddAddress(m_start_ptr, m_retained_size), (m_committed_size - m_retained_size) / m_page_size, m_page_size);
+
+					m_committed_size = m_retained_size;
+				}
+			}
+			else
+				MemorySet(m_start_ptr, 0, m_stats.m_total_size);
+
 			m_offset_ptr = m_start_ptr;
 
 			m_stats.m_peak_size = 0;
 			m_stats.m_used_memory = 0;
 			m_stats.m_num_of_allocs = 0;
-
-			MemorySet(m_start_ptr, 0, m_stats.m_total_size);
 		}
 	}
-}
\ No newline at end of file
+}
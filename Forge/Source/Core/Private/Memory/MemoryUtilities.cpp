@@ -0,0 +1,100 @@
+#include "Core/Public/Memory/MemoryUtilities.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(FORGE_PLATFORM_LINUX)
+	#include <unistd.h>
+	#include <sys/mman.h>
+#endif
+
+namespace Forge {
+	namespace Memory
+	{
+#if defined(FORGE_PLATFORM_LINUX)
+		namespace
+		{
+			Size GetMappedSize(Size size)
+			{
+				static const Size page_size = static_cast<Size>(sysconf(_SC_PAGESIZE));
+
+				return AlignSizeUpward(size, page_size);
+			}
+
+			Bool IsMapped(Size size)
+			{
+				return size >= HEAP_MAPPING_THRESHOLD;
+			}
+
+			VoidPtr MapBlock(Size size)
+			{
+				VoidPtr address = mmap(nullptr, GetMappedSize(size), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+				return address != MAP_FAILED ? address : nullptr;
+			}
+		}
+#endif
+
+		VoidPtr HeapAllocate(Size size)
+		{
+#if defined(FORGE_PLATFORM_LINUX)
+			if (IsMapped(size))
+				return MapBlock(size);
+#endif
+			return malloc(size);
+		}
+
+		VoidPtr HeapReallocate(VoidPtr address, Size old_size, Size new_size)
+		{
+			if (!address)
+				return HeapAllocate(new_size);
+
+#if defined(FORGE_PLATFORM_LINUX)
+			Bool is_old_mapped = IsMapped(old_size);
+			Bool is_new_mapped = IsMapped(new_size);
+
+			if (is_old_mapped && is_new_mapped)
+			{
+				if (GetMappedSize(old_size) == GetMappedSize(new_size))
+					return address;
+
+				VoidPtr new_address = mremap(address, GetMappedSize(old_size), GetMappedSize(new_size), MREMAP_MAYMOVE);
+
+				return new_address != MAP_FAILED ? new_address : nullptr;
+			}
+
+			if (is_old_mapped || is_new_mapped)
+			{
+				/// Crossing the threshold happens at most twice in the lifetime
+				/// of a growing block, the content is copied once.
+				VoidPtr new_address = HeapAllocate(new_size);
+
+				if (!new_address)
+					return nullptr;
+
+				memcpy(new_address, address, old_size < new_size ? old_size : new_size);
+
+				HeapDeallocate(address, old_size);
+
+				return new_address;
+			}
+#endif
+			return realloc(address, new_size);
+		}
+
+		Void HeapDeallocate(VoidPtr address, Size size)
+		{
+			if (!address)
+				return;
+
+#if defined(FORGE_PLATFORM_LINUX)
+			if (IsMapped(size))
+			{
+				munmap(address, GetMappedSize(size));
+				return;
+			}
+#endif
+			free(address);
+		}
+	}
+}
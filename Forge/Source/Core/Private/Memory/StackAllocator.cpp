@@ -35,7 +35,8 @@ namespace Forge {
 		VoidPtr StackAllocator::Allocate(Size size, Byte alignment)
 		{
 			Size header_size = sizeof(AllocationHeader);
-			Byte adjustment = AlignAddressUpwardAdjustment(m_offset_ptr, alignment);
+			// The header sits right before the returned address, so it is the address after the header that is aligned.
+			Byte adjustment = AlignAddressUpwardAdjustment(AddAddress(m_offset_ptr, header_size), alignment);
 
 			if ((m_stats.m_used_memory + size + adjustment + header_size) > m_stats.m_total_size)
 			{
@@ -75,10 +76,17 @@ namespace Forge {
 				/*FORGE_EXCEPT(Debug::Exception::ERR_INVALID_OPERATION_EXCEPTION, "Stack allocator only supports reallocation of the most recently allocated memroy")*/
 			}
 
-			Size amt_to_shift = size - (U64)SubAddress(m_offset_ptr, address);
-			m_offset_ptr = AddAddress(m_offset_ptr, amt_to_shift);
+			/// Only the most recent allocation can be resized in place, and
+			/// only within the pool, otherwise the caller has to move it.
+			if (m_prev_address != address || !IsAddressAligned(address, alignment) ||
+				reinterpret_cast<U64>(SubAddress(address, m_start_ptr)) + size > m_stats.m_total_size)
+				return nullptr;
 
-			m_stats.m_used_memory += amt_to_shift;
+			Size old_size = reinterpret_cast<U64>(SubAddress(m_offset_ptr, address));
+
+			m_offset_ptr = AddAddress(address, size);
+
+			m_stats.m_used_memory = m_stats.m_used_memory - old_size + size;
 
 			return address;
 		}
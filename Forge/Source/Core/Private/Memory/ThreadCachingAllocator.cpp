@@ -0,0 +1,349 @@
+#include "Core/Public/Memory/ThreadCachingAllocator.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		namespace
+		{
+			/// Guards the list of live allocators and the free slot indices.
+			std::mutex s_registry_mutex;
+
+			ThreadCachingAllocator* s_first_allocator = nullptr;
+
+			FORGE_FORCE_INLINE U32 GetSizeClass(Size size)
+			{
+				return size <= ((Size)1 << 4) ? 0 : Algorithm::FloorLog2(size - 1) + 1 - 4;
+			}
+		}
+
+		/// Holds the cache slot of a thread, taken on its first allocation and
+		/// returned when the thread exits.
+		struct ThreadCachingAllocator::ThreadSlot
+		{
+			static U32 s_num_of_slots;
+			static U32 s_num_of_free_slots;
+			static U32 s_free_slots[MAX_THREAD_COUNT];
+
+			U32 m_index;
+
+			ThreadSlot(Void)
+			{
+				std::lock_guard<std::mutex> lock(s_registry_mutex);
+
+				if (s_num_of_free_slots)
+					m_index = s_free_slots[--s_num_of_free_slots];
+				else if (s_num_of_slots < MAX_THREAD_COUNT)
+					m_index = s_num_of_slots++;
+				else
+					m_index = MAX_THREAD_COUNT;
+			}
+
+		   ~ThreadSlot(Void)
+			{
+				if (m_index >= MAX_THREAD_COUNT)
+					return;
+
+				std::lock_guard<std::mutex> lock(s_registry_mutex);
+
+				/// The next thread taking the slot inherits the caches, so their
+				/// statistics keep adding up, but starts with empty magazines.
+				for (ThreadCachingAllocator* allocator = s_first_allocator; allocator; allocator = allocator->m_next_allocator)
+				{
+					ThreadCache* cache = allocator->m_thread_caches[m_index].load(std::memory_order_relaxed);
+
+					if (!cache)
+						continue;
+
+					for (I32 i = 0; i < SIZE_CLASS_COUNT; i++)
+						allocator->DrainMagazine(cache->m_magazines[i], cache->m_magazines[i].m_count);
+				}
+
+				s_free_slots[s_num_of_free_slots++] = m_index;
+			}
+		};
+
+		U32 ThreadCachingAllocator::ThreadSlot::s_num_of_slots = 0;
+		U32 ThreadCachingAllocator::ThreadSlot::s_num_of_free_slots = 0;
+		U32 ThreadCachingAllocator::ThreadSlot::s_free_slots[MAX_THREAD_COUNT];
+
+		ThreadCachingAllocator::ThreadCachingAllocator(AbstractAllocator* backing_allocator)
+			: AbstractAllocator(nullptr, backing_allocator->GetTotalSize()), m_backing_allocator(backing_allocator), m_prev_allocator(nullptr)
+		{
+			m_is_mem_owned = false;
+
+			for (I32 i = 0; i < MAX_THREAD_COUNT; i++)
+				m_thread_caches[i].store(nullptr, std::memory_order_relaxed);
+
+			std::lock_guard<std::mutex> lock(s_registry_mutex);
+
+			m_next_allocator = s_first_allocator;
+
+			if (s_first_allocator)
+				s_first_allocator->m_prev_allocator = this;
+
+			s_first_allocator = this;
+		}
+
+		ThreadCachingAllocator::~ThreadCachingAllocator()
+		{
+			{
+				std::lock_guard<std::mutex> lock(s_registry_mutex);
+
+				if (m_prev_allocator)
+					m_prev_allocator->m_next_allocator = m_next_allocator;
+				else
+					s_first_allocator = m_next_allocator;
+
+				if (m_next_allocator)
+					m_next_allocator->m_prev_allocator = m_prev_allocator;
+			}
+
+			for (I32 i = 0; i < MAX_THREAD_COUNT; i++)
+			{
+				ThreadCache* cache = m_thread_caches[i].load(std::memory_order_acquire);
+
+				if (!cache)
+					continue;
+
+				for (I32 j = 0; j < SIZE_CLASS_COUNT; j++)
+					DrainMagazine(cache->m_magazines[j], cache->m_magazines[j].m_count);
+
+				delete cache;
+			}
+		}
+
+		ThreadCachingAllocator::ThreadCache* ThreadCachingAllocator::GetThreadCache(Void)
+		{
+			static thread_local ThreadSlot s_thread_slot;
+
+			if (s_thread_slot.m_index >= MAX_THREAD_COUNT)
+				return nullptr;
+
+			ThreadCache* cache = m_thread_caches[s_thread_slot.m_index].load(std::memory_order_relaxed);
+
+			if (!cache)
+			{
+				cache = new ThreadCache();
+
+				for (I32 i = 0; i < SIZE_CLASS_COUNT; i++)
+					cache->m_magazines[i].m_count = 0;
+
+				cache->m_used_memory.store(0, std::memory_order_relaxed);
+				cache->m_num_of_allocs.store(0, std::memory_order_relaxed);
+				cache->m_num_of_deallocs.store(0, std::memory_order_relaxed);
+
+				m_thread_caches[s_thread_slot.m_index].store(cache, std::memory_order_release);
+			}
+
+			return cache;
+		}
+
+		Void ThreadCachingAllocator::RefillMagazine(Magazine& magazine, U32 size_class)
+		{
+			Size block_size = ((Size)1 << (size_class + MIN_SIZE_CLASS_SHIFT)) + HEADER_SIZE;
+
+			std::lock_guard<std::mutex> lock(m_backing_mutex);
+
+			while (magazine.m_count < MAGAZINE_CAPACITY / 2)
+			{
+				VoidPtr backing_address = m_backing_allocator->Allocate(block_size, HEADER_SIZE);
+
+				if (!backing_address)
+					break;
+
+				AllocationHeader* header = reinterpret_cast<AllocationHeader*>(backing_address);
+
+				header->m_backing_address = backing_address;
+				header->m_size_class = size_class;
+
+				magazine.m_blocks[magazine.m_count++] = AddAddress(backing_address, HEADER_SIZE);
+			}
+		}
+		Void ThreadCachingAllocator::DrainMagazine(Magazine& magazine, Size count)
+		{
+			std::lock_guard<std::mutex> lock(m_backing_mutex);
+
+			for (Size i = 0; i < count; i++)
+			{
+				AllocationHeader* header = reinterpret_cast<AllocationHeader*>(SubAddress(magazine.m_blocks[--magazine.m_count], HEADER_SIZE));
+
+				m_backing_allocator->Deallocate(header->m_backing_address);
+			}
+		}
+
+		Size ThreadCachingAllocator::GetBlockSize(VoidPtr address)
+		{
+			AllocationHeader* header = reinterpret_cast<AllocationHeader*>(SubAddress(address, HEADER_SIZE));
+
+			return header->m_size_class < SIZE_CLASS_COUNT ? (Size)1 << (header->m_size_class + MIN_SIZE_CLASS_SHIFT) : header->m_size;
+		}
+
+		VoidPtr ThreadCachingAllocator::AllocateLarge(Size size, Byte alignment)
+		{
+			Size extra_space = alignment > HEADER_SIZE ? alignment : 0;
+
+			VoidPtr backing_address;
+
+			{
+				std::lock_guard<std::mutex> lock(m_backing_mutex);
+
+				backing_address = m_backing_allocator->Allocate(size + HEADER_SIZE + extra_space, HEADER_SIZE);
+			}
+
+			if (!backing_address)
+			{
+				/*FORGE_EXCEPT(Debug::Exception::ERR_BAD_ALLOCATION_EXCEPTION, "No sufficent space for required size")*/
+
+				return nullptr;
+			}
+
+			VoidPtr address = AlignAddressUpward(AddAddress(backing_address, HEADER_SIZE), alignment);
+
+			AllocationHeader* header = reinterpret_cast<AllocationHeader*>(SubAddress(address, HEADER_SIZE));
+
+			header->m_backing_address = backing_address;
+			header->m_size_class = LARGE_SIZE_CLASS;
+			header->m_size = size;
+
+			return address;
+		}
+
+		Size ThreadCachingAllocator::GetUsedMemory(Void)
+		{
+			Size used_memory = 0;
+
+			for (I32 i = 0; i < MAX_THREAD_COUNT; i++)
+				if (ThreadCache* cache = m_thread_caches[i].load(std::memory_order_acquire))
+					used_memory += cache->m_used_memory.load(std::memory_order_relaxed);
+
+			return used_memory;
+		}
+		Size ThreadCachingAllocator::GetNumOfAllocs(Void)
+		{
+			Size num_of_allocs = 0;
+
+			for (I32 i = 0; i < MAX_THREAD_COUNT; i++)
+				if (ThreadCache* cache = m_thread_caches[i].load(std::memory_order_acquire))
+					num_of_allocs += cache->m_num_of_allocs.load(std::memory_order_relaxed);
+
+			return num_of_allocs;
+		}
+		Size ThreadCachingAllocator::GetNumOfDeallocs(Void)
+		{
+			Size num_of_deallocs = 0;
+
+			for (I32 i = 0; i < MAX_THREAD_COUNT; i++)
+				if (ThreadCache* cache = m_thread_caches[i].load(std::memory_order_acquire))
+					num_of_deallocs += cache->m_num_of_deallocs.load(std::memory_order_relaxed);
+
+			return num_of_deallocs;
+		}
+
+		VoidPtr ThreadCachingAllocator::Allocate(Size size, Byte alignment)
+		{
+			ThreadCache* cache = GetThreadCache();
+
+			U32 size_class = GetSizeClass(size);
+
+			VoidPtr address;
+
+			if (!cache || size_class >= SIZE_CLASS_COUNT || alignment > HEADER_SIZE)
+				address = AllocateLarge(size, alignment);
+			else
+			{
+				Magazine& magazine = cache->m_magazines[size_class];
+
+				if (!magazine.m_count)
+					RefillMagazine(magazine, size_class);
+
+				if (!magazine.m_count)
+				{
+					/*FORGE_EXCEPT(Debug::Exception::ERR_BAD_ALLOCATION_EXCEPTION, "No sufficent space for required size")*/
+
+					return nullptr;
+				}
+
+				address = magazine.m_blocks[--magazine.m_count];
+			}
+
+			if (address && cache)
+			{
+				cache->m_used_memory.store(cache->m_used_memory.load(std::memory_order_relaxed) + GetBlockSize(address), std::memory_order_relaxed);
+				cache->m_num_of_allocs.store(cache->m_num_of_allocs.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			}
+
+			return address;
+		}
+		VoidPtr ThreadCachingAllocator::Reallocate(VoidPtr address, Size size, Byte alignment)
+		{
+			if (!address)
+				return Allocate(size, alignment);
+
+			AllocationHeader* header = reinterpret_cast<AllocationHeader*>(SubAddress(address, HEADER_SIZE));
+
+			if (header->m_size_class < SIZE_CLASS_COUNT && 
+				size <= ((Size)1 << (header->m_size_class + MIN_SIZE_CLASS_SHIFT)) && alignment <= HEADER_SIZE)
+				return address;
+
+			VoidPtr new_address = Allocate(size, alignment);
+
+			if (!new_address)
+				return nullptr;
+
+			MemoryCopy(new_address, address, Algorithm::Min(GetBlockSize(address), size));
+
+			Deallocate(address);
+
+			return new_address;
+		}
+		Void    ThreadCachingAllocator::Deallocate(VoidPtr address)
+		{
+			if (!address)
+				return;
+
+			ThreadCache* cache = GetThreadCache();
+
+			AllocationHeader* header = reinterpret_cast<AllocationHeader*>(SubAddress(address, HEADER_SIZE));
+
+			if (cache)
+			{
+				cache->m_used_memory.store(cache->m_used_memory.load(std::memory_order_relaxed) - GetBlockSize(address), std::memory_order_relaxed);
+				cache->m_num_of_deallocs.store(cache->m_num_of_deallocs.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			}
+
+			if (!cache || header->m_size_class >= SIZE_CLASS_COUNT)
+			{
+				std::lock_guard<std::mutex> lock(m_backing_mutex);
+
+				m_backing_allocator->Deallocate(header->m_backing_address);
+
+				return;
+			}
+
+			Magazine& magazine = cache->m_magazines[header->m_size_class];
+
+			if (magazine.m_count == MAGAZINE_CAPACITY)
+				DrainMagazine(magazine, MAGAZINE_CAPACITY / 2);
+
+			magazine.m_blocks[magazine.m_count++] = address;
+		}
+
+		Void ThreadCachingAllocator::Reset(Void)
+		{
+			for (I32 i = 0; i < MAX_THREAD_COUNT; i++)
+			{
+				ThreadCache* cache = m_thread_caches[i].load(std::memory_order_acquire);
+
+				if (!cache)
+					continue;
+
+				for (I32 j = 0; j < SIZE_CLASS_COUNT; j++)
+					cache->m_magazines[j].m_count = 0;
+
+				cache->m_used_memory.store(0, std::memory_order_relaxed);
+			}
+
+			m_backing_allocator->Reset();
+		}
+	}
+}
@@ -11,11 +11,11 @@ namespace Forge {
 
 		Bool Object::IsInstanceOf(ConstStringHash type_id) const
 		{
-			return GetTypeInfo()->IsDerivedFrom(type_id);
+			return GetInstanceTypeInfo()->IsDerivedFrom(type_id);
 		}
 		Bool Object::IsInstanceOf(ConstTypeInfoPtr type_info) const
 		{
-			return GetTypeInfo()->IsDerivedFrom(type_info);
+			return GetInstanceTypeInfo()->IsDerivedFrom(type_info);
 		}
 	}
 }
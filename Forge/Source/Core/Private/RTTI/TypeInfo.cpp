@@ -1,27 +1,49 @@
+#include <stdio.h>
+
 #include "Core/Public/RTTI/TypeInfo.h"
+#include "Core/Public/RTTI/TypeRegistry.h"
+
+#include "Core/Public/Common/PreprocessorUtilities.h"
 
 namespace Forge {
 	namespace RTTI
 	{
 		TypeInfo::TypeInfo(ConstCharPtr type_name, ConstSize type_size, ConstTypeInfoPtr base_type_info)
-			: m_type_name(m_type_name), m_type_size(type_size), m_base_type_info(base_type_info)
+			: m_type_size(type_size), m_type_name(type_name), m_type_hash_id(type_name), m_base_type_info(base_type_info), m_hierarchy_number(0)
 		{
-			/// Compute type ID
+			FORGE_ASSERT(ConstStringHash::Register(m_type_hash_id, type_name), "Type name hash collides with another type name")
+
+			TypeRegistry::GetInstance().Register(this);
 		}
 
-		Bool TypeInfo::IsSameAs(ConstStringHash& type_id) const
+		TypeInfo::~TypeInfo()
 		{
-			return false;
+			TypeRegistry::GetInstance().Unregister(this);
 		}
-		Bool TypeInfo::IsDerivedFrom(ConstStringHash& type_id) const
+
+		Bool TypeInfo::IsSameAs(ConstStringHash type_id) const
+		{
+			return m_type_hash_id == type_id;
+		}
+		Bool TypeInfo::IsDerivedFrom(ConstStringHash type_id) const
 		{
+			ConstTypeInfoPtr current = this;
+
+			while (current)
+			{
+				if (current->m_type_hash_id == type_id)
+					return true;
+
+				current = current->m_base_type_info;
+			}
+
 			return false;
 		}
 		Bool TypeInfo::IsSameAs(ConstTypeInfoPtr type_info) const
 		{
 			return this == type_info;
 		}
-		Bool TypeInfo::IsDerivedFrom(ConstTypeInfoPtr type_info) const
+		Bool TypeInfo::IsDerivedFromBaseChain(ConstTypeInfoPtr type_info) const
 		{
 			if (!type_info)
 				return false;
@@ -0,0 +1,130 @@
+#include "Core/Public/RTTI/TypeRegistry.h"
+
+#include "Core/Public/Containers/THashMap.h"
+
+namespace Forge {
+	namespace RTTI
+	{
+		namespace
+		{
+			const Size NO_TYPE = ~((Size)0);
+		}
+
+		Void TypeRegistry::Register(TypeInfoPtr type_info)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			m_types.PushBack(type_info);
+		}
+
+		Void TypeRegistry::Unregister(TypeInfoPtr type_info)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			ConstSize count = m_types.GetCount();
+
+			for (Size i = 0; i < count; i++)
+			{
+				if (m_types[i] == type_info)
+				{
+					m_types[i] = m_types[count - 1];
+					m_types.PopBack();
+
+					return;
+				}
+			}
+		}
+
+		Void TypeRegistry::Build(Void)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			ConstSize count = m_types.GetCount();
+
+			// Generations wrap around skipping zero, so numbered types never
+			// read as unnumbered.
+			m_generation = m_generation % TypeInfo::GENERATION_MASK + 1;
+
+			U64 generation = m_generation;
+
+			Containers::THashMap<ConstTypeInfoPtr, Size> indices;
+
+			for (Size i = 0; i < count; i++)
+				indices.Insert(m_types[i], i);
+
+			// Children of every type are linked through index arrays, types
+			// whose base is not registered are the roots of the hierarchy.
+			Containers::TDynamicArray<Size> first_child(NO_TYPE, count);
+			Containers::TDynamicArray<Size> next_sibling(NO_TYPE, count);
+			Containers::TDynamicArray<Size> roots;
+
+			for (Size i = count; i-- > 0;)
+			{
+				ConstTypeInfoPtr base_type_info = m_types[i]->m_base_type_info;
+				Size* base = base_type_info ? indices.Find(base_type_info) : nullptr;
+
+				if (base)
+				{
+					next_sibling[i] = first_child[*base];
+					first_child[*base] = i;
+				}
+				else
+					roots.PushBack(i);
+			}
+
+			// Numbers start at one, zero marks a type that was never numbered.
+			Size order = 0;
+
+			Containers::TDynamicArray<Size> pre_order(0, count);
+			Containers::TDynamicArray<Size> stack;
+
+			for (Size r = 0; r < roots.GetCount(); r++)
+			{
+				pre_order[roots[r]] = ++order;
+				stack.PushBack(roots[r]);
+
+				while (stack.GetCount())
+				{
+					Size top = stack[stack.GetCount() - 1];
+					Size child = first_child[top];
+
+					if (child != NO_TYPE)
+					{
+						first_child[top] = next_sibling[child];
+
+						pre_order[child] = ++order;
+						stack.PushBack(child);
+					}
+					else
+					{
+						// Both numbers of a type are published at once, tagged
+						// with the generation of this build.
+						U64 number = order > TypeInfo::HIERARCHY_NUMBER_MASK ? 0 :
+							generation << TypeInfo::GENERATION_SHIFT | (U64)pre_order[top] << TypeInfo::HIERARCHY_NUMBER_BITS | order;
+
+						m_types[top]->m_hierarchy_number.store(number, std::memory_order_relaxed);
+						stack.PopBack();
+					}
+				}
+			}
+		}
+
+		Size TypeRegistry::GetCount(Void)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			return m_types.GetCount();
+		}
+
+		ConstTypeInfoPtr TypeRegistry::FindType(ConstStringHash type_id)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			for (Size i = 0; i < m_types.GetCount(); i++)
+				if (m_types[i]->GetTypeId() == type_id)
+					return m_types[i];
+
+			return nullptr;
+		}
+	}
+}
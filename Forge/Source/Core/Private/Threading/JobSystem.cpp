@@ -0,0 +1,276 @@
+#include "Core/Public/Threading/JobSystem.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+
+namespace Forge {
+	namespace Threading
+	{
+		namespace
+		{
+			/// The number of rounds a worker looks for jobs before it sleeps.
+			const Size SPIN_COUNT = 64;
+
+			/// The worker of the calling thread, stored untyped since the worker
+			/// type is private to the job system.
+			thread_local VoidPtr s_current_worker = nullptr;
+		}
+
+		JobSystem::JobSystem(Size worker_count, Size frame_size)
+			: m_num_of_sleeping(0), m_num_of_wakeups(0), m_is_running(true), m_previous_worker(static_cast<Worker*>(s_current_worker))
+		{
+			if (!worker_count)
+				worker_count = Algorithm::Max<Size>(std::thread::hardware_concurrency(), 1);
+
+			for (Size i = 0; i < worker_count; i++)
+				m_workers.PushBack(new Worker(this, i, frame_size));
+
+			s_current_worker = m_workers[0];
+
+			for (Size i = 1; i < worker_count; i++)
+				m_workers[i]->m_thread = std::thread(&JobSystem::WorkerMain, this, m_workers[i]);
+		}
+
+		JobSystem::~JobSystem(Void)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+
+				m_is_running.store(false, std::memory_order_release);
+				m_condition.notify_all();
+			}
+
+			for (Size i = 1; i < m_workers.GetCount(); i++)
+				m_workers[i]->m_thread.join();
+
+			for (Size i = 0; i < m_workers.GetCount(); i++)
+				delete m_workers[i];
+
+			s_current_worker = m_previous_worker;
+		}
+
+		JobSystem::Worker* JobSystem::GetCurrentWorker(Void)
+		{
+			Worker* worker = static_cast<Worker*>(s_current_worker);
+
+			FORGE_ASSERT(worker && worker->m_system == this, "Jobs can only be created and waited on by the workers of the job system.")
+
+			return worker;
+		}
+
+		VoidPtr JobSystem::AllocateJob(Size size, Size alignment, Bool& is_heap_allocated)
+		{
+			VoidPtr address = GetCurrentWorker()->m_frame_allocator.Allocate(size, (Byte)alignment);
+
+			is_heap_allocated = address == nullptr;
+
+			if (is_heap_allocated)
+			{
+				FORGE_ASSERT(alignment <= alignof(max_align_t), "Jobs aligned above the fundamental alignment must fit in the frame.")
+
+				address = malloc(size);
+			}
+
+			return address;
+		}
+
+		Void JobSystem::Submit(Internal::Job* job, JobCounter* counter, JobCounter* dependency)
+		{
+			job->m_counter = counter;
+
+			if (counter)
+				counter->m_count.fetch_add(1, std::memory_order_relaxed);
+
+			if (dependency)
+			{
+				dependency->Lock();
+
+				if (dependency->m_count.load(std::memory_order_acquire))
+				{
+					job->m_next = dependency->m_continuations;
+					dependency->m_continuations = job;
+
+					dependency->Unlock();
+					return;
+				}
+
+				dependency->Unlock();
+			}
+
+			Schedule(job);
+		}
+
+		Void JobSystem::Schedule(Internal::Job* job)
+		{
+			if (!GetCurrentWorker()->m_queue.Push(job))
+			{
+				Execute(job);
+				return;
+			}
+
+			if (m_num_of_sleeping.load(std::memory_order_seq_cst))
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+
+				if (m_num_of_wakeups < m_workers.GetCount())
+					m_num_of_wakeups++;
+
+				m_condition.notify_one();
+			}
+		}
+
+		Internal::Job* JobSystem::FindJob(Worker* worker)
+		{
+			Internal::Job* job = worker->m_queue.Pop();
+
+			if (job)
+				return job;
+
+			ConstSize count = m_workers.GetCount();
+
+			if (count == 1)
+				return nullptr;
+
+			/// Starts at a random victim so thieves spread over the workers.
+			worker->m_random ^= worker->m_random << 13;
+			worker->m_random ^= worker->m_random >> 17;
+			worker->m_random ^= worker->m_random << 5;
+
+			Size offset = worker->m_random % count;
+
+			for (Size i = 0; i < count; i++)
+			{
+				Worker* victim = m_workers[(offset + i) % count];
+
+				if (victim == worker)
+					continue;
+
+				job = victim->m_queue.Steal();
+
+				if (job)
+					return job;
+			}
+
+			return nullptr;
+		}
+
+		Void JobSystem::Execute(Internal::Job* job)
+		{
+			JobCounter* counter = job->m_counter;
+			Bool is_heap_allocated = job->m_is_heap_allocated;
+
+			job->m_function(job);
+
+			if (is_heap_allocated)
+				free(job);
+
+			if (!counter)
+				return;
+
+			Size count = counter->m_count.load(std::memory_order_relaxed);
+
+			while (count > 1)
+				if (counter->m_count.compare_exchange_weak(count, count - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+					return;
+
+			/// The counter may only be released by its waiter once the list of
+			/// dependent jobs was taken, so the last decrement is locked.
+			counter->Lock();
+
+			Internal::Job* continuations = nullptr;
+
+			if (counter->m_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				continuations = counter->m_continuations;
+				counter->m_continuations = nullptr;
+			}
+
+			counter->Unlock();
+
+			while (continuations)
+			{
+				Internal::Job* next = continuations->m_next;
+
+				Schedule(continuations);
+
+				continuations = next;
+			}
+		}
+
+		Void JobSystem::WorkerMain(Worker* worker)
+		{
+			s_current_worker = worker;
+
+			while (m_is_running.load(std::memory_order_acquire))
+			{
+				Internal::Job* job = nullptr;
+
+				for (Size i = 0; i < SPIN_COUNT && !job; i++)
+					if (!(job = FindJob(worker)))
+						std::this_thread::yield();
+
+				if (job)
+				{
+					Execute(job);
+					continue;
+				}
+
+				std::unique_lock<std::mutex> lock(m_mutex);
+
+				m_num_of_sleeping.fetch_add(1, std::memory_order_seq_cst);
+
+				/// Looks once more after announcing the sleep, a job pushed
+				/// before the announcement is found here, and a job pushed after
+				/// it comes with a wakeup.
+				job = FindJob(worker);
+
+				if (!job)
+				{
+					m_condition.wait(lock, [this]()
+					{
+						return m_num_of_wakeups || !m_is_running.load(std::memory_order_acquire);
+					});
+
+					if (m_num_of_wakeups)
+						m_num_of_wakeups--;
+				}
+
+				m_num_of_sleeping.fetch_sub(1, std::memory_order_relaxed);
+
+				lock.unlock();
+
+				if (job)
+					Execute(job);
+			}
+
+			s_current_worker = nullptr;
+		}
+
+		Void JobSystem::Wait(JobCounter* counter)
+		{
+			Worker* worker = GetCurrentWorker();
+
+			while (counter->m_count.load(std::memory_order_acquire))
+			{
+				Internal::Job* job = FindJob(worker);
+
+				if (job)
+					Execute(job);
+				else
+					std::this_thread::yield();
+			}
+
+			/// Waits for the last signaller to release the counter.
+			counter->Lock();
+			counter->Unlock();
+		}
+
+		Void JobSystem::NextFrame(Void)
+		{
+			FORGE_ASSERT(GetCurrentWorker() == m_workers[0], "Frames can only be advanced by the thread that constructed the job system.")
+
+			for (Size i = 0; i < m_workers.GetCount(); i++)
+				m_workers[i]->m_frame_allocator.NextFrame();
+		}
+	}
+}
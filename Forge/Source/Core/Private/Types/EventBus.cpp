@@ -0,0 +1,41 @@
+#include "Core/Public/Types/EventBus.h"
+
+namespace Forge {
+	namespace Common
+	{
+		EventBus::EventBus(Size queue_size)
+			: m_front_allocator(queue_size), m_back_allocator(queue_size), m_queued_count(), m_queue_index(0), m_is_dispatching(false) {}
+
+		EventBus::~EventBus(Void)
+		{
+			for (auto& entry : m_channels)
+				delete entry.m_value;
+		}
+
+		Void EventBus::Dispatch(Void)
+		{
+			FORGE_ASSERT(!m_is_dispatching, "Events can not be dispatched from an event handler.")
+
+			ConstSize index = m_queue_index;
+			Containers::TDynamicArray<Internal::AbstractEventChannel*>& channels = m_queued_channels[index];
+
+			/// Events published by the handlers are queued in the other
+			/// allocator, which was reset at the end of the last dispatch.
+			m_queue_index ^= 1;
+			m_is_dispatching = true;
+
+			for (Size i = 0; i < channels.GetCount(); i++)
+				channels[i]->Detach();
+
+			for (Size i = 0; i < channels.GetCount(); i++)
+				channels[i]->Dispatch();
+
+			m_is_dispatching = false;
+
+			channels.Clear();
+			m_queued_count[index] = 0;
+
+			GetQueueAllocator(index)->Reset();
+		}
+	}
+}
@@ -1,22 +1,358 @@
+#include <string.h>
+
 #include "Core/Public/Types/String/AbstractString.h"
 
+#if defined(FORGE_SIMD_AVX2)
+	#include <immintrin.h>
+#elif defined(FORGE_SIMD_SSE4_2)
+	#include <nmmintrin.h>
+#elif defined(FORGE_SIMD_SSE2)
+	#include <emmintrin.h>
+#endif
+
 namespace Forge {
 	namespace Type
 	{
+		namespace
+		{
+			const Size NOT_FOUND = static_cast<Size>(-1);
+
+#if defined(FORGE_SIMD_AVX2)
+			using Block = __m256i;
+
+			enum : Size { BLOCK_SIZE = 32 };
+
+			FORGE_FORCE_INLINE Block LoadBlock(ConstCharPtr data) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)); }
+			FORGE_FORCE_INLINE Block SplatBlock(Char ch) { return _mm256_set1_epi8(ch); }
+
+			FORGE_FORCE_INLINE U32 MatchBlock(Block block, Block splat)
+			{
+				return static_cast<U32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, splat)));
+			}
+#elif defined(FORGE_SIMD_SSE2)
+			using Block = __m128i;
+
+			enum : Size { BLOCK_SIZE = 16 };
+
+			FORGE_FORCE_INLINE Block LoadBlock(ConstCharPtr data) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)); }
+			FORGE_FORCE_INLINE Block SplatBlock(Char ch) { return _mm_set1_epi8(ch); }
+
+			FORGE_FORCE_INLINE U32 MatchBlock(Block block, Block splat)
+			{
+				return static_cast<U32>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, splat)));
+			}
+#endif
+
+#if defined(FORGE_SIMD_SSE2)
+			const U32 FULL_MASK = static_cast<U32>((U64(1) << BLOCK_SIZE) - 1);
+
+			FORGE_FORCE_INLINE Size LowestBit(U32 mask) { return Algorithm::CountTrailingZeros(mask); }
+			FORGE_FORCE_INLINE Size HighestBit(U32 mask) { return 63 - Algorithm::CountLeadingZeros(mask); }
+#endif
+
+			/**
+			 * Finds the first character in [begin, end) that is equal, or not
+			 * equal if is_equal is false, to the given character.
+			 */
+			Size FindFirstChar(ConstCharPtr data, Size begin, Size end, Char ch, Bool is_equal)
+			{
+				Size i = begin;
+
+#if defined(FORGE_SIMD_SSE2)
+				Block splat = SplatBlock(ch);
+				U32 flip = is_equal ? 0 : FULL_MASK;
+
+				for (; i + BLOCK_SIZE <= end; i += BLOCK_SIZE)
+				{
+					U32 mask = MatchBlock(LoadBlock(data + i), splat) ^ flip;
+
+					if (mask)
+						return i + LowestBit(mask);
+				}
+#endif
+				for (; i < end; i++)
+					if ((data[i] == ch) == is_equal)
+						return i;
+
+				return NOT_FOUND;
+			}
+
+			/**
+			 * Finds the last character in [0, end) that is equal, or not equal
+			 * if is_equal is false, to the given character.
+			 */
+			Size FindLastChar(ConstCharPtr data, Size end, Char ch, Bool is_equal)
+			{
+				Size i = end;
+
+#if defined(FORGE_SIMD_SSE2)
+				Block splat = SplatBlock(ch);
+				U32 flip = is_equal ? 0 : FULL_MASK;
+
+				for (; i >= BLOCK_SIZE; i -= BLOCK_SIZE)
+				{
+					U32 mask = MatchBlock(LoadBlock(data + i - BLOCK_SIZE), splat) ^ flip;
+
+					if (mask)
+						return i - BLOCK_SIZE + HighestBit(mask);
+				}
+#endif
+				while (i-- > 0)
+					if ((data[i] == ch) == is_equal)
+						return i;
+
+				return NOT_FOUND;
+			}
+
+			/**
+			 * A set of characters stored as a 256 bit membership table, and as
+			 * a packed SSE4.2 operand when it has at most 16 characters. Larger
+			 * sets of ASCII characters are also stored as a table of the high
+			 * nibbles present for every low nibble, so a whole block can be
+			 * classified with two byte shuffles.
+			 */
+			struct CharacterSet
+			{
+				U64  m_table[4];
+				Size m_count;
+
+#if defined(FORGE_SIMD_SSE4_2)
+				__m128i m_packed;
+				__m128i m_nibbles;
+				Bool    m_is_ascii;
+#endif
+
+				CharacterSet(ConstCharPtr str)
+					: m_table{ 0, 0, 0, 0 }, m_count(Algorithm::GetStringLength(str))
+				{
+					for (Size i = 0; i < m_count; i++)
+					{
+						U8 ch = static_cast<U8>(str[i]);
+
+						m_table[ch >> 6] |= U64(1) << (ch & 63);
+					}
+
+#if defined(FORGE_SIMD_SSE4_2)
+					Char packed[16] = {};
+
+					if (m_count <= 16)
+						memcpy(packed, str, m_count);
+
+					m_packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(packed));
+
+					U8 nibbles[16] = {};
+
+					for (Size i = 0; i < m_count; i++)
+					{
+						U8 ch = static_cast<U8>(str[i]);
+
+						nibbles[ch & 15] |= static_cast<U8>(1 << ((ch >> 4) & 7));
+					}
+
+					m_nibbles  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(nibbles));
+					m_is_ascii = !(m_table[2] | m_table[3]);
+#endif
+				}
+
+#if defined(FORGE_SIMD_SSE4_2)
+				/**
+				 * Gets a 16 bit mask of the characters of the block that are
+				 * members of an ASCII set.
+				 */
+				FORGE_FORCE_INLINE U32 MatchNibbles(__m128i block) const
+				{
+					const __m128i low_mask = _mm_set1_epi8(0x0F);
+					const __m128i high_bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+
+					__m128i rows = _mm_shuffle_epi8(m_nibbles, _mm_and_si128(block, low_mask));
+					__m128i bits = _mm_shuffle_epi8(high_bits, _mm_and_si128(_mm_srli_epi16(block, 4), low_mask));
+
+					return ~static_cast<U32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(rows, bits), _mm_setzero_si128()))) & 0xFFFF;
+				}
+#endif
+
+				FORGE_FORCE_INLINE Bool Contains(Char ch) const
+				{
+					U8 index = static_cast<U8>(ch);
+
+					return (m_table[index >> 6] >> (index & 63)) & 1;
+				}
+			};
+
+			Size FindFirstInSet(ConstCharPtr data, Size begin, Size end, const CharacterSet& set, Bool is_member)
+			{
+				Size i = begin;
+
+#if defined(FORGE_SIMD_SSE4_2)
+				if (set.m_count <= 16)
+				{
+					for (; i + 16 <= end; i += 16)
+					{
+						__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+
+						I32 index = is_member ?
+							_mm_cmpestri(set.m_packed, static_cast<I32>(set.m_count), block, 16, _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT) :
+							_mm_cmpestri(set.m_packed, static_cast<I32>(set.m_count), block, 16, _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_NEGATIVE_POLARITY | _SIDD_LEAST_SIGNIFICANT);
+
+						if (index < 16)
+							return i + index;
+					}
+				}
+				else if (set.m_is_ascii)
+				{
+					U32 flip = is_member ? 0 : 0xFFFF;
+
+					for (; i + 16 <= end; i += 16)
+					{
+						U32 mask = set.MatchNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i))) ^ flip;
+
+						if (mask)
+							return i + LowestBit(mask);
+					}
+				}
+#endif
+				for (; i < end; i++)
+					if (set.Contains(data[i]) == is_member)
+						return i;
+
+				return NOT_FOUND;
+			}
+
+			Size FindLastInSet(ConstCharPtr data, Size end, const CharacterSet& set, Bool is_member)
+			{
+				Size i = end;
+
+#if defined(FORGE_SIMD_SSE4_2)
+				if (set.m_count <= 16)
+				{
+					for (; i >= 16; i -= 16)
+					{
+						__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i - 16));
+
+						I32 index = is_member ?
+							_mm_cmpestri(set.m_packed, static_cast<I32>(set.m_count), block, 16, _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_MOST_SIGNIFICANT) :
+							_mm_cmpestri(set.m_packed, static_cast<I32>(set.m_count), block, 16, _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_NEGATIVE_POLARITY | _SIDD_MOST_SIGNIFICANT);
+
+						if (index < 16)
+							return i - 16 + index;
+					}
+				}
+				else if (set.m_is_ascii)
+				{
+					U32 flip = is_member ? 0 : 0xFFFF;
+
+					for (; i >= 16; i -= 16)
+					{
+						U32 mask = set.MatchNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i - 16))) ^ flip;
+
+						if (mask)
+							return i - 16 + HighestBit(mask);
+					}
+				}
+#endif
+				while (i-- > 0)
+					if (set.Contains(data[i]) == is_member)
+						return i;
+
+				return NOT_FOUND;
+			}
+
+			/**
+			 * Finds the first occurrence of a sub-string at or after a position.
+			 *
+			 * Candidates are filtered by comparing the first and the last
+			 * character of the sub-string against a whole block of positions
+			 * at once, only positions matching both are compared in full.
+			 * Without SIMD support the first character is located with
+			 * memchr() instead.
+			 */
+			Size FindSubStringImpl(ConstCharPtr data, Size count, Size pos, ConstCharPtr substr, Size substr_count)
+			{
+				if (pos > count || substr_count > count - pos)
+					return NOT_FOUND;
+
+				if (substr_count == 0)
+					return pos;
+
+				if (substr_count == 1)
+					return FindFirstChar(data, pos, count, *substr, true);
+
+				Size i = pos;
+				Size last = count - substr_count;
+
+#if defined(FORGE_SIMD_SSE2)
+				Block first_splat = SplatBlock(substr[0]);
+				Block last_splat  = SplatBlock(substr[substr_count - 1]);
+
+				for (; i + BLOCK_SIZE <= last + 1; i += BLOCK_SIZE)
+				{
+					U32 mask = MatchBlock(LoadBlock(data + i), first_splat) & MatchBlock(LoadBlock(data + i + substr_count - 1), last_splat);
+
+					while (mask)
+					{
+						Size candidate = i + LowestBit(mask);
+
+						if (memcmp(data + candidate + 1, substr + 1, substr_count - 2) == 0)
+							return candidate;
+
+						mask &= mask - 1;
+					}
+				}
+#endif
+				while (i <= last)
+				{
+					ConstCharPtr match = static_cast<ConstCharPtr>(memchr(data + i, substr[0], last - i + 1));
+
+					if (!match)
+						break;
+
+					i = match - data;
+
+					if (memcmp(data + i + 1, substr + 1, substr_count - 1) == 0)
+						return i;
+
+					i++;
+				}
+
+				return NOT_FOUND;
+			}
+
+			FORGE_FORCE_INLINE Char ToLower(Char ch)
+			{
+				return ch >= 'A' && ch <= 'Z' ? static_cast<Char>(ch - 'A' + 'a') : ch;
+			}
+
+			Bool CompareRange(ConstCharPtr lh_data, ConstCharPtr rh_data, Size count, StringSearchCase search_case)
+			{
+				if (search_case == CASE_SENSETIVE)
+					return memcmp(lh_data, rh_data, count) == 0;
+
+				for (Size i = 0; i < count; i++)
+					if (ToLower(lh_data[i]) != ToLower(rh_data[i]))
+						return false;
+
+				return true;
+			}
+
+			Bool IsLexicographicallyLess(ConstCharPtr lh_data, Size lh_count, ConstCharPtr rh_data, Size rh_count)
+			{
+				I32 result = memcmp(lh_data, rh_data, Algorithm::Min(lh_count, rh_count));
+
+				return result < 0 || (result == 0 && lh_count < rh_count);
+			}
+		}
+
 		ConstBool AbstractString::operator ==(AbstractString::ConstSelfTypeRef other) const
 		{
 			if (this->GetCount() != other.m_count)
 				return false;
 
-			return Memory::MemoryCompare(this->GetRawData(), other.GetRawData(), this->GetCount());
+			return memcmp(this->GetRawData(), other.GetRawData(), this->GetCount()) == 0;
 		}
 
 		ConstBool AbstractString::operator !=(AbstractString::ConstSelfTypeRef other) const
 		{
-			if (this->GetCount() != other.m_count)
-				return true;
-
-			return !(Memory::MemoryCompare(this->GetRawData(), other.GetRawData(), this->GetCount()));
+			return !(*this == other);
 		}
 
 		ConstSize AbstractString::FindFirstOf(ConstChar ch, ConstSize pos) const
@@ -27,13 +363,10 @@ namespace Forge {
 			/*if (Algorithm::IsWithinBoundsInclusive(pos, 0, this->GetCount()))
 				FORGE_EXCEPT(Debug::Exception::ERR_ARGUMENT_EXCEPTION, "Position can not be less than zero or greater than string length");*/
 
-			ConstCharPtr data = this->GetRawData();
+			if (pos >= this->GetCount())
+				return NOT_FOUND;
 
-			for (I32 i = pos; i < this->GetCount(); i++)
-				if (*(data + i) == ch)
-					return i;
-
-			return -1;
+			return FindFirstChar(this->GetRawData(), pos, this->GetCount(), ch, true);
 		}
 
 		ConstSize AbstractString::FindLastOf(ConstChar ch, ConstSize pos) const
@@ -44,13 +377,10 @@ namespace Forge {
 			/*if (Algorithm::IsWithinBoundsInclusive(pos, 0, this->GetCount()))
 				FORGE_EXCEPT(Debug::Exception::ERR_ARGUMENT_EXCEPTION, "Position can not be less than zero or greater than string length");*/
 
-			ConstCharPtr data = this->GetRawData();
-
-			for (I32 i = (this->GetCount() - 1) - pos; i >= 0; i--)
-				if (*(data + i) == ch)
-					return i;
+			if (pos >= this->GetCount())
+				return NOT_FOUND;
 
-			return -1;
+			return FindLastChar(this->GetRawData(), this->GetCount() - pos, ch, true);
 		}
 
 		ConstSize AbstractString::FindFirstNotOf(ConstChar ch, ConstSize pos) const
@@ -61,13 +391,10 @@ namespace Forge {
 			/*if (Algorithm::IsWithinBoundsInclusive(pos, 0, this->GetCount()))
 				FORGE_EXCEPT(Debug::Exception::ERR_ARGUMENT_EXCEPTION, "Position can not be less than zero or greater than string length");*/
 
-			ConstCharPtr data = this->GetRawData();
-
-			for (I32 i = pos; i < this->GetCount(); i++)
-				if (*(data + i) != ch)
-					return i;
+			if (pos >= this->GetCount())
+				return NOT_FOUND;
 
-			return -1;
+			return FindFirstChar(this->GetRawData(), pos, this->GetCount(), ch, false);
 		}
 
 		ConstSize AbstractString::FindLastNotOf(ConstChar ch, ConstSize pos) const
@@ -78,13 +405,10 @@ namespace Forge {
 			/*if (Algorithm::IsWithinBoundsInclusive(pos, 0, this->GetCount()))
 				FORGE_EXCEPT(Debug::Exception::ERR_ARGUMENT_EXCEPTION, "Position can not be less than zero or greater than string length");*/
 
-			ConstCharPtr data = this->GetRawData();
+			if (pos >= this->GetCount())
+				return NOT_FOUND;
 
-			for (I32 i = (this->GetCount() - 1) - pos; i >= 0; i--)
-				if (*(data + i) != ch)
-					return i;
-
-			return -1;
+			return FindLastChar(this->GetRawData(), this->GetCount() - pos, ch, false);
 		}
 
 		ConstSize AbstractString::FindFirstOf(ConstCharPtr str, ConstSize pos) const
@@ -98,18 +422,10 @@ namespace Forge {
 			/*if (Algorithm::IStringNullOrEmpty(str))
 				FORGE_EXCEPT(Debug::Exception::ERR_ARGUMENT_EXCEPTION, "Character array must not be null");*/
 
-			ConstCharPtr data = this->GetRawData();
-
-			for (I32 i = pos; i < this->GetCount(); i++)
-			{
-				ConstCharPtr tmp = str;
+			if (pos >= this->GetCount())
+				return NOT_FOUND;
 
-				while (Algorithm::IStringNullOrEmpty(tmp))
-					if (*(data + i) == *(tmp++))
-						return i;
-			}
-
-			return -1;
+			return FindFirstInSet(this->GetRawData(), pos, this->GetCount(), CharacterSet(str), true);
 		}
 
 		ConstSize AbstractString::FindLastOf(ConstCharPtr str, ConstSize pos) const
@@ -123,18 +439,10 @@ namespace Forge {
 			/*if (Algorithm::IStringNullOrEmpty(str))
 				FORGE_EXCEPT(Debug::Exception::ERR_ARGUMENT_EXCEPTION, "Character array must not be null");*/
 
-			ConstCharPtr data = this->GetRawData();
-
-			for (I32 i = (this->GetCount() - 1) - pos; i >= 0; i--)
-			{
-				ConstCharPtr tmp = str;
+			if (pos >= this->GetCount())
+				return NOT_FOUND;
 
-				while (Algorithm::IStringNullOrEmpty(tmp))
-					if (*(data + i) == *(tmp++))
-						return i;
-			}
-
-			return -1;
+			return FindLastInSet(this->GetRawData(), this->GetCount() - pos, CharacterSet(str), true);
 		}
 
 		ConstSize AbstractString::FindFirstNotOf(ConstCharPtr str, ConstSize pos) const
@@ -148,18 +456,10 @@ namespace Forge {
 			/*if (Algorithm::IStringNullOrEmpty(str))
 				FORGE_EXCEPT(Debug::Exception::ERR_ARGUMENT_EXCEPTION, "Character array must not be null");*/
 
-			ConstCharPtr data = this->GetRawData();
-
-			for (I32 i = pos; i < this->GetCount(); i++)
-			{
-				ConstCharPtr tmp = str;
-
-				while (Algorithm::IStringNullOrEmpty(tmp))
-					if (*(data + i) != *(tmp++))
-						return i;
-			}
+			if (pos >= this->GetCount())
+				return NOT_FOUND;
 
-			return -1;
+			return FindFirstInSet(this->GetRawData(), pos, this->GetCount(), CharacterSet(str), false);
 		}
 
 		ConstSize AbstractString::FindLastNotOf(ConstCharPtr str, ConstSize pos) const
@@ -173,18 +473,10 @@ namespace Forge {
 			/*if (Algorithm::IStringNullOrEmpty(str))
 				FORGE_EXCEPT(Debug::Exception::ERR_ARGUMENT_EXCEPTION, "Character array must not be null");*/
 
-			ConstCharPtr data = this->GetRawData();
-
-			for (I32 i = (this->GetCount() - 1) - pos; i >= 0; i--)
-			{
-				ConstCharPtr tmp = str;
-
-				while (Algorithm::IStringNullOrEmpty(tmp))
-					if (*(data + i) != *(tmp++))
-						return i;
-			}
+			if (pos >= this->GetCount())
+				return NOT_FOUND;
 
-			return -1;
+			return FindLastInSet(this->GetRawData(), this->GetCount() - pos, CharacterSet(str), false);
 		}
 
 		ConstSize AbstractString::FindSubString(ConstCharPtr substr, ConstSize pos) const
@@ -198,20 +490,7 @@ namespace Forge {
 			/*if (Algorithm::IStringNullOrEmpty(substr))
 				FORGE_EXCEPT(Debug::Exception::ERR_ARGUMENT_EXCEPTION, "Substring must not be null");*/
 
-			ConstCharPtr data = this->GetRawData();
-
-			ConstSize substr_size = Algorithm::GetStringLength(substr);
-
-			for (I32 i = pos; i < this->GetCount() - substr_size; i++)
-				for (I32 j = 0; j < substr_size; j++)
-				{
-					if (*(data + (i + j)) != *(substr + j))
-						break;
-
-					return i;
-				}
-
-			return -1;
+			return FindSubStringImpl(this->GetRawData(), this->GetCount(), pos, substr, Algorithm::GetStringLength(substr));
 		}
 
 		ConstSize AbstractString::FindSubString(ConstSelfTypeRef substr, ConstSize pos) const
@@ -225,47 +504,31 @@ namespace Forge {
 			/*if (substr.IsEmpty())
 				FORGE_EXCEPT(Debug::Exception::ERR_ARGUMENT_EXCEPTION, "Substring must no be empty");*/
 
-			ConstCharPtr data = this->GetRawData();
-			ConstCharPtr substr_data = substr.GetRawData();
-
-			ConstSize substr_size = substr.GetCount();
-
-			for (I32 i = pos; i < this->GetCount() - substr_size; i++)
-				for (I32 j = 0; j < substr_size; j++)
-				{
-					if (*(data + (i + j)) != *(substr_data + j))
-						break;
-
-					return i;
-				}
-
-			return -1;
+			return FindSubStringImpl(this->GetRawData(), this->GetCount(), pos, substr.GetRawData(), substr.GetCount());
 		}
 
 		ConstBool AbstractString::StartsWith(ConstCharPtr substr, StringSearchCase search_case) const
 		{
-			return this->FindSubString(substr) == 0;
+			ConstSize substr_count = Algorithm::GetStringLength(substr);
+
+			return substr_count <= this->GetCount() && CompareRange(this->GetRawData(), substr, substr_count, search_case);
 		}
 
 		ConstBool AbstractString::StartsWith(ConstSelfTypeRef substr, StringSearchCase search_case) const
 		{
-			return this->FindSubString(substr) == 0;
+			return substr.GetCount() <= this->GetCount() && CompareRange(this->GetRawData(), substr.GetRawData(), substr.GetCount(), search_case);
 		}
 
 		ConstBool AbstractString::EndsWith(ConstCharPtr substr, StringSearchCase search_case) const
 		{
-			ConstSize index = this->FindSubString(substr);
-			ConstSize substr_size = Algorithm::GetStringLength(this->GetRawData() + index);
+			ConstSize substr_count = Algorithm::GetStringLength(substr);
 
-			return (this->GetCount() - index) == substr_size;
+			return substr_count <= this->GetCount() && CompareRange(this->GetRawData() + this->GetCount() - substr_count, substr, substr_count, search_case);
 		}
 
 		ConstBool AbstractString::EndsWith(ConstSelfTypeRef substr, StringSearchCase search_case) const
 		{
-			ConstSize index = this->FindSubString(substr);
-			ConstSize substr_size = Algorithm::GetStringLength(this->GetRawData() + index);
-
-			return this->GetCount() - index == substr_size;
+			return substr.GetCount() <= this->GetCount() && CompareRange(this->GetRawData() + this->GetCount() - substr.GetCount(), substr.GetRawData(), substr.GetCount(), search_case);
 		}
 
 		ConstBool AbstractString::LexicographicalCompare(ConstCharPtr str)
@@ -276,13 +539,7 @@ namespace Forge {
 			/*if (Algorithm::IStringNullOrEmpty(str))
 				FORGE_EXCEPT(Debug::Exception::ERR_ARGUMENT_EXCEPTION, "Character array must not be null");*/
 
-			ConstCharPtr data = this->GetRawData();
-
-			for (I32 i = 0; i < Algorithm::Max(this->GetCount(), Algorithm::GetStringLength(str)); i++)
-				if (*(data + i) < *(str + i))
-					return true;
-				else
-					return false;
+			return IsLexicographicallyLess(this->GetRawData(), this->GetCount(), str, Algorithm::GetStringLength(str));
 		}
 
 		ConstBool AbstractString::LexicographicalCompare(ConstSelfTypeRef str)
@@ -293,14 +550,7 @@ namespace Forge {
 			/*if (Algorithm::IStringNullOrEmpty(str))
 				FORGE_EXCEPT(Debug::Exception::ERR_ARGUMENT_EXCEPTION, "Character array must not be null");*/
 
-			ConstCharPtr data = this->GetRawData();
-			ConstCharPtr str_data = str.GetRawData();
-
-			for (I32 i = 0; i < Algorithm::Min(this->GetCount(), str.GetCount()); i++)
-				if (*(data + i) < *(str_data + i))
-					return true;
-				else
-					return false;
+			return IsLexicographicallyLess(this->GetRawData(), this->GetCount(), str.GetRawData(), str.GetCount());
 		}
 	}
 }
@@ -0,0 +1,229 @@
+#include <string.h>
+
+#include "Core/Public/Debug/Debug.h"
+#include "Core/Public/Types/String/String.h"
+
+namespace Forge {
+	namespace Type
+	{
+		String::String(ConstCharPtr str, Memory::AbstractAllocator* allocator)
+			: m_buffer(m_inline_buffer), m_allocator(allocator), m_version(0), m_capacity(INLINE_CAPACITY), AbstractString(0, ~((Size)0))
+		{
+			*this->m_inline_buffer = '\0';
+
+			this->Append(str, Algorithm::GetStringLength(str));
+		}
+
+		String::String(SelfType&& other)
+			: m_buffer(m_inline_buffer), m_allocator(nullptr), m_version(0), m_capacity(INLINE_CAPACITY), AbstractString(0, ~((Size)0))
+		{
+			*this->m_inline_buffer = '\0';
+
+			*this = Algorithm::Move(other);
+		}
+
+		String::String(ConstSelfTypeRef other)
+			: m_buffer(m_inline_buffer), m_allocator(other.m_allocator), m_version(0), m_capacity(INLINE_CAPACITY), AbstractString(0, ~((Size)0))
+		{
+			*this->m_inline_buffer = '\0';
+
+			*this = other;
+		}
+
+		String::~String()
+		{
+			this->DeallocateBuffer();
+		}
+
+		String& String::operator =(ConstCharPtr str)
+		{
+			this->Clear();
+			this->Append(str, Algorithm::GetStringLength(str));
+
+			return *this;
+		}
+
+		String& String::operator =(SelfType&& other)
+		{
+			if (this == &other)
+				return *this;
+
+			this->DeallocateBuffer();
+
+			// Inline characters can not be taken over and are copied instead.
+			if (other.IsInline())
+				memcpy(this->m_inline_buffer, other.m_inline_buffer, other.m_count + 1);
+			else
+			{
+				this->m_buffer = other.m_buffer;
+				this->m_capacity = other.m_capacity;
+			}
+
+			this->m_allocator = other.m_allocator;
+			this->m_count = other.m_count;
+			this->m_version = other.m_version;
+			this->m_max_capacity = other.m_max_capacity;
+
+			other.m_buffer = other.m_inline_buffer;
+			other.m_capacity = INLINE_CAPACITY;
+			other.m_count = other.m_version = 0;
+
+			*other.m_inline_buffer = '\0';
+
+			return *this;
+		}
+
+		String& String::operator =(ConstSelfTypeRef other)
+		{
+			if (this == &other)
+				return *this;
+
+			this->Clear();
+			this->Append(other.m_buffer, other.m_count);
+
+			this->m_max_capacity = other.m_max_capacity;
+
+			return *this;
+		}
+
+		Void String::DeallocateBuffer(void)
+		{
+			if (this->IsInline())
+				return;
+
+			if (this->m_allocator)
+				this->m_allocator->Deallocate(this->m_buffer);
+			else
+				Memory::HeapDeallocate(this->m_buffer, this->m_capacity + 1);
+
+			this->m_buffer = this->m_inline_buffer;
+			this->m_capacity = INLINE_CAPACITY;
+		}
+
+		Void String::ReallocateBuffer(Size capacity)
+		{
+			CharPtr new_buffer;
+
+			ConstSize count = Algorithm::Min(this->m_count, capacity);
+
+			if (capacity <= INLINE_CAPACITY)
+			{
+				if (!this->IsInline())
+				{
+					memcpy(this->m_inline_buffer, this->m_buffer, count + 1);
+
+					this->DeallocateBuffer();
+				}
+
+				this->m_version++;
+
+				return;
+			}
+
+			// The null terminator is never counted in the capacity.
+			if (this->IsInline())
+			{
+				new_buffer = this->m_allocator ?
+					reinterpret_cast<CharPtr>(this->m_allocator->Allocate(capacity + 1, alignof(Char))) :
+					reinterpret_cast<CharPtr>(Memory::HeapAllocate(capacity + 1));
+
+				if (!new_buffer)
+					FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "The allocator of the string is exhausted.")
+
+				memcpy(new_buffer, this->m_inline_buffer, count + 1);
+			}
+			else if (!this->m_allocator)
+			{
+				new_buffer = reinterpret_cast<CharPtr>(Memory::HeapReallocate(this->m_buffer, this->m_capacity + 1, capacity + 1));
+
+				if (!new_buffer)
+					FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "The allocator of the string is exhausted.")
+			}
+			else
+			{
+				new_buffer = reinterpret_cast<CharPtr>(this->m_allocator->Reallocate(this->m_buffer, capacity + 1, alignof(Char)));
+
+				// Allocators that can neither resize nor move blocks return
+				// nullptr.
+				if (!new_buffer)
+				{
+					new_buffer = reinterpret_cast<CharPtr>(this->m_allocator->Allocate(capacity + 1, alignof(Char)));
+
+					if (!new_buffer)
+						FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "The allocator of the string is exhausted.")
+
+					memcpy(new_buffer, this->m_buffer, count + 1);
+
+					this->m_allocator->Deallocate(this->m_buffer);
+				}
+			}
+
+			this->m_buffer = new_buffer;
+			this->m_capacity = capacity;
+			this->m_version++;
+		}
+
+		Void String::Append(ConstCharPtr str, Size count)
+		{
+			if (!count)
+				return;
+
+			ConstSize new_count = this->m_count + count;
+
+			if (new_count > this->m_capacity)
+			{
+				// Appending a string to itself reads from the buffer being grown.
+				if (str >= this->m_buffer && str < this->m_buffer + this->m_count)
+				{
+					ConstSize offset = str - this->m_buffer;
+
+					this->ReserveCapacity(new_count);
+
+					str = this->m_buffer + offset;
+				}
+				else
+					this->ReserveCapacity(new_count);
+			}
+
+			memcpy(this->m_buffer + this->m_count, str, count);
+
+			this->m_count = new_count;
+			this->m_buffer[new_count] = '\0';
+		}
+
+		Void String::Resize(Size capacity)
+		{
+			if (capacity == this->m_capacity)
+				return;
+
+			this->ReallocateBuffer(capacity);
+
+			if (this->m_count > capacity)
+				this->m_count = capacity;
+
+			this->m_buffer[this->m_count] = '\0';
+		}
+
+		Void String::ReserveCapacity(Size capacity)
+		{
+			if (capacity <= this->m_capacity)
+				return;
+
+			Size new_capacity;
+
+			new_capacity = this->m_capacity + (this->m_capacity >> 1);
+			new_capacity = new_capacity > capacity ? new_capacity : capacity;
+			new_capacity = new_capacity < this->m_max_capacity ? new_capacity : this->m_max_capacity;
+			new_capacity = (new_capacity + (CAPACITY_ALIGNMENT - 1)) & ~(CAPACITY_ALIGNMENT - 1);
+
+			this->ReallocateBuffer(new_capacity);
+		}
+
+		Void String::Clear(void)
+		{
+			this->m_count = 0;
+
+			*this->m_buffer = '\0';
+		}
+	}
+}
@@ -0,0 +1,103 @@
+#include <string.h>
+
+#include "Core/Public/Debug/Debug.h"
+#include "Core/Public/Types/String/StringBuilder.h"
+
+namespace Forge {
+	namespace Type
+	{
+		StringBuilder::~StringBuilder()
+		{
+			this->Clear();
+		}
+
+		Bool StringBuilder::AddChunk(Size capacity)
+		{
+			Chunk* chunk = reinterpret_cast<Chunk*>(this->m_allocator->Allocate(sizeof(Chunk) + capacity, alignof(Chunk)));
+
+			if (!chunk)
+				return false;
+
+			chunk->m_prev = this->m_tail;
+			chunk->m_next = nullptr;
+			chunk->m_count = 0;
+			chunk->m_capacity = capacity;
+
+			if (this->m_tail)
+				this->m_tail->m_next = chunk;
+			else
+				this->m_head = chunk;
+
+			this->m_tail = chunk;
+
+			return true;
+		}
+
+		Void StringBuilder::Append(ConstCharPtr str, Size count)
+		{
+			while (count)
+			{
+				if (!this->m_tail || this->m_tail->m_count == this->m_tail->m_capacity)
+					if (!this->AddChunk(Algorithm::Max(this->m_chunk_size, count)))
+						FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "The allocator of the string builder is exhausted.")
+
+				ConstSize copied = Algorithm::Min(count, this->m_tail->m_capacity - this->m_tail->m_count);
+
+				memcpy(this->m_tail->GetData() + this->m_tail->m_count, str, copied);
+
+				this->m_tail->m_count += copied;
+				this->m_count += copied;
+
+				str   += copied;
+				count -= copied;
+			}
+		}
+
+		Void StringBuilder::AppendInteger(I64 value)
+		{
+			Char digits[20];
+			Size count = 0;
+
+			// Negating the smallest value overflows, so digits are taken from the unsigned magnitude.
+			U64 magnitude = value < 0 ? ~static_cast<U64>(value) + 1 : static_cast<U64>(value);
+
+			do
+			{
+				digits[sizeof(digits) - ++count] = static_cast<Char>('0' + magnitude % 10);
+				magnitude /= 10;
+			} while (magnitude);
+
+			if (value < 0)
+				digits[sizeof(digits) - ++count] = '-';
+
+			this->Append(digits + sizeof(digits) - count, count);
+		}
+
+		String StringBuilder::ToString(Memory::AbstractAllocator* allocator) const
+		{
+			String result(allocator);
+
+			result.ReserveCapacity(this->m_count);
+
+			for (Chunk* chunk = this->m_head; chunk; chunk = chunk->m_next)
+				result.Append(chunk->GetData(), chunk->m_count);
+
+			return result;
+		}
+
+		Void StringBuilder::Clear(void)
+		{
+			while (this->m_tail)
+			{
+				Chunk* prev = this->m_tail->m_prev;
+
+				this->m_allocator->Deallocate(this->m_tail);
+
+				this->m_tail = prev;
+			}
+
+			this->m_head = nullptr;
+			this->m_count = 0;
+		}
+	}
+}
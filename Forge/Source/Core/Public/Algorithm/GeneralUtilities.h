@@ -2,6 +2,11 @@
 #define GENERAL_UTILITIES_H
 
 #include "Core/Public/Common/Compiler.h"
+
+#if defined(FORGE_COMPILER_MSVC)
+	#include <intrin.h>
+#endif
+
 #include "Core/Public/Common/TypeTraits.h"
 #include "Core/Public/Common/TypeDefinitions.h"
 
@@ -143,7 +148,7 @@ namespace Forge {
 		FORGE_FORCE_INLINE auto SwapEndian(InType& data)
 			-> Void
 		{
-			mutable Byte buffer[sizeof(data)];
+			Byte buffer[sizeof(data)];
 
 			if (Common::TIsFloatingPoint<InType>::Value)
 				Internal::EndiannessImpl<InType>::union_helper.f = data;
@@ -172,6 +177,21 @@ namespace Forge {
 			return static_cast<typename Common::TRemoveRefernce<InType>::Type&&>(arg);
 		}
 
+		/**
+		 * @brief Forwards an argument preserving its value category, allowing
+		 * r-value arguments to be moved and l-value arguments to be copied.
+		 *
+		 * @param arg The object to be forwarded.
+		 *
+		 * @return InType&& storing a reference of the same value category.
+		 */
+		template<typename InType>
+		FORGE_FORCE_INLINE auto Forward(typename Common::TRemoveRefernce<InType>::Type& arg)
+			-> InType&&
+		{
+			return static_cast<InType&&>(arg);
+		}
+
 		/**
 		 * @brief Swaps the content of two varibales.
 		 *
@@ -380,6 +400,59 @@ namespace Forge {
 		{
 			return val > low && val < high;
 		}
+
+		/**
+		 * @brief Counts the number of consecutive zero bits starting from the
+		 * least significant bit.
+		 *
+		 * @param val The value to scan, must not be zero.
+		 *
+		 * @return U32 storing the index of the lowest set bit.
+		 */
+		FORGE_FORCE_INLINE auto CountTrailingZeros(U64 val)
+			-> U32
+		{
+#if defined(FORGE_COMPILER_MSVC)
+			unsigned long index;
+			_BitScanForward64(&index, val);
+			return static_cast<U32>(index);
+#else
+			return static_cast<U32>(__builtin_ctzll(val));
+#endif
+		}
+
+		/**
+		 * @brief Counts the number of consecutive zero bits starting from the
+		 * most significant bit.
+		 *
+		 * @param val The value to scan, must not be zero.
+		 *
+		 * @return U32 storing the number of leading zero bits.
+		 */
+		FORGE_FORCE_INLINE auto CountLeadingZeros(U64 val)
+			-> U32
+		{
+#if defined(FORGE_COMPILER_MSVC)
+			unsigned long index;
+			_BitScanReverse64(&index, val);
+			return 63 - static_cast<U32>(index);
+#else
+			return static_cast<U32>(__builtin_clzll(val));
+#endif
+		}
+
+		/**
+		 * @brief Computes the base two logarithm of a value rounded down.
+		 *
+		 * @param val The value to compute its logarithm, must not be zero.
+		 *
+		 * @return U32 storing the index of the highest set bit.
+		 */
+		FORGE_FORCE_INLINE auto FloorLog2(U64 val)
+			-> U32
+		{
+			return 63 - CountLeadingZeros(val);
+		}
 	}
 }
 
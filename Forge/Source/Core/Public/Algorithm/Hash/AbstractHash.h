@@ -1,15 +1,78 @@
 #ifndef ABSTRACT_HASH_H
 #define ABSTRACT_HASH_H
 
+#include "HashResult.h"
+
+#include "Core/Public/Common/Compiler.h"
 #include "Core/Public/Common/TypeDefinitions.h"
 
 namespace Forge {
 	namespace Algorithms
 	{
+		/**
+		 * @brief Base class for streaming hash functions.
+		 *
+		 * A hash object is reset with a seed, fed any number of byte ranges
+		 * through Update() and finalized into a HashResult. Feeding the same
+		 * bytes split differently across Update() calls must produce the
+		 * same result.
+		 *
+		 * Implementations also expose a static one-shot Hash() function which
+		 * containers call directly, avoiding the virtual dispatch on hot paths.
+		 *
+		 * @author Karim Hisham
+		 */
 		class AbstractHash
 		{
+		public:
+			virtual ~AbstractHash() = default;
+
+		public:
+			/**
+			 * @brief Discards any buffered input and starts a new digest.
+			 *
+			 * @param[in] seed The seed to start the digest with.
+			 */
+			virtual Void Reset(U64 seed = 0) = 0;
+
+			/**
+			 * @brief Feeds a range of bytes into the digest.
+			 *
+			 * @param[in] data The address of the bytes to hash.
+			 * @param[in] size The number of bytes to hash.
+			 */
+			virtual Void Update(ConstVoidPtr data, Size size) = 0;
+
+			/**
+			 * @brief Computes the digest of every byte fed since the last reset.
+			 *
+			 * The hash object is left untouched and may keep being updated.
+			 *
+			 * @return HashResult storing the digest.
+			 */
+			virtual HashResult Finalize(Void) const = 0;
 
+		public:
+			/**
+			 * @brief Resets the hash object and computes the digest of a single
+			 * range of bytes.
+			 *
+			 * @param[in] data The address of the bytes to hash.
+			 * @param[in] size The number of bytes to hash.
+			 * @param[in] seed The seed to start the digest with.
+			 *
+			 * @return HashResult storing the digest.
+			 */
+			HashResult Compute(ConstVoidPtr data, Size size, U64 seed = 0);
 		};
+
+		FORGE_FORCE_INLINE HashResult AbstractHash::Compute(ConstVoidPtr data, Size size, U64 seed)
+		{
+			Reset(seed);
+			Update(data, size);
+
+			return Finalize();
+		}
 	}
 }
 
@@ -0,0 +1,109 @@
+#ifndef CONST_STRING_HASH_H
+#define CONST_STRING_HASH_H
+
+#include "THash.h"
+#include "FNV1aHash.h"
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+namespace Forge {
+	namespace Algorithms
+	{
+		/**
+		 * @brief A 64-bit identifier computed from a string, usable as a type
+		 * id or as the name of an asset or an event.
+		 *
+		 * The digest is the 64-bit FNV-1a hash of the characters, computed by
+		 * a constexpr constructor so hashes of string literals are folded into
+		 * constants. Comparing two hashes is a single integer compare, and
+		 * the digest equals FNV1aHash::Hash() over the same characters.
+		 *
+		 * In debug builds every hash is meant to be passed to Register(),
+		 * which detects two different strings hashing to the same value.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API ConstStringHash
+		{
+		private:
+			U64 m_value;
+
+		public:
+			constexpr ConstStringHash(Void)
+				: m_value(0) {}
+
+			constexpr ConstStringHash(ConstCharPtr str)
+				: m_value(Compute(str, GetLength(str))) {}
+
+			constexpr ConstStringHash(ConstCharPtr str, Size count)
+				: m_value(Compute(str, count)) {}
+
+		private:
+			static constexpr Size GetLength(ConstCharPtr str)
+			{
+				Size count = 0;
+
+				while (str[count] != '\0')
+					count++;
+
+				return count;
+			}
+
+			static constexpr U64 Compute(ConstCharPtr str, Size count)
+			{
+				U64 state = FNV1aHash::OFFSET_BASIS;
+
+				for (Size i = 0; i < count; i++)
+					state = (state ^ static_cast<U8>(str[i])) * FNV1aHash::PRIME;
+
+				return state;
+			}
+
+		public:
+			/**
+			 * @brief Gets the digest of the string.
+			 *
+			 * @return U64 storing the digest, zero for a default constructed
+			 * hash.
+			 */
+			constexpr U64 GetValue(Void) const { return m_value; }
+
+		public:
+			/**
+			 * @brief Records the string a hash was computed from, and checks
+			 * that no different string was recorded with the same hash.
+			 *
+			 * Only debug builds keep the registry, release builds always
+			 * succeed without recording anything.
+			 *
+			 * @param[in] hash The hash computed from the string.
+			 * @param[in] str  The string the hash was computed from.
+			 *
+			 * @return True if the hash was not recorded before or was recorded
+			 * with the same string, false on a collision.
+			 */
+			static Bool Register(ConstStringHash hash, ConstCharPtr str);
+
+		public:
+			constexpr Bool operator ==(ConstStringHash other) const { return m_value == other.m_value; }
+			constexpr Bool operator !=(ConstStringHash other) const { return m_value != other.m_value; }
+			constexpr Bool operator < (ConstStringHash other) const { return m_value <  other.m_value; }
+		};
+
+		/**
+		 * @brief Hashes a string hash by mixing its digest, the low bits of a
+		 * FNV-1a digest only depend on the low bits of the characters.
+		 */
+		template<>
+		struct THash<ConstStringHash>
+		{
+			U64 operator ()(const ConstStringHash& key) const
+			{
+				return Internal::MixBits(key.GetValue());
+			}
+		};
+	}
+}
+
+#endif // CONST_STRING_HASH_H
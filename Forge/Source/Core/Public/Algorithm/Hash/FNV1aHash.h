@@ -0,0 +1,85 @@
+#ifndef FNV1A_HASH_H
+#define FNV1A_HASH_H
+
+#include "AbstractHash.h"
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+namespace Forge {
+	namespace Algorithms
+	{
+		/**
+		 * @brief The 64-bit Fowler-Noll-Vo 1a hash function.
+		 *
+		 * FNV-1a processes one byte at a time, which keeps it simple and
+		 * usable in constant expressions but makes it slow on long inputs.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FNV1aHash final : public AbstractHash
+		{
+		public:
+			enum : U64
+			{
+				OFFSET_BASIS = 0xCBF29CE484222325ULL,
+				PRIME        = 0x00000100000001B3ULL
+			};
+
+		private:
+			U64 m_state;
+
+		public:
+			FNV1aHash(U64 seed = 0)
+				: m_state(OFFSET_BASIS ^ seed) {}
+
+		public:
+			/**
+			 * @brief Computes the digest of a range of bytes.
+			 *
+			 * @param[in] data The address of the bytes to hash.
+			 * @param[in] size The number of bytes to hash.
+			 * @param[in] seed The seed to start the digest with.
+			 *
+			 * @return U64 storing the digest.
+			 */
+			static U64 Hash(ConstVoidPtr data, Size size, U64 seed = 0);
+
+		public:
+			Void Reset(U64 seed = 0) override;
+			Void Update(ConstVoidPtr data, Size size) override;
+			HashResult Finalize(Void) const override;
+		};
+
+		FORGE_FORCE_INLINE U64 FNV1aHash::Hash(ConstVoidPtr data, Size size, U64 seed)
+		{
+			const U8* bytes = static_cast<const U8*>(data);
+			U64 state = OFFSET_BASIS ^ seed;
+
+			for (Size i = 0; i < size; i++)
+				state = (state ^ bytes[i]) * PRIME;
+
+			return state;
+		}
+
+		FORGE_FORCE_INLINE Void FNV1aHash::Reset(U64 seed)
+		{
+			m_state = OFFSET_BASIS ^ seed;
+		}
+
+		FORGE_FORCE_INLINE Void FNV1aHash::Update(ConstVoidPtr data, Size size)
+		{
+			const U8* bytes = static_cast<const U8*>(data);
+
+			for (Size i = 0; i < size; i++)
+				m_state = (m_state ^ bytes[i]) * PRIME;
+		}
+
+		FORGE_FORCE_INLINE HashResult FNV1aHash::Finalize(Void) const
+		{
+			return HashResult(m_state);
+		}
+	}
+}
+
+#endif
@@ -1,10 +1,58 @@
 #ifndef HASH_RESULT_H
 #define HASH_RESULT_H
 
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
 namespace Forge {
 	namespace Algorithms
 	{
+		/**
+		 * @brief The digest produced by a hash function.
+		 *
+		 * Results are up to 128 bits wide, 64-bit hash functions only fill
+		 * the low half and leave the high half zeroed.
+		 *
+		 * @author Karim Hisham
+		 */
+		struct HashResult
+		{
+		public:
+			U64 m_low;
+			U64 m_high;
+
+		public:
+			constexpr HashResult(Void)
+				: m_low(0), m_high(0) {}
+
+			constexpr HashResult(U64 low, U64 high = 0)
+				: m_low(low), m_high(high) {}
+
+		public:
+			/**
+			 * @brief Gets the low 64 bits of the digest.
+			 *
+			 * @return U64 storing the low half of the digest.
+			 */
+			constexpr U64 GetLow(Void) const { return m_low; }
+
+			/**
+			 * @brief Gets the high 64 bits of the digest.
+			 *
+			 * @return U64 storing the high half of the digest.
+			 */
+			constexpr U64 GetHigh(Void) const { return m_high; }
 
+		public:
+			constexpr Bool operator ==(const HashResult& other) const
+			{
+				return m_low == other.m_low && m_high == other.m_high;
+			}
+			constexpr Bool operator !=(const HashResult& other) const
+			{
+				return !(*this == other);
+			}
+		};
 	}
 }
 
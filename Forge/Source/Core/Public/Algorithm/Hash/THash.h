@@ -0,0 +1,97 @@
+#ifndef T_HASH_H
+#define T_HASH_H
+
+#include <type_traits>
+
+#include "XXH3Hash.h"
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeTraits.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+#include "Core/Public/Memory/MemoryUtilities.h"
+
+namespace Forge {
+	namespace Algorithms
+	{
+		namespace Internal
+		{
+			/**
+			 * @brief Scrambles the bits of a 64-bit value so that keys differing
+			 * in a few low bits land in distant buckets.
+			 *
+			 * This is the finalizer of MurmurHash3, it is a bijection so
+			 * distinct keys never collide before the table masks the result.
+			 */
+			FORGE_FORCE_INLINE U64 MixBits(U64 value)
+			{
+				value ^= value >> 33;
+				value *= 0xFF51AFD7ED558CCDULL;
+				value ^= value >> 33;
+				value *= 0xC4CEB9FE1A85EC53ULL;
+				value ^= value >> 33;
+
+				return value;
+			}
+
+			/**
+			 * @brief Folds negative zero into positive zero so both hash the
+			 * same as they compare equal.
+			 */
+			template<typename InKeyType>
+			FORGE_FORCE_INLINE InKeyType NormalizeKey(InKeyType key) { return key; }
+			FORGE_FORCE_INLINE F32 NormalizeKey(F32 key) { return key + 0.0f; }
+			FORGE_FORCE_INLINE F64 NormalizeKey(F64 key) { return key + 0.0; }
+
+			template<typename InKeyType, Bool IsScalar>
+			struct THashImpl
+			{
+				static_assert(std::has_unique_object_representations<InKeyType>::value,
+					"THash can not hash a key type with padding bytes, specialize THash or use a custom hasher.");
+
+				static U64 Hash(const InKeyType& key)
+				{
+					return XXH3Hash::Hash(&key, sizeof(InKeyType));
+				}
+			};
+
+			template<typename InKeyType>
+			struct THashImpl<InKeyType, true>
+			{
+				static U64 Hash(const InKeyType& key)
+				{
+					InKeyType normalized = NormalizeKey(key);
+
+					U64 bits = 0;
+					Memory::MemoryCopy(&bits, &normalized, sizeof(InKeyType));
+
+					return MixBits(bits);
+				}
+			};
+		}
+
+		/**
+		 * @brief The default key hasher used by the hash containers.
+		 *
+		 * Integers, floating point numbers, enums and pointers are hashed by
+		 * mixing their bits, any other key type is hashed over its object
+		 * representation and must therefore not contain padding or pointers
+		 * to owned data. Such types should specialize THash or be used with
+		 * a custom hasher, keys with padding fail to compile.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InKeyType>
+		struct THash
+		{
+			U64 operator ()(const InKeyType& key) const
+			{
+				return Internal::THashImpl<InKeyType, Common::TIsArithmetic<InKeyType>::Value ||
+													  Common::TIsPointer<InKeyType>::Value    ||
+													  std::is_enum<InKeyType>::value>::Hash(key);
+			}
+		};
+	}
+}
+
+#endif
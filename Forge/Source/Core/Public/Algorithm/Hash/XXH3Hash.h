@@ -0,0 +1,158 @@
+#ifndef XXH3_HASH_H
+#define XXH3_HASH_H
+
+#include "HashResult.h"
+#include "AbstractHash.h"
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+namespace Forge {
+	namespace Algorithms
+	{
+		namespace Internal
+		{
+			/**
+			 * @brief Streaming state shared by the 64-bit and 128-bit XXH3
+			 * variants.
+			 *
+			 * Input is buffered until a full 256 byte chunk is available and
+			 * then accumulated stripe by stripe. At least one byte is always
+			 * kept buffered since the digest has to process the last stripe of
+			 * the input separately.
+			 *
+			 * @author Karim Hisham
+			 */
+			struct FORGE_API XXH3State
+			{
+			public:
+				enum : Size
+				{
+					SECRET_SIZE         = 192,
+					BUFFER_SIZE         = 256,
+					STRIPE_SIZE         = 64,
+					NUM_OF_ACCUMULATORS = 8
+				};
+
+			public:
+				FORGE_ALIGN(64) U64 m_accumulators[NUM_OF_ACCUMULATORS];
+				FORGE_ALIGN(64) U8  m_secret[SECRET_SIZE];
+				FORGE_ALIGN(64) U8  m_buffer[BUFFER_SIZE];
+
+			public:
+				Size m_buffered_size;
+				Size m_num_of_stripes;
+				U64  m_total_size;
+				U64  m_seed;
+
+			public:
+				/**
+				 * @brief Starts a new digest, deriving the secret from the seed.
+				 *
+				 * @param[in] seed The seed to start the digest with.
+				 */
+				Void Reset(U64 seed);
+
+				/**
+				 * @brief Feeds a range of bytes into the digest.
+				 *
+				 * @param[in] data The address of the bytes to hash.
+				 * @param[in] size The number of bytes to hash.
+				 */
+				Void Update(ConstVoidPtr data, Size size);
+
+				/**
+				 * @brief Accumulates the buffered tail of a long input without
+				 * modifying the state.
+				 *
+				 * @param[out] accumulators The accumulators to merge into the
+				 * final digest.
+				 */
+				Void Digest(U64* accumulators) const;
+			};
+		}
+
+		/**
+		 * @brief The 64-bit XXH3 hash function.
+		 *
+		 * XXH3 reads short inputs with a handful of wide multiplications and
+		 * processes long inputs in 64 byte stripes over eight independent
+		 * accumulators, using SSE2 or AVX2 when the target supports them.
+		 * Results are identical to the reference XXH3_64bits_withSeed()
+		 * on every platform.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API XXH3Hash final : public AbstractHash
+		{
+		private:
+			Internal::XXH3State m_state;
+
+		public:
+			XXH3Hash(U64 seed = 0);
+
+		public:
+			/**
+			 * @brief Computes the digest of a range of bytes.
+			 *
+			 * @param[in] data The address of the bytes to hash.
+			 * @param[in] size The number of bytes to hash.
+			 * @param[in] seed The seed to start the digest with.
+			 *
+			 * @return U64 storing the digest.
+			 */
+			static U64 Hash(ConstVoidPtr data, Size size, U64 seed = 0);
+
+		public:
+			Void Reset(U64 seed = 0) override;
+			Void Update(ConstVoidPtr data, Size size) override;
+			HashResult Finalize(Void) const override;
+		};
+
+		/**
+		 * @brief The 128-bit XXH3 hash function.
+		 *
+		 * Shares the stripe processing of XXH3Hash and derives a second
+		 * independent 64-bit lane, making collisions practically impossible
+		 * for content addressing. Results are identical to the reference
+		 * XXH3_128bits_withSeed() on every platform.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API XXH3Hash128 final : public AbstractHash
+		{
+		private:
+			Internal::XXH3State m_state;
+
+		public:
+			XXH3Hash128(U64 seed = 0);
+
+		public:
+			/**
+			 * @brief Computes the digest of a range of bytes.
+			 *
+			 * @param[in] data The address of the bytes to hash.
+			 * @param[in] size The number of bytes to hash.
+			 * @param[in] seed The seed to start the digest with.
+			 *
+			 * @return HashResult storing the digest.
+			 */
+			static HashResult Hash(ConstVoidPtr data, Size size, U64 seed = 0);
+
+		public:
+			Void Reset(U64 seed = 0) override;
+			Void Update(ConstVoidPtr data, Size size) override;
+			HashResult Finalize(Void) const override;
+		};
+
+		FORGE_FORCE_INLINE XXH3Hash::XXH3Hash(U64 seed) { m_state.Reset(seed); }
+		FORGE_FORCE_INLINE Void XXH3Hash::Reset(U64 seed) { m_state.Reset(seed); }
+		FORGE_FORCE_INLINE Void XXH3Hash::Update(ConstVoidPtr data, Size size) { m_state.Update(data, size); }
+
+		FORGE_FORCE_INLINE XXH3Hash128::XXH3Hash128(U64 seed) { m_state.Reset(seed); }
+		FORGE_FORCE_INLINE Void XXH3Hash128::Reset(U64 seed) { m_state.Reset(seed); }
+		FORGE_FORCE_INLINE Void XXH3Hash128::Update(ConstVoidPtr data, Size size) { m_state.Update(data, size); }
+	}
+}
+
+#endif
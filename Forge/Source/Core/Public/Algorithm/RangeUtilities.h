@@ -8,7 +8,7 @@
 #include "Core/Public/Common/TypeDefinitions.h"
 
 #include "Core/Public/Types/TPair.h"
-#include "Core/Public/Types/TDelegate.h"
+#include "Core/Public/Types/TFunctionRef.h"
 
 #include "Core/Public/Memory/MemoryUtilities.h"
 
@@ -349,7 +349,7 @@ namespace Forge {
 		 * range and false otherwise.
 		 */
 		template<typename InIterator, typename InElementType>
-		FORGE_FORCE_INLINE auto AllOfRange(InIterator first, InIterator last, Common::TDelegate<Bool(const InElementType&)> pred)
+		FORGE_FORCE_INLINE auto AllOfRange(InIterator first, InIterator last, Common::TFunctionRef<Bool(const InElementType&)> pred)
 			-> Bool
 		{
 			if (first == last)
@@ -375,7 +375,7 @@ namespace Forge {
 		 * the range and false otherwise.
 		 */
 		template<typename InIterator, typename InElementType>
-		FORGE_FORCE_INLINE auto AnyOfRange(InIterator first, InIterator last, Common::TDelegate<Bool(const InElementType&)> pred)
+		FORGE_FORCE_INLINE auto AnyOfRange(InIterator first, InIterator last, Common::TFunctionRef<Bool(const InElementType&)> pred)
 			-> Bool
 		{
 			if (first == last)
@@ -401,7 +401,7 @@ namespace Forge {
 		 * the range and false otherwise.
 		 */
 		template<typename InIterator, typename InElementType>
-		FORGE_FORCE_INLINE auto NoneOfRange(InIterator first, InIterator last, Common::TDelegate<Bool(const InElementType&)> pred)
+		FORGE_FORCE_INLINE auto NoneOfRange(InIterator first, InIterator last, Common::TFunctionRef<Bool(const InElementType&)> pred)
 			-> Bool
 		{
 			if (first == last)
@@ -1,6 +1,8 @@
 #ifndef STRING_UTILITIES_H
 #define STRING_UTILITIES_H
 
+#include <string.h>
+
 #include "Core/Public/Common/Compiler.h"
 #include"Core/Public/Common/TypeDefinitions.h"
 
@@ -38,12 +40,7 @@ namespace Forge {
 				// Throw Exception
 			}
 
-			Size count = 0;
-
-			while (*(str++) != '\0')
-				count++;
-
-			return count;
+			return strlen(str);
 		}
 	}
 }
@@ -6,7 +6,6 @@
 	#error "Android is not currently supported."
 #elif defined(__linux__)
 	#define FORGE_PLATFORM_LINUX
-	#error "Linux is not currently supported."
 #elif defined(__APPLE__)
 	#define FORGE_PLATFORM_MACOS
 	#error "MacOS is not currently supported."
@@ -45,9 +44,21 @@
 	#define FORGE_ARCHITECTURE_32BIT
 #endif
 
+#if defined(FORGE_CPU_X86)
+	#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define FORGE_SIMD_SSE2
+	#endif
+	#if defined(__SSE4_2__) || defined(__AVX__)
+		#define FORGE_SIMD_SSE4_2
+	#endif
+	#if defined(__AVX2__)
+		#define FORGE_SIMD_AVX2
+	#endif
+#endif
+
 #if defined(FORGE_PLATFORM_ANDROID)
 	#define FORGE_PLATFORM_NAME "Android"
-#elif defined(FORGE_PLAFTORM_LINUX)
+#elif defined(FORGE_PLATFORM_LINUX)
 	#define FORGE_PLATFORM_NAME "Linux"
 #elif defined(FORGE_PLATFORM_MACOS)
 	#define FORGE_PLATFORM_NAME "MacOS"
@@ -109,7 +120,19 @@
 #elif defined(FORGE_COMPILER_EMSCRIPTEN)
 	#error "Emscripten is not currently supported."
 #elif defined(FORGE_COMPILER_GCC)
-	#error "GCC is not currently supported."
+	#define FORGE_CDECL
+	#define FORGE_STDCALL
+	#define FORGE_INLINE              inline
+	#define FORGE_FORCE_INLINE        inline __attribute__((always_inline))
+	#define FORGE_DEBUG_BREAK         __builtin_trap();
+	#define FORGE_DLL_EXPORT          __attribute__((visibility("default")))
+	#define FORGE_DLL_IMPORT          __attribute__((visibility("default")))
+	#define FORGE_NO_INLINE           __attribute__((noinline))
+	#define FORGE_NO_RETURN           __attribute__((noreturn))
+	#define FORGE_RESTRICT            __restrict__
+	#define FORGE_ALIGN(__ALIGN__)    __attribute__((aligned(__ALIGN__)))
+	#define FORGE_DEPRECATED(__MSG__) __attribute__((deprecated(__MSG__)))
+	#define FORGE_FUNC_SIGNATURE      __PRETTY_FUNCTION__
 #elif defined(FORGE_COMPILER_MSVC) 
 	#define FORGE_CDECL               __cdecl
     #define FORGE_STDCALL             __stdcall
@@ -120,8 +143,10 @@
 	#define FORGE_DLL_IMPORT          __declspec(dllimport)
 	#define FORGE_NO_INLINE           __declspec(noinline)
 	#define FORGE_NO_RETURN           __declspec(noreturn)
+	#define FORGE_RESTRICT            __restrict
 	#define FORGE_ALIGN(__ALIGN__)    __declspec(align(__ALIGN__))
 	#define FORGE_DEPRECATED(__MSG__) __declspec(deprecated(__MSG__))
+	#define FORGE_FUNC_SIGNATURE      __FUNCSIG__
 #endif
 
 #if defined(FORGE_EXPORT)
@@ -85,7 +85,7 @@
 			= 1 / (int) (!!(__EXPR__))           \
 	};
 #else
-	#define FORGE_ASSERT(__EXPR__)
+	#define FORGE_ASSERT(__EXPR__, __MSG__)
 	#define FORGE_STATIC_ASSERT(__EXPR__)
 #endif
 
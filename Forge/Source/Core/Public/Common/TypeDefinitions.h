@@ -4,6 +4,10 @@
 #include "Compiler.h"
 #include "PreprocessorUtilities.h"
 
+#if !defined(FORGE_COMPILER_MSVC)
+	#include <stdint.h>
+#endif
+
 namespace Forge
 {
 	typedef void		               Void,      *VoidPtr;
@@ -44,8 +48,7 @@ namespace Forge
 	
 	typedef unsigned __int64	       Size,      *SizePtr;
 	typedef const unsigned __int64	   ConstSize, *ConstSizePtr;
-#elif
-	#include<stdint.h>
+#else
 					               
 	typedef int8_t	                   I8,        *I8Ptr;
 	typedef int16_t	                   I16,       *I16Ptr;
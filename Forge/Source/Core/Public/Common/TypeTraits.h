@@ -10,10 +10,10 @@
 namespace Forge {
 	namespace Common
 	{
-		template<I32 Value>
+		template<I32 InValue>
 		struct TTraitInt
 		{
-			enum { Value = Value };
+			enum { Value = InValue };
 		};
 
 		using TypeIsPod = TTraitInt<1>;
@@ -55,6 +55,21 @@ namespace Forge {
 		template<typename InType>
 		struct TIsTriviallyCopyAssignable { enum { Value = __has_trivial_assign(InType) }; };
 
+		/**
+		 * @brief Tests if a type can be relocated with a plain memory copy.
+		 *
+		 * Relocating moves an object to a new address and ends the lifetime
+		 * of the original without running its move constructor or destructor.
+		 * Trivially copyable types always qualify, other types that never
+		 * point into themselves can opt in with
+		 * FORGE_DECLARE_TRIVIALLY_RELOCATABLE.
+		 */
+		template<typename InType>
+		struct TIsTriviallyRelocatable { enum { Value = std::is_trivially_copyable<InType>::value }; };
+
+		template<typename InType>
+		struct TIsTriviallyRelocatable<const InType> { enum { Value = TIsTriviallyRelocatable<InType>::Value }; };
+
 		/**
 		 * @brief Tests whether two typenames are the same.
 		 */
@@ -195,7 +210,7 @@ namespace Forge {
 		template<> struct TIsDoublePrecision<F64> { enum { Value = true }; };
 
 		template<typename InType>
-		struct TIsDoublePrecision<const InType> { enum { Value = TIsDouble<InType>::Value }; };
+		struct TIsDoublePrecision<const InType> { enum { Value = TIsDoublePrecision<InType>::Value }; };
 
 		/**
 		 * @brief Removes constant qualifiers from a type.
@@ -229,4 +244,16 @@ namespace Forge {
 	}
 }
 
+/**
+ * Marks a type as trivially relocatable, must be used in the global
+ * namespace after the type is declared.
+ */
+#define FORGE_DECLARE_TRIVIALLY_RELOCATABLE(__TYPE__)                                    \
+	namespace Forge {                                                                    \
+		namespace Common                                                                 \
+		{                                                                                \
+			template<> struct TIsTriviallyRelocatable<__TYPE__> { enum { Value = true }; }; \
+		}                                                                                \
+	}
+
 #endif // TYPE_TRAITS_H
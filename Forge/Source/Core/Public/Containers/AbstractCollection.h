@@ -2,7 +2,7 @@
 #define ABSTRACT_COLLECTION_H
 
 #include <Core/Public/Common/Common.h>
-#include <Core/Public/Types/TDelegate.h>
+#include <Core/Public/Types/TFunctionRef.h>
 
 using namespace Forge::Common;
 
@@ -25,7 +25,7 @@ namespace Forge {
 			using SelfType         = AbstractCollection<ElementType>;
 			using SelfTypePtr      = AbstractCollection<ElementType>*;
 			using SelfTypeRef      = AbstractCollection<ElementType>&;
-			using SelfTypeRef      = AbstractCollection<ElementType>&&;
+			using SelfTypeMoveRef  = AbstractCollection<ElementType>&&;
 			using ConstSelfType    = const AbstractCollection<ElementType>;
 			using ConstSelfTypeRef = const AbstractCollection<ElementType>&;
 			using ConstSelfTypePtr = const AbstractCollection<ElementType>*;
@@ -145,7 +145,7 @@ namespace Forge {
 			 * 
 			 * @throws InvalidOperationException if collection is empty.
 			 */
-			virtual Void ForEach(TDelegate<Void(ElementTypeRef)> function) = 0;
+			virtual Void ForEach(TFunctionRef<Void(ElementTypeRef)> function) = 0;
 
 			/**
 			 * @brief Iterates through all the elements inside the collection and
@@ -159,7 +159,7 @@ namespace Forge {
 			 *
 			 * @throws InvalidOperationException if collection is empty.
 			 */
-			virtual Void ForEach(TDelegate<Void(ConstElementTypeRef)> function) const = 0;
+			virtual Void ForEach(TFunctionRef<Void(ConstElementTypeRef)> function) const = 0;
 
 		public:
 			/**
@@ -249,7 +249,7 @@ namespace Forge {
 		}
 		template<typename T> FORGE_FORCE_INLINE Bool AbstractCollection<T>::IsEmpty() const 
 		{ 
-			return >m_count == 0; 
+			return m_count == 0; 
 		}
 		template<typename T> FORGE_FORCE_INLINE Size AbstractCollection<T>::GetCount() const 
 		{ 
@@ -8,7 +8,9 @@
 
 #include "Core/Public/Common/TypeDefinitions.h"
 #include "Core/Public/Common/PreprocessorUtilities.h"
+#include "Core/Public/Debug/Debug.h"
 
+#include "Core/Public/Memory/AbstractAllocator.h"
 #include "Core/Public/Memory/MemoryUtilities.h"
 
 namespace Forge {
@@ -23,6 +25,11 @@ namespace Forge {
 		 * dynamically, with the storage being handled automatically by the
 		 * container.
 		 * 
+		 * Memory is obtained from the allocator passed on construction, or from
+		 * the system heap if none is given. Elements of trivially relocatable
+		 * types are grown in place through AbstractAllocator::Reallocate() or
+		 * HeapReallocate() without moving them one by one.
+		 * 
 		 * @author Karim Hisham.
 		 */
 		template<typename InElementType>
@@ -51,11 +58,81 @@ namespace Forge {
 
 		private:
 			ElementTypePtr m_mem_block;
+			Memory::AbstractAllocator* m_allocator;
 
 		private:
 			Size m_version;
 			Size m_capacity;
 
+		private:
+			ElementTypePtr AllocateBlock(Size capacity)
+			{
+				ElementTypePtr block = this->m_allocator ?
+					reinterpret_cast<ElementTypePtr>(this->m_allocator->Allocate(capacity * sizeof(ElementType), alignof(ElementType))) :
+					reinterpret_cast<ElementTypePtr>(Memory::HeapAllocate(capacity * sizeof(ElementType)));
+
+				if (!block)
+					FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "The allocator of the array is exhausted.")
+
+				return block;
+			}
+
+			Void DeallocateBlock(ElementTypePtr block, Size capacity)
+			{
+				if (!block)
+					return;
+
+				if (this->m_allocator)
+					this->m_allocator->Deallocate(block);
+				else
+					Memory::HeapDeallocate(block, capacity * sizeof(ElementType));
+			}
+
+			Void GrowBlock(Size new_capacity, Common::TTraitInt<true>)
+			{
+				ElementTypePtr new_elements;
+
+				if (!this->m_mem_block)
+					new_elements = this->AllocateBlock(new_capacity);
+				else if (this->m_allocator)
+				{
+					new_elements = reinterpret_cast<ElementTypePtr>(this->m_allocator->Reallocate(this->m_mem_block, new_capacity * sizeof(ElementType), alignof(ElementType)));
+
+					// Allocators that can neither resize nor move blocks return
+					// nullptr, the elements are still relocated with a single
+					// copy, and the block is kept if the allocator is exhausted.
+					if (!new_elements)
+					{
+						new_elements = this->AllocateBlock(new_capacity);
+
+						Memory::MemoryCopy(new_elements, this->m_mem_block, this->m_count * sizeof(ElementType));
+
+						this->DeallocateBlock(this->m_mem_block, this->m_capacity);
+					}
+				}
+				else
+				{
+					new_elements = reinterpret_cast<ElementTypePtr>(Memory::HeapReallocate(this->m_mem_block, this->m_capacity * sizeof(ElementType), new_capacity * sizeof(ElementType)));
+
+					if (!new_elements)
+						FORGE_EXCEPT(Debug::ExceptionType::FORGE_BAD_ALLOCATION, "The allocator of the array is exhausted.")
+				}
+
+				this->m_mem_block = new_elements;
+			}
+
+			Void GrowBlock(Size new_capacity, Common::TTraitInt<false>)
+			{
+				ElementTypePtr new_elements = this->AllocateBlock(new_capacity);
+
+				Memory::MoveConstructArray(new_elements, this->m_mem_block, this->m_count);
+				Memory::Destruct(this->m_mem_block, this->m_count);
+
+				this->DeallocateBlock(this->m_mem_block, this->m_capacity);
+
+				this->m_mem_block = new_elements;
+			}
+
 		public:
 			struct Iterator
 			{
@@ -293,17 +370,26 @@ namespace Forge {
 			 * Constructs an empty dynamic array.
 			 */
 			TDynamicArray(Void) 
-				: m_mem_block(nullptr), m_version(0), m_capacity(0), AbstractList<ElementType>(0, ~((Size)0)) {}
+				: m_mem_block(nullptr), m_allocator(nullptr), m_version(0), m_capacity(0), AbstractList<ElementType>(0, ~((Size)0)) {}
+
+			/**
+			 * @brief Allocator constructor.
+			 *
+			 * Constructs an empty dynamic array that obtains its memory from an
+			 * allocator.
+			 */
+			explicit TDynamicArray(Memory::AbstractAllocator* allocator)
+				: m_mem_block(nullptr), m_allocator(allocator), m_version(0), m_capacity(0), AbstractList<ElementType>(0, ~((Size)0)) {}
 
 			/**
 			 * @brief Move element constructor.
 			 *
 			 * Constructs a dynamic array with a copy of an element.
 			 */
-			TDynamicArray(ElementTypeMoveRef element, Size count)
-				: m_mem_block(nullptr), m_version(0), m_capacity(count), AbstractList<ElementType>(count, ~((Size)0))
+			TDynamicArray(ElementTypeMoveRef element, Size count, Memory::AbstractAllocator* allocator = nullptr)
+				: m_mem_block(nullptr), m_allocator(allocator), m_version(0), m_capacity(count), AbstractList<ElementType>(count, ~((Size)0))
 			{
-				this->m_mem_block = (ElementTypePtr)malloc(this->m_count * sizeof(ElementType));
+				this->m_mem_block = this->AllocateBlock(this->m_capacity);
 
 				Memory::MoveConstruct(this->m_mem_block, Move(element), this->m_count);
 			}
@@ -313,10 +399,10 @@ namespace Forge {
 			 *
 			 * Constructs a dynamic array with a copy of an element.
 			 */
-			TDynamicArray(ConstElementTypeRef element, Size count)
-				: m_mem_block(nullptr), m_version(0), m_capacity(count), AbstractList<ElementType>(count, ~((Size)0))
+			TDynamicArray(ConstElementTypeRef element, Size count, Memory::AbstractAllocator* allocator = nullptr)
+				: m_mem_block(nullptr), m_allocator(allocator), m_version(0), m_capacity(count), AbstractList<ElementType>(count, ~((Size)0))
 			{
-				this->m_mem_block = (ElementTypePtr)malloc(this->m_count * sizeof(ElementType));
+				this->m_mem_block = this->AllocateBlock(this->m_capacity);
 
 				Memory::CopyConstruct(this->m_mem_block, element, this->m_count);
 			}
@@ -326,10 +412,10 @@ namespace Forge {
 			 *
 			 * Constructs a static array with an initializer list.
 			 */
-			TDynamicArray(std::initializer_list<ElementType> init_list)
-				: m_mem_block(nullptr), m_version(0), m_capacity(init_list.size()), AbstractList<ElementType>(init_list.size(), ~((Size)0))
+			TDynamicArray(std::initializer_list<ElementType> init_list, Memory::AbstractAllocator* allocator = nullptr)
+				: m_mem_block(nullptr), m_allocator(allocator), m_version(0), m_capacity(init_list.size()), AbstractList<ElementType>(init_list.size(), ~((Size)0))
 			{
-				this->m_mem_block = (ElementTypePtr)malloc(this->m_count * sizeof(ElementType));
+				this->m_mem_block = this->AllocateBlock(this->m_capacity);
 
 				Memory::CopyConstructArray(this->m_mem_block, const_cast<ElementTypePtr>(init_list.begin()), this->m_count);
 			}
@@ -339,16 +425,19 @@ namespace Forge {
 			 * @brief Move constructor.
 			 */
 			TDynamicArray(SelfTypeMoveRef other)
-				: m_mem_block(nullptr), m_version(0), m_capacity(0), AbstractList<ElementType>(0, ~((Size)0))
+				: m_mem_block(nullptr), m_allocator(nullptr), m_version(0), m_capacity(0), AbstractList<ElementType>(0, ~((Size)0))
 			{
 				*this = Move(other);
 			}
 
 			/**
 			 * @brief Copy constructor.
+			 *
+			 * The copy obtains its memory from the same allocator as the other
+			 * dynamic array.
 			 */
 			TDynamicArray(ConstSelfTypeRef other)
-				: m_mem_block(nullptr), m_version(0), m_capacity(0), AbstractList<ElementType>(0, ~((Size)0))
+				: m_mem_block(nullptr), m_allocator(other.m_allocator), m_version(0), m_capacity(0), AbstractList<ElementType>(0, ~((Size)0))
 			{
 				*this = other;
 			}
@@ -361,8 +450,7 @@ namespace Forge {
 			{
 				this->Clear();
 
-				if(this->m_mem_block)
-					free(this->m_mem_block);
+				this->DeallocateBlock(this->m_mem_block, this->m_capacity);
 			}
 
 		public:
@@ -371,9 +459,18 @@ namespace Forge {
 			 */
 			SelfTypeRef operator =(SelfTypeMoveRef other)
 			{
+				if (this == &other)
+					return *this;
+
 				this->Clear();
-				
-				Memory::MemoryCopy(this, &other, sizeof(SelfType));
+				this->DeallocateBlock(this->m_mem_block, this->m_capacity);
+
+				this->m_mem_block = other.m_mem_block;
+				this->m_allocator = other.m_allocator;
+				this->m_count = other.m_count;
+				this->m_version = other.m_version;
+				this->m_capacity = other.m_capacity;
+				this->m_max_capacity = other.m_max_capacity;
 
 				other.m_mem_block = nullptr;
 				other.m_capacity = other.m_count = other.m_version = 0;
@@ -386,25 +483,16 @@ namespace Forge {
 			 */
 			SelfTypeRef operator =(ConstSelfTypeRef other)
 			{
-				ConstSize old_count = this->m_count;
-				ConstSize new_count = other.m_count;
+				if (this == &other)
+					return *this;
 
 				this->Clear();
+				this->ReserveCapacity(other.m_count);
 
-				if (new_count > old_count)
-				{
-					this->ReserveCapacity(new_count);
-
-					Memory::CopyArray(this->m_mem_block, other.m_mem_block, old_count);
-					Memory::CopyConstructArray(this->m_mem_block + old_count, other.m_mem_block + old_count, new_count - old_count);
-				}
-				else
-					Memory::CopyArray(this->m_mem_block, other.m_mem_block, new_count);
-
+				Memory::CopyConstructArray(this->m_mem_block, other.m_mem_block, other.m_count);
 
 				this->m_count = other.m_count;
 				this->m_version = other.m_version;
-				this->m_capacity = other.m_capacity;
 				this->m_max_capacity = other.m_max_capacity;
 
 				return *this;
@@ -561,7 +649,7 @@ namespace Forge {
 			 *
 			 * @param[in] function The function to perform on each element.
 			 */
-			Void ForEach(TDelegate<Void(ElementTypeRef)> function) override
+			Void ForEach(TFunctionRef<Void(ElementTypeRef)> function) override
 			{
 				for (U32 i = 0; i < this->m_count; i++)
 					function.Invoke(*(this->m_mem_block + i));
@@ -579,12 +667,35 @@ namespace Forge {
 			 *
 			 * @throws InvalidOperationException if collection is empty.
 			 */
-			Void ForEach(TDelegate<Void(ConstElementTypeRef)> function) const override
+			Void ForEach(TFunctionRef<Void(ConstElementTypeRef)> function) const override
 			{
 				for (U32 i = 0; i < this->m_count; i++)
 					function.Invoke(*(this->m_mem_block + i));
 			}
 
+		public:
+			/**
+			 * @brief Gets the number of elements this collection can store
+			 * without growing.
+			 *
+			 * @return Size storing the capacity of the dynamic array.
+			 */
+			Size GetCapacity(Void) const
+			{
+				return this->m_capacity;
+			}
+
+			/**
+			 * @brief Gets the allocator this collection obtains memory from.
+			 *
+			 * @return Memory::AbstractAllocator* storing the allocator, or
+			 * nullptr if the system heap is used.
+			 */
+			Memory::AbstractAllocator* GetAllocator(Void) const
+			{
+				return this->m_allocator;
+			}
+
 		public:
 			/**
 			 * @brief Requests that this collection capacity is large enough
@@ -599,21 +710,13 @@ namespace Forge {
 
 				Size new_capacity;
 
-				ElementTypePtr old_elements, new_elements;
-
 				new_capacity = this->m_capacity + (this->m_capacity / 2);
 				new_capacity = new_capacity > capacity ? new_capacity : capacity;
 				new_capacity = new_capacity < this->m_max_capacity ? new_capacity : this->m_max_capacity;
 				new_capacity = (new_capacity + (CAPACITY_ALIGNMENT - 1)) & ~(CAPACITY_ALIGNMENT - 1);
-			
-				old_elements = this->m_mem_block;
-				new_elements = (ElementTypePtr)malloc(new_capacity * sizeof(ElementType));
-
-				Memory::MoveConstructArray(new_elements, old_elements, this->m_count);
 
-				free(old_elements);
+				this->GrowBlock(new_capacity, Common::TTraitInt<Common::TIsTriviallyRelocatable<ElementType>::Value>());
 
-				this->m_mem_block = new_elements;
 				this->m_capacity = new_capacity;
 				this->m_version++;
 			}
@@ -706,21 +809,24 @@ namespace Forge {
 
 				this->ReserveCapacity(this->m_count + 1);
 
-				ElementType next, prev;
+				ElementTypePtr ptr = this->m_mem_block + this->m_count;
 
-				ElementTypePtr ptr = this->m_mem_block + index;
+				if (index < this->m_count)
+				{
+					// The past-end slot is raw memory and has to be constructed,
+					// the remaining slots are shifted by move assignment.
+					new (ptr) ElementType(Move(*(ptr - 1)));
 
-				prev = *ptr;
+					for (ptr--; ptr != this->m_mem_block + index; ptr--)
+						*ptr = Move(*(ptr - 1));
 
-				for (I32 i = 0;  i < this->m_count - index; i++)
+					*ptr = Move(element);
+				}
+				else
 				{
-					next = *(++ptr);
-					*ptr = prev;
-					prev = next;
+					new (ptr) ElementType(Move(element));
 				}
 
-				Memory::Move(this->m_mem_block + index, Move(element), 1);
-
 				this->m_count++;
 			}
 
@@ -757,21 +863,24 @@ namespace Forge {
 					return;
 
 				this->ReserveCapacity(this->m_count + 1);
-				
-				ElementType next, prev;
 
-				ElementTypePtr ptr = this->m_mem_block + index;
-				
-				prev = *ptr;
-				
-				for (I32 i = 0;  i < this->m_count - index; i++)
+				ElementTypePtr ptr = this->m_mem_block + this->m_count;
+
+				if (index < this->m_count)
 				{
-					next = *(++ptr);
-					*ptr = prev;
-					prev = next;
-				}
+					// The past-end slot is raw memory and has to be constructed,
+					// the remaining slots are shifted by move assignment.
+					new (ptr) ElementType(Move(*(ptr - 1)));
 
-				Memory::Copy(this->m_mem_block + index, element, 1);
+					for (ptr--; ptr != this->m_mem_block + index; ptr--)
+						*ptr = Move(*(ptr - 1));
+
+					*ptr = element;
+				}
+				else
+				{
+					new (ptr) ElementType(element);
+				}
 
 				this->m_count++;
 			}
@@ -805,14 +914,14 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				ElementTypePtr slow_ptr = this->m_mem_block + index;
-				ElementTypePtr fast_ptr = this->m_mem_block + index + 1;
+				ElementTypePtr ptr = this->m_mem_block + index;
+				ElementTypePtr end = this->m_mem_block + this->m_count - 1;
+
+				for (; ptr != end; ptr++)
+					*ptr = Move(*(ptr + 1));
 
-				Memory::Destruct(this->m_mem_block + index, 1);
+				Memory::Destruct(end, 1);
 
-				for (I32 i = 0; i < this->m_count - index; i++)
-					*(slow_ptr++) = *(fast_ptr++);
-				
 				this->m_count--;
 			}
 
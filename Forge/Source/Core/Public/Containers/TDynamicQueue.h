@@ -323,7 +323,7 @@ namespace Forge {
 					this->m_head->m_prev = nullptr;
 				}
 
-				free(curr_node);
+				delete curr_node;
 
 				this->m_count--;
 			}
@@ -497,7 +497,28 @@ namespace Forge {
 			 *
 			 * @param[in] function The function to perform on each element.
 			 */
-			Void ForEach(Common::TDelegate<Void(ElementTypeRef)> function) override
+			Void ForEach(Common::TFunctionRef<Void(ElementTypeRef)> function) override
+			{
+				if (this->IsEmpty())
+				{
+					// Throw Exception
+				}
+
+				for (EntryNode* curr_node = this->m_head; curr_node; curr_node = curr_node->m_next)
+					function.Invoke(curr_node->m_data);
+			}
+
+			/**
+			 * @brief Iterates through all the elements inside the collection and
+			 * performs the operation provided on each element.
+			 *
+			 * The operation is performed in the order of iteration, and is performed
+			 * until all elements have been processed or the operation throws an
+			 * exception.
+			 *
+			 * @param[in] function The function to perform on each element.
+			 */
+			Void ForEach(Common::TFunctionRef<Void(ConstElementTypeRef)> function) const override
 			{
 				if (this->IsEmpty())
 				{
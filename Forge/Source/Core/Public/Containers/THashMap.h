@@ -0,0 +1,195 @@
+#ifndef T_HASH_MAP_H
+#define T_HASH_MAP_H
+
+#include "THashTable.h"
+
+#include "Core/Public/Common/TypeDefinitions.h"
+#include "Core/Public/Algorithm/Hash/THash.h"
+
+namespace Forge {
+	namespace Containers
+	{
+		/**
+		 * @brief A key-value pair stored by THashMap.
+		 *
+		 * The key must not be modified while the entry is stored in a map.
+		 */
+		template<typename InKeyType, typename InValueType>
+		struct THashMapEntry
+		{
+		public:
+			InKeyType   m_key;
+			InValueType m_value;
+
+		public:
+			template<typename... InArgs>
+			THashMapEntry(const InKeyType& key, InArgs&&... args)
+				: m_key(key), m_value(Algorithm::Forward<InArgs>(args)...) {}
+		};
+
+		namespace Internal
+		{
+			template<typename InKeyType, typename InValueType>
+			struct THashMapKeyTraits
+			{
+				static const InKeyType& GetKey(const THashMapEntry<InKeyType, InValueType>& entry)
+				{
+					return entry.m_key;
+				}
+			};
+		}
+
+		/**
+		 * @brief An unordered associative container mapping unique keys to
+		 * values.
+		 *
+		 * THashMap is an open addressing Robin Hood hash table, entries are
+		 * stored inline in a single allocation rather than in per-node
+		 * allocations, so lookups touch at most a couple of cache lines.
+		 * Growing or removing moves entries, therefore pointers to values
+		 * are only valid until the next insertion or removal.
+		 *
+		 * Memory is obtained from the allocator passed on construction, or
+		 * from the C heap if none is provided.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InKeyType, typename InValueType, typename InHasher = Algorithms::THash<InKeyType>>
+		class THashMap final : public Internal::THashTable<InKeyType, THashMapEntry<InKeyType, InValueType>,
+														   Internal::THashMapKeyTraits<InKeyType, InValueType>, InHasher>
+		{
+		public:
+			using KeyType          = InKeyType;
+			using ValueType        = InValueType;
+			using ValueTypePtr     = InValueType*;
+			using ValueTypeRef     = InValueType&;
+			using ConstKeyTypeRef  = const InKeyType&;
+			using ConstValueTypePtr = const InValueType*;
+			using ConstValueTypeRef = const InValueType&;
+
+		private:
+			using BaseType = Internal::THashTable<InKeyType, THashMapEntry<InKeyType, InValueType>,
+												  Internal::THashMapKeyTraits<InKeyType, InValueType>, InHasher>;
+
+		public:
+			/**
+			 * @brief Default constructor.
+			 *
+			 * Constructs an empty hash map, no memory is allocated until the
+			 * first insertion.
+			 *
+			 * @param[in] allocator The allocator to obtain memory from, or
+			 * nullptr to use the C heap.
+			 */
+			THashMap(Memory::AbstractAllocator* allocator = nullptr)
+				: BaseType(allocator) {}
+
+		public:
+			/**
+			 * @brief Inserts a key-value pair if the key is not already stored
+			 * in this map.
+			 *
+			 * @param[in] key   The key to insert.
+			 * @param[in] value The value to associate with the key.
+			 *
+			 * @return True if the pair was inserted, false if the key was
+			 * already present and its value was left untouched.
+			 */
+			Bool Insert(ConstKeyTypeRef key, ConstValueTypeRef value)
+			{
+				Bool is_inserted;
+				this->FindOrEmplace(key, is_inserted, value);
+
+				return is_inserted;
+			}
+
+			/**
+			 * @brief Inserts a key-value pair if the key is not already stored
+			 * in this map.
+			 *
+			 * @param[in] key   The key to insert.
+			 * @param[in] value The value to move into the map.
+			 *
+			 * @return True if the pair was inserted, false if the key was
+			 * already present and its value was left untouched.
+			 */
+			Bool Insert(ConstKeyTypeRef key, InValueType&& value)
+			{
+				Bool is_inserted;
+				this->FindOrEmplace(key, is_inserted, Algorithm::Move(value));
+
+				return is_inserted;
+			}
+
+			/**
+			 * @brief Inserts a key-value pair or overwrites the value of an
+			 * already stored key.
+			 *
+			 * @param[in] key   The key to insert.
+			 * @param[in] value The value to associate with the key.
+			 *
+			 * @return True if the pair was inserted, false if an existing value
+			 * was overwritten.
+			 */
+			Bool InsertOrAssign(ConstKeyTypeRef key, ConstValueTypeRef value)
+			{
+				Bool is_inserted;
+				auto entry = this->FindOrEmplace(key, is_inserted, value);
+
+				if (!is_inserted)
+					entry->m_value = value;
+
+				return is_inserted;
+			}
+
+		public:
+			/**
+			 * @brief Finds the value associated with the specified key.
+			 *
+			 * @param[in] key The key to search for.
+			 *
+			 * @return ValueTypePtr storing the address of the value, or nullptr
+			 * if the key was not found.
+			 */
+			ValueTypePtr Find(ConstKeyTypeRef key)
+			{
+				Size index = this->FindIndex(key);
+
+				return index != this->m_capacity ? &this->m_entries[index].m_value : nullptr;
+			}
+
+			/**
+			 * @brief Finds the value associated with the specified key.
+			 *
+			 * @param[in] key The key to search for.
+			 *
+			 * @return ConstValueTypePtr storing the address of the value, or
+			 * nullptr if the key was not found.
+			 */
+			ConstValueTypePtr Find(ConstKeyTypeRef key) const
+			{
+				Size index = this->FindIndex(key);
+
+				return index != this->m_capacity ? &this->m_entries[index].m_value : nullptr;
+			}
+
+		public:
+			/**
+			 * @brief Gets the value associated with the specified key, inserting
+			 * a default constructed value if the key is not present.
+			 *
+			 * @param[in] key The key to search for.
+			 *
+			 * @return ValueTypeRef storing the associated value.
+			 */
+			ValueTypeRef operator [](ConstKeyTypeRef key)
+			{
+				Bool is_inserted;
+
+				return this->FindOrEmplace(key, is_inserted)->m_value;
+			}
+		};
+	}
+}
+
+#endif // T_HASH_MAP_H
@@ -0,0 +1,79 @@
+#ifndef T_HASH_SET_H
+#define T_HASH_SET_H
+
+#include "THashTable.h"
+
+#include "Core/Public/Common/TypeDefinitions.h"
+#include "Core/Public/Algorithm/Hash/THash.h"
+
+namespace Forge {
+	namespace Containers
+	{
+		namespace Internal
+		{
+			template<typename InKeyType>
+			struct THashSetKeyTraits
+			{
+				static const InKeyType& GetKey(const InKeyType& entry)
+				{
+					return entry;
+				}
+			};
+		}
+
+		/**
+		 * @brief An unordered container storing unique keys.
+		 *
+		 * THashSet shares the Robin Hood hash table of THashMap, keys are
+		 * stored inline in a single allocation and move when the set grows
+		 * or a key is removed.
+		 *
+		 * Memory is obtained from the allocator passed on construction, or
+		 * from the C heap if none is provided.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InKeyType, typename InHasher = Algorithms::THash<InKeyType>>
+		class THashSet final : public Internal::THashTable<InKeyType, InKeyType, Internal::THashSetKeyTraits<InKeyType>, InHasher>
+		{
+		public:
+			using KeyType         = InKeyType;
+			using ConstKeyTypeRef = const InKeyType&;
+
+		private:
+			using BaseType = Internal::THashTable<InKeyType, InKeyType, Internal::THashSetKeyTraits<InKeyType>, InHasher>;
+
+		public:
+			/**
+			 * @brief Default constructor.
+			 *
+			 * Constructs an empty hash set, no memory is allocated until the
+			 * first insertion.
+			 *
+			 * @param[in] allocator The allocator to obtain memory from, or
+			 * nullptr to use the C heap.
+			 */
+			THashSet(Memory::AbstractAllocator* allocator = nullptr)
+				: BaseType(allocator) {}
+
+		public:
+			/**
+			 * @brief Inserts a key if it is not already stored in this set.
+			 *
+			 * @param[in] key The key to insert.
+			 *
+			 * @return True if the key was inserted, false if it was already
+			 * present.
+			 */
+			Bool Insert(ConstKeyTypeRef key)
+			{
+				Bool is_inserted;
+				this->FindOrEmplace(key, is_inserted);
+
+				return is_inserted;
+			}
+		};
+	}
+}
+
+#endif // T_HASH_SET_H
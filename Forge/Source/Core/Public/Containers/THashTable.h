@@ -0,0 +1,723 @@
+#ifndef T_HASH_TABLE_H
+#define T_HASH_TABLE_H
+
+#include <new>
+#include <stdlib.h>
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+#include "Core/Public/Debug/Debug.h"
+#include "Core/Public/Types/TFunctionRef.h"
+
+#include "Core/Public/Memory/AbstractAllocator.h"
+#include "Core/Public/Memory/MemoryUtilities.h"
+
+#include "Core/Public/Algorithm/GeneralUtilities.h"
+
+namespace Forge {
+	namespace Containers
+	{
+		namespace Internal
+		{
+			/**
+			 * @brief Open addressing hash table shared by THashMap and THashSet.
+			 *
+			 * The table uses Robin Hood linear probing: every slot stores the
+			 * distance of its entry from the entry's home slot, and insertion
+			 * keeps entries of a cluster ordered by home slot so that no entry
+			 * is ever further from home than a later one. Lookups stop as soon
+			 * as they reach a slot closer to home than the probed distance,
+			 * which keeps unsuccessful lookups short even at high load factors.
+			 *
+			 * Removal uses backward shifting instead of tombstones, so the
+			 * table never degrades after many insertions and removals.
+			 *
+			 * Entries and their two byte distances live in a single block
+			 * whose capacity is always a power of two. The block is obtained
+			 * from the allocator the table was constructed with, or from the
+			 * C heap if none was provided.
+			 *
+			 * @author Karim Hisham
+			 */
+			template<typename InKeyType, typename InEntryType, typename InKeyTraits, typename InHasher>
+			class THashTable
+			{
+			public:
+				using KeyType          = InKeyType;
+				using ConstKeyTypeRef  = const InKeyType&;
+				using EntryType        = InEntryType;
+				using EntryTypePtr     = InEntryType*;
+				using EntryTypeRef     = InEntryType&;
+				using ConstEntryTypePtr = const InEntryType*;
+				using ConstEntryTypeRef = const InEntryType&;
+
+			public:
+				using SelfType         = THashTable<InKeyType, InEntryType, InKeyTraits, InHasher>;
+				using SelfTypeRef      = SelfType&;
+				using SelfTypeMoveRef  = SelfType&&;
+				using ConstSelfTypeRef = const SelfType&;
+
+			protected:
+				using DistanceType = U16;
+
+				enum : DistanceType
+				{
+					EMPTY_DISTANCE = 0,
+					MAX_DISTANCE   = 0xFFFF
+				};
+
+				enum : Size { MIN_CAPACITY = 16 };
+
+			protected:
+				EntryTypePtr m_entries;
+				DistanceType* m_distances;
+
+			protected:
+				Size m_count;
+				Size m_capacity;
+				Size m_max_count;
+
+			protected:
+				F32 m_max_load_factor;
+
+			protected:
+				InHasher m_hasher;
+				Memory::AbstractAllocator* m_allocator;
+
+			public:
+				template<typename InIteratorEntryType>
+				struct TIterator
+				{
+				private:
+					InIteratorEntryType* m_entries;
+					const DistanceType* m_distances;
+					Size m_index;
+					Size m_capacity;
+
+				public:
+					TIterator(Void)
+						: m_entries(nullptr), m_distances(nullptr), m_index(0), m_capacity(0) {}
+
+					TIterator(InIteratorEntryType* entries, const DistanceType* distances, Size index, Size capacity)
+						: m_entries(entries), m_distances(distances), m_index(index), m_capacity(capacity)
+					{
+						SkipEmptySlots();
+					}
+
+				private:
+					Void SkipEmptySlots(Void)
+					{
+						while (m_index < m_capacity && m_distances[m_index] == EMPTY_DISTANCE)
+							m_index++;
+					}
+
+				public:
+					TIterator operator ++(I32)
+					{
+						TIterator temp(*this);
+
+						m_index++;
+						SkipEmptySlots();
+
+						return temp;
+					}
+					TIterator& operator ++(Void)
+					{
+						m_index++;
+						SkipEmptySlots();
+
+						return *this;
+					}
+
+				public:
+					Bool operator ==(const TIterator& other) const
+					{
+						return m_index == other.m_index;
+					}
+					Bool operator !=(const TIterator& other) const
+					{
+						return m_index != other.m_index;
+					}
+
+				public:
+					InIteratorEntryType& operator *() const
+					{
+						return m_entries[m_index];
+					}
+
+				public:
+					InIteratorEntryType* operator ->() const
+					{
+						return m_entries + m_index;
+					}
+				};
+
+				using Iterator      = TIterator<EntryType>;
+				using ConstIterator = TIterator<const EntryType>;
+
+			public:
+				/**
+				 * @brief Constructs an empty hash table, no memory is allocated
+				 * until the first insertion.
+				 *
+				 * @param[in] allocator The allocator to obtain memory from, or
+				 * nullptr to use the C heap.
+				 */
+				THashTable(Memory::AbstractAllocator* allocator = nullptr)
+					: m_entries(nullptr), m_distances(nullptr), m_count(0), m_capacity(0), m_max_count(0),
+					  m_max_load_factor(0.875f), m_hasher(), m_allocator(allocator) {}
+
+				THashTable(SelfTypeMoveRef other)
+					: m_entries(other.m_entries), m_distances(other.m_distances), m_count(other.m_count),
+					  m_capacity(other.m_capacity), m_max_count(other.m_max_count), m_max_load_factor(other.m_max_load_factor),
+					  m_hasher(Algorithm::Move(other.m_hasher)), m_allocator(other.m_allocator)
+				{
+					other.m_entries   = nullptr;
+					other.m_distances = nullptr;
+					other.m_count     = other.m_capacity = other.m_max_count = 0;
+				}
+
+				THashTable(ConstSelfTypeRef other)
+					: m_entries(nullptr), m_distances(nullptr), m_count(0), m_capacity(0), m_max_count(0),
+					  m_max_load_factor(other.m_max_load_factor), m_hasher(other.m_hasher), m_allocator(other.m_allocator)
+				{
+					CopyFrom(other);
+				}
+
+			public:
+			   ~THashTable()
+				{
+					Clear();
+					FreeStorage(m_entries);
+				}
+
+			public:
+				SelfTypeRef operator =(SelfTypeMoveRef other)
+				{
+					if (this == &other)
+						return *this;
+
+					Clear();
+					FreeStorage(m_entries);
+
+					m_entries         = other.m_entries;
+					m_distances       = other.m_distances;
+					m_count           = other.m_count;
+					m_capacity        = other.m_capacity;
+					m_max_count       = other.m_max_count;
+					m_max_load_factor = other.m_max_load_factor;
+					m_hasher          = Algorithm::Move(other.m_hasher);
+					m_allocator       = other.m_allocator;
+
+					other.m_entries   = nullptr;
+					other.m_distances = nullptr;
+					other.m_count     = other.m_capacity = other.m_max_count = 0;
+
+					return *this;
+				}
+
+				SelfTypeRef operator =(ConstSelfTypeRef other)
+				{
+					if (this == &other)
+						return *this;
+
+					Clear();
+
+					m_max_load_factor = other.m_max_load_factor;
+					m_hasher          = other.m_hasher;
+
+					CopyFrom(other);
+
+					return *this;
+				}
+
+			private:
+				VoidPtr AllocateStorage(Size size)
+				{
+					if (m_allocator)
+						return m_allocator->Allocate(size, static_cast<Byte>(alignof(EntryType) > 8 ? alignof(EntryType) : 8));
+
+					return malloc(size);
+				}
+
+				Void FreeStorage(VoidPtr address)
+				{
+					if (!address)
+						return;
+
+					if (m_allocator)
+						m_allocator->Deallocate(address);
+					else
+						free(address);
+				}
+
+				Void CopyFrom(ConstSelfTypeRef other)
+				{
+					if (!other.m_count)
+						return;
+
+					// Both tables hash keys identically, so slots can be copied
+					// one to one without rehashing when capacities match.
+					if (m_capacity != other.m_capacity)
+					{
+						FreeStorage(m_entries);
+						AllocateTable(other.m_capacity);
+					}
+
+					for (Size i = 0; i < m_capacity; i++)
+					{
+						if (other.m_distances[i] != EMPTY_DISTANCE)
+							new (m_entries + i) EntryType(other.m_entries[i]);
+
+						m_distances[i] = other.m_distances[i];
+					}
+
+					m_count     = other.m_count;
+					m_max_count = static_cast<Size>(static_cast<F32>(m_capacity) * m_max_load_factor);
+				}
+
+				Void AllocateTable(Size capacity)
+				{
+					m_entries   = reinterpret_cast<EntryTypePtr>(AllocateStorage(capacity * (sizeof(EntryType) + sizeof(DistanceType))));
+					m_distances = reinterpret_cast<DistanceType*>(m_entries + capacity);
+					m_capacity  = capacity;
+					m_max_count = static_cast<Size>(static_cast<F32>(capacity) * m_max_load_factor);
+
+					Memory::MemorySet(m_distances, EMPTY_DISTANCE, capacity * sizeof(DistanceType));
+				}
+
+				Void Rehash(Size capacity)
+				{
+					EntryTypePtr old_entries   = m_entries;
+					DistanceType* old_distances = m_distances;
+					Size         old_capacity  = m_capacity;
+
+					AllocateTable(capacity);
+
+					for (Size i = 0; i < old_capacity; i++)
+					{
+						if (old_distances[i] == EMPTY_DISTANCE)
+							continue;
+
+						InsertUnique(Algorithm::Move(old_entries[i]));
+						old_entries[i].~EntryType();
+					}
+
+					FreeStorage(old_entries);
+				}
+
+				Void Grow(Void)
+				{
+					Rehash(m_capacity ? m_capacity << 1 : static_cast<Size>(MIN_CAPACITY));
+				}
+
+				/**
+				 * Places an entry known to be absent from the table, used while
+				 * rehashing where no duplicate checks are needed.
+				 */
+				Void InsertUnique(EntryType&& entry)
+				{
+					Size mask  = m_capacity - 1;
+					Size index = static_cast<Size>(m_hasher(InKeyTraits::GetKey(entry))) & mask;
+					DistanceType distance = 1;
+
+					while (m_distances[index] >= distance)
+					{
+						index = (index + 1) & mask;
+						distance++;
+					}
+
+					// Robin Hood: the entry steals the slot of the first entry
+					// closer to its home, which is then shifted one slot ahead.
+					ShiftForward(index);
+
+					new (m_entries + index) EntryType(Algorithm::Move(entry));
+					m_distances[index] = distance;
+				}
+
+				/**
+				 * Moves the run of entries starting at index one slot forward
+				 * up to the next empty slot, leaving index vacant.
+				 */
+				Void ShiftForward(Size index)
+				{
+					Size mask = m_capacity - 1;
+					Size last = index;
+
+					while (m_distances[last] != EMPTY_DISTANCE)
+						last = (last + 1) & mask;
+
+					while (last != index)
+					{
+						Size previous = (last - 1) & mask;
+
+						new (m_entries + last) EntryType(Algorithm::Move(m_entries[previous]));
+						m_entries[previous].~EntryType();
+
+						m_distances[last] = static_cast<DistanceType>(m_distances[previous] + 1);
+						last = previous;
+					}
+				}
+
+				/**
+				 * Checks whether shifting the run at index forward would push an
+				 * entry beyond the maximum representable probe distance.
+				 */
+				Bool WouldOverflow(Size index, DistanceType distance) const
+				{
+					if (distance >= MAX_DISTANCE)
+						return true;
+
+					Size mask = m_capacity - 1;
+
+					for (; m_distances[index] != EMPTY_DISTANCE; index = (index + 1) & mask)
+					{
+						if (m_distances[index] >= MAX_DISTANCE - 1)
+							return true;
+					}
+
+					return false;
+				}
+
+			protected:
+				/**
+				 * @brief Finds the slot storing the specified key.
+				 *
+				 * @return Size storing the slot index, or the table capacity if
+				 * the key is not in the table.
+				 */
+				Size FindIndex(ConstKeyTypeRef key) const
+				{
+					if (!m_count)
+						return m_capacity;
+
+					Size mask  = m_capacity - 1;
+					Size index = static_cast<Size>(m_hasher(key)) & mask;
+					DistanceType distance = 1;
+
+					for (;;)
+					{
+						DistanceType slot_distance = m_distances[index];
+
+						// Entries of a cluster are ordered by home slot, a slot
+						// closer to its home than the probe means the key would
+						// have been placed before it.
+						if (slot_distance < distance)
+							return m_capacity;
+
+						if (slot_distance == distance && InKeyTraits::GetKey(m_entries[index]) == key)
+							return index;
+
+						index = (index + 1) & mask;
+						distance++;
+					}
+				}
+
+				/**
+				 * @brief Finds the entry storing the specified key or constructs
+				 * a new one from the key and the specified arguments.
+				 *
+				 * @param[in]  key         The key of the entry.
+				 * @param[out] is_inserted Set to true if a new entry was created.
+				 * @param[in]  args        The arguments following the key passed
+				 * to the entry constructor.
+				 *
+				 * @return EntryTypePtr storing the address of the entry, which
+				 * stays valid until the next insertion or removal.
+				 */
+				template<typename... InArgs>
+				EntryTypePtr FindOrEmplace(ConstKeyTypeRef key, Bool& is_inserted, InArgs&&... args)
+				{
+					if (!m_capacity)
+						Grow();
+
+					Bool is_grown_for_overflow = false;
+
+					for (;;)
+					{
+						Size mask  = m_capacity - 1;
+						Size index = static_cast<Size>(m_hasher(key)) & mask;
+						DistanceType distance = 1;
+
+						while (m_distances[index] >= distance)
+						{
+							if (m_distances[index] == distance && InKeyTraits::GetKey(m_entries[index]) == key)
+							{
+								is_inserted = false;
+								return m_entries + index;
+							}
+
+							index = (index + 1) & mask;
+							distance++;
+						}
+
+						if (m_count >= m_max_count)
+						{
+							Grow();
+							continue;
+						}
+
+						// Pathological clusters are broken up by growing the
+						// table, unless the keys share their hash so growing
+						// can not spread them.
+						if (WouldOverflow(index, distance))
+						{
+							if (is_grown_for_overflow)
+								FORGE_EXCEPT(Debug::ExceptionType::FORGE_INVALID_OPERATION, "Too many keys of the hash table share a hash.")
+
+							is_grown_for_overflow = true;
+
+							Grow();
+							continue;
+						}
+
+						ShiftForward(index);
+
+						new (m_entries + index) EntryType(key, Algorithm::Forward<InArgs>(args)...);
+						m_distances[index] = distance;
+						m_count++;
+
+						is_inserted = true;
+						return m_entries + index;
+					}
+				}
+
+				/**
+				 * @brief Destroys the entry at the specified slot and shifts the
+				 * following entries of its cluster one slot back.
+				 */
+				Void RemoveIndex(Size index)
+				{
+					Size mask = m_capacity - 1;
+					Size next = (index + 1) & mask;
+
+					m_entries[index].~EntryType();
+
+					while (m_distances[next] > 1)
+					{
+						new (m_entries + index) EntryType(Algorithm::Move(m_entries[next]));
+						m_entries[next].~EntryType();
+
+						m_distances[index] = static_cast<DistanceType>(m_distances[next] - 1);
+
+						index = next;
+						next  = (next + 1) & mask;
+					}
+
+					m_distances[index] = EMPTY_DISTANCE;
+					m_count--;
+				}
+
+			public:
+				/**
+				 * @brief Checks whether this table stores no entries.
+				 *
+				 * @return True if this table is empty.
+				 */
+				Bool IsEmpty(Void) const
+				{
+					return m_count == 0;
+				}
+
+				/**
+				 * @brief Gets the number of entries stored in this table.
+				 *
+				 * @return Size storing the number of entries.
+				 */
+				Size GetCount(Void) const
+				{
+					return m_count;
+				}
+
+				/**
+				 * @brief Gets the number of slots allocated by this table.
+				 *
+				 * @return Size storing the number of slots.
+				 */
+				Size GetCapacity(Void) const
+				{
+					return m_capacity;
+				}
+
+				/**
+				 * @brief Gets the ratio of occupied slots to allocated slots.
+				 *
+				 * @return F32 storing the current load factor.
+				 */
+				F32 GetLoadFactor(Void) const
+				{
+					return m_capacity ? static_cast<F32>(m_count) / static_cast<F32>(m_capacity) : 0.0f;
+				}
+
+				/**
+				 * @brief Gets the load factor this table grows at.
+				 *
+				 * @return F32 storing the maximum load factor.
+				 */
+				F32 GetMaxLoadFactor(Void) const
+				{
+					return m_max_load_factor;
+				}
+
+				/**
+				 * @brief Sets the load factor this table grows at, the table is
+				 * rehashed if it is already beyond the new maximum.
+				 *
+				 * Robin Hood probing keeps lookups short up to high load factors,
+				 * values are clamped to the range [0.25, 0.95].
+				 *
+				 * @param[in] max_load_factor The new maximum load factor.
+				 */
+				Void SetMaxLoadFactor(F32 max_load_factor)
+				{
+					m_max_load_factor = max_load_factor < 0.25f ? 0.25f : (max_load_factor > 0.95f ? 0.95f : max_load_factor);
+					m_max_count       = static_cast<Size>(static_cast<F32>(m_capacity) * m_max_load_factor);
+
+					if (m_capacity && m_count >= m_max_count)
+						Reserve(m_count + 1);
+				}
+
+				/**
+				 * @brief Gets the allocator this table obtains memory from.
+				 *
+				 * @return Memory::AbstractAllocator* storing the allocator, or
+				 * nullptr if the C heap is used.
+				 */
+				Memory::AbstractAllocator* GetAllocator(Void) const
+				{
+					return m_allocator;
+				}
+
+			public:
+				/**
+				 * @brief Requests that this table can store the specified number
+				 * of entries without growing.
+				 *
+				 * @param[in] count The number of entries to make room for.
+				 */
+				Void Reserve(Size count)
+				{
+					Size capacity = MIN_CAPACITY;
+
+					while (static_cast<Size>(static_cast<F32>(capacity) * m_max_load_factor) <= count)
+						capacity <<= 1;
+
+					if (capacity > m_capacity)
+						Rehash(capacity);
+				}
+
+			public:
+				Iterator GetStartItr(Void)
+				{
+					return Iterator(m_entries, m_distances, 0, m_capacity);
+				}
+				Iterator GetEndItr(Void)
+				{
+					return Iterator(m_entries, m_distances, m_capacity, m_capacity);
+				}
+
+				ConstIterator GetStartItr(Void) const
+				{
+					return ConstIterator(m_entries, m_distances, 0, m_capacity);
+				}
+				ConstIterator GetEndItr(Void) const
+				{
+					return ConstIterator(m_entries, m_distances, m_capacity, m_capacity);
+				}
+
+				Iterator begin(Void) { return GetStartItr(); }
+				Iterator end(Void) { return GetEndItr(); }
+
+				ConstIterator begin(Void) const { return GetStartItr(); }
+				ConstIterator end(Void) const { return GetEndItr(); }
+
+			public:
+				/**
+				 * @brief Iterates through all the entries inside the table and
+				 * performs the operation provided on each entry.
+				 *
+				 * The iteration order is unspecified and changes when the table
+				 * grows.
+				 *
+				 * @param[in] function The function to perform on each entry.
+				 */
+				Void ForEach(TFunctionRef<Void(EntryTypeRef)> function)
+				{
+					for (Size i = 0; i < m_capacity; i++)
+						if (m_distances[i] != EMPTY_DISTANCE)
+							function.Invoke(m_entries[i]);
+				}
+
+				/**
+				 * @brief Iterates through all the entries inside the table and
+				 * performs the operation provided on each entry.
+				 *
+				 * The iteration order is unspecified and changes when the table
+				 * grows.
+				 *
+				 * @param[in] function The function to perform on each entry.
+				 */
+				Void ForEach(TFunctionRef<Void(ConstEntryTypeRef)> function) const
+				{
+					for (Size i = 0; i < m_capacity; i++)
+						if (m_distances[i] != EMPTY_DISTANCE)
+							function.Invoke(m_entries[i]);
+				}
+
+			public:
+				/**
+				 * @brief Checks whether an entry with the specified key is
+				 * stored in this table.
+				 *
+				 * @param[in] key The key to search for.
+				 *
+				 * @return True if the key was found.
+				 */
+				Bool Contains(ConstKeyTypeRef key) const
+				{
+					return FindIndex(key) != m_capacity;
+				}
+
+				/**
+				 * @brief Removes the entry with the specified key.
+				 *
+				 * @param[in] key The key of the entry to remove.
+				 *
+				 * @return True if the key was found and removed.
+				 */
+				Bool Remove(ConstKeyTypeRef key)
+				{
+					Size index = FindIndex(key);
+
+					if (index == m_capacity)
+						return false;
+
+					RemoveIndex(index);
+
+					return true;
+				}
+
+				/**
+				 * @brief Removes all the entries from this table, the allocated
+				 * slots are kept for reuse.
+				 */
+				Void Clear(Void)
+				{
+					if (!m_count)
+						return;
+
+					for (Size i = 0; i < m_capacity; i++)
+					{
+						if (m_distances[i] != EMPTY_DISTANCE)
+							m_entries[i].~EntryType();
+					}
+
+					Memory::MemorySet(m_distances, EMPTY_DISTANCE, m_capacity * sizeof(DistanceType));
+					m_count = 0;
+				}
+			};
+		}
+	}
+}
+
+#endif // T_HASH_TABLE_H
@@ -510,7 +510,30 @@ namespace Forge {
 			 * 
 			 * @throws InvalidOperationException if collection is empty.
 			 */
-			Void ForEach(Common::TDelegate<Void(ElementTypeRef)> function) override
+			Void ForEach(Common::TFunctionRef<Void(ElementTypeRef)> function) override
+			{
+				if (this->IsEmpty())
+				{
+					// Throw Exception
+				}
+
+				for (EntryNode* curr_node = this->m_head; curr_node; curr_node = curr_node->m_next)
+					function.Invoke(curr_node->m_data);
+			}
+
+			/**
+			 * @brief Iterates through all the elements inside the collection and
+			 * performs the operation provided on each element.
+			 *
+			 * The operation is performed in the order of iteration, and is performed
+			 * until all elements have been processed or the operation throws an
+			 * exception.
+			 *
+			 * @param[in] function The function to perform on each element.
+			 * 
+			 * @throws InvalidOperationException if collection is empty.
+			 */
+			Void ForEach(Common::TFunctionRef<Void(ConstElementTypeRef)> function) const override
 			{
 				if (this->IsEmpty())
 				{
@@ -747,10 +770,24 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				EntryNode* curr_node = this->m_head;
+				EntryNode* curr_node;
 
-				while (curr_node->m_next && (index--) > 0)
-					curr_node = curr_node->m_next;
+				// Walk from whichever end is closer, so that removing from the
+				// back, as PopBack and Clear do, takes constant time.
+				if (index < this->m_count / 2)
+				{
+					curr_node = this->m_head;
+
+					while (curr_node->m_next && (index--) > 0)
+						curr_node = curr_node->m_next;
+				}
+				else
+				{
+					curr_node = this->m_tail;
+
+					for (Size i = this->m_count - 1; curr_node->m_prev && i > index; i--)
+						curr_node = curr_node->m_prev;
+				}
 
 				EntryNode* next_node = curr_node->m_next;
 				EntryNode* prev_node = curr_node->m_prev;
@@ -775,7 +812,7 @@ namespace Forge {
 					next_node->m_prev = prev_node;
 				}
 
-				free(curr_node);
+				delete curr_node;
 
 				this->m_count--;
 			}
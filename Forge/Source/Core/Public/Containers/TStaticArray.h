@@ -416,7 +416,7 @@ namespace Forge {
 			 */
 			Iterator GetEndItr(void)
 			{
-				return Iterator(const_cast<ElementTypePtr>(this->m_mem_block + this->m_count - 1));
+				return Iterator(const_cast<ElementTypePtr>(this->m_mem_block + this->m_count));
 			}
 
 			/**
@@ -438,7 +438,7 @@ namespace Forge {
 			 */
 			ConstIterator GetEndConstItr(void) const
 			{
-				return ConstIterator(const_cast<ElementTypePtr>(this->m_mem_block + this->m_count - 1));
+				return ConstIterator(const_cast<ElementTypePtr>(this->m_mem_block + this->m_count));
 			}
 
 		public:
@@ -535,7 +535,23 @@ namespace Forge {
 		     *
 		     * @param[in] function The function to perform on each element.
 		     */
-			Void ForEach(Common::TDelegate<Void(ElementTypeRef)> function) override
+			Void ForEach(Common::TFunctionRef<Void(ElementTypeRef)> function) override
+			{
+				for (I32 i = 0; i < this->m_count; i++)
+					function.Invoke(*(this->m_mem_block + i));
+			}
+
+			/**
+		     * @brief Iterates through all the elements inside the collection and
+		     * performs the operation provided on each element.
+		     *
+		     * The operation is performed in the order of iteration, and is performed
+		     * until all elements have been processed or the operation throws an
+		     * exception.
+		     *
+		     * @param[in] function The function to perform on each element.
+		     */
+			Void ForEach(Common::TFunctionRef<Void(ConstElementTypeRef)> function) const override
 			{
 				for (I32 i = 0; i < this->m_count; i++)
 					function.Invoke(*(this->m_mem_block + i));
@@ -623,18 +639,14 @@ namespace Forge {
 					// Throw Exception
 				}
 					
-				ElementType next, prev;
-
-				ElementTypePtr ptr = this->m_mem_block + index;
+				// Slots of a static array are always constructed, elements are
+				// shifted by move assignment.
+				ElementTypePtr ptr = this->m_mem_block + this->m_count;
 
-				for (I32 i = 0, prev = *ptr; i < this->m_count - index; i++)
-				{
-					next = *(++ptr);
-					*ptr = prev;
-					prev = next;
-				}
+				for (; ptr != this->m_mem_block + index; ptr--)
+					*ptr = std::move(*(ptr - 1));
 
-				Memory::Move(this->m_mem_block + index, std::move(element), 1);
+				*ptr = std::move(element);
 
 				this->m_count++;
 			}
@@ -668,18 +680,14 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				ElementType next, prev;
+				// Slots of a static array are always constructed, elements are
+				// shifted by move assignment.
+				ElementTypePtr ptr = this->m_mem_block + this->m_count;
 
-				ElementTypePtr ptr = this->m_mem_block + index;
-
-				for (I32 i = 0, prev = *ptr; i < this->m_count - index; i++)
-				{
-					next = *(++ptr);
-					*ptr = prev;
-					prev = next;
-				}
+				for (; ptr != this->m_mem_block + index; ptr--)
+					*ptr = std::move(*(ptr - 1));
 
-				Memory::Copy(this->m_mem_block + index, element, 1);
+				*ptr = element;
 
 				this->m_count++;
 			}
@@ -713,13 +721,11 @@ namespace Forge {
 					// Throw Exception
 				}
 
-				ElementTypePtr slow_ptr = this->m_mem_block + index;
-				ElementTypePtr fast_ptr = this->m_mem_block + index + 1;
-				
-				Memory::Destruct(this->m_mem_block + index, 1);
+				ElementTypePtr ptr = this->m_mem_block + index;
+				ElementTypePtr end = this->m_mem_block + this->m_count - 1;
 
-				for (I32 i = 0; i < this->m_count - index; i++)
-					*(slow_ptr++) = *(fast_ptr++);
+				for (; ptr != end; ptr++)
+					*ptr = std::move(*(ptr + 1));
 
 				this->m_count--;
 			}
@@ -503,7 +503,23 @@ namespace Forge {
 			 *
 			 * @param[in] function The function to perform on each element.
 			 */
-			Void ForEach(Common::TDelegate<Void(ElementTypeRef)> function) override
+			Void ForEach(Common::TFunctionRef<Void(ElementTypeRef)> function) override
+			{
+				for (I32 i = 0; i < this->m_count; i++)
+					function.Invoke(*(this->m_mem_block + i));
+			}
+
+			/**
+			 * @brief Iterates through all the elements inside the collection and
+			 * performs the operation provided on each element.
+			 *
+			 * The operation is performed in the order of iteration, and is performed
+			 * until all elements have been processed or the operation throws an
+			 * exception.
+			 *
+			 * @param[in] function The function to perform on each element.
+			 */
+			Void ForEach(Common::TFunctionRef<Void(ConstElementTypeRef)> function) const override
 			{
 				for (I32 i = 0; i < this->m_count; i++)
 					function.Invoke(*(this->m_mem_block + i));
@@ -15,6 +15,17 @@ namespace Forge {
 	}
 }
 
+namespace Forge {
+	namespace Common
+	{
+		template<typename T>
+		class TSharedPtr;
+
+		template<typename T>
+		class TWeakPtr;
+	}
+}
+
 namespace Forge {
 	namespace RTTI
 	{
@@ -22,13 +33,15 @@ namespace Forge {
 		class AbstractObjectFactory;
 
 		class TypeInfo;
-		class RefCounted;
 
-		template<typename T>
-		class TSharedPtr;
+		struct AtomicRefCountPolicy;
+		struct NonAtomicRefCountPolicy;
 
-		template<typename T>
-		class TWeakPtr;
+		template<typename InPolicy>
+		struct TRefCount;
+
+		using Common::TSharedPtr;
+		using Common::TWeakPtr;
 	}
 }
 
@@ -3,6 +3,7 @@
 
 #include <Core/Public/Debug/Exception/Exception.h>
 #include <Core/Public/Debug/Exception/ExceptionFactory.h>
+#include <Core/Public/Debug/Profiler.h>
 
 #include <Core/Public/Debug/Exception/Exceptions/IOException.h>
 #include <Core/Public/Debug/Exception/Exceptions/TimeoutException.h>
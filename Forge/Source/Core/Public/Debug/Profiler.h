@@ -0,0 +1,378 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <mutex>
+#include <atomic>
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+#include "Core/Public/Common/PreprocessorUtilities.h"
+#include "Core/Public/Types/Singleton.h"
+
+#if defined(FORGE_COMPILER_MSVC)
+	#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+#else
+	#include <chrono>
+#endif
+
+/**
+ * Profiling zones are compiled in unless the build defines
+ * FORGE_ENABLE_PROFILER to FORGE_FALSE, in which case the macros below
+ * expand to nothing.
+ */
+#if !defined(FORGE_ENABLE_PROFILER)
+	#define FORGE_ENABLE_PROFILER FORGE_TRUE
+#endif
+
+#if FORGE_ENABLE_PROFILER
+	#define FORGE_PROFILE_SCOPE(__NAME__)                                                                                   \
+		static const Forge::Debug::ProfileZone FORGE_CONCATENATE(forge_profile_zone_, __LINE__)(__NAME__, __FILE__, __LINE__); \
+		Forge::Debug::ProfileScope FORGE_CONCATENATE(forge_profile_scope_, __LINE__)(&FORGE_CONCATENATE(forge_profile_zone_, __LINE__));
+
+	#define FORGE_PROFILE_FUNCTION() FORGE_PROFILE_SCOPE(FORGE_FUNC_LITERAL)
+#else
+	#define FORGE_PROFILE_SCOPE(__NAME__)
+	#define FORGE_PROFILE_FUNCTION()
+#endif
+
+namespace Forge {
+	namespace Debug
+	{
+		/**
+		 * @brief Static description of an instrumented code region.
+		 *
+		 * Zones are declared once per FORGE_PROFILE_SCOPE site and register
+		 * themselves in a lock-free list on first use, so events only need to
+		 * carry a pointer to them.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API ProfileZone
+		{
+		private:
+			const Char* m_name;
+			const Char* m_file;
+			U32 m_line;
+			U32 m_id;
+
+		private:
+			const ProfileZone* m_next;
+
+		private:
+			friend class Profiler;
+
+		public:
+			/**
+			 * @brief Constructs and registers a profile zone.
+			 *
+			 * @param[in] name The display name of the zone, must outlive the
+			 * profiler.
+			 * @param[in] file The source file the zone is declared in.
+			 * @param[in] line The source line the zone is declared at.
+			 */
+			ProfileZone(const Char* name, const Char* file, U32 line);
+
+		public:
+			/**
+			 * @brief Gets the display name of the zone.
+			 *
+			 * @return const Char* storing the zone name.
+			 */
+			const Char* GetName(Void) const;
+
+			/**
+			 * @brief Gets the source file the zone is declared in.
+			 *
+			 * @return const Char* storing the file path.
+			 */
+			const Char* GetFile(Void) const;
+
+			/**
+			 * @brief Gets the source line the zone is declared at.
+			 *
+			 * @return U32 storing the line number.
+			 */
+			U32 GetLine(Void) const;
+
+			/**
+			 * @brief Gets the unique identifier assigned on registration.
+			 *
+			 * @return U32 storing the zone identifier.
+			 */
+			U32 GetID(Void) const;
+
+			/**
+			 * @brief Gets the zone registered before this one.
+			 *
+			 * @return const ProfileZone* storing the next zone in the list.
+			 */
+			const ProfileZone* GetNext(Void) const;
+		};
+
+		/**
+		 * @brief A single completed zone recorded by a thread.
+		 */
+		struct ProfileEvent
+		{
+			const ProfileZone* m_zone;
+			U64 m_begin_cycles;
+			U64 m_end_cycles;
+			U32 m_depth;
+		};
+
+		/**
+		 * @brief Fixed-size ring of events written by a single thread.
+		 *
+		 * The owning thread is the only writer and publishes events by
+		 * advancing the write index with release semantics. The flushing
+		 * thread is the only reader, events it reads while they are being
+		 * overwritten are detected by re-reading the write index and dropped.
+		 *
+		 * @author Karim Hisham
+		 */
+		struct ProfileThreadBuffer
+		{
+			enum
+			{
+				CAPACITY = 1 << 13,
+				MASK     = CAPACITY - 1
+			};
+
+			std::atomic<U64> m_write_index;
+			U64 m_read_index;
+			U64 m_dropped_events;
+
+			U32 m_thread_index;
+			U32 m_depth;
+
+			ProfileThreadBuffer* m_next;
+
+			ProfileEvent m_events[CAPACITY];
+		};
+
+		/**
+		 * @brief Collects profile events from every thread and exports them.
+		 *
+		 * Each thread records completed zones into its own ring buffer
+		 * without synchronization. Buffers are lazily created on the first
+		 * zone a thread enters and live until the profiler is destroyed.
+		 *
+		 * Flushing drains every buffer and writes either a Chrome trace JSON
+		 * file, loadable in chrome://tracing or Perfetto, or a compact binary
+		 * file for offline tools. A thread that records more than the ring
+		 * capacity between two flushes loses its oldest events.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API Profiler : public TSingleton<Profiler>
+		{
+		FORGE_CLASS_SINGLETON(Profiler)
+
+		public:
+			enum : U32
+			{
+				BINARY_MAGIC   = 0x46525046, // "FPRF"
+				BINARY_VERSION = 1
+			};
+
+		private:
+			std::atomic<Bool> m_is_enabled = { true };
+			std::atomic<U32> m_num_of_threads = { 0 };
+			std::atomic<ProfileThreadBuffer*> m_thread_buffers = { nullptr };
+
+		private:
+			std::mutex m_flush_mutex;
+
+		private:
+			U64 m_start_cycles = ReadCycles();
+			U64 m_start_nanoseconds = ReadNanoseconds();
+
+		private:
+			static std::atomic<U32> s_num_of_zones;
+			static std::atomic<const ProfileZone*> s_zones;
+
+		public:
+		   ~Profiler();
+
+		private:
+			static U64 ReadNanoseconds(Void);
+
+		private:
+			Size DrainThreadBuffer(ProfileThreadBuffer* buffer, ProfileEvent* events);
+
+		public:
+			/**
+			 * @brief Reads the timestamp counter zones are measured with.
+			 *
+			 * @return U64 storing the current cycle count.
+			 */
+			static U64 ReadCycles(Void);
+
+		public:
+			/**
+			 * @brief Gets the calling thread's event buffer, creating and
+			 * registering it on first use.
+			 *
+			 * @return ProfileThreadBuffer* storing the calling thread's buffer.
+			 */
+			ProfileThreadBuffer* GetThreadBuffer(Void);
+
+			/**
+			 * @brief Adds a zone to the list of known zones and assigns it an
+			 * identifier.
+			 *
+			 * @param[in] zone The zone to register.
+			 *
+			 * @return U32 storing the assigned identifier.
+			 */
+			static U32 RegisterZone(ProfileZone* zone);
+
+		public:
+			/**
+			 * @brief Checks whether zones are currently being recorded.
+			 *
+			 * @return Bool true if recording is enabled.
+			 */
+			Bool IsEnabled(Void) const;
+
+			/**
+			 * @brief Enables or disables recording at runtime.
+			 *
+			 * @param[in] is_enabled Whether new zones should be recorded.
+			 */
+			Void SetEnabled(Bool is_enabled);
+
+		public:
+			/**
+			 * @brief Estimates the frequency of the timestamp counter from the
+			 * time elapsed since the profiler was created.
+			 *
+			 * @return U64 storing the number of cycles per second.
+			 */
+			U64 GetCyclesPerSecond(Void);
+
+			/**
+			 * @brief Gets the number of threads that recorded at least one zone.
+			 *
+			 * @return U32 storing the number of thread buffers.
+			 */
+			U32 GetNumOfThreads(Void) const;
+
+			/**
+			 * @brief Gets the number of events lost to ring buffer overruns.
+			 *
+			 * @return U64 storing the number of dropped events.
+			 */
+			U64 GetNumOfDroppedEvents(Void) const;
+
+		public:
+			/**
+			 * @brief Drains every thread buffer into a Chrome trace JSON file.
+			 *
+			 * @param[in] path The path of the file to write.
+			 *
+			 * @return Bool true if the file was written successfully.
+			 */
+			Bool WriteChromeTrace(const Char* path);
+
+			/**
+			 * @brief Drains every thread buffer into a binary trace file.
+			 *
+			 * The file starts with a header of magic, version, cycles per
+			 * second, zone count and thread count. It is followed by the zone
+			 * table, each entry being id, line, name length, name, file length
+			 * and file. Every thread block then stores its index and event
+			 * count followed by zone id, depth, begin and end cycles for each
+			 * event. All values are little-endian.
+			 *
+			 * @param[in] path The path of the file to write.
+			 *
+			 * @return Bool true if the file was written successfully.
+			 */
+			Bool WriteBinaryTrace(const Char* path);
+
+			/**
+			 * @brief Discards every recorded event without writing it.
+			 */
+			Void Clear(Void);
+		};
+
+		/**
+		 * @brief Records the lifetime of a scope as a profile event.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API ProfileScope
+		{
+		private:
+			const ProfileZone* m_zone;
+			ProfileThreadBuffer* m_buffer;
+			U64 m_begin_cycles;
+
+		public:
+			/**
+			 * @brief Opens a zone on the calling thread.
+			 *
+			 * @param[in] zone The zone this scope measures.
+			 */
+			ProfileScope(const ProfileZone* zone);
+
+		public:
+		   ~ProfileScope();
+		};
+
+		FORGE_FORCE_INLINE const Char* ProfileZone::GetName(Void) const { return m_name; }
+		FORGE_FORCE_INLINE const Char* ProfileZone::GetFile(Void) const { return m_file; }
+		FORGE_FORCE_INLINE U32 ProfileZone::GetLine(Void) const { return m_line; }
+		FORGE_FORCE_INLINE U32 ProfileZone::GetID(Void) const { return m_id; }
+		FORGE_FORCE_INLINE const ProfileZone* ProfileZone::GetNext(Void) const { return m_next; }
+
+		FORGE_FORCE_INLINE U64 Profiler::ReadCycles(Void)
+		{
+#if defined(FORGE_COMPILER_MSVC) || defined(__x86_64__) || defined(__i386__)
+			return __rdtsc();
+#else
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+		}
+
+		FORGE_FORCE_INLINE Bool Profiler::IsEnabled(Void) const { return m_is_enabled.load(std::memory_order_relaxed); }
+		FORGE_FORCE_INLINE Void Profiler::SetEnabled(Bool is_enabled) { m_is_enabled.store(is_enabled, std::memory_order_relaxed); }
+		FORGE_FORCE_INLINE U32 Profiler::GetNumOfThreads(Void) const { return m_num_of_threads.load(std::memory_order_acquire); }
+
+		FORGE_FORCE_INLINE ProfileScope::ProfileScope(const ProfileZone* zone)
+			: m_zone(zone), m_buffer(nullptr), m_begin_cycles(0)
+		{
+			Profiler& profiler = Profiler::GetInstance();
+
+			if (!profiler.IsEnabled())
+				return;
+
+			m_buffer = profiler.GetThreadBuffer();
+			m_buffer->m_depth++;
+			m_begin_cycles = Profiler::ReadCycles();
+		}
+
+		FORGE_FORCE_INLINE ProfileScope::~ProfileScope()
+		{
+			if (!m_buffer)
+				return;
+
+			U64 end_cycles  = Profiler::ReadCycles();
+			U64 write_index = m_buffer->m_write_index.load(std::memory_order_relaxed);
+
+			ProfileEvent& event = m_buffer->m_events[write_index & ProfileThreadBuffer::MASK];
+			event.m_zone         = m_zone;
+			event.m_begin_cycles = m_begin_cycles;
+			event.m_end_cycles   = end_cycles;
+			event.m_depth        = --m_buffer->m_depth;
+
+			m_buffer->m_write_index.store(write_index + 1, std::memory_order_release);
+		}
+	}
+}
+
+#endif // PROFILER_H
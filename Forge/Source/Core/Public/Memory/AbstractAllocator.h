@@ -7,6 +7,8 @@
 #include "Core/Public/Common/TypeDefinitions.h"
 #include "Core/Public/Common/TypeTraits.h"
 
+#include "Core/Public/Algorithm/GeneralUtilities.h"
+
 namespace Forge {
 	namespace Memory
 	{
@@ -56,14 +58,14 @@ namespace Forge {
 		
 		private:
 			template<typename InElementType, typename... Args>
-			InElementType* ConstructImpl(Args&&... args, Common::TypeIsPod)
+			InElementType* ConstructImpl(Common::TypeIsPod, Args&&... args)
 			{
 				return reinterpret_cast<InElementType*>(Allocate(sizeof(InElementType)));
 			}
 			template<typename InElementType, typename... Args>
-			InElementType* ConstructImpl(Args&&... args, Common::TypeIsClass)
+			InElementType* ConstructImpl(Common::TypeIsClass, Args&&... args)
 			{
-				return new (Allocate(sizeof(InElementType))) InElementType(args...);
+				return new (Allocate(sizeof(InElementType))) InElementType(Algorithm::Forward<Args>(args)...);
 			}
 
 			template<typename InElementType>
@@ -95,12 +97,12 @@ namespace Forge {
 			}
 
 			template<typename InElementType>
-			InElementType* DeconstructArrayImpl(Size size, InElementType* address, Common::TypeIsPod)
+			Void DeconstructArrayImpl(Size size, InElementType* address, Common::TypeIsPod)
 			{
 				Deallocate(address);
 			}
 			template<typename InElementType>
-			InElementType* DeconstructArrayImpl(Size size, InElementType* address, Common::TypeIsClass)
+			Void DeconstructArrayImpl(Size size, InElementType* address, Common::TypeIsClass)
 			{
 				for (I32 i = 0; i < size; i++)
 					(address + i)->~InElementType();
@@ -232,7 +234,7 @@ namespace Forge {
 			template<typename InElementType, typename... Args>
 			InElementType* Construct(Args&&... args)
 			{
-				ConstructImpl(args, Common::TTraitInt<Common::TIsPod<InElementType>::Value>);
+				return ConstructImpl<InElementType>(Common::TTraitInt<Common::TIsPod<InElementType>::Value>(), Algorithm::Forward<Args>(args)...);
 			}
 			
 			/**
@@ -246,7 +248,7 @@ namespace Forge {
 			template<typename InElementType>
 			Void Destruct(InElementType* address)
 			{
-				DestructImpl(address, Common::TTraitInt<Common::TIsPod<InElementType>::Value>);
+				DestructImpl(address, Common::TTraitInt<Common::TIsPod<InElementType>::Value>());
 			}
 
 			/**
@@ -260,7 +262,7 @@ namespace Forge {
 			template<typename InElementType>
 			InElementType* ConstructArray(Size size)
 			{
-				ConstructArrayImpl(size, Common::TTraitInt<Common::TIsPod<InElementType>::Value>);
+				return ConstructArrayImpl<InElementType>(size, Common::TTraitInt<Common::TIsPod<InElementType>::Value>());
 			}
 
 			/**
@@ -273,9 +275,9 @@ namespace Forge {
 			 * the allocator
 			 */
 			template<typename InElementType>
-			InElementType* DeconstructArray(Size size, InElementType* address)
+			Void DeconstructArray(Size size, InElementType* address)
 			{
-				DeconstructArrayImpl(size, address, Common::TTraitInt<Common::TIsPod<InElementType>::Value>);
+				DeconstructArrayImpl(size, address, Common::TTraitInt<Common::TIsPod<InElementType>::Value>());
 			}
 
 		public:
@@ -0,0 +1,148 @@
+#ifndef CONCURRENT_POOL_ALLOCATOR_H
+#define CONCURRENT_POOL_ALLOCATOR_H
+
+#include <stdlib.h>
+#include <atomic>
+
+#include "MemoryUtilities.h"
+#include "AbstractAllocator.h"
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		/**
+		 * @brief Manages memory in fixed-size chunks that can be allocated and
+		 * freed concurrently from multiple threads without locking.
+		 * 
+		 * Free chunks form a lock-free stack whose head packs the index of the
+		 * top chunk with a version tag bumped on every update, so a chunk that
+		 * is popped and pushed back between a thread's read and its swap can
+		 * not be mistaken for an unchanged head.
+		 * 
+		 * The pool is limited to 2^32 - 1 chunks.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API ConcurrentPoolAllocator : public AbstractAllocator
+		{
+		private:
+			enum : U32
+			{
+				NULL_INDEX = 0xFFFFFFFF
+			};
+
+		private:
+			VoidPtr m_first_chunk;
+			std::atomic<U64> m_head;
+
+		private:
+			Size m_chunk_size;
+			Size m_num_of_chunks;
+
+		private:
+			std::atomic<Size> m_used_memory;
+			std::atomic<Size> m_num_of_allocs;
+			std::atomic<Size> m_num_of_deallocs;
+
+		public:
+			ConcurrentPoolAllocator(Size chunk_size, Size capacity);
+			ConcurrentPoolAllocator(VoidPtr start, Size chunk_size, Size capacity);
+
+		public:
+		   ~ConcurrentPoolAllocator();
+
+		private:
+			Void InitializeFreeList(Void);
+
+			VoidPtr GetChunk(U32 index);
+			U32 GetChunkIndex(VoidPtr address);
+
+		public:
+			/**
+			 * @brief Gets the maximum chunk size the pool allocator is capable of
+			 * allocation.
+			 * 
+			 * @return Size storing the chunk size in bytes.
+			 */
+			Size GetChunktSize(Void);
+
+		public:
+			/**
+			 * @brief Gets the currently occupied space in the memory pool.
+			 *
+			 * @return Size storing the occupied space in bytes.
+			 */
+			Size GetUsedMemory(Void) override;
+
+			/**
+			 * @brief Gets the number of allocations made by the allocator object
+			 * during its lifetime.
+			 *
+			 * @return Size storting the number of allocations made.
+			 */
+			Size GetNumOfAllocs(Void) override;
+
+			/**
+			 * @brief Gets the number of deallocations made by the allocator object
+			 * during its lifetime.
+			 *
+			 * @return Size storting the number of deallocations made.
+			 */
+			Size GetNumOfDeallocs(Void) override;
+
+		public:
+			/**
+			 * @brief Retrieves a free chunk from the pre-allocated memory pool,
+			 * safe to call from multiple threads.
+			 *
+			 * @param[in] size      The size of chunk to retrieve in bytes.
+			 * @param[in] alignment The alignment of memory, must be power of two.
+			 *
+			 * @return VoidPtr storing the address to start of the allocated chunk.
+			 *
+			 * @throws BadAllocationException if the pool is exhausted.
+			 */
+			VoidPtr Allocate(Size size, Byte alignment = 4) override;
+
+			/**
+			 * @brief The pool allocator does not allow reallocations to previously
+			 * allocated memory chunks.
+			 *
+			 * @throws InvalidOperationException if attempted to reallocate an
+			 * address.
+			 */
+			VoidPtr Reallocate(VoidPtr address, Size size, Byte alignment = 4) override;
+
+			/**
+			 * @brief Returns the chunk to the pre-allocated memory pool, safe to
+			 * call from multiple threads.
+			 *
+			 * @param[in] address The address of the chunk to free.
+			 *
+			 * @throws MemoryOutOfBoundsException if the address provided is out
+			 * of the memory pool bounds.
+			 */
+			Void Deallocate(VoidPtr address) override;
+
+		public:
+			/**
+			 * @brief Resets the whole memory pool.
+			 * 
+			 * This function must not be called while other threads are using
+			 * the allocator.
+			 */
+			Void Reset(Void) override;
+		};
+
+		FORGE_FORCE_INLINE Size ConcurrentPoolAllocator::GetChunktSize(Void) { return m_chunk_size; }
+
+		FORGE_FORCE_INLINE Size ConcurrentPoolAllocator::GetUsedMemory(Void)    { return m_used_memory.load(std::memory_order_relaxed);     }
+		FORGE_FORCE_INLINE Size ConcurrentPoolAllocator::GetNumOfAllocs(Void)   { return m_num_of_allocs.load(std::memory_order_relaxed);   }
+		FORGE_FORCE_INLINE Size ConcurrentPoolAllocator::GetNumOfDeallocs(Void) { return m_num_of_deallocs.load(std::memory_order_relaxed); }
+	}
+}
+
+#endif // CONCURRENT_POOL_ALLOCATOR_H
@@ -0,0 +1,181 @@
+#ifndef FRAME_ALLOCATOR_H
+#define FRAME_ALLOCATOR_H
+
+#include "MemoryUtilities.h"
+#include "LinearAllocator.h"
+#include "FreeListAllocator.h"
+#include "AbstractAllocator.h"
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		/**
+		 * @brief Manages per-frame scratch memory using two linear allocators
+		 * that swap on every frame boundary.
+		 * 
+		 * Addresses allocated during a frame stay valid until the end of the
+		 * following frame, which allows handing data over to a consumer that
+		 * runs one frame behind. Like the linear allocator, the frame allocator
+		 * prevents reallocation and deallocation of memory chunks.
+		 * 
+		 * When a frame runs out of space, allocations fall back to an optional
+		 * free list allocator and are released along with the frame. Overflows
+		 * are reported in the frame statistics so the frame size can be tuned.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API FrameAllocator : public AbstractAllocator
+		{
+		public:
+			struct FrameStats : public AllocatorStats
+			{
+				Size m_overflow_memory;
+				Size m_num_of_overflow_allocs;
+			};
+
+		private:
+			struct OverflowHeader
+			{
+				OverflowHeader* m_next;
+			};
+
+		private:
+			LinearAllocator m_frame_allocators[2];
+			OverflowHeader* m_overflow_heads[2];
+
+		private:
+			FrameStats m_frame_stats[2];
+			FrameStats m_last_frame_stats;
+
+		private:
+			FreeListAllocator* m_overflow_allocator;
+
+		private:
+			Size m_frame_index;
+
+		public:
+			/**
+			 * @brief Constructs a frame allocator object.
+			 * 
+			 * @param[in] frame_size         The size of each frame's memory pool
+			 * in bytes.
+			 * @param[in] overflow_allocator The allocator to fall back to once a
+			 * frame is full, or nullptr to fail such allocations.
+			 */
+			FrameAllocator(Size frame_size, FreeListAllocator* overflow_allocator = nullptr);
+
+			/**
+			 * @brief Constructs a frame allocator object whose frames are backed
+			 * by virtual memory pages.
+			 * 
+			 * @param[in] platform           The platform used to reserve and
+			 * commit pages, it must outlive this allocator.
+			 * @param[in] reserve_size       The size of the address range each
+			 * frame reserves in bytes.
+			 * @param[in] retained_size      The size of committed memory each
+			 * frame keeps when it is recycled in bytes.
+			 * @param[in] overflow_allocator The allocator to fall back to once a
+			 * frame is full, or nullptr to fail such allocations.
+			 */
+			FrameAllocator(Platform::AbstractPlatform* platform, Size reserve_size, Size retained_size, FreeListAllocator* overflow_allocator = nullptr);
+
+		public:
+		   ~FrameAllocator();
+
+		private:
+			Void ReleaseOverflow(Size frame_index);
+			Void ResetFrameStats(Size frame_index);
+
+			VoidPtr AllocateOverflow(Size size, Byte alignment);
+
+		public:
+			/**
+			 * @brief Gets the index of the current frame since construction or
+			 * the last reset.
+			 *
+			 * @return Size storing the frame index.
+			 */
+			Size GetFrameIndex(Void);
+
+			/**
+			 * @brief Gets the statistics of the frame in progress.
+			 *
+			 * @return FrameStats storing the current frame statistics.
+			 */
+			const FrameStats& GetFrameStats(Void);
+
+			/**
+			 * @brief Gets the statistics of the last completed frame.
+			 *
+			 * @return FrameStats storing the last frame statistics.
+			 */
+			const FrameStats& GetLastFrameStats(Void);
+
+			/**
+			 * @brief Gets the memory in use by the current and previous frames.
+			 *
+			 * @return Size storing the occupied space in bytes.
+			 */
+			Size GetUsedMemory(Void) override;
+
+		public:
+			/**
+			 * @brief Ends the current frame and starts a new one.
+			 * 
+			 * This function releases every address allocated two frames ago,
+			 * addresses allocated during the frame that just ended stay valid
+			 * until the next call.
+			 */
+			Void NextFrame(Void);
+
+		public:
+			/**
+			 * @brief Retrieves a properly aligned memory address from the
+			 * current frame's memory pool.
+			 *
+			 * @param[in] size      The size of chunk to retrieve in bytes.
+			 * @param[in] alignment The alignment of memory, must be power of two.
+			 *
+			 * @return VoidPtr storing the address to start of the allocated chunk.
+			 *
+			 * @throws BadAllocationException if the frame is full and the overflow
+			 * allocator is out of memory or missing.
+			 */
+			VoidPtr Allocate(Size size, Byte alignment = 4) override;
+
+			/**
+			 * @brief The frame allocator does not support reallocations to
+			 * previously allocated memory chunks.
+			 *
+			 * @throws InvalidOperationException if attempted to reallocate an
+			 * address.
+			 */
+			VoidPtr Reallocate(VoidPtr address, Size size, Byte alignment = 4) override;
+
+			/**
+			 * @brief The frame allocator does not support deallocations to
+			 * previously allocated memory chunks.
+			 *
+			 * @throws InvalidOperationException if attempted to deallocate an
+			 * address.
+			 */
+			Void Deallocate(VoidPtr address) override;
+
+		public:
+			/**
+			 * @brief Resets both frames, releasing every allocated address.
+			 */
+			Void Reset(Void) override;
+		};
+
+		FORGE_FORCE_INLINE Size FrameAllocator::GetFrameIndex(Void) { return m_frame_index; }
+
+		FORGE_FORCE_INLINE const FrameAllocator::FrameStats& FrameAllocator::GetFrameStats(Void)     { return m_frame_stats[m_frame_index & 1]; }
+		FORGE_FORCE_INLINE const FrameAllocator::FrameStats& FrameAllocator::GetLastFrameStats(Void) { return m_last_frame_stats; }
+	}
+}
+
+#endif // FRAME_ALLOCATOR_H
@@ -9,9 +9,43 @@
 #include "Core/Public/Common/Compiler.h"
 #include "Core/Public/Common/TypeDefinitions.h"
 
+#include "Core/Public/Algorithm/GeneralUtilities.h"
+
 namespace Forge {
 	namespace Memory
 	{
+		enum class FreeListPolicy : Byte
+		{
+			/**
+			 * @brief Walks the whole free list on every allocation to find the
+			 * block that leaves the smallest remainder.
+			 */
+			FORGE_ENUM_DECL(FORGE_BEST_FIT,       0x0)
+
+			/**
+			 * @brief Keeps free blocks in power-of-two size class bins tracked by
+			 * a bitmap, so allocation and deallocation run in constant time.
+			 */
+			FORGE_ENUM_DECL(FORGE_SEGREGATED_FIT, 0x1)
+
+			MAX
+		};
+
+		/**
+		 * @brief Manages memory in variable-size chunks that can be allocated
+		 * and freed in any order.
+		 * 
+		 * The free list allocator keeps track of the unused regions of its memory
+		 * pool and hands out chunks from them according to its free list policy.
+		 * 
+		 * The best fit policy walks a single address-ordered free list, so its
+		 * cost grows with fragmentation. The segregated fit policy splits free
+		 * blocks into power-of-two size class bins and keeps a bitmap of the
+		 * non-empty bins, finding a fitting block with a single bit scan and
+		 * coalescing neighbours through boundary tags.
+		 *
+		 * @author Karim Hisham
+		 */
 		class FORGE_API FreeListAllocator : public AbstractAllocator
 		{
 		private:
@@ -27,9 +61,37 @@ namespace Forge {
 				FreeBlockNode* m_link;
 			};
 
+			struct SegregatedBlockHeader
+			{
+				SegregatedBlockHeader* m_prev_physical;
+				Size m_block_size;
+
+				SegregatedBlockHeader* m_next_free;
+				SegregatedBlockHeader* m_prev_free;
+			};
+
+		private:
+			enum
+			{
+				SEGREGATED_BIN_COUNT    = 64,
+				SEGREGATED_GRANULARITY  = 16,
+				SEGREGATED_HEADER_SIZE  = 2 * sizeof(VoidPtr),
+				SEGREGATED_MIN_BLOCK    = sizeof(SegregatedBlockHeader),
+				SEGREGATED_FREE_FLAG    = 0x1,
+				SEGREGATED_PADDING_FLAG = 0x2
+			};
+
+		private:
+			FreeListPolicy m_policy;
+
 		private:
 			FreeBlockNode* m_free_list;
 
+		private:
+			U64 m_bin_bitmap;
+			VoidPtr m_end_ptr;
+			SegregatedBlockHeader* m_bins[SEGREGATED_BIN_COUNT];
+
 		public:
 			/**
 			 * @brief Constructs a free list allocator object.
@@ -38,8 +100,9 @@ namespace Forge {
 			 * be owned and managed by it.
 			 * 
 			 * @param[in] capacity Size of the memory pool in bytes.
+			 * @param[in] policy   The policy used to search for free blocks.
 			 */
-			FreeListAllocator(Size capacity);
+			FreeListAllocator(Size capacity, FreeListPolicy policy = FreeListPolicy::FORGE_BEST_FIT);
 
 			/**
 			 * @brief Constructs a free list allocator object.
@@ -49,12 +112,35 @@ namespace Forge {
 			 * 
 			 * @oaram[in] start Address of start of the pre-allocated memory pool.
 			 * @param[in] capacity Size of the memory pool in bytes.
+			 * @param[in] policy   The policy used to search for free blocks.
 			 */
-			FreeListAllocator(VoidPtr start, Size capacity);
+			FreeListAllocator(VoidPtr start, Size capacity, FreeListPolicy policy = FreeListPolicy::FORGE_BEST_FIT);
 
 		public:
 			~FreeListAllocator();
 
+		private:
+			Void InitializeFreeList(Void);
+			Void InitializeSegregatedBins(Void);
+
+			Void InsertSegregatedBlock(SegregatedBlockHeader* block);
+			Void RemoveSegregatedBlock(SegregatedBlockHeader* block);
+
+			SegregatedBlockHeader* GetSegregatedBlock(VoidPtr address);
+			SegregatedBlockHeader* GetNextPhysicalBlock(SegregatedBlockHeader* block);
+
+			VoidPtr AllocateSegregated(Size size, Byte alignment);
+			VoidPtr ReallocateSegregated(VoidPtr address, Size size, Byte alignment);
+			Void    DeallocateSegregated(VoidPtr address);
+
+		public:
+			/**
+			 * @brief Gets the policy used to search for free blocks.
+			 *
+			 * @return FreeListPolicy storing the free list policy.
+			 */
+			FreeListPolicy GetPolicy(Void);
+
 		public:
 			/**
 			 * @brief Retrieves a properly aligned memory address from the
@@ -111,6 +197,8 @@ namespace Forge {
 			 */
 			Void Reset(void);
 		};
+
+		FORGE_FORCE_INLINE FreeListPolicy FreeListAllocator::GetPolicy(Void) { return m_policy; }
 	}
 }
 
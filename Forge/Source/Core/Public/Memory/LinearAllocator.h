@@ -10,6 +10,11 @@
 #include "Core/Public/Common/TypeDefinitions.h"
 
 namespace Forge {
+	namespace Platform
+	{
+		class AbstractPlatform;
+	}
+
 	namespace Memory
 	{
 		/**
@@ -22,21 +27,64 @@ namespace Forge {
 		 * 
 		 * To free memory, the entire memory pool must be reset. This makes the
 		 * linear allocator useful for single-frame allocations.
+		 * 
+		 * When constructed with a platform, the linear allocator reserves a
+		 * virtual address range up front and only commits pages as allocations
+		 * advance through it. On reset, pages above the retained size are
+		 * decommitted, so a single spike does not stay resident forever.
 		 *
 		 * @author Karim Hisham
 		 */
 		class FORGE_API LinearAllocator : public AbstractAllocator
 		{
+		private:
+			enum
+			{
+				MIN_COMMIT_SIZE = 64 * 1024
+			};
+
 		private:
 			VoidPtr m_offset_ptr;
 
+		private:
+			Platform::AbstractPlatform* m_platform;
+
+			Size m_page_size;
+			Size m_committed_size;
+			Size m_retained_size;
+
 		public:
 			LinearAllocator(Size total_size);
 			LinearAllocator(VoidPtr start, Size total_size);
 
+			/**
+			 * @brief Constructs a growable linear allocator backed by virtual
+			 * memory pages.
+			 * 
+			 * @param[in] platform      The platform used to reserve and commit
+			 * pages, it must outlive this allocator.
+			 * @param[in] reserve_size  The size of the address range to reserve
+			 * in bytes, it bounds the total size of allocations.
+			 * @param[in] retained_size The size of committed memory kept on reset
+			 * in bytes, pages above it are decommitted.
+			 */
+			LinearAllocator(Platform::AbstractPlatform* platform, Size reserve_size, Size retained_size);
+
 		public:
 		   ~LinearAllocator();
 
+		private:
+			Bool CommitUpTo(Size size);
+
+		public:
+			/**
+			 * @brief Gets the size of memory currently backed by physical pages.
+			 *
+			 * @return Size storing the committed size in bytes, equal to the
+			 * total size if the allocator is not backed by virtual memory.
+			 */
+			Size GetCommittedSize(Void);
+
 		public:
 			/**
 			 * @brief Retrieves a properly aligned memory address from the
@@ -74,10 +122,13 @@ namespace Forge {
 			/**
 			 * @brief Resets the whole memory pool.
 			 * 
-			 * This function sets the entire allocated memory pool to zeros.
+			 * This function sets the entire allocated memory pool to zeros, and
+			 * decommits pages above the retained size if backed by virtual memory.
 			 */
 			Void Reset(void) override;
 		};
+
+		FORGE_FORCE_INLINE Size LinearAllocator::GetCommittedSize(Void) { return m_committed_size; }
 	}
 }
 
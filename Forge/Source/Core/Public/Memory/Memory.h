@@ -2,12 +2,15 @@
 #define MEMORY_H
 
 #include "CAllocator.h"
+#include "ConcurrentPoolAllocator.h"
 #include "MemorySystem.h"
 #include "PoolAllocator.h"
 #include "StackAllocator.h"
+#include "FrameAllocator.h"
 #include "LinearAllocator.h"
 #include "MemoryUtilities.h"
 #include "FreeListAllocator.h"
 #include "AbstractAllocator.h"
+#include "ThreadCachingAllocator.h"
 
 #endif // MEMORY_H
@@ -444,6 +444,19 @@ namespace Forge {
 			return adjustment != alignment ? adjustment : 0;
 		}
 
+		/**
+		 * @brief Rounds a size up to the next multiple of an alignment boundry.
+		 *
+		 * @param[in] size      The size to align.
+		 * @param[in] alignment The alignment boundry, must be power of two.
+		 *
+		 * @returns Size storing the aligned size.
+		 */
+		FORGE_FORCE_INLINE Size AlignSizeUpward(Size size, Size alignment)
+		{
+			return (size + (alignment - 1)) & ~(alignment - 1);
+		}
+
 		/**
 		 *@brief Checks whether address is aligned to a specific alignment boundry.
 		 *
@@ -536,6 +549,53 @@ namespace Forge {
 			return reinterpret_cast<U64>(address) >= reinterpret_cast<U64>(start_address) &&
 				reinterpret_cast<U64>(address) < reinterpret_cast<U64>(start_address) + total_size;
 		}
+
+		/**
+		 * @brief Blocks of at least this many bytes are mapped directly from
+		 * the system by the heap block functions, so they can be grown by
+		 * remapping pages instead of copying them.
+		 */
+		enum : Size { HEAP_MAPPING_THRESHOLD = 1 << 20 };
+
+		/**
+		 * @brief Allocates a block from the system heap.
+		 *
+		 * Blocks returned by this function are aligned to at least 16 bytes
+		 * and must only be resized by HeapReallocate() and freed by
+		 * HeapDeallocate() with the same size they were requested with.
+		 *
+		 * @param[in] size The size of the block in bytes.
+		 *
+		 * @returns VoidPtr storing the address of the block, or nullptr on
+		 * failure.
+		 */
+		FORGE_API VoidPtr HeapAllocate(Size size);
+
+		/**
+		 * @brief Resizes a block allocated by HeapAllocate(), preserving its
+		 * content up to the smaller of both sizes.
+		 *
+		 * Small blocks are resized by realloc(). On Linux blocks larger than
+		 * HEAP_MAPPING_THRESHOLD live in their own mapping and are resized by
+		 * mremap(), which moves page table entries and never copies the
+		 * content regardless of the block size.
+		 *
+		 * @param[in] address  The address of the block, may be nullptr.
+		 * @param[in] old_size The size the block was requested with.
+		 * @param[in] new_size The new size of the block in bytes.
+		 *
+		 * @returns VoidPtr storing the address of the resized block, or
+		 * nullptr on failure in which case the original block is left intact.
+		 */
+		FORGE_API VoidPtr HeapReallocate(VoidPtr address, Size old_size, Size new_size);
+
+		/**
+		 * @brief Frees a block allocated by HeapAllocate().
+		 *
+		 * @param[in] address The address of the block, may be nullptr.
+		 * @param[in] size    The size the block was requested with.
+		 */
+		FORGE_API Void HeapDeallocate(VoidPtr address, Size size);
 	}
 }
 
@@ -0,0 +1,196 @@
+#ifndef THREAD_CACHING_ALLOCATOR_H
+#define THREAD_CACHING_ALLOCATOR_H
+
+#include <mutex>
+#include <atomic>
+
+#include "MemoryUtilities.h"
+#include "AbstractAllocator.h"
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+namespace Forge {
+	namespace Memory
+	{
+		/**
+		 * @brief Thread-safe front-end that caches recently freed blocks per
+		 * thread in front of another allocator.
+		 * 
+		 * Every thread owns a set of magazines, one per power-of-two size class,
+		 * holding blocks it can hand out or take back without synchronization.
+		 * The backing allocator is only locked when a magazine runs dry and has
+		 * to be refilled, or overflows and has to return half of its blocks.
+		 * 
+		 * The backing allocator must support variable-size allocations, such as
+		 * the free list allocator. Requests larger than the biggest size class,
+		 * or aligned above 32 bytes, bypass the magazines and always lock the
+		 * backing allocator.
+		 * 
+		 * Threads take a cache slot the first time they use any thread caching
+		 * allocator, and return it when they exit, after their magazines were
+		 * drained to the backing allocators. At most MAX_THREAD_COUNT threads
+		 * hold a slot at once, the others always lock the backing allocator.
+		 * 
+		 * Statistics are kept per thread and summed when queried, so they are
+		 * only exact once all threads stopped allocating.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API ThreadCachingAllocator : public AbstractAllocator
+		{
+		private:
+			enum
+			{
+				MIN_SIZE_CLASS_SHIFT = 4,
+				MAX_SIZE_CLASS_SHIFT = 12,
+				SIZE_CLASS_COUNT     = MAX_SIZE_CLASS_SHIFT - MIN_SIZE_CLASS_SHIFT + 1,
+				LARGE_SIZE_CLASS     = SIZE_CLASS_COUNT,
+				MAGAZINE_CAPACITY    = 64,
+				MAX_THREAD_COUNT     = 64,
+				HEADER_SIZE          = 32
+			};
+
+			struct AllocationHeader
+			{
+				VoidPtr m_backing_address;
+				Size m_size;
+				U32 m_size_class;
+			};
+
+			struct ThreadSlot;
+
+			struct Magazine
+			{
+				Size m_count;
+				VoidPtr m_blocks[MAGAZINE_CAPACITY];
+			};
+
+			struct ThreadCache
+			{
+				Magazine m_magazines[SIZE_CLASS_COUNT];
+
+				std::atomic<Size> m_used_memory;
+				std::atomic<Size> m_num_of_allocs;
+				std::atomic<Size> m_num_of_deallocs;
+			};
+
+		private:
+			AbstractAllocator* m_backing_allocator;
+
+		private:
+			ThreadCachingAllocator* m_prev_allocator;
+			ThreadCachingAllocator* m_next_allocator;
+
+		private:
+			std::mutex m_backing_mutex;
+			std::atomic<ThreadCache*> m_thread_caches[MAX_THREAD_COUNT];
+
+		public:
+			/**
+			 * @brief Constructs a thread caching allocator object.
+			 * 
+			 * @param[in] backing_allocator The allocator to fetch blocks from,
+			 * it must outlive this allocator.
+			 */
+			ThreadCachingAllocator(AbstractAllocator* backing_allocator);
+
+		public:
+		   ~ThreadCachingAllocator();
+
+		private:
+			ThreadCache* GetThreadCache(Void);
+
+			Void RefillMagazine(Magazine& magazine, U32 size_class);
+			Void DrainMagazine(Magazine& magazine, Size count);
+
+			Size GetBlockSize(VoidPtr address);
+
+			VoidPtr AllocateLarge(Size size, Byte alignment);
+
+		public:
+			/**
+			 * @brief Gets the allocator blocks are fetched from.
+			 *
+			 * @return AbstractAllocator* storing the backing allocator.
+			 */
+			AbstractAllocator* GetBackingAllocator(Void);
+
+		public:
+			/**
+			 * @brief Gets the memory currently handed out to the callers of all
+			 * threads, excluding blocks parked in magazines.
+			 *
+			 * @return Size storing the occupied space in bytes.
+			 */
+			Size GetUsedMemory(Void) override;
+
+			/**
+			 * @brief Gets the number of allocations made by all threads.
+			 *
+			 * @return Size storting the number of allocations made.
+			 */
+			Size GetNumOfAllocs(Void) override;
+
+			/**
+			 * @brief Gets the number of deallocations made by all threads.
+			 *
+			 * @return Size storting the number of deallocations made.
+			 */
+			Size GetNumOfDeallocs(Void) override;
+
+		public:
+			/**
+			 * @brief Retrieves a properly aligned memory address, from the
+			 * calling thread's magazine when possible.
+			 *
+			 * @param[in] size      The size of chunk to retrieve in bytes.
+			 * @param[in] alignment The alignment of memory, must be power of two.
+			 *
+			 * @return VoidPtr storing the address to start of the allocated chunk.
+			 *
+			 * @throws BadAllocationException if the backing allocator is out of
+			 * memory.
+			 */
+			VoidPtr Allocate(Size size, Byte alignment = 4) override;
+
+			/**
+			 * @brief Resizes an allocated address to a new size and copies its
+			 * content to the new chunk.
+			 *
+			 * @param[in] address   The address of the chunk to resize.
+			 * @param[in] size      The new size of the chunk to reallocate in bytes.
+			 * @param[in] alignment The Alignment of memory, must be power of two.
+			 *
+			 * @returns VoidPtr storing the address to the start of the reallocated
+			 * chunk.
+			 *
+			 * @throws BadAllocationException if the backing allocator is out of
+			 * memory.
+			 */
+			VoidPtr Reallocate(VoidPtr address, Size size, Byte alignment = 4) override;
+
+			/**
+			 * @brief Returns the address to the calling thread's magazine, or to
+			 * the backing allocator if the magazine is full.
+			 *
+			 * @param[in] address The address of the chunk to free.
+			 */
+			Void Deallocate(VoidPtr address) override;
+
+		public:
+			/**
+			 * @brief Returns every cached block to the backing allocator and
+			 * resets it.
+			 *
+			 * This function must not be called while other threads are using
+			 * the allocator.
+			 */
+			Void Reset(Void) override;
+		};
+
+		FORGE_FORCE_INLINE AbstractAllocator* ThreadCachingAllocator::GetBackingAllocator(Void) { return m_backing_allocator; }
+	}
+}
+
+#endif // THREAD_CACHING_ALLOCATOR_H
@@ -2,12 +2,14 @@
 #define OBJECT_H
 
 #include "TypeInfo.h"
-#include "RefCounter.h"
 
 #include "Core/Public/CoreFwd.h"
 
 #include "Core/Public/Common/Compiler.h"
 #include "Core/Public/Common/TypeDefinitions.h"
+#include "Core/Public/Common/PreprocessorUtilities.h"
+
+#include "Core/Public/Types/SmartPointer.h"
 
 using namespace Forge::Memory;
 
@@ -22,15 +24,23 @@ namespace Forge {
 
 		/**
 		 * @brief Base class for classes with run-time type information. This
-		 * class is reference-counted and is non-copyable.
+		 * class is non-copyable.
+		 * 
+		 * Objects are reference-counted by the TSharedPtr managing them, so
+		 * they carry no counts of their own. Casts share ownership with that
+		 * TSharedPtr, so objects must be created with MakeShared(), which
+		 * allocates the object and its counts together, or adopted by a
+		 * TSharedPtr to be cast.
 		 * 
 		 * @author Karim Hisham
 		 */
-		class FORGE_API Object : public RefCounted
+		class FORGE_API Object : public Common::SharedFromThis
 		{
+		FORGE_CLASS_NONCOPYABLE(Object)
+
 		public:
 			Object() = default;
-		   ~Object() = default;
+			virtual ~Object() = default;
 		
 		public:
 			/**
@@ -40,6 +50,21 @@ namespace Forge {
 			 */
 			static ConstTypeInfoPtr GetTypeInfo(void);
 
+			/**
+			 * @brief Gets the type ID of this class, computed at compile time.
+			 *
+			 * @return ConstStringHash storing the hash of the class name.
+			 */
+			static constexpr ConstStringHash GetTypeId(void) { return ConstStringHash("Object"); }
+
+			/**
+			 * @brief Gets the run-time type info of the most derived class of
+			 * the object.
+			 *
+			 * @return Const raw pointer to the type info of the object.
+			 */
+			virtual ConstTypeInfoPtr GetInstanceTypeInfo(void) const { return GetTypeInfo(); }
+
 		public:
 			/**
 			 * @brief Performs a deep-copy of the object and returns the new
@@ -83,25 +108,28 @@ namespace Forge {
 			/**
 			 * @brief Casts the object to the class specified staticly.
 			 * 
-			 * @return TSharedPtr object to the class specified.
+			 * @return TSharedPtr object to the class specified, sharing
+			 * ownership with the TSharedPtr managing the object, or an empty
+			 * one if none manages it.
 			 */
 			template<typename T> 
 			TSharedPtr<T> StaticCast(void)
 			{
-				return TSharedPtr((T*)this);
+				return this->GetSharedFromThis(static_cast<T*>(this));
 			}
 
 			/**
 			 * @brief Casts the object to the class specified dynamically.
 			 *
-			 * @return TSharedPtr to the class specified, or an empty one if not 
-			 * derived from it.
+			 * @return TSharedPtr to the class specified, sharing ownership with
+			 * the TSharedPtr managing the object, or an empty one if none
+			 * manages it or the object is not derived from the class.
 			 */
 			template<typename T> 
 			TSharedPtr<T> DynamicCast(void)
 			{
 				if (this->IsInstanceOf(T::GetTypeInfo()))
-					return TSharedPtr<T>((T*)this);
+					return this->GetSharedFromThis(static_cast<T*>(this));
 				
 				return TSharedPtr<T>();
 			}
@@ -110,7 +138,9 @@ namespace Forge {
 		#define FORGE_DECLARE_TYPEINFO(__TYPENAME__, __BASE_TYPENAME__)	\
 			using ClassName     = __TYPENAME__;							\
 			using BaseClassName = __BASE_TYPENAME__;					\
-			static ConstTypeInfoPtr GetTypeInfo(void) { static TypeInfo static_type_info(#__TYPENAME__, sizeof(ClassName), BaseClassName::GetTypeInfo()); return &static_type_info; }
+			static ConstTypeInfoPtr GetTypeInfo(void) { static TypeInfo static_type_info(#__TYPENAME__, sizeof(ClassName), BaseClassName::GetTypeInfo()); return &static_type_info; } \
+			static constexpr ConstStringHash GetTypeId(void) { return ConstStringHash(#__TYPENAME__); } \
+			ConstTypeInfoPtr GetInstanceTypeInfo(void) const override { return GetTypeInfo(); }
 	}
 }
 
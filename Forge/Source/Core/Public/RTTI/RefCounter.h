@@ -1,6 +1,8 @@
 #ifndef REF_COUNTER_H
 #define REF_COUNTER_H
 
+#include <atomic>
+
 #include "Core/Public/Common/Compiler.h"
 #include "Core/Public/Common/TypeDefinitions.h"
 
@@ -8,60 +10,95 @@ namespace Forge {
 	namespace RTTI
 	{
 		/**
-		 * @brief Manages reference-counting on objects and prevents copying.
-		 * 
+		 * @brief Reference counting policy for objects shared between threads.
+		 *
+		 * Increments are relaxed, since a new reference can only be created
+		 * from an existing one. Decrements are acquire-release, so the writes
+		 * made through every released reference are visible to the thread
+		 * that sees the count reach zero and destroys the object.
+		 *
 		 * @author Karim Hisham
 		 */
-		class FORGE_API RefCounted
+		struct AtomicRefCountPolicy
 		{
-		FORGE_CLASS_NONCOPYABLE(RefCounted)
+			using CountType = std::atomic<Size>;
+
+			static FORGE_FORCE_INLINE Void Increment(CountType& count)
+			{
+				count.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			static FORGE_FORCE_INLINE Size Decrement(CountType& count)
+			{
+				return count.fetch_sub(1, std::memory_order_acq_rel) - 1;
+			}
+
+			static FORGE_FORCE_INLINE Size Load(const CountType& count)
+			{
+				return count.load(std::memory_order_acquire);
+			}
 
-		private:
-			struct RefCounter
+			static FORGE_FORCE_INLINE Bool IncrementIfNotZero(CountType& count)
 			{
-				Size m_ref;
-				Size m_weak_ref;
-			} *m_ref_counter;
+				Size value = count.load(std::memory_order_relaxed);
+
+				while (value)
+					if (count.compare_exchange_weak(value, value + 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+						return true;
+
+				return false;
+			}
+		};
+
+		/**
+		 * @brief Reference counting policy for objects that never leave the
+		 * thread that created them, counts are plain integers.
+		 *
+		 * @author Karim Hisham
+		 */
+		struct NonAtomicRefCountPolicy
+		{
+			using CountType = Size;
+
+			static FORGE_FORCE_INLINE Void Increment(CountType& count) { count++; }
+
+			static FORGE_FORCE_INLINE Size Decrement(CountType& count) { return --count; }
+
+			static FORGE_FORCE_INLINE Size Load(const CountType& count) { return count; }
+
+			static FORGE_FORCE_INLINE Bool IncrementIfNotZero(CountType& count) { return count ? (count++, true) : false; }
+		};
+
+		/**
+		 * @brief A strong and a weak reference count updated through a
+		 * counting policy.
+		 *
+		 * The control block of TSharedPtr stores the counts, which
+		 * MakeShared() allocates together with the object.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InPolicy>
+		struct TRefCount
+		{
+		public:
+			typename InPolicy::CountType m_ref;
+			typename InPolicy::CountType m_weak_ref;
 
 		public:
-			RefCounted();
-			virtual ~RefCounted();
+			TRefCount(Size ref = 0, Size weak_ref = 0)
+				: m_ref(ref), m_weak_ref(weak_ref) {}
 
 		public:
-			/**
-			 * @brief Gets number of object references.
-			 * 
-			 * @return ConstSize storing number of references. 
-			 */
-			ConstSize GetRefCount(void) const;
-
-			/**
-			 * @brief Gets number of object weak references.
-			 *
-			 * @return ConstSize storing number of weak references. 
-			 */
-			ConstSize GetWeakRefCount(void) const;
+			FORGE_FORCE_INLINE Size GetRefCount(Void) const     { return InPolicy::Load(m_ref); }
+			FORGE_FORCE_INLINE Size GetWeakRefCount(Void) const { return InPolicy::Load(m_weak_ref); }
 
 		public:
-			/**
-			 * @brief Increments number of object references.
-			 */
-			Void IncrementRef(void);
-
-			/**
-			 * @brief Decrements number of object references.
-			 */
-			Void DecrementRef(void);
-
-			/**
-			 * @brief Increments number of object weak references.
-			 */
-			Void IncrementWeakRef(void);
-
-			/**
-			 * @brief Decrements number of object weak references.
-			 */
-			Void DecrementWeakRef(void);
+			FORGE_FORCE_INLINE Void IncrementRef(Void)     { InPolicy::Increment(m_ref); }
+			FORGE_FORCE_INLINE Bool TryIncrementRef(Void)  { return InPolicy::IncrementIfNotZero(m_ref); }
+			FORGE_FORCE_INLINE Size DecrementRef(Void)     { return InPolicy::Decrement(m_ref); }
+			FORGE_FORCE_INLINE Void IncrementWeakRef(Void) { InPolicy::Increment(m_weak_ref); }
+			FORGE_FORCE_INLINE Size DecrementWeakRef(Void) { return InPolicy::Decrement(m_weak_ref); }
 		};
 	}
 }
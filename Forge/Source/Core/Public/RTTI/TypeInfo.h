@@ -1,19 +1,20 @@
 #ifndef TYPE_INFO_H
 #define TYPE_INFO_H
 
+#include <atomic>
+
 #include "Core/Public/CoreFwd.h"
 
 #include "Core/Public/Common/Compiler.h"
 #include "Core/Public/Common/TypeDefinitions.h"
 
-class ConstStringHash
-{
-
-};
+#include "Core/Public/Algorithm/Hash/ConstStringHash.h"
 
 namespace Forge {
 	namespace RTTI
 	{
+		using Algorithms::ConstStringHash;
+
 		using TypeInfoRef	   = TypeInfo&;
 		using TypeInfoPtr      = TypeInfo*;
 		using ConstTypeInfo    = const TypeInfo;
@@ -23,21 +24,54 @@ namespace Forge {
 		/**
 		 * @brief Stores run-time meta-information about classes.
 		 * 
+		 * The type ID is the hash of the type name, so it can be computed at
+		 * compile time from the name alone. Debug builds assert that no two
+		 * type names hash to the same ID.
+		 * 
+		 * Derivation checks against a type info take constant time once the
+		 * TypeRegistry has numbered the hierarchy, and walk the base type
+		 * chain otherwise. Every type publishes its numbers together with the
+		 * generation of the build that computed them in a single atomic, so
+		 * checks running while the hierarchy is renumbered compare numbers
+		 * of the same build or fall back to the base type chain.
+		 * 
 		 * @author Karim Hisham
 		 */
 		class FORGE_API TypeInfo
 		{
+		FORGE_CLASS_NONCOPYABLE(TypeInfo)
+
+		private:
+			friend class TypeRegistry;
+
 		private:
 			ConstSize		  m_type_size;
 			ConstCharPtr      m_type_name;
 			ConstStringHash	  m_type_hash_id;
 			ConstTypeInfoPtr  m_base_type_info;
+
+		private:
+			enum : U64
+			{
+				HIERARCHY_NUMBER_BITS = 24,
+				HIERARCHY_NUMBER_MASK = (1ull << HIERARCHY_NUMBER_BITS) - 1,
+				GENERATION_SHIFT      = 2 * HIERARCHY_NUMBER_BITS,
+				GENERATION_MASK       = (1ull << (64 - GENERATION_SHIFT)) - 1
+			};
+
+		private:
+			/// The generation in the high bits, then the pre-order number and
+			/// the last descendant number, zero if never numbered.
+			std::atomic<U64> m_hierarchy_number;
 		
 		public:
 			TypeInfo(ConstCharPtr type_name, ConstSize type_Size, ConstTypeInfoPtr base_type_info);
 
 		public:
-		   ~TypeInfo() = default;
+		   ~TypeInfo();
+
+		private:
+			Bool IsDerivedFromBaseChain(ConstTypeInfoPtr type_info) const;
 
 		public:
 			/**
@@ -86,7 +120,7 @@ namespace Forge {
 			 * 
 			 * @return True if the object is same as the type ID.
 			 */
-			Bool IsSameAs(ConstStringHash& type_id) const;
+			Bool IsSameAs(ConstStringHash type_id) const;
 	 
 			/**
 			 * @brief Checks wether the current type is derived from a specified 
@@ -97,7 +131,7 @@ namespace Forge {
 			 * 
 			 * @return True if the object is derived from the type ID.
 			 */
-			Bool IsDerivedFrom(ConstStringHash& type_id) const;
+			Bool IsDerivedFrom(ConstStringHash type_id) const;
 			
 			/**
 			 * @brief Checks whether the current type is same as a specified type 
@@ -114,6 +148,9 @@ namespace Forge {
 			 * @brief Checks wether the current type is derived from a specified
 			 * type info.
 			 *
+			 * Takes two integer compares when both types were numbered by the
+			 * last TypeRegistry::Build().
+			 *
 			 * @param[in] type_info The type info to check whether the object is
 			 * derived from it.
 			 *
@@ -126,6 +163,23 @@ namespace Forge {
 		FORGE_FORCE_INLINE ConstCharPtr TypeInfo::GetTypeName(void) const         { return m_type_name; }
 		FORGE_FORCE_INLINE ConstStringHash TypeInfo::GetTypeId(void) const		  { return m_type_hash_id; }
 		FORGE_FORCE_INLINE ConstTypeInfoPtr TypeInfo::GetBaseTypeInfo(void) const { return m_base_type_info; }
+
+		FORGE_FORCE_INLINE Bool TypeInfo::IsDerivedFrom(ConstTypeInfoPtr type_info) const
+		{
+			U64 number      = m_hierarchy_number.load(std::memory_order_relaxed);
+			U64 base_number = type_info ? type_info->m_hierarchy_number.load(std::memory_order_relaxed) : 0;
+
+			if (number && base_number && (number >> GENERATION_SHIFT) == (base_number >> GENERATION_SHIFT))
+			{
+				U64 pre_order            = (number >> HIERARCHY_NUMBER_BITS) & HIERARCHY_NUMBER_MASK;
+				U64 base_pre_order       = (base_number >> HIERARCHY_NUMBER_BITS) & HIERARCHY_NUMBER_MASK;
+				U64 base_last_descendant = base_number & HIERARCHY_NUMBER_MASK;
+
+				return base_pre_order <= pre_order && pre_order <= base_last_descendant;
+			}
+
+			return IsDerivedFromBaseChain(type_info);
+		}
 	}
 }
 
@@ -0,0 +1,94 @@
+#ifndef TYPE_REGISTRY_H
+#define TYPE_REGISTRY_H
+
+#include <mutex>
+
+#include "TypeInfo.h"
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+#include "Core/Public/Types/Singleton.h"
+
+#include "Core/Public/Containers/TDynamicArray.h"
+
+namespace Forge {
+	namespace RTTI
+	{
+		/**
+		 * @brief Tracks every live type info and numbers the type hierarchy
+		 * so derivation checks take constant time.
+		 *
+		 * Type infos register themselves on construction. Build() walks the
+		 * hierarchy depth-first and gives every type its pre-order number and
+		 * the largest pre-order number among its descendants. A type is then
+		 * derived from another exactly when its number lies within the range
+		 * of the other type, which is two integer compares.
+		 *
+		 * Build() is meant to run once at startup, after the types in use
+		 * have been touched. It may run again while other threads check
+		 * derivations, which then walk the base type chain for the types
+		 * numbered by different builds. Types created after the last Build()
+		 * keep working through the base type chain until Build() runs again.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API TypeRegistry : public TSingleton<TypeRegistry>
+		{
+		FORGE_CLASS_SINGLETON(TypeRegistry)
+
+		private:
+			std::mutex m_mutex;
+
+		private:
+			Containers::TDynamicArray<TypeInfoPtr> m_types;
+			U64 m_generation = 0;
+
+		public:
+			~TypeRegistry() = default;
+
+		public:
+			/**
+			 * @brief Adds a type info to the registry, called by the type info
+			 * constructor.
+			 *
+			 * @param[in] type_info The type info to add.
+			 */
+			Void Register(TypeInfoPtr type_info);
+
+			/**
+			 * @brief Removes a type info from the registry, called by the type
+			 * info destructor.
+			 *
+			 * @param[in] type_info The type info to remove.
+			 */
+			Void Unregister(TypeInfoPtr type_info);
+
+		public:
+			/**
+			 * @brief Numbers the hierarchy of all the registered types.
+			 */
+			Void Build(Void);
+
+		public:
+			/**
+			 * @brief Gets the number of registered types.
+			 *
+			 * @return Size storing the number of registered types.
+			 */
+			Size GetCount(Void);
+
+			/**
+			 * @brief Finds a registered type by its type ID.
+			 *
+			 * @param[in] type_id The type ID to search for.
+			 *
+			 * @return ConstTypeInfoPtr storing the type info, or nullptr if no
+			 * registered type has the type ID.
+			 */
+			ConstTypeInfoPtr FindType(ConstStringHash type_id);
+		};
+	}
+}
+
+#endif // TYPE_REGISTRY_H
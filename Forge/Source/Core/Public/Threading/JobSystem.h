@@ -0,0 +1,366 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <new>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <type_traits>
+
+#include "Core/Public/Debug/Debug.h"
+#include "Core/Public/Common/Common.h"
+#include "Core/Public/Memory/FrameAllocator.h"
+#include "Core/Public/Containers/TDynamicArray.h"
+#include "Core/Public/Algorithm/GeneralUtilities.h"
+#include "Core/Public/Threading/TWorkStealingQueue.h"
+
+namespace Forge {
+	namespace Threading
+	{
+		/**
+		 * @brief The number of jobs each worker's deque holds before further
+		 * jobs are run inline.
+		 */
+		constexpr Size JOB_QUEUE_CAPACITY = 4096;
+
+		/**
+		 * @brief The default number of bytes of each frame of a worker's job
+		 * allocator.
+		 */
+		constexpr Size JOB_FRAME_SIZE = 256 * 1024;
+
+		class JobCounter;
+
+		namespace Internal
+		{
+			/**
+			 * @brief Header of a job, the callable it runs follows the header
+			 * in the same allocation.
+			 */
+			struct Job
+			{
+				using JobFunc = Void(*)(Job*);
+
+				JobFunc m_function;
+				JobCounter* m_counter;
+				Job* m_next;
+				Bool m_is_heap_allocated;
+			};
+
+			/**
+			 * @brief A job running a callable object, which it destroys once it
+			 * has run.
+			 */
+			template<typename InFunction>
+			struct TJob : public Job
+			{
+				InFunction m_callable;
+
+				template<typename InArg>
+				TJob(InArg&& callable)
+					: Job{ &TJob::Execute, nullptr, nullptr, false }, m_callable(Algorithm::Forward<InArg>(callable)) {}
+
+				static Void Execute(Job* job)
+				{
+					TJob* self = static_cast<TJob*>(job);
+
+					self->m_callable();
+					self->~TJob();
+				}
+			};
+		}
+
+		/**
+		 * @brief Counts the unfinished jobs of a group of jobs.
+		 *
+		 * Every job run with a counter increments it, and decrements it once
+		 * it has finished. Jobs can be made to depend on a counter, they are
+		 * held by the counter and scheduled the moment it reaches zero.
+		 *
+		 * A counter must be waited on with JobSystem::Wait() before it is
+		 * destroyed or reused.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API JobCounter
+		{
+		FORGE_CLASS_NONCOPYABLE(JobCounter)
+
+		private:
+			friend class JobSystem;
+
+		private:
+			std::atomic<Size> m_count;
+
+		private:
+			std::atomic<Bool> m_is_locked;
+
+		private:
+			Internal::Job* m_continuations;
+
+		public:
+			JobCounter(Void)
+				: m_count(0), m_is_locked(false), m_continuations(nullptr) {}
+
+		public:
+			~JobCounter(Void) = default;
+
+		private:
+			/**
+			 * @brief Acquires the lock guarding the list of dependent jobs.
+			 */
+			Void Lock(Void)
+			{
+				while (m_is_locked.exchange(true, std::memory_order_acquire))
+					while (m_is_locked.load(std::memory_order_relaxed))
+						std::this_thread::yield();
+			}
+
+			/**
+			 * @brief Releases the lock guarding the list of dependent jobs.
+			 */
+			Void Unlock(Void)
+			{
+				m_is_locked.store(false, std::memory_order_release);
+			}
+
+		public:
+			/**
+			 * @brief Gets the number of unfinished jobs.
+			 *
+			 * @return Size storing the number of unfinished jobs.
+			 */
+			Size GetCount(Void) const
+			{
+				return m_count.load(std::memory_order_acquire);
+			}
+
+			/**
+			 * @brief Checks whether every job run with the counter finished.
+			 *
+			 * @return True if the count is zero.
+			 */
+			Bool IsDone(Void) const
+			{
+				return GetCount() == 0;
+			}
+		};
+
+		/**
+		 * @brief Runs jobs on a pool of worker threads that steal work from
+		 * each other.
+		 *
+		 * Every worker owns a Chase-Lev deque it pushes the jobs it creates to
+		 * and pops them from, last in first out, while idle workers steal the
+		 * oldest jobs of random other workers. The thread that constructs the
+		 * job system is the first worker, and runs jobs while it waits on a
+		 * counter. Waiting inside a job is allowed and runs other jobs too.
+		 *
+		 * Jobs and the callables they run are copied into the frame allocator
+		 * of the worker creating them, so creating a job never takes a lock.
+		 * NextFrame() recycles the frame allocators, and must be called by the
+		 * first worker once all the jobs created in the frame have finished.
+		 *
+		 * Jobs may only be created by the first worker or by other jobs.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API JobSystem
+		{
+		FORGE_CLASS_NONCOPYABLE(JobSystem)
+
+		private:
+			struct alignas(64) Worker
+			{
+				TWorkStealingQueue<Internal::Job, JOB_QUEUE_CAPACITY> m_queue;
+				Memory::FrameAllocator m_frame_allocator;
+				JobSystem* m_system;
+				Size m_index;
+				U32 m_random;
+				std::thread m_thread;
+
+				Worker(JobSystem* system, Size index, Size frame_size)
+					: m_frame_allocator(frame_size), m_system(system), m_index(index), m_random((U32)index * 2654435761u + 1) {}
+			};
+
+		private:
+			Containers::TDynamicArray<Worker*> m_workers;
+
+		private:
+			std::mutex m_mutex;
+			std::condition_variable m_condition;
+
+		private:
+			std::atomic<Size> m_num_of_sleeping;
+			Size m_num_of_wakeups;
+
+		private:
+			std::atomic<Bool> m_is_running;
+
+		private:
+			Worker* m_previous_worker;
+
+		public:
+			/**
+			 * @brief Constructs a job system and starts its worker threads.
+			 *
+			 * @param[in] worker_count The number of workers including the calling
+			 * thread, or zero for one worker per hardware thread.
+			 * @param[in] frame_size   The number of bytes of each frame of every
+			 * worker's job allocator.
+			 */
+			JobSystem(Size worker_count = 0, Size frame_size = JOB_FRAME_SIZE);
+
+		public:
+			/**
+			 * @brief Stops and joins the worker threads, the jobs still queued
+			 * are not run.
+			 */
+			~JobSystem(Void);
+
+		private:
+			/**
+			 * @brief Gets the worker of the calling thread.
+			 */
+			Worker* GetCurrentWorker(Void);
+
+			/**
+			 * @brief Allocates memory for a job from the frame allocator of the
+			 * calling thread's worker, falling back to the heap once the frame
+			 * is full.
+			 */
+			VoidPtr AllocateJob(Size size, Size alignment, Bool& is_heap_allocated);
+
+			/**
+			 * @brief Schedules a job, or holds it until its dependency reaches
+			 * zero.
+			 */
+			Void Submit(Internal::Job* job, JobCounter* counter, JobCounter* dependency);
+
+			/**
+			 * @brief Pushes a job to the deque of the calling thread's worker and
+			 * wakes up a sleeping worker.
+			 */
+			Void Schedule(Internal::Job* job);
+
+			/**
+			 * @brief Pops a job from a worker's deque or steals one.
+			 */
+			Internal::Job* FindJob(Worker* worker);
+
+			/**
+			 * @brief Runs a job and signals its counter.
+			 */
+			Void Execute(Internal::Job* job);
+
+			/**
+			 * @brief The loop run by the worker threads.
+			 */
+			Void WorkerMain(Worker* worker);
+
+		private:
+			/**
+			 * @brief Runs a function on a range, splitting off half of the
+			 * range as a new job while it is larger than the batch size.
+			 */
+			template<typename InFunction>
+			Void RunRange(const InFunction* function, Size begin, Size end, Size batch_size, JobCounter* counter)
+			{
+				while (end - begin > batch_size)
+				{
+					Size middle = begin + (end - begin) / 2;
+
+					Run([this, function, middle, end, batch_size, counter]()
+					{
+						RunRange(function, middle, end, batch_size, counter);
+					}, counter);
+
+					end = middle;
+				}
+
+				(*function)(begin, end);
+			}
+
+		public:
+			/**
+			 * @brief Gets the number of workers, including the thread that
+			 * constructed the job system.
+			 *
+			 * @return Size storing the number of workers.
+			 */
+			Size GetWorkerCount(Void) const
+			{
+				return m_workers.GetCount();
+			}
+
+		public:
+			/**
+			 * @brief Runs a callable object as a job.
+			 *
+			 * @param[in] function   The callable object to run, it is copied
+			 * into the job.
+			 * @param[in] counter    The counter to increment now and decrement
+			 * once the job finished, or nullptr.
+			 * @param[in] dependency The counter that must reach zero before the
+			 * job is scheduled, or nullptr to schedule the job now.
+			 */
+			template<typename InFunction>
+			Void Run(InFunction&& function, JobCounter* counter = nullptr, JobCounter* dependency = nullptr)
+			{
+				using JobType = Internal::TJob<typename std::decay<InFunction>::type>;
+
+				Bool is_heap_allocated;
+				VoidPtr address = AllocateJob(sizeof(JobType), alignof(JobType), is_heap_allocated);
+
+				JobType* job = new (address) JobType(Algorithm::Forward<InFunction>(function));
+				job->m_is_heap_allocated = is_heap_allocated;
+
+				Submit(job, counter, dependency);
+			}
+
+			/**
+			 * @brief Runs jobs until a counter reaches zero.
+			 *
+			 * @param[in] counter The counter to wait on.
+			 */
+			Void Wait(JobCounter* counter);
+
+			/**
+			 * @brief Calls a function on batches of a range in parallel and
+			 * waits for all of them.
+			 *
+			 * The range is split in halves recursively, so idle workers steal
+			 * large halves first and the batches spread across the workers
+			 * after a few steals.
+			 *
+			 * @param[in] count      The number of elements of the range.
+			 * @param[in] batch_size The maximum number of elements per call.
+			 * @param[in] function   The function to call with the beginning and
+			 * end of each batch.
+			 */
+			template<typename InFunction>
+			Void ParallelFor(Size count, Size batch_size, const InFunction& function)
+			{
+				if (!count)
+					return;
+
+				JobCounter counter;
+
+				RunRange(&function, 0, count, batch_size ? batch_size : 1, &counter);
+
+				Wait(&counter);
+			}
+
+			/**
+			 * @brief Recycles the frame allocators of all the workers.
+			 *
+			 * Jobs created during the last frame stay valid until the next call,
+			 * but every job created before must have finished.
+			 */
+			Void NextFrame(Void);
+		};
+	}
+}
+
+#endif // JOB_SYSTEM_H
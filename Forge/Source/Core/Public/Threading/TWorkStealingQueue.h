@@ -0,0 +1,155 @@
+#ifndef T_WORK_STEALING_QUEUE_H
+#define T_WORK_STEALING_QUEUE_H
+
+#include <atomic>
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+
+namespace Forge {
+	namespace Threading
+	{
+		/**
+		 * @brief Bounded Chase-Lev work-stealing deque of pointers.
+		 *
+		 * A single owner thread pushes and pops at the bottom of the deque
+		 * without contention, while any number of thief threads steal from
+		 * the top. Only the last element is contended between the owner and
+		 * the thieves, which is resolved with a compare-and-swap on the top
+		 * index.
+		 *
+		 * The deque has a fixed power-of-two capacity and never allocates,
+		 * Push() fails once it is full.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InElementType, Size InCapacity>
+		class TWorkStealingQueue
+		{
+			static_assert((InCapacity & (InCapacity - 1)) == 0, "The capacity of a work-stealing queue must be a power of two");
+
+		FORGE_CLASS_NONCOPYABLE(TWorkStealingQueue)
+
+		private:
+			static constexpr I64 MASK = (I64)InCapacity - 1;
+
+		private:
+			alignas(64) std::atomic<I64> m_top;
+			alignas(64) std::atomic<I64> m_bottom;
+
+		private:
+			alignas(64) std::atomic<InElementType*> m_elements[InCapacity];
+
+		public:
+			TWorkStealingQueue(Void)
+				: m_top(0), m_bottom(0)
+			{
+				for (Size i = 0; i < InCapacity; i++)
+					m_elements[i].store(nullptr, std::memory_order_relaxed);
+			}
+
+		public:
+			~TWorkStealingQueue(Void) = default;
+
+		public:
+			/**
+			 * @brief Gets the approximate number of elements in the deque.
+			 *
+			 * @return Size storing the number of elements.
+			 */
+			Size GetCount(Void) const
+			{
+				I64 count = m_bottom.load(std::memory_order_relaxed) - m_top.load(std::memory_order_relaxed);
+
+				return count > 0 ? (Size)count : 0;
+			}
+
+		public:
+			/**
+			 * @brief Pushes an element at the bottom of the deque, must only be
+			 * called by the owner thread.
+			 *
+			 * @param[in] element The element to push, must not be nullptr.
+			 *
+			 * @return True if the element was pushed, false if the deque is
+			 * full.
+			 */
+			Bool Push(InElementType* element)
+			{
+				I64 bottom = m_bottom.load(std::memory_order_relaxed);
+				I64 top = m_top.load(std::memory_order_acquire);
+
+				if (bottom - top >= (I64)InCapacity)
+					return false;
+
+				m_elements[bottom & MASK].store(element, std::memory_order_relaxed);
+
+				/// Sequentially consistent, so a thread going to sleep after
+				/// finding the deque empty is seen by the pusher waking it.
+				m_bottom.store(bottom + 1, std::memory_order_seq_cst);
+
+				return true;
+			}
+
+			/**
+			 * @brief Pops the element at the bottom of the deque, must only be
+			 * called by the owner thread.
+			 *
+			 * @return Pointer to the popped element, or nullptr if the deque is
+			 * empty or its last element was stolen.
+			 */
+			InElementType* Pop(Void)
+			{
+				I64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+
+				m_bottom.store(bottom, std::memory_order_seq_cst);
+
+				I64 top = m_top.load(std::memory_order_seq_cst);
+
+				if (top > bottom)
+				{
+					m_bottom.store(bottom + 1, std::memory_order_relaxed);
+					return nullptr;
+				}
+
+				InElementType* element = m_elements[bottom & MASK].load(std::memory_order_relaxed);
+
+				if (top == bottom)
+				{
+					/// The last element, race the thieves for it.
+					if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+						element = nullptr;
+
+					m_bottom.store(bottom + 1, std::memory_order_relaxed);
+				}
+
+				return element;
+			}
+
+			/**
+			 * @brief Steals the element at the top of the deque, may be called
+			 * by any thread.
+			 *
+			 * @return Pointer to the stolen element, or nullptr if the deque is
+			 * empty or another thread took the element first.
+			 */
+			InElementType* Steal(Void)
+			{
+				I64 top = m_top.load(std::memory_order_seq_cst);
+				I64 bottom = m_bottom.load(std::memory_order_seq_cst);
+
+				if (top >= bottom)
+					return nullptr;
+
+				InElementType* element = m_elements[top & MASK].load(std::memory_order_relaxed);
+
+				if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					return nullptr;
+
+				return element;
+			}
+		};
+	}
+}
+
+#endif // T_WORK_STEALING_QUEUE_H
@@ -0,0 +1,421 @@
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include <new>
+#include <type_traits>
+
+#include <Core/Public/Debug/Debug.h>
+#include <Core/Public/Common/Common.h>
+#include <Core/Public/Memory/LinearAllocator.h>
+#include <Core/Public/Memory/MemoryUtilities.h>
+#include <Core/Public/Containers/THashMap.h>
+#include <Core/Public/Containers/TDynamicArray.h>
+#include <Core/Public/Algorithm/Hash/ConstStringHash.h>
+#include <Core/Public/Types/TMulticastDelegate.h>
+
+namespace Forge {
+	namespace Common
+	{
+		/**
+		 * @brief The number of bytes of each page events of a single type are
+		 * queued in.
+		 */
+		constexpr Size EVENT_PAGE_SIZE = 1024;
+
+		/**
+		 * @brief The default number of bytes of each of the two event queues.
+		 */
+		constexpr Size EVENT_QUEUE_SIZE = 256 * 1024;
+
+		namespace Internal
+		{
+			/**
+			 * @brief Header of a page of queued events of a single type, the
+			 * events follow the header in the same page.
+			 */
+			struct EventPage
+			{
+				EventPage* m_next;
+				Size m_count;
+			};
+
+			/**
+			 * @brief Base class of the per type event channels.
+			 *
+			 * The channel keeps the pages of events queued since the last sync
+			 * point apart from the pages being dispatched, so events published
+			 * by handlers are held for the next sync point.
+			 *
+			 * @author Karim Hisham
+			 */
+			class AbstractEventChannel
+			{
+			FORGE_CLASS_NONCOPYABLE(AbstractEventChannel)
+
+			protected:
+				EventPage* m_queued_head;
+				EventPage* m_queued_tail;
+
+			protected:
+				EventPage* m_dispatched_head;
+
+			protected:
+				Bool m_is_queued;
+
+			public:
+				AbstractEventChannel(Void)
+					: m_queued_head(nullptr), m_queued_tail(nullptr), m_dispatched_head(nullptr), m_is_queued(false) {}
+
+			public:
+				virtual ~AbstractEventChannel(Void) = default;
+
+			public:
+				/**
+				 * @brief Checks whether the channel is in the list of channels
+				 * with queued events, marking it if it is not.
+				 *
+				 * @return True if the channel was already marked.
+				 */
+				Bool MarkQueued(Void)
+				{
+					Bool is_queued = m_is_queued;
+					m_is_queued = true;
+					return is_queued;
+				}
+
+				/**
+				 * @brief Takes the queued pages out for dispatch.
+				 */
+				Void Detach(Void)
+				{
+					m_dispatched_head = m_queued_head;
+					m_queued_head = m_queued_tail = nullptr;
+					m_is_queued = false;
+				}
+
+			public:
+				/**
+				 * @brief Delivers the detached events to every handler, then
+				 * destroys them.
+				 */
+				virtual Void Dispatch(Void) = 0;
+			};
+
+			/**
+			 * @brief Holds the handlers and the queued events of a single event
+			 * type.
+			 *
+			 * Events are constructed in pages of contiguous events obtained
+			 * from the event bus's queue allocator, and delivered a page at a
+			 * time to one handler after another.
+			 *
+			 * @author Karim Hisham
+			 */
+			template<typename InEvent>
+			class TEventChannel : public AbstractEventChannel
+			{
+			public:
+				using HandlerType = TMulticastDelegate<Void(const InEvent&)>;
+
+			private:
+				static constexpr Size EVENT_ALIGNMENT = alignof(InEvent) > alignof(EventPage) ? alignof(InEvent) : alignof(EventPage);
+				static constexpr Size EVENT_OFFSET = (sizeof(EventPage) + alignof(InEvent) - 1) & ~(alignof(InEvent) - 1);
+				static constexpr Size PAGE_CAPACITY = EVENT_OFFSET + sizeof(InEvent) < EVENT_PAGE_SIZE ? (EVENT_PAGE_SIZE - EVENT_OFFSET) / sizeof(InEvent) : 1;
+
+			public:
+				HandlerType m_handlers;
+
+			public:
+				~TEventChannel(Void)
+				{
+					DestroyPages(m_queued_head);
+				}
+
+			private:
+				/**
+				 * @brief Gets the first event of a page.
+				 */
+				static InEvent* GetEvents(EventPage* page)
+				{
+					return reinterpret_cast<InEvent*>(reinterpret_cast<BytePtr>(page) + EVENT_OFFSET);
+				}
+
+				/**
+				 * @brief Destroys the events of a list of pages, the pages
+				 * themselves are released with the queue allocator.
+				 */
+				static Void DestroyPages(EventPage* page)
+				{
+					if constexpr (!std::is_trivially_destructible<InEvent>::value)
+						for (; page; page = page->m_next)
+							Memory::Destruct(GetEvents(page), page->m_count);
+				}
+
+			public:
+				/**
+				 * @brief Constructs an event at the end of the queue.
+				 *
+				 * @param[in] allocator The allocator to obtain a new page from
+				 * when the last page is full.
+				 * @param[in] args      The arguments to construct the event with.
+				 *
+				 * @return True if the event was queued, false if the allocator is
+				 * out of memory.
+				 */
+				template<typename... InArgs>
+				Bool Enqueue(Memory::AbstractAllocator* allocator, InArgs&&... args)
+				{
+					if (!m_queued_tail || m_queued_tail->m_count == PAGE_CAPACITY)
+					{
+						EventPage* page = static_cast<EventPage*>(allocator->Allocate(EVENT_OFFSET + PAGE_CAPACITY * sizeof(InEvent), (Byte)EVENT_ALIGNMENT));
+
+						if (!page)
+							return false;
+
+						page->m_next = nullptr;
+						page->m_count = 0;
+
+						if (m_queued_tail)
+							m_queued_tail->m_next = page;
+						else
+							m_queued_head = page;
+
+						m_queued_tail = page;
+					}
+
+					new (GetEvents(m_queued_tail) + m_queued_tail->m_count) InEvent(Algorithm::Forward<InArgs>(args)...);
+					m_queued_tail->m_count++;
+
+					return true;
+				}
+
+			public:
+				Void Dispatch(Void) override
+				{
+					EventPage* head = m_dispatched_head;
+					m_dispatched_head = nullptr;
+
+					for (EventPage* page = head; page; page = page->m_next)
+						m_handlers.BroadcastBatch(GetEvents(page), page->m_count);
+
+					DestroyPages(head);
+				}
+			};
+		}
+
+		/**
+		 * @brief Delivers events to the handlers subscribed to their type.
+		 *
+		 * Events published to the bus are queued and delivered at the sync
+		 * point, Dispatch(), usually called once per frame. Each event type has
+		 * its own channel with its handlers in a contiguous TMulticastDelegate
+		 * and its queued events in contiguous pages, so dispatch costs one
+		 * virtual call per event type with queued events and each handler is
+		 * invoked on the whole batch before the next handler runs.
+		 *
+		 * Queued events live in one of two LinearAllocators that are swapped at
+		 * every sync point and reset once the events queued in them have been
+		 * dispatched, so queueing an event never reaches the heap. Events
+		 * published while dispatching are queued for the next sync point.
+		 *
+		 * Events that must be handled right away can be sent with Send(), which
+		 * invokes the handlers before returning.
+		 *
+		 * The event bus is not thread-safe.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API EventBus
+		{
+		FORGE_CLASS_NONCOPYABLE(EventBus)
+
+		private:
+			Memory::LinearAllocator m_front_allocator;
+			Memory::LinearAllocator m_back_allocator;
+
+		private:
+			Containers::THashMap<Algorithms::ConstStringHash, Internal::AbstractEventChannel*> m_channels;
+
+		private:
+			Containers::TDynamicArray<Internal::AbstractEventChannel*> m_queued_channels[2];
+
+		private:
+			Size m_queued_count[2];
+
+		private:
+			Size m_queue_index;
+
+		private:
+			Bool m_is_dispatching;
+
+		public:
+			/**
+			 * @brief Default constructor.
+			 *
+			 * @param[in] queue_size The number of bytes of each of the two event
+			 * queues.
+			 */
+			EventBus(Size queue_size = EVENT_QUEUE_SIZE);
+
+		public:
+			~EventBus(Void);
+
+		private:
+			/**
+			 * @brief Gets the signature of this function, which names the event
+			 * type, so it is the same in every module built by one compiler.
+			 */
+			template<typename InEvent>
+			static constexpr ConstCharPtr GetEventTypeSignature(Void)
+			{
+				return FORGE_FUNC_SIGNATURE;
+			}
+
+			/**
+			 * @brief Gets the id of an event type, used to find its channel.
+			 *
+			 * The id is the hash of the type name computed at compile time,
+			 * unlike a counter it does not depend on the module the event is
+			 * published or subscribed from.
+			 */
+			template<typename InEvent>
+			static constexpr Algorithms::ConstStringHash GetEventTypeId(Void)
+			{
+				return Algorithms::ConstStringHash(GetEventTypeSignature<InEvent>());
+			}
+
+		private:
+			/**
+			 * @brief Gets the queue allocator events are currently queued in.
+			 */
+			Memory::LinearAllocator* GetQueueAllocator(Size index)
+			{
+				return index ? &m_back_allocator : &m_front_allocator;
+			}
+
+			/**
+			 * @brief Finds the channel of an event type.
+			 *
+			 * @return Pointer to the channel, or nullptr if there is none.
+			 */
+			template<typename InEvent>
+			Internal::TEventChannel<InEvent>* FindChannel(Void)
+			{
+				constexpr Algorithms::ConstStringHash id = GetEventTypeId<InEvent>();
+
+				Internal::AbstractEventChannel** channel = m_channels.Find(id);
+
+				return channel ? static_cast<Internal::TEventChannel<InEvent>*>(*channel) : nullptr;
+			}
+
+			/**
+			 * @brief Gets the channel of an event type, creating it if it does
+			 * not exist.
+			 */
+			template<typename InEvent>
+			Internal::TEventChannel<InEvent>* GetChannel(Void)
+			{
+				constexpr Algorithms::ConstStringHash id = GetEventTypeId<InEvent>();
+
+				Internal::AbstractEventChannel*& channel = m_channels[id];
+
+				if (!channel)
+					channel = new Internal::TEventChannel<InEvent>();
+
+				return static_cast<Internal::TEventChannel<InEvent>*>(channel);
+			}
+
+		public:
+			/**
+			 * @brief Gets the number of events queued for the next sync point.
+			 *
+			 * @return Size storing the number of queued events.
+			 */
+			Size GetNumOfQueuedEvents(Void) const
+			{
+				return m_queued_count[m_queue_index];
+			}
+
+		public:
+			/**
+			 * @brief Subscribes a handler to an event type.
+			 *
+			 * @param[in] handler The delegate to invoke on every event of the
+			 * type.
+			 *
+			 * @return DelegateHandle identifying the subscription.
+			 */
+			template<typename InEvent>
+			DelegateHandle Subscribe(typename Internal::TEventChannel<InEvent>::HandlerType::DelegateType handler)
+			{
+				return GetChannel<InEvent>()->m_handlers.Add(Move(handler));
+			}
+
+			/**
+			 * @brief Unsubscribes a handler from an event type.
+			 *
+			 * @param[in] handle The handle returned on subscription.
+			 *
+			 * @return True if the handler was subscribed.
+			 */
+			template<typename InEvent>
+			Bool Unsubscribe(DelegateHandle handle)
+			{
+				Internal::TEventChannel<InEvent>* channel = FindChannel<InEvent>();
+
+				return channel ? channel->m_handlers.Remove(handle) : false;
+			}
+
+		public:
+			/**
+			 * @brief Queues an event, to be delivered at the next sync point.
+			 *
+			 * @param[in] args The arguments to construct the event with.
+			 *
+			 * @return True if the event was queued, false if the event queue is
+			 * out of memory.
+			 */
+			template<typename InEvent, typename... InArgs>
+			Bool Publish(InArgs&&... args)
+			{
+				Internal::TEventChannel<InEvent>* channel = GetChannel<InEvent>();
+
+				if (!channel->Enqueue(GetQueueAllocator(m_queue_index), Algorithm::Forward<InArgs>(args)...))
+				{
+					FORGE_ASSERT(false, "Event queue is out of memory.")
+					return false;
+				}
+
+				if (!channel->MarkQueued())
+					m_queued_channels[m_queue_index].PushBack(channel);
+
+				m_queued_count[m_queue_index]++;
+
+				return true;
+			}
+
+			/**
+			 * @brief Delivers an event to its handlers before returning.
+			 *
+			 * @param[in] event The event to deliver.
+			 */
+			template<typename InEvent>
+			Void Send(const InEvent& event)
+			{
+				Internal::TEventChannel<InEvent>* channel = FindChannel<InEvent>();
+
+				if (channel)
+					channel->m_handlers.Broadcast(event);
+			}
+
+		public:
+			/**
+			 * @brief Delivers every queued event, type by type in the order the
+			 * types were first published, and releases the event queue.
+			 */
+			Void Dispatch(Void);
+		};
+	}
+}
+
+#endif // EVENT_BUS_H
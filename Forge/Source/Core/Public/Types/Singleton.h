@@ -1,5 +1,5 @@
 #ifndef SINGLETON_H
-#define SINGELTON_H
+#define SINGLETON_H
 
 #include "../Common/Compiler.h"
 
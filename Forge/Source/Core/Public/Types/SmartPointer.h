@@ -1,14 +1,19 @@
 #ifndef SMART_POINTER_H
 #define SMART_POINTER_H
 
+#include <new>
+
 #include "Core/Public/RTTI/RefCounter.h"
 
 #include "Core/Public/CoreFwd.h"
 
-#include <Core/Public/Debug/Debug.h>
-#include <Core/Public/Common/Common.h>
-#include <Core/Public/Types/TDelegate.h>
-#include <Core/Public/Algorithm/GeneralUtilities.h>
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/TypeDefinitions.h"
+#include "Core/Public/Common/PreprocessorUtilities.h"
+
+#include "Core/Public/Memory/AbstractAllocator.h"
+
+#include "Core/Public/Algorithm/GeneralUtilities.h"
 
 using namespace Forge::Common;
 using namespace Forge::Algorithm;
@@ -16,26 +21,232 @@ using namespace Forge::Algorithm;
 namespace Forge {
 	namespace Common
 	{
+		namespace Internal
+		{
+			/**
+			 * @brief The block shared by every TSharedPtr and TWeakPtr managing
+			 * the same pointer, holding the reference counts and knowing how to
+			 * destroy the object and itself.
+			 *
+			 * The strong count is the number of TSharedPtr objects. The weak
+			 * count is the number of TWeakPtr objects, plus one held by all the
+			 * TSharedPtr objects together. The object is destroyed when the
+			 * strong count reaches zero, the block when the weak count does.
+			 *
+			 * @author Karim Hisham
+			 */
+			class SharedControlBlock
+			{
+			FORGE_CLASS_NONCOPYABLE(SharedControlBlock)
+
+			private:
+				RTTI::TRefCount<RTTI::AtomicRefCountPolicy> m_ref_count;
+
+			public:
+				SharedControlBlock(Void)
+					: m_ref_count(1, 1) {}
+
+			protected:
+				virtual ~SharedControlBlock(Void) = default;
+
+			protected:
+				/**
+				 * @brief Destroys the managed object.
+				 */
+				virtual Void DestroyObject(Void) = 0;
+
+				/**
+				 * @brief Destroys the control block and releases its memory.
+				 */
+				virtual Void DestroyBlock(Void) = 0;
+
+			public:
+				FORGE_FORCE_INLINE ConstSize GetRefCount(Void) const { return m_ref_count.GetRefCount(); }
+
+			public:
+				FORGE_FORCE_INLINE Void IncrementRef(Void)     { m_ref_count.IncrementRef(); }
+				FORGE_FORCE_INLINE Bool TryIncrementRef(Void)  { return m_ref_count.TryIncrementRef(); }
+				FORGE_FORCE_INLINE Void IncrementWeakRef(Void) { m_ref_count.IncrementWeakRef(); }
+
+				Void DecrementRef(Void)
+				{
+					if (m_ref_count.DecrementRef() == 0)
+					{
+						DestroyObject();
+						DecrementWeakRef();
+					}
+				}
+
+				Void DecrementWeakRef(Void)
+				{
+					if (m_ref_count.DecrementWeakRef() == 0)
+						DestroyBlock();
+				}
+			};
+
+			/**
+			 * @brief The default deleter of objects adopted by TSharedPtr, it
+			 * holds no state so storing it takes no space.
+			 */
+			template<typename InType>
+			struct TDefaultDeleter
+			{
+				Void operator ()(InType* ptr) const { delete ptr; }
+			};
+
+			/**
+			 * @brief Control block of an object allocated separately and adopted
+			 * by TSharedPtr, storing the deleter to destroy it with.
+			 *
+			 * @author Karim Hisham
+			 */
+			template<typename InType, typename InDeleter>
+			class TPointerControlBlock final : public SharedControlBlock
+			{
+			private:
+				InType* m_raw_ptr;
+				InDeleter m_deleter;
+
+			public:
+				TPointerControlBlock(InType* ptr, InDeleter deleter)
+					: m_raw_ptr(ptr), m_deleter(Algorithm::Move(deleter)) {}
+
+			protected:
+				Void DestroyObject(Void) override { m_deleter(m_raw_ptr); }
+				Void DestroyBlock(Void) override  { delete this; }
+			};
+
+			/**
+			 * @brief Control block storing the object itself right after the
+			 * counts, created by MakeShared() in a single allocation.
+			 *
+			 * @author Karim Hisham
+			 */
+			template<typename InType>
+			class TInlineControlBlock final : public SharedControlBlock
+			{
+			private:
+				Memory::AbstractAllocator* m_allocator;
+
+			private:
+				alignas(InType) Byte m_storage[sizeof(InType)];
+
+			public:
+				template<typename... InArgs>
+				TInlineControlBlock(Memory::AbstractAllocator* allocator, InArgs&&... args)
+					: m_allocator(allocator)
+				{
+					new (m_storage) InType(Algorithm::Forward<InArgs>(args)...);
+				}
+
+			public:
+				FORGE_FORCE_INLINE InType* GetObject(Void) { return reinterpret_cast<InType*>(m_storage); }
+
+			protected:
+				Void DestroyObject(Void) override { GetObject()->~InType(); }
+
+				Void DestroyBlock(Void) override
+				{
+					Memory::AbstractAllocator* allocator = m_allocator;
+
+					if (!allocator)
+					{
+						delete this;
+						return;
+					}
+
+					this->~TInlineControlBlock();
+					allocator->Deallocate(this);
+				}
+			};
+		}
+
+		/**
+		 * @brief Base class of objects that create TSharedPtr to themselves,
+		 * sharing ownership with the TSharedPtr already managing them.
+		 *
+		 * The TSharedPtr pointer constructors and MakeShared() record the
+		 * control block of the first TSharedPtr managing the object, as a
+		 * weak reference so the object does not keep itself alive. Copies of
+		 * the object are not managed by the original control block.
+		 *
+		 * @author Karim Hisham
+		 */
+		class SharedFromThis
+		{
+		template<typename InOtherType>
+		friend class TSharedPtr;
+
+		private:
+			mutable Internal::SharedControlBlock* m_weak_control_block;
+
+		protected:
+			SharedFromThis(Void)
+				: m_weak_control_block(nullptr) {}
+
+			SharedFromThis(const SharedFromThis&)
+				: m_weak_control_block(nullptr) {}
+
+		protected:
+			~SharedFromThis(Void)
+			{
+				if (m_weak_control_block)
+					m_weak_control_block->DecrementWeakRef();
+			}
+
+		protected:
+			SharedFromThis& operator =(const SharedFromThis&) { return *this; }
+
+		protected:
+			/**
+			 * @brief Shares ownership of the object with the TSharedPtr
+			 * managing it.
+			 *
+			 * @param[in] ptr The object, as a pointer to the type to return.
+			 *
+			 * @returns TSharedPtr storing the pointer, or an empty one if no
+			 * TSharedPtr manages the object.
+			 */
+			template<typename InType>
+			TSharedPtr<InType> GetSharedFromThis(InType* ptr) const;
+		};
+
 		/**
 		 * @brief Manages the storage of raw pointers, provides garbage-collection,
 		 * and allows multiple TSharedPtr to share management of the same pointer.
 		 * This ultimatly prevents accidental memory leaks and helps in monitoring
 		 * shared memory locations.
-		 * 
+		 *
 		 * Objects of TSharedPtr have the ability of taking ownership of a pointer
-		 * and share that ownership. Upon taking ownership, a reference counter 
+		 * and share that ownership. Upon taking ownership, a reference counter
 		 * is incremented indicating the number of TSharedPtr objects managing the
-		 * pointer. 
-		 * 
+		 * pointer.
+		 *
 		 * When a TSharedPtr is destroyed the reference counter is decremented.
 		 * A TSharedPtr becomes responsible for the deletion of the stored pointer
 		 * when it is the last object to release ownership.
-		 * 
+		 *
+		 * A TSharedPtr is two pointers wide, the stored pointer and the control
+		 * block holding the counts and the deleter, which is shared by every
+		 * copy. Use MakeShared() to allocate the object and its control block
+		 * together.
+		 *
 		 * @author Karim Hisham
 		 */
 		template<typename InType>
 		class TSharedPtr final
 		{
+		template<typename InOtherType>
+		friend class TSharedPtr;
+
+		template<typename InOtherType>
+		friend class TWeakPtr;
+
+		template<typename InOtherType, typename... InArgs>
+		friend TSharedPtr<InOtherType> MakeShared(Memory::AbstractAllocator* allocator, InArgs&&... args);
+
+		friend class SharedFromThis;
+
 		public:
 			using Type         = InType;
 			using TypePtr      = InType*;
@@ -58,245 +269,234 @@ namespace Forge {
 			TypePtr m_raw_ptr;
 
 		private:
-			TDelegate<Void(TypePtr)> m_deleter_callback;
+			Internal::SharedControlBlock* m_control_block;
+
+		private:
+			/**
+			 * @brief Control block constructor, adopts a reference already
+			 * counted in the control block.
+			 */
+			TSharedPtr(TypePtr ptr, Internal::SharedControlBlock* control_block)
+				: m_raw_ptr(ptr), m_control_block(control_block) {}
+
+		private:
+			/**
+			 * @brief Records the control block in objects deriving from
+			 * SharedFromThis, unless a TSharedPtr already manages them.
+			 */
+			static Void EnableSharedFromThis(const SharedFromThis* object, Internal::SharedControlBlock* control_block)
+			{
+				if (object && !object->m_weak_control_block)
+				{
+					control_block->IncrementWeakRef();
+					object->m_weak_control_block = control_block;
+				}
+			}
+
+			static Void EnableSharedFromThis(...) {}
 
 		public:
 			/**
 			 * @brief Default constructor.
 			 */
 			TSharedPtr(Void)
-				: m_raw_ptr(nullptr) 
+				: m_raw_ptr(nullptr), m_control_block(nullptr) {}
+
+			/**
+			 * @brief Null pointer constructor.
+			 */
+			TSharedPtr(decltype(nullptr))
+				: m_raw_ptr(nullptr), m_control_block(nullptr) {}
+
+			/**
+			 * @brief Pointer constructor, the pointer is released with delete.
+			 */
+			explicit TSharedPtr(TypePtr ptr)
+				: m_raw_ptr(ptr), m_control_block(nullptr)
 			{
-				m_deleter_callback = [](TypePtr ptr) -> Void
+				if (ptr)
 				{
-					delete ptr;
-					return;
-				};
+					m_control_block = new Internal::TPointerControlBlock<Type, Internal::TDefaultDeleter<Type>>(ptr, Internal::TDefaultDeleter<Type>());
+
+					EnableSharedFromThis(ptr, m_control_block);
+				}
 			}
 
 			/**
-			 * @brief Pointer constructor.
+			 * @brief Pointer and Deleter constructor, the deleter is stored once
+			 * in the control block and called with the pointer.
 			 */
-			TSharedPtr(TypePtr ptr)
-				: m_raw_ptr(ptr)
+			template<typename InDeleter>
+			TSharedPtr(TypePtr ptr, InDeleter deleter)
+				: m_raw_ptr(ptr), m_control_block(nullptr)
 			{
-				m_deleter_callback = [](ValueTypePtr ptr) -> Void
+				if (ptr)
 				{
-					delete ptr;
-					return;
-				};
+					m_control_block = new Internal::TPointerControlBlock<Type, InDeleter>(ptr, Algorithm::Move(deleter));
+
+					EnableSharedFromThis(ptr, m_control_block);
+				}
 			}
-			
-			/**
-			 * @brief Pointer and Deleter constructor.
-			 */
-			TSharedPtr(TypePtr ptr, TDelegate<Void(TypePtr)> del)
-				: m_raw_ptr(ptr), m_deleter_callback(del) {}
-		   
+
 		public:
 			/**
 			 * @brief Shared pointer move constructor.
 			 */
 			TSharedPtr(SelfTypeMoveRef rhs)
+				: m_raw_ptr(rhs.m_raw_ptr), m_control_block(rhs.m_control_block)
 			{
-				*this = Move(rhs);
+				rhs.m_raw_ptr = nullptr;
+				rhs.m_control_block = nullptr;
 			}
 
 			/**
 			 * @brief Shared pointer copy constructor.
 			 */
 			TSharedPtr(ConstSelfTypeRef rhs)
+				: m_raw_ptr(rhs.m_raw_ptr), m_control_block(rhs.m_control_block)
 			{
-				*this = rhs;
+				if (m_control_block)
+					m_control_block->IncrementRef();
 			}
 
 			/**
-			 * @brief Weak pointer move constructor.
+			 * @brief Shared pointer to a derived type move constructor.
 			 */
-			TSharedPtr(TWeakPtr<Type>&& rhs)
+			template<typename InOtherType>
+			TSharedPtr(TSharedPtr<InOtherType>&& rhs)
+				: m_raw_ptr(rhs.m_raw_ptr), m_control_block(rhs.m_control_block)
 			{
-				*this = Move(rhs);
+				rhs.m_raw_ptr = nullptr;
+				rhs.m_control_block = nullptr;
 			}
 
 			/**
-			 * @brief Weak pointer copy constructor.
+			 * @brief Shared pointer to a derived type copy constructor.
 			 */
-			TSharedPtr(const TWeakPtr<Type>& rhs)
+			template<typename InOtherType>
+			TSharedPtr(const TSharedPtr<InOtherType>& rhs)
+				: m_raw_ptr(rhs.m_raw_ptr), m_control_block(rhs.m_control_block)
 			{
-				*this = rhs;
+				if (m_control_block)
+					m_control_block->IncrementRef();
 			}
-			
-		public:
+
 			/**
-			 * @brief Default constructor.
+			 * @brief Weak pointer constructor, shares ownership of the pointer
+			 * if it has not expired, otherwise constructs an empty TSharedPtr.
 			 */
-			~TSharedPtr(Void)
+			explicit TSharedPtr(const TWeakPtr<Type>& rhs)
+				: m_raw_ptr(nullptr), m_control_block(nullptr)
 			{
-				m_raw_ptr->DecrementRef();
-
-				if (!m_raw_ptr->GetRefCount())
-					m_deleter_callback(m_raw_ptr);
+				if (rhs.m_control_block && rhs.m_control_block->TryIncrementRef())
+				{
+					m_raw_ptr = rhs.m_raw_ptr;
+					m_control_block = rhs.m_control_block;
+				}
 			}
 
 		public:
 			/**
-			 * @brief Pointer copy assigment.
+			 * @brief Destructor.
 			 */
-			SelfTypeRef operator =(TypePtr ptr)
+			~TSharedPtr(Void)
 			{
-				if (m_raw_ptr == ptr)
-					return *this;
-
-				if (ptr)
-					ptr->IncrementRef();
-
-				m_raw_ptr->DecrementRef();
-
-				if (!m_raw_ptr->GetRefCount())
-					m_deleter_callback(m_raw_ptr);
-
-				m_raw_ptr = ptr;
-
-				return *this;
+				if (m_control_block)
+					m_control_block->DecrementRef();
 			}
-			
+
+		public:
 			/**
 			 * @brief Shared pointer move assigment.
 			 */
 			SelfTypeRef operator =(SelfTypeMoveRef rhs)
 			{
-				if (m_raw_ptr == rhs.m_raw_ptr)
-					return *this;
-
-				m_raw_ptr->DecrementRef();
-
-				if (!m_raw_ptr->GetRefCount())
-					m_deleter_callback(m_raw_ptr);
-
-				m_raw_ptr = rhs.m_raw_ptr;
-				rhs.m_raw_ptr = nullptr;
+				SelfType(Algorithm::Move(rhs)).Swap(*this);
 
 				return *this;
 			}
-			
+
 			/**
 			 * @brief Shared pointer copy assigment.
 			 */
 			SelfTypeRef operator =(ConstSelfTypeRef rhs)
 			{
-				if (m_raw_ptr == rhs.m_raw_ptr)
-					return *this;
-
-				if (rhs.m_raw_ptr)
-					rhs.m_raw_ptr->IncrementRef();
-
-				m_raw_ptr->DecrementRef();
-
-				if (!m_raw_ptr->GetRefCount())
-					m_deleter_callback(m_raw_ptr);
-
-				m_raw_ptr = rhs.m_raw_ptr;
+				SelfType(rhs).Swap(*this);
 
 				return *this;
 			}
 
 			/**
-			 * @brief Weak pointer move assigment.
+			 * @brief Null pointer assigment, releases ownership of the pointer.
 			 */
-			SelfTypeRef operator =(TWeakPtr<Type>&& rhs)
+			SelfTypeRef operator =(decltype(nullptr))
 			{
-				if (m_raw_ptr == rhs.m_raw_ptr)
-					return *this;
-
-				m_raw_ptr->DecrementRef();
-
-				if (!m_raw_ptr->GetRefCount())
-					m_deleter_callback(m_raw_ptr);
-
-				m_raw_ptr = rhs.m_raw_ptr;
-				rhs.m_raw_ptr = nullptr;
+				Reset();
 
 				return *this;
 			}
 
+		public:
 			/**
-			 * @brief Weak pointer copy assigment.
+			 * @brief Dereference operator.
 			 */
-			SelfTypeRef operator =(const TWeakPtr<Type>& rhs)
+			TypeRef operator *() const
 			{
-				if (m_raw_ptr == rhs.m_raw_ptr)
-					return *this;
-
-				if (rhs.m_raw_ptr)
-					rhs.m_raw_ptr->IncrementRef();
-
-				m_raw_ptr->DecrementRef();
+				FORGE_ASSERT(m_raw_ptr, "Shared pointer is storing a null pointer")
 
-				if (!m_raw_ptr->GetRefCount())
-					m_deleter_callback(m_raw_ptr);
-
-				m_raw_ptr = rhs.m_raw_ptr;
-
-				return *this;
+				return *m_raw_ptr;
 			}
 
 		public:
 			/**
-			 * @brief Dereference operator.
+			 * @brief Arrow operator.
 			 */
-			TypeRef operator *()
+			TypePtr operator ->() const
 			{
-				if (!m_raw_ptr)
-					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "Shared pointer is storing a null pointer")
+				FORGE_ASSERT(m_raw_ptr, "Shared pointer is storing a null pointer")
 
-				return *m_raw_ptr;
+				return m_raw_ptr;
 			}
 
 		public:
 			/**
-			 * @brief Arrow operator.
+			 * @brief Checks whether the stored pointer is not a null pointer.
 			 */
-			TypePtr operator ->()
+			explicit operator Bool(Void) const
 			{
-				if (!m_raw_ptr)
-					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "Shared pointer is storing a null pointer")
-
-				return m_raw_ptr;
+				return m_raw_ptr != nullptr;
 			}
-		
+
+		public:
+			template<typename InOtherType>
+			Bool operator ==(const TSharedPtr<InOtherType>& rhs) const { return m_raw_ptr == rhs.m_raw_ptr; }
+
+			template<typename InOtherType>
+			Bool operator !=(const TSharedPtr<InOtherType>& rhs) const { return m_raw_ptr != rhs.m_raw_ptr; }
+
 		public:
 			/**
 			 * @brief Gets the number of TSharedPtr objects that share ownership
 			 * over the same stored pointer including itself.
-			 * 
+			 *
 			 * @returns ConstSize storing the number of refrences to the stored
-			 * pointer.
-			 * 
-			 * @throws InvalidOperationException if the stored pointer is null.
+			 * pointer, or zero if the stored pointer is null.
 			 */
 			ConstSize GetRefCount(Void) const
 			{
-				if (!m_raw_ptr)
-					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "Shared pointer is storing a null pointer")
-				
-				return m_raw_ptr->GetRefCount();
+				return m_control_block ? m_control_block->GetRefCount() : 0;
 			}
 
 			/**
-			 * @brief Gets the stored pointer owned by the TSharedPtr object. 
-			 * 
+			 * @brief Gets the stored pointer owned by the TSharedPtr object.
+			 *
 			 * Avoid manually deleting the stored pointer as this may cause
-			 * undefined behaviour. 
-			 * 
+			 * undefined behaviour.
+			 *
 			 * @returns TypePtr storing the address of the stored pointer.
-			 * 
-			 * @throws InvalidOperationException if the stored pointer is null.
 			 */
-			TypePtr GetRawPtr(Void)
+			TypePtr GetRawPtr(Void) const
 			{
-				if (!m_raw_ptr)
-					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "Shared pointer is storing a null pointer")
-
 				return m_raw_ptr;
 			}
 
@@ -308,10 +508,7 @@ namespace Forge {
 			 */
 			Bool IsNull(Void) const
 			{
-				if (!m_raw_ptr)
-					return FORGE_TRUE;
-
-				return FORGE_FALSE;
+				return m_raw_ptr == nullptr;
 			}
 
 			/**
@@ -319,69 +516,74 @@ namespace Forge {
 			 * over its pointer with other shared pointers.
 			 *
 			 * @returns True if the TShartedPtr object is unique, otherwise false.
-			 * 
-			 * @throws InvalidOperationException if the stored pointer is null.
 			 */
 			Bool IsUnique(Void) const
 			{
-				if (!m_raw_ptr)
-					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "Shared pointer is storing a null pointer")
-
-				return FORGE_TRUE ? m_raw_ptr->GetRefCount() == 1 : FORGE_FALSE;
+				return GetRefCount() == 1;
 			}
 
 		public:
 			/**
 			 * @brief Swaps the content of the TSharedPtr object with the other,
 			 * without altering the reference count of either or destroying them.
-			 * 
+			 *
 			 * @param[in] other The TSharedPtr object to swap content with.
 			 */
 			Void Swap(SelfTypeRef other)
 			{
-				Algorithm::Swap(this, other);
+				Algorithm::Swap(m_raw_ptr, other.m_raw_ptr);
+				Algorithm::Swap(m_control_block, other.m_control_block);
 			}
 
 			/**
-			 * @brief Resets the raw pointer to null by default, or sets a new ownership of 
+			 * @brief Resets the raw pointer to null by default, or sets a new ownership of
 			 * the pointer passed and releases ownership of the old pointer.
-			 * 
+			 *
 			 * @param[in] ptr The new pointer that will be owned by the TSharedPtr object.
 			 */
 			Void Reset(TypePtr ptr = nullptr)
 			{
-				if (ptr)
-					ptr->IncrementRef();
-
-				m_raw_ptr->DecrementRef();
-
-				if (!m_raw_ptr->GetRefCount())
-					m_deleter_callback(m_raw_ptr);
-
-				m_raw_ptr = ptr;
+				SelfType(ptr).Swap(*this);
 			}
 		};
 
 		FORGE_TYPEDEF_TEMPLATE_DECL(TSharedPtr)
 
+		template<typename InType>
+		TSharedPtr<InType> SharedFromThis::GetSharedFromThis(InType* ptr) const
+		{
+			if (!m_weak_control_block || !m_weak_control_block->TryIncrementRef())
+				return TSharedPtr<InType>();
+
+			return TSharedPtr<InType>(ptr, m_weak_control_block);
+		}
+
 		/**
-		 * @brief Manages the storage of raw pointers, by holding non-owning 
-		 * "weak" references to data managed by TSharedPtr. Unlike TSharedPtr it 
-		 * does not provide garabge-collection. 
-		 * 
-		 * TWeakPtr models temporary ownership, allowing data to be accessed only 
-		 * if it exists, and may be deleted at any time. 
-		 * 
-		 * TWeakPtr is used to track the object, and is converted to TSharedPtr 
-		 * to assume temporary ownership and access the data. If the original 
-		 * TSharedPtr object is destroyed at this time, the object's lifetime 
+		 * @brief Manages the storage of raw pointers, by holding non-owning
+		 * "weak" references to data managed by TSharedPtr. Unlike TSharedPtr it
+		 * does not provide garabge-collection.
+		 *
+		 * TWeakPtr models temporary ownership, allowing data to be accessed only
+		 * if it exists, and may be deleted at any time.
+		 *
+		 * TWeakPtr is used to track the object, and is converted to TSharedPtr
+		 * to assume temporary ownership and access the data. If the original
+		 * TSharedPtr object is destroyed at this time, the object's lifetime
 		 * is extended until the temporary TSharedPtr is destroyed as well.
-		 * 
+		 *
+		 * A TWeakPtr keeps the control block alive, but not the object.
+		 *
 		 * @author Karim Hisham
 		 */
 		template<typename InType>
 		class TWeakPtr final
 		{
+		template<typename InOtherType>
+		friend class TSharedPtr;
+
+		template<typename InOtherType>
+		friend class TWeakPtr;
+
 		public:
 			using Type         = InType;
 			using TypePtr      = InType*;
@@ -403,146 +605,86 @@ namespace Forge {
 		private:
 			TypePtr m_raw_ptr;
 
+		private:
+			Internal::SharedControlBlock* m_control_block;
+
 		public:
+			/**
+			 * @brief Default constructor.
+			 */
 			TWeakPtr(Void)
-				: m_raw_ptr(nullptr) 
-			{
-				
-			}
-			TWeakPtr(ValueTypePtr ptr)
-				: m_raw_ptr(ptr) 
-			{
-				
-			}
+				: m_raw_ptr(nullptr), m_control_block(nullptr) {}
 
 		public:
-			TWeakPtr(TWeakPtr<ValueType>&& rhs)
+			/**
+			 * @brief Weak pointer move constructor.
+			 */
+			TWeakPtr(SelfTypeMoveRef rhs)
+				: m_raw_ptr(rhs.m_raw_ptr), m_control_block(rhs.m_control_block)
 			{
-				if (m_raw_ptr == rhs.m_raw_ptr)
-					return;
-
-				if (rhs.m_raw_ptr)
-					rhs.m_raw_ptr->IncrementWeakRef();
-
-				m_raw_ptr->DecrementWeakRef();
-
-				m_raw_ptr = rhs.m_raw_ptr;
 				rhs.m_raw_ptr = nullptr;
+				rhs.m_control_block = nullptr;
 			}
-			TWeakPtr(TSharedPtr<ValueType>&& rhs)
-			{
-				if (m_raw_ptr == rhs.m_raw_ptr)
-					return;
-
-				if (rhs.m_raw_ptr)
-					rhs.m_raw_ptr->IncrementWeakRef();
 
-				m_raw_ptr->DecrementWeakRef();
-
-				m_raw_ptr = rhs.m_raw_ptr;
-				rhs.m_raw_ptr = nullptr;
-			}
-			TWeakPtr(const TWeakPtr<ValueType>& rhs)
+			/**
+			 * @brief Weak pointer copy constructor.
+			 */
+			TWeakPtr(ConstSelfTypeRef rhs)
+				: m_raw_ptr(rhs.m_raw_ptr), m_control_block(rhs.m_control_block)
 			{
-				if (m_raw_ptr == rhs.m_raw_ptr)
-					return;
-
-				if (rhs.m_raw_ptr)
-					rhs.m_raw_ptr->IncrementWeakRef();
-
-				m_raw_ptr->DecrementWeakRef();
-
-				m_raw_ptr = rhs.m_raw_ptr;
+				if (m_control_block)
+					m_control_block->IncrementWeakRef();
 			}
-			TWeakPtr(const TSharedPtr<ValueType>& rhs)
-			{
-				if (m_raw_ptr == rhs.m_raw_ptr)
-					return;
-
-				if (rhs.m_raw_ptr)
-					rhs.m_raw_ptr->IncrementWeakRef();
 
-				m_raw_ptr->DecrementWeakRef();
-
-				m_raw_ptr = rhs.m_raw_ptr;
+			/**
+			 * @brief Shared pointer constructor.
+			 */
+			template<typename InOtherType>
+			TWeakPtr(const TSharedPtr<InOtherType>& rhs)
+				: m_raw_ptr(rhs.m_raw_ptr), m_control_block(rhs.m_control_block)
+			{
+				if (m_control_block)
+					m_control_block->IncrementWeakRef();
 			}
 
 		public:
-			~TWeakPtr()
+			/**
+			 * @brief Destructor.
+			 */
+			~TWeakPtr(Void)
 			{
-				m_raw_ptr->DecrementWeakRef();
+				if (m_control_block)
+					m_control_block->DecrementWeakRef();
 			}
 
 		public:
-			TWeakPtr<ValueType>& operator =(ValueTypePtr ptr)
+			/**
+			 * @brief Weak pointer move assigment.
+			 */
+			SelfTypeRef operator =(SelfTypeMoveRef rhs)
 			{
-				if (m_raw_ptr == ptr)
-					return *this;
-
-				if (ptr)
-					ptr->IncrementWeakRef();
-
-				m_raw_ptr->DecrementWeakRef();
-
-				m_raw_ptr = ptr;
+				SelfType(Algorithm::Move(rhs)).Swap(*this);
 
 				return *this;
 			}
-			TWeakPtr<ValueType>& operator =(TWeakPtr<ValueType>&& rhs)
-			{
-				if (m_raw_ptr == rhs.m_raw_ptr)
-					return *this;
-
-				if (rhs.m_raw_ptr)
-					rhs.m_raw_ptr->IncrementWeakRef();
-				
-				m_raw_ptr->DecrementWeakRef();
 
-				m_raw_ptr = rhs.m_raw_ptr;
-				rhs.m_raw_ptr = nullptr;
-
-				return *this;
-			}
-			TWeakPtr<ValueType>& operator =(TSharedPtr<ValueType>&& rhs)
+			/**
+			 * @brief Weak pointer copy assigment.
+			 */
+			SelfTypeRef operator =(ConstSelfTypeRef rhs)
 			{
-				if (m_raw_ptr == rhs.m_raw_ptr)
-					return *this;
-
-				if (rhs.m_raw_ptr)
-					rhs.m_raw_ptr->IncrementWeakRef();
-
-				m_raw_ptr->DecrementWeakRef();
-
-				m_raw_ptr = rhs.m_raw_ptr;
-				rhs.m_raw_ptr = nullptr;
+				SelfType(rhs).Swap(*this);
 
 				return *this;
 			}
-			TWeakPtr<ValueType>& operator =(const TWeakPtr<ValueType>& rhs)
-			{
-				if (m_raw_ptr == rhs.m_raw_ptr)
-					return *this;
-
-				if (rhs.m_raw_ptr)
-					rhs.m_raw_ptr->IncrementWeakRef();
-
-				m_raw_ptr->DecrementWeakRef();
 
-				m_raw_ptr = rhs.m_raw_ptr;
-
-				return *this;
-			}
-			TWeakPtr<ValueType>& operator =(const TSharedPtr<ValueType>& rhs)
+			/**
+			 * @brief Shared pointer copy assigment.
+			 */
+			template<typename InOtherType>
+			SelfTypeRef operator =(const TSharedPtr<InOtherType>& rhs)
 			{
-				if (m_raw_ptr == rhs.m_raw_ptr)
-					return *this;
-
-				if (rhs.m_raw_ptr)
-					rhs.m_raw_ptr->IncrementWeakRef();
-
-				m_raw_ptr->DecrementWeakRef();
-
-				m_raw_ptr = rhs.m_raw_ptr;
+				SelfType(rhs).Swap(*this);
 
 				return *this;
 			}
@@ -552,29 +694,25 @@ namespace Forge {
 			 * @brief Gets the number of TSharedPtr objects that share ownership
 			 * over the same stored pointer. TWeakPtr objects are not counted.
 			 *
-			 * @return Number of refrences to the stored pointer.
-			 * 
-			 * @throws InvalidOperationException if the stored pointer is null.
+			 * @return Number of refrences to the stored pointer, or zero if the
+			 * TWeakPtr object is empty.
 			 */
-			ConstSize GetRefCount(Void)
+			ConstSize GetRefCount(Void) const
 			{
-				/*if (!m_raw_ptr)
-					FORGE_EXCEPT(Debug::Exception::ERR_INVALID_OPERATION_EXCEPTION, "Shared pointer is storing a null pointer")*/
-
-				return m_raw_ptr->GetRefCount();
+				return m_control_block ? m_control_block->GetRefCount() : 0;
 			}
 
 		public:
 			/**
 			 * @brief Checks whether the TWeakPtr object is either empty or there
 			 * are no more TSharedPtr referencing the stored pointer.
-			 * 
-			 * @return True if no more TSharedPtr are referencing the stored 
+			 *
+			 * @return True if no more TSharedPtr are referencing the stored
 			 * pointer and has been deallocated or the TWeakPtr object is empty.
 			 */
-			Bool IsExpired(Void)
+			Bool IsExpired(Void) const
 			{
-				return !m_raw_ptr || GetRefCount() == 0;
+				return GetRefCount() == 0;
 			}
 
 			/**
@@ -582,28 +720,22 @@ namespace Forge {
 			 *
 			 * @return True if the stored pointer is not null.
 			 */
-			Bool IsNotNull(Void)
+			Bool IsNotNull(Void) const
 			{
-				if (m_raw_ptr)
-					return FORGE_TRUE;
-
-				return false;
+				return m_raw_ptr != nullptr;
 			}
 
 		public:
 			/**
 			 * @brief Locks the stored pointer and prevents it from being released.
-			 * 
+			 *
 			 * @return TSharedPtr with the information preserved by the TWeakPtr
-			 * object if it is not expired. If the TWeakPtr object has expired, 
+			 * object if it is not expired. If the TWeakPtr object has expired,
 			 * the function returns an empty TSharedPtr.
 			 */
-			TSharedPtr<ValueType> Lock(Void)
+			TSharedPtr<Type> Lock(Void) const
 			{
-				if (IsExpired())
-					return TSharedPtr<ValueType>();
-				
-				return TSharedPtr<ValueType>(m_raw_ptr);
+				return TSharedPtr<Type>(*this);
 			}
 
 		public:
@@ -613,21 +745,46 @@ namespace Forge {
 			 *
 			 * @param[in] other The TWeakPtr object to swap content with.
 			 */
-			Void Swap(TWeakPtr<ValueType>& other)
+			Void Swap(SelfTypeRef other)
 			{
-				ValueTypePtr temp = other.m_raw_ptr;
-				other.m_raw_ptr = m_raw_ptr;
-				m_raw_ptr = temp;
+				Algorithm::Swap(m_raw_ptr, other.m_raw_ptr);
+				Algorithm::Swap(m_control_block, other.m_control_block);
 			}
 
 			/**
 			 * @brief Resets the TWeakPtr and makes it empty.
 			 */
-			Void Reset()
+			Void Reset(Void)
 			{
-				m_raw_ptr = nullptr;
+				SelfType().Swap(*this);
 			}
 		};
+
+		FORGE_TYPEDEF_TEMPLATE_DECL(TWeakPtr)
+
+		/**
+		 * @brief Constructs an object managed by a TSharedPtr, allocating the
+		 * object and its control block together in a single block.
+		 *
+		 * @param[in] allocator The allocator to obtain the block from, or
+		 * nullptr to use the heap.
+		 * @param[in] args      The arguments to construct the object with.
+		 *
+		 * @return TSharedPtr storing the constructed object.
+		 */
+		template<typename InType, typename... InArgs>
+		TSharedPtr<InType> MakeShared(Memory::AbstractAllocator* allocator, InArgs&&... args)
+		{
+			using BlockType = Internal::TInlineControlBlock<InType>;
+
+			BlockType* block = allocator ?
+				new (allocator->Allocate(sizeof(BlockType), alignof(BlockType))) BlockType(allocator, Algorithm::Forward<InArgs>(args)...) :
+				new BlockType(nullptr, Algorithm::Forward<InArgs>(args)...);
+
+			TSharedPtr<InType>::EnableSharedFromThis(block->GetObject(), block);
+
+			return TSharedPtr<InType>(block->GetObject(), static_cast<Internal::SharedControlBlock*>(block));
+		}
 	}
 }
 
@@ -28,6 +28,10 @@ namespace Forge {
 		 * @brief Abstract base class for strings which implements read-only
 		 * operations.
 		 * 
+		 * Searches run on SSE2/AVX2 blocks when the target supports them,
+		 * character set searches use SSE4.2 string instructions for sets of
+		 * up to 16 characters.
+		 * 
 		 * @author Karim Hisham
 		 */
 		class AbstractString
@@ -126,9 +130,9 @@ namespace Forge {
 			 * @brief Searches the string for the last character that matches a
 			 * given character starting from a given position.
 			 *
-			 * When a position is specified, the search only includes characters
-			 * at or before the position, ignoring any possible occurrences after
-			 * it.
+			 * When a position is specified, the search skips that many characters
+			 * at the end of the string, ignoring any possible occurrences among
+			 * them.
 			 *
 			 * @param ch  The character to search for in the string.
 			 * @param pos The position to start the search from.
@@ -168,9 +172,9 @@ namespace Forge {
 			 * @brief Searches the string for the last character that does not 
 			 * match a given character starting from a given position.
 			 *
-			 * When a position is specified, the search only includes characters
-			 * at or before the position, ignoring any possible occurrences after
-			 * it.
+			 * When a position is specified, the search skips that many characters
+			 * at the end of the string, ignoring any possible occurrences among
+			 * them.
 			 *
 			 * @param ch  The character to search for in the string.
 			 * @param pos The position to start the search from.
@@ -214,9 +218,9 @@ namespace Forge {
 			 * given character in an array of characters starting from a given
 			 * position.
 			 *
-			 * When a position is specified, the search only includes characters
-			 * at or before the position, ignoring any possible occurrences after
-			 * it.
+			 * When a position is specified, the search skips that many characters
+			 * at the end of the string, ignoring any possible occurrences among
+			 * them.
 			 *
 			 * @param str The character array to search for in the string.
 			 * @param pos The position to start the search from.
@@ -262,9 +266,9 @@ namespace Forge {
 			 * match a given character in an array of characters starting from a
 			 * given position.
 			 *
-			 * When a position is specified, the search only includes characters
-			 * at or after the position, ignoring any possible occurrences before
-			 * it.
+			 * When a position is specified, the search skips that many characters
+			 * at the end of the string, ignoring any possible occurrences among
+			 * them.
 			 *
 			 * @param str The character array to search for in the string.
 			 * @param pos The position to start the search from.
@@ -5,9 +5,26 @@
 
 #include "Core/Public/Common/Compiler.h"
 
+#include "Core/Public/Memory/AbstractAllocator.h"
+
+#include "Core/Public/Algorithm/Hash/THash.h"
+
 namespace Forge {
 	namespace Type
 	{
+		/**
+		 * @brief A null terminated sequence of characters that can change in
+		 * size.
+		 *
+		 * Strings of up to INLINE_CAPACITY characters are stored inside the
+		 * object and never allocate. Longer strings obtain memory from the
+		 * allocator passed on construction, or from the system heap if none is
+		 * given. Characters are trivially relocatable, so the heap buffer is
+		 * always grown in place through AbstractAllocator::Reallocate() or
+		 * Memory::HeapReallocate().
+		 *
+		 * @author Karim Hisham
+		 */
 		class FORGE_API String : public AbstractString
 		{
 		private:
@@ -18,193 +35,160 @@ namespace Forge {
 			using ConstSelfTypeRef = const String&;
 			using ConstSelfTypePtr = const String*;
 
+		public:
+			enum : Size { INLINE_CAPACITY = 23 };
+
 		private:
 			enum { CAPACITY_ALIGNMENT = 2};
 
 		private:
 			CharPtr m_buffer;
-		
+			Memory::AbstractAllocator* m_allocator;
+
 		private:
 			Size m_version;
 			Size m_capacity;
 
+		private:
+			Char m_inline_buffer[INLINE_CAPACITY + 1];
+
 		public:
 			String(void)
-				: m_buffer(nullptr), m_version(0), m_capacity(0), AbstractString(0, ~((Size)0)) {}
+				: m_buffer(m_inline_buffer), m_allocator(nullptr), m_version(0), m_capacity(INLINE_CAPACITY), m_inline_buffer(), AbstractString(0, ~((Size)0)) {}
 
-			String(CharPtr str)
-				: m_version(0), m_capacity(0), AbstractString(0, ~((Size)0))
-			{
-				this->m_count = this->m_capacity = Algorithm::GetStringLength(str);
+			explicit String(Memory::AbstractAllocator* allocator)
+				: m_buffer(m_inline_buffer), m_allocator(allocator), m_version(0), m_capacity(INLINE_CAPACITY), m_inline_buffer(), AbstractString(0, ~((Size)0)) {}
 
-				this->m_buffer = (CharPtr)malloc((this->GetCount() + 1) * sizeof(Char));
+			String(ConstCharPtr str, Memory::AbstractAllocator* allocator = nullptr);
 
-				Memory::MemorySet(this->m_buffer, '\0', this->GetCount() + 1);
-
-				Memory::MemoryCopy(this->m_buffer, str, this->GetCount());
-			}
-
-			String(ConstCharPtr str)
-				: m_version(0), m_capacity(0), AbstractString(0, ~((Size)0))
-			{
-				this->m_count = this->m_capacity = Algorithm::GetStringLength(str);
-
-				this->m_buffer = (CharPtr)malloc((this->GetCount() + 1) * sizeof(Char));
+		public:
+			String(SelfType&& other);
 
-				Memory::MemorySet(this->m_buffer, '\0', this->GetCount() + 1);
-
-				Memory::MemoryCopy(this->m_buffer, const_cast<CharPtr>(str), this->GetCount());
-			}
+			String(ConstSelfTypeRef other);
 
 		public:
-			String(SelfType&& other)
-				: AbstractString(other)
-			{
-				*this = Algorithm::Move(other);
-			}
+			~String();
 
-			String(ConstSelfTypeRef other)
-				: AbstractString(other)
-			{
-				*this = other;
-			}
-		
 		public:
-			String& operator =(CharPtr str)
-			{
-				ConstSize new_count = Algorithm::GetStringLength(str);
-
-				this->Clear();
-
-				if (new_count > this->GetCount())
-					this->ReserveCapacity(new_count);
-
-				Memory::MemoryCopy(this->m_buffer, str, new_count);
-
-				this->m_count = new_count;
-
-				return *this;
-			}
-
-			String& operator =(ConstCharPtr str)
-			{
-				ConstSize new_count = Algorithm::GetStringLength(str);
-
-				this->Clear();
-
-				if (new_count > this->GetCount())
-					this->ReserveCapacity(new_count);
+			String& operator =(ConstCharPtr str);
 
-				Memory::MemoryCopy(this->m_buffer, const_cast<CharPtr>(str), new_count);
+			String& operator =(SelfType&& other);
 
-				this->m_count = new_count;
-
-				return *this;
-			}
+			String& operator =(ConstSelfTypeRef other);
 
-			String& operator =(SelfType&& other)
-			{
-				this->Clear();
+		public:
+			String& operator +=(Char c);
 
-				Memory::MemoryCopy(this, &other, sizeof(SelfType));
+			String& operator +=(ConstCharPtr str);
 
-				other.m_buffer = nullptr;
-				other.m_count = other.m_version = other.m_capacity = 0;
+			String& operator +=(ConstSelfTypeRef other);
 
-				return *this;
-			}
+		private:
+			Void DeallocateBuffer(void);
+			Void ReallocateBuffer(Size capacity);
 
-			String& operator =(ConstSelfTypeRef other)
-			{
-				this->Clear();
+		public:
+			ConstCharPtr GetRawData(void) const override;
 
-				if (other.GetCount() > this->GetCount())
-					this->ReserveCapacity(other.GetCount());
+		public:
+			/**
+			 * @brief Checks whether the characters are stored inside the string
+			 * object rather than in an allocated buffer.
+			 *
+			 * @return True if the string does not own an allocation.
+			 */
+			ConstBool IsInline(void) const;
 
-				Memory::MemoryCopy(this->m_buffer, other.m_buffer, other.GetCount());
+		public:
+			ConstSize GetVersion(void) const;
 
-				this->m_count = other.GetCount();
-				this->m_version = other.GetVersion();
-				this->m_capacity = other.GetCapacity();
-				this->m_max_capacity = other.GetMaxCapacity();
+			ConstSize GetCapacity(void) const;
 
-				return *this;
-			}
+			Memory::AbstractAllocator* GetAllocator(void) const;
 
 		public:
-			String& operator +=(Char c)
-			{
-
-			}
+			/**
+			 * @brief Appends a range of characters to the end of the string.
+			 *
+			 * @param[in] str   The characters to append.
+			 * @param[in] count The number of characters to append.
+			 */
+			Void Append(ConstCharPtr str, Size count);
 
-			String& operator +=(CharPtr str)
-			{
+		public:
+			/**
+			 * @brief Sets the capacity of the string to exactly the given number
+			 * of characters, truncating the string if it is shorter.
+			 *
+			 * Capacities of up to INLINE_CAPACITY characters move the string
+			 * back into the inline buffer and release its allocation.
+			 *
+			 * @param[in] capacity The new capacity of the string.
+			 */
+			Void Resize(Size capacity);
+
+			/**
+			 * @brief Requests that the string capacity is large enough to contain
+			 * the specified number of characters.
+			 *
+			 * @param[in] capacity The minimum capacity of the string.
+			 */
+			Void ReserveCapacity(Size capacity);
 
-			}
+		public:
+			/**
+			 * @brief Removes all the characters from the string, keeping its
+			 * capacity.
+			 */
+			Void Clear(void);
+		};
 
-			String& operator +=(ConstCharPtr str)
-			{
+		FORGE_FORCE_INLINE String& String::operator +=(Char c)
+		{
+			this->Append(&c, 1);
 
-			}
+			return *this;
+		}
 
-			String& operator +=(ConstSelfTypeRef other)
-			{
+		FORGE_FORCE_INLINE String& String::operator +=(ConstCharPtr str)
+		{
+			this->Append(str, Algorithm::GetStringLength(str));
 
-			}
+			return *this;
+		}
 
-		public:
-			ConstSize GetVersion(void) const;
+		FORGE_FORCE_INLINE String& String::operator +=(ConstSelfTypeRef other)
+		{
+			this->Append(other.m_buffer, other.m_count);
 
-			ConstSize GetCapacity(void) const;
+			return *this;
+		}
 
-		public:
-			Void Resize(Size capacity)
-			{
-				if (capacity)
-				{
-					CharPtr temp_buffer = this->m_buffer;
+		FORGE_FORCE_INLINE ConstCharPtr String::GetRawData(void) const { return this->m_buffer; }
 
-					this->m_buffer = (CharPtr)malloc(capacity * sizeof(Char));
+		FORGE_FORCE_INLINE ConstBool String::IsInline(void) const { return this->m_buffer == this->m_inline_buffer; }
 
-					Memory::MemorySet(this->m_buffer, '\0', this->GetCapacity());
+		FORGE_FORCE_INLINE ConstSize String::GetVersion(void) const { return this->m_version; };
 
-					Memory::MemoryCopy(this->m_buffer, temp_buffer, this->GetCount());
+		FORGE_FORCE_INLINE ConstSize String::GetCapacity(void) const { return this->m_capacity; };
 
-					free(temp_buffer);
-				}	
-			}
+		FORGE_FORCE_INLINE Memory::AbstractAllocator* String::GetAllocator(void) const { return this->m_allocator; };
+	}
 
-			Void ReserveCapacity(Size capacity)
+	namespace Algorithms
+	{
+		/**
+		 * @brief Hashes a string over its characters, the object itself only
+		 * stores a pointer to them.
+		 */
+		template<>
+		struct THash<Type::String>
+		{
+			U64 operator ()(const Type::String& key) const
 			{
-				if (!this->m_buffer)
-				{
-					this->m_buffer = (CharPtr)malloc(capacity * sizeof(Char));
-					return;
-				}
-
-				if (capacity && capacity > this->GetCapacity())
-				{
-					Size new_capacity;
-
-					new_capacity = this->GetCapacity() + (this->GetCapacity() >> 1);
-					new_capacity = new_capacity > capacity ? new_capacity : capacity;
-					new_capacity = new_capacity < this->GetMaxCapacity() ? new_capacity : this->GetMaxCapacity();
-					new_capacity = (new_capacity + (CAPACITY_ALIGNMENT - 1)) & ~(CAPACITY_ALIGNMENT - 1);
-
-					this->Resize(new_capacity);
-
-					this->m_capacity = new_capacity;
-					this->m_version++;
-				}
+				return XXH3Hash::Hash(key.GetRawData(), key.GetCount());
 			}
-
-		public:
-			Void Clear(void);
 		};
-
-		FORGE_FORCE_INLINE ConstSize String::GetVersion(void) { return this->m_version; };
-
-		FORGE_FORCE_INLINE ConstSize String::GetCapacity(void) { return this->m_capacity; };
 	}
 }
 
@@ -1 +1,174 @@
-#pragma once
+#ifndef STRING_BUILDER_H
+#define STRING_BUILDER_H
+
+#include "String.h"
+#include "StringView.h"
+
+#include "Core/Public/Common/Compiler.h"
+#include "Core/Public/Common/PreprocessorUtilities.h"
+
+#include "Core/Public/Memory/AbstractAllocator.h"
+
+namespace Forge {
+	namespace Type
+	{
+		/**
+		 * @brief Builds a string from many pieces without reallocating or
+		 * copying the characters appended so far.
+		 *
+		 * Characters are appended into a list of fixed-size chunks obtained
+		 * from the allocator the builder was constructed with. This is
+		 * usually a LinearAllocator or a StackAllocator scoped to the task
+		 * building the string. ToString() gathers the chunks into a string
+		 * with a single allocation, or none if the result fits in the inline
+		 * buffer of the string.
+		 *
+		 * Chunks are released in reverse order on Clear() and on destruction,
+		 * as StackAllocator requires. A LinearAllocator only reclaims them
+		 * when it is reset.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API StringBuilder
+		{
+		FORGE_CLASS_NONCOPYABLE(StringBuilder)
+
+		private:
+			using SelfType         = StringBuilder;
+			using SelfTypeRef      = StringBuilder&;
+			using SelfTypePtr      = StringBuilder*;
+			using ConstSelfType    = const StringBuilder;
+			using ConstSelfTypeRef = const StringBuilder&;
+			using ConstSelfTypePtr = const StringBuilder*;
+
+		public:
+			enum : Size { DEFAULT_CHUNK_SIZE = 256 };
+
+		private:
+			struct Chunk
+			{
+				Chunk* m_prev;
+				Chunk* m_next;
+				Size   m_count;
+				Size   m_capacity;
+
+				CharPtr GetData(void) { return reinterpret_cast<CharPtr>(this + 1); }
+			};
+
+		private:
+			Memory::AbstractAllocator* m_allocator;
+
+		private:
+			Chunk* m_head;
+			Chunk* m_tail;
+
+		private:
+			Size m_count;
+			Size m_chunk_size;
+
+		public:
+			/**
+			 * @brief Constructs an empty string builder.
+			 *
+			 * @param[in] allocator  The allocator chunks are obtained from.
+			 * @param[in] chunk_size The number of characters stored in each
+			 * chunk, pieces larger than this get a chunk of their own size.
+			 */
+			StringBuilder(Memory::AbstractAllocator* allocator, Size chunk_size = DEFAULT_CHUNK_SIZE)
+				: m_allocator(allocator), m_head(nullptr), m_tail(nullptr), m_count(0), m_chunk_size(chunk_size) {}
+
+		public:
+		   ~StringBuilder();
+
+		public:
+			SelfTypeRef operator +=(Char c);
+
+			SelfTypeRef operator +=(ConstCharPtr str);
+
+			SelfTypeRef operator +=(const AbstractString& str);
+
+		private:
+			/**
+			 * @brief Appends a chunk of the given capacity to the list.
+			 *
+			 * @returns True if the chunk was allocated, otherwise false if the
+			 * allocator is exhausted.
+			 */
+			Bool AddChunk(Size capacity);
+
+		public:
+			ConstBool IsEmpty(void) const;
+
+			ConstSize GetCount(void) const;
+
+			Memory::AbstractAllocator* GetAllocator(void) const;
+
+		public:
+			/**
+			 * @brief Appends a range of characters to the end of the builder.
+			 *
+			 * @param[in] str   The characters to append.
+			 * @param[in] count The number of characters to append.
+			 *
+			 * @throws BadAllocationException if the allocator is exhausted,
+			 * the characters which fit are kept.
+			 */
+			Void Append(ConstCharPtr str, Size count);
+
+			/**
+			 * @brief Appends the decimal representation of an integer to the
+			 * end of the builder.
+			 *
+			 * @param[in] value The integer to append.
+			 */
+			Void AppendInteger(I64 value);
+
+		public:
+			/**
+			 * @brief Copies the characters appended so far into a string.
+			 *
+			 * @param[in] allocator The allocator the string obtains memory
+			 * from, or nullptr to use the system heap.
+			 *
+			 * @return String storing the characters of the builder.
+			 */
+			String ToString(Memory::AbstractAllocator* allocator = nullptr) const;
+
+		public:
+			/**
+			 * @brief Removes all the characters from the builder and releases
+			 * its chunks to the allocator.
+			 */
+			Void Clear(void);
+		};
+
+		FORGE_FORCE_INLINE StringBuilder& StringBuilder::operator +=(Char c)
+		{
+			this->Append(&c, 1);
+
+			return *this;
+		}
+
+		FORGE_FORCE_INLINE StringBuilder& StringBuilder::operator +=(ConstCharPtr str)
+		{
+			this->Append(str, Algorithm::GetStringLength(str));
+
+			return *this;
+		}
+
+		FORGE_FORCE_INLINE StringBuilder& StringBuilder::operator +=(const AbstractString& str)
+		{
+			this->Append(str.GetRawData(), str.GetCount());
+
+			return *this;
+		}
+
+		FORGE_FORCE_INLINE ConstBool StringBuilder::IsEmpty(void) const { return this->m_count == 0; }
+
+		FORGE_FORCE_INLINE ConstSize StringBuilder::GetCount(void) const { return this->m_count; }
+
+		FORGE_FORCE_INLINE Memory::AbstractAllocator* StringBuilder::GetAllocator(void) const { return this->m_allocator; }
+	}
+}
+
+#endif // STRING_BUILDER_H
@@ -1 +1,123 @@
-#pragma once
+#ifndef STRING_VIEW_H
+#define STRING_VIEW_H
+
+#include "AbstractString.h"
+
+#include "Core/Public/Common/Compiler.h"
+
+namespace Forge {
+	namespace Type
+	{
+		/**
+		 * @brief A non-owning reference to a contiguous range of characters.
+		 *
+		 * The view never allocates or copies. It is only valid while the
+		 * characters it refers to are alive and unchanged. The range is not
+		 * required to be null terminated. A view into the middle of another
+		 * string therefore supports every AbstractString search without a
+		 * copy.
+		 *
+		 * @author Karim Hisham
+		 */
+		class StringView : public AbstractString
+		{
+		private:
+			using SelfType         = StringView;
+			using SelfTypeRef      = StringView&;
+			using SelfTypePtr      = StringView*;
+			using ConstSelfType    = const StringView;
+			using ConstSelfTypeRef = const StringView&;
+			using ConstSelfTypePtr = const StringView*;
+
+		private:
+			ConstCharPtr m_data;
+
+		public:
+			StringView(void)
+				: m_data(""), AbstractString(0, 0) {}
+
+			StringView(ConstCharPtr str)
+				: StringView(str, Algorithm::GetStringLength(str)) {}
+
+			StringView(ConstCharPtr str, Size count)
+				: m_data(str), AbstractString(count, count) {}
+
+			StringView(const AbstractString& str)
+				: m_data(str.GetRawData()), AbstractString(str.GetCount(), str.GetCount()) {}
+
+		public:
+			StringView(ConstSelfTypeRef other) = default;
+
+			SelfTypeRef operator =(ConstSelfTypeRef other) = default;
+
+		public:
+			~StringView() = default;
+
+		public:
+			/**
+			 * @brief Gets a pointer to the first character of the view.
+			 *
+			 * The characters are not guaranteed to be followed by a null
+			 * terminator, use GetCount() to find the end of the view.
+			 *
+			 * @return ConstCharPtr storing the address of the first character.
+			 */
+			ConstCharPtr GetRawData(void) const override;
+
+		public:
+			/**
+			 * @brief Gets a view of a range of characters of this view.
+			 *
+			 * @param[in] pos   The position of the first character of the range.
+			 * @param[in] count The maximum number of characters in the range.
+			 *
+			 * @return StringView referring to at most count characters starting
+			 * at the given position, or an empty view if the position is past
+			 * the end.
+			 */
+			SelfType GetSubView(Size pos, Size count = ~((Size)0)) const;
+
+		public:
+			/**
+			 * @brief Shrinks the view by moving its start forward.
+			 *
+			 * @param[in] count The number of characters to remove from the start.
+			 */
+			Void RemovePrefix(Size count);
+
+			/**
+			 * @brief Shrinks the view by moving its end backward.
+			 *
+			 * @param[in] count The number of characters to remove from the end.
+			 */
+			Void RemoveSuffix(Size count);
+		};
+
+		FORGE_FORCE_INLINE ConstCharPtr StringView::GetRawData(void) const { return this->m_data; }
+
+		FORGE_FORCE_INLINE StringView StringView::GetSubView(Size pos, Size count) const
+		{
+			if (pos >= this->m_count)
+				return SelfType(this->m_data + this->m_count, 0);
+
+			return SelfType(this->m_data + pos, Algorithm::Min(count, this->m_count - pos));
+		}
+
+		FORGE_FORCE_INLINE Void StringView::RemovePrefix(Size count)
+		{
+			count = Algorithm::Min(count, this->m_count);
+
+			this->m_data  += count;
+			this->m_count -= count;
+			this->m_max_capacity = this->m_count;
+		}
+
+		FORGE_FORCE_INLINE Void StringView::RemoveSuffix(Size count)
+		{
+			this->m_count -= Algorithm::Min(count, this->m_count);
+			this->m_max_capacity = this->m_count;
+		}
+	}
+}
+
+#endif // STRING_VIEW_H
@@ -1,6 +1,10 @@
 #ifndef T_DELEGATE_HPP
 #define T_DELEGATE_HPP
 
+#include <new>
+#include <string.h>
+#include <type_traits>
+
 #include <Core/Public/Debug/Debug.h>
 #include <Core/Public/Common/Common.h>
 #include <Core/Public/Memory/MemoryUtilities.h>
@@ -12,228 +16,242 @@ using namespace Forge::Algorithm;
 namespace Forge {
 	namespace Common
 	{
-		template<typename Type>
+		/**
+		 * @brief The default number of bytes a delegate stores its invokable
+		 * in without allocating, enough for a member function bound to an
+		 * instance or a lambda capturing up to four pointers.
+		 */
+		constexpr Size DELEGATE_INLINE_SIZE = 32;
+
+		template<typename Type, Size InInlineSize = DELEGATE_INLINE_SIZE>
 		class TDelegate {};
 
 		/**
-		 * @brief Adelegateis a type that represents references to callable
+		 * @brief A delegate is a type that represents references to callable
 		 * objects with a particular parameter list and return type.
-		 * 
+		 *
 		 * When an instance of a delegate is created, the instance can be associated
 		 * with any function with a compatible signature and return type. The method
 		 * can be invoked (or called) through the delegate instance.
-		 * 
+		 *
 		 * Delegates are used to pass functions as arguments to other functions.
 		 * This ability to refer to a function as a parameter makes delegates ideal
 		 * for defining callback functions.
-		 * 
+		 *
+		 * Invokables of up to InInlineSize bytes are stored inside the delegate
+		 * object and binding them never allocates, which can be checked at
+		 * compile time with IsStoredInline(). Larger invokables are stored on
+		 * the heap.
+		 *
 		 * @author Karim Hisham
 		 */
-		template<typename InReturnType, typename... InParams>
-		class TDelegate<InReturnType(InParams...)>
+		template<typename InReturnType, typename... InParams, Size InInlineSize>
+		class TDelegate<InReturnType(InParams...), InInlineSize>
 		{
 		private:
-			using SelfType         = TDelegate<InReturnType(InParams...)>;
-			using SelfTypeRef      = TDelegate<InReturnType(InParams...)>&;
-			using SelfTypePtr      = TDelegate<InReturnType(InParams...)>*;
-			using ConstSelfType    = const TDelegate<InReturnType(InParams...)>;
-			using ConstSelfTypeRef = const TDelegate<InReturnType(InParams...)>&;
-			using ConstSelfTypePtr = const TDelegate<InReturnType(InParams...)>*;
+			using SelfType         = TDelegate<InReturnType(InParams...), InInlineSize>;
+			using SelfTypeRef      = TDelegate<InReturnType(InParams...), InInlineSize>&;
+			using SelfTypePtr      = TDelegate<InReturnType(InParams...), InInlineSize>*;
+			using ConstSelfType    = const TDelegate<InReturnType(InParams...), InInlineSize>;
+			using ConstSelfTypeRef = const TDelegate<InReturnType(InParams...), InInlineSize>&;
+			using ConstSelfTypePtr = const TDelegate<InReturnType(InParams...), InInlineSize>*;
 
 		private:
-			using SignatureFunc = InReturnType(InParams...);
-			using InvokableFunc = InReturnType(*)(ConstSelfTypeRef, InParams...);
+			enum class StorageOperation { COPY, MOVE, DESTROY };
 
 		private:
-			template<typename InLambdaFunctor>
-			struct LambdaStorage 
-			{ 
-				InLambdaFunctor m_lambda; 
-				LambdaStorage(InLambdaFunctor lambda) : m_lambda(lambda) {}
-			};
+			using InvokableFunc = InReturnType(*)(ConstVoidPtr, InParams...);
+			using ManagerFunc   = Void(*)(StorageOperation, VoidPtr, VoidPtr);
 
 		private:
-			union
+			/**
+			 * @brief A member function bound to the instance to call it on.
+			 */
+			template<typename InFunction, typename InClass>
+			struct MemberFunctionBinding
 			{
-				VoidPtr m_instance_ptr;
-				ConstVoidPtr m_const_instance_ptr;
+				InFunction m_function;
+				InClass* m_instance;
+
+				InReturnType operator ()(InParams... params) const
+				{
+					return (m_instance->*m_function)(Algorithm::Forward<InParams>(params)...);
+				}
 			};
 
 		private:
-			Size m_func_container_size;
-			 
+			alignas(VoidPtr) Byte m_storage[InInlineSize];
+
 		private:
 			InvokableFunc m_invokable;
 
 		private:
-			 mutable BytePtr m_fptr_address;
+			ManagerFunc m_manager;
 
-		private:
+		public:
 			/**
-			 * @brief Invokes the lambda functor currently bound inplace in the
-			 * delegate object.
-			 *
-			 * This function is used internally by the delegate object to call a
-			 * function pointer with the appropriate parameter semantics it was
-			 * passed.
+			 * @brief Checks whether an invokable is stored inside the delegate
+			 * object without allocating.
 			 *
-			 * @param[in] self_type The calling delegate object to this function.
-			 * @param[in] InParams    The parameters to pass to the bound function.
-			 *
-			 * @return InReturnType storing the return value of the bound function.
+			 * @return True if the invokable is stored inline.
 			 */
 			template<typename InFunction>
-			static InReturnType InvokeLambda(ConstSelfTypeRef self_type, InParams... params)
+			static constexpr Bool IsStoredInline(Void)
 			{
-				return reinterpret_cast<LambdaStorage<InFunction>*>(self_type.m_fptr_address)->m_lambda(params...);
+				using FunctionType = typename std::decay<InFunction>::type;
+
+				return sizeof(FunctionType) <= InInlineSize &&
+					   alignof(FunctionType) <= alignof(VoidPtr) &&
+					   std::is_nothrow_move_constructible<FunctionType>::value;
 			}
 
+		private:
 			/**
-			 * @brief Invokes the global function currently bound inplace in the
-			 * delegate object.
+			 * @brief Invokes an invokable stored inplace in the delegate object.
 			 *
-			 * This function is used internally by the delegate object to call a
-			 * function pointer with the appropriate parameter semantics it was
-			 * passed.
-			 *
-			 * @param[in] self_type The calling delegate object to this function.
-			 * @param[in] InParams    The parameters to pass to the bound function.
+			 * @param[in] storage The storage of the calling delegate object.
+			 * @param[in] params  The parameters to pass to the bound function.
 			 *
 			 * @return InReturnType storing the return value of the bound function.
 			 */
 			template<typename InFunction>
-			static InReturnType InvokeFunction(ConstSelfTypeRef self_type, InParams... params)
+			static InReturnType InvokeInline(ConstVoidPtr storage, InParams... params)
 			{
-				return (*(reinterpret_cast<InFunction*>(self_type.m_fptr_address)))(params...);
+				return (*const_cast<InFunction*>(reinterpret_cast<const InFunction*>(storage)))(Algorithm::Forward<InParams>(params)...);
 			}
 
 			/**
-			 * @brief Invokes the member function currently bound inplace in the
-			 * delegate object.
-			 *
-			 * This function is used internally by the delegate object to call a
-			 * function pointer with the appropriate parameter semantics it was
-			 * passed.
+			 * @brief Invokes an invokable stored on the heap, whose address is
+			 * stored in the delegate object.
 			 *
-			 * @param[in] self_type The calling delegate object to this function.
-			 * @param[in] InParams    The parameters to pass to the bound function.
+			 * @param[in] storage The storage of the calling delegate object.
+			 * @param[in] params  The parameters to pass to the bound function.
 			 *
 			 * @return InReturnType storing the return value of the bound function.
 			 */
-			template<typename InFunction, typename InClass>
-			static InReturnType InvokeClassFunction(ConstSelfTypeRef self_type, InParams... params)
+			template<typename InFunction>
+			static InReturnType InvokeHeap(ConstVoidPtr storage, InParams... params)
 			{
-				InFunction function = *(reinterpret_cast<InFunction*>(self_type.m_fptr_address));
-
-				return (static_cast<InClass*>(self_type.m_instance_ptr)->*function)(params...);
+				return (**reinterpret_cast<InFunction* const*>(storage))(Algorithm::Forward<InParams>(params)...);
 			}
 
 			/**
-			 * @brief Invokes the const member function currently bound inplace in
-			 * the delegate object.
-			 *
-			 * This function is used internally by the delegate object to call a
-			 * function pointer with the appropriate parameter semantics it was
-			 * passed.
-			 *
-			 * @param[in] self_type The calling delegate object to this function.
-			 * @param[in] InParams    The parameters to pass to the bound function.
-			 *
-			 * @return InReturnType storing the return value of the bound function.
+			 * @brief Copies, moves or destroys an invokable stored inplace.
+			 * Trivially copyable invokables need no manager and are copied
+			 * bytewise.
 			 */
-			template<typename InFunction, typename InClass>
-			static InReturnType InvokeClassConstFunction(ConstSelfTypeRef self_type, InParams... params)
+			template<typename InFunction>
+			static Void ManageInline(StorageOperation operation, VoidPtr destination, VoidPtr source)
 			{
-				InFunction function = *(reinterpret_cast<InFunction*>(self_type.m_fptr_address));
+				InFunction* function = reinterpret_cast<InFunction*>(source);
 
-				return (static_cast<const InClass*>(self_type.m_const_instance_ptr)->*function)(params...);
+				switch (operation)
+				{
+				case StorageOperation::COPY:
+					new (destination) InFunction(*function);
+					break;
+
+				case StorageOperation::MOVE:
+					new (destination) InFunction(Algorithm::Move(*function));
+					function->~InFunction();
+					break;
+
+				case StorageOperation::DESTROY:
+					function->~InFunction();
+					break;
+				}
 			}
 
-		public:
 			/**
-			 * @brief Default constructor.
-			 * 
-			 * Constructs an empty delegate object with the invokable to null.
+			 * @brief Copies, moves or destroys an invokable stored on the heap.
 			 */
-			TDelegate(Void)
-				: m_func_container_size(sizeof(InReturnType(*)(InParams...))), m_fptr_address(nullptr), m_invokable(nullptr) {}
+			template<typename InFunction>
+			static Void ManageHeap(StorageOperation operation, VoidPtr destination, VoidPtr source)
+			{
+				InFunction*& function = *reinterpret_cast<InFunction**>(source);
 
+				switch (operation)
+				{
+				case StorageOperation::COPY:
+					*reinterpret_cast<InFunction**>(destination) = new InFunction(*function);
+					break;
+
+				case StorageOperation::MOVE:
+					*reinterpret_cast<InFunction**>(destination) = function;
+					function = nullptr;
+					break;
+
+				case StorageOperation::DESTROY:
+					delete function;
+					break;
+				}
+			}
+
+		private:
 			/**
-			 * @brief Global invokable constructor.
-			 * 
-			 * Constructs a delegate object with the passed invokable bound to the
-			 * delegate object.
+			 * @brief Binds an invokable, storing it inplace if it fits.
 			 */
 			template<typename InFunction>
-			TDelegate(InFunction function)
+			Void Bind(InFunction&& function)
 			{
-				if (TIsAssignable<SignatureFunc*&, InFunction>::Value)
+				using FunctionType = typename std::decay<InFunction>::type;
+
+				if constexpr (std::is_pointer<typename std::remove_reference<InFunction>::type>::value)
+					if (!function)
+						return;
+
+				if constexpr (IsStoredInline<FunctionType>())
 				{
-					ConstSize function_size = sizeof(InFunction);
-
-					m_fptr_address = new Byte[function_size];
-					
-					if (function_size > 1 && function_size <= sizeof(InReturnType(*)(InParams...)))
-						Memory::MemoryCopy(m_fptr_address, &function, function_size);
-					else
-						Memory::MemorySet(m_fptr_address, 0, function_size);
-
-					m_instance_ptr = nullptr;
-					m_func_container_size = function_size;
-					m_invokable = reinterpret_cast<InvokableFunc>(&InvokeFunction<InFunction>);
+					new (m_storage) FunctionType(Algorithm::Forward<InFunction>(function));
+
+					m_invokable = &InvokeInline<FunctionType>;
+					m_manager = std::is_trivially_copyable<FunctionType>::value ? nullptr : &ManageInline<FunctionType>;
 				}
 				else
 				{
-					ConstSize lambda_size = sizeof(LambdaStorage<InFunction>);
-
-					this->m_fptr_address = (BytePtr)malloc(lambda_size);
-						
-					new (this->m_fptr_address) LambdaStorage<InFunction>(function);
-				
-					this->m_instance_ptr = nullptr;
-					this->m_func_container_size = lambda_size;
-					this->m_invokable = reinterpret_cast<InvokableFunc>(&InvokeLambda<InFunction>);
+					*reinterpret_cast<FunctionType**>(m_storage) = new FunctionType(Algorithm::Forward<InFunction>(function));
+
+					m_invokable = &InvokeHeap<FunctionType>;
+					m_manager = &ManageHeap<FunctionType>;
 				}
 			}
-			
+
+		public:
 			/**
-			 * @brief Member function constructor.
-			 * 
-			 * Constructs a delegate object with the passed member function bound
-			 * to the delegate object.
+			 * @brief Default constructor.
+			 *
+			 * Constructs an empty delegate object with the invokable to null.
 			 */
-			template<typename InFunction, typename InClass>
-			TDelegate(InFunction function, InClass* instance)
-			{
-				ConstSize function_size = sizeof(InFunction);
-
-				this->m_fptr_address = (BytePtr)malloc(function_size);
-
-				Memory::MemoryCopy(this->m_fptr_address, &function, function_size);
+			TDelegate(Void)
+				: m_storage(), m_invokable(nullptr), m_manager(nullptr) {}
 
-				this->m_instance_ptr = instance;
-				this->m_func_container_size = function_size;
-				this->m_invokable = &InvokeClassFunction<InFunction, InClass>;
+			/**
+			 * @brief Global invokable constructor.
+			 *
+			 * Constructs a delegate object with the passed invokable bound to the
+			 * delegate object.
+			 */
+			template<typename InFunction, typename = typename TEnableIf<!TAreSameType<typename std::decay<InFunction>::type, SelfType>::Value, Void>::Type>
+			TDelegate(InFunction&& function)
+				: m_storage(), m_invokable(nullptr), m_manager(nullptr)
+			{
+				Bind(Algorithm::Forward<InFunction>(function));
 			}
-			
+
 			/**
-			 * @brief Bind const member function constructor.
+			 * @brief Member function constructor.
 			 *
-			 * Constructs a delegate object with the passed const member function
-			 * bound to the delegate object.
+			 * Constructs a delegate object with the passed member function bound
+			 * to the delegate object, the instance may be const if the member
+			 * function is const.
 			 */
 			template<typename InFunction, typename InClass>
-			TDelegate(InFunction function, const InClass* instance)
+			TDelegate(InFunction function, InClass* instance)
+				: m_storage(), m_invokable(nullptr), m_manager(nullptr)
 			{
-				ConstSize function_size = sizeof(InFunction);
-
-				this->m_fptr_address = (BytePtr)malloc(function_size);
-
-				Memory::MemoryCopy(this->m_fptr_address, &function, function_size);
+				static_assert(IsStoredInline<MemberFunctionBinding<InFunction, InClass>>(), "Bound member functions must be stored inline");
 
-				this->m_const_instance_ptr = instance;
-				this->m_func_container_size = function_size;
-				this->m_invokable = &InvokeClassFunction<InFunction, InClass>;
+				Bind(MemberFunctionBinding<InFunction, InClass>{ function, instance });
 			}
 
 		public:
@@ -241,7 +259,7 @@ namespace Forge {
 			 * @brief Move constructor.
 			 */
 			TDelegate(SelfType&& other)
-				: m_func_container_size(sizeof(InReturnType(*)(InParams...))), m_fptr_address(nullptr), m_invokable(nullptr)
+				: m_storage(), m_invokable(nullptr), m_manager(nullptr)
 			{
 				*this = Move(other);
 			}
@@ -250,7 +268,7 @@ namespace Forge {
 			 * @brief Copy constructor.
 			 */
 			TDelegate(ConstSelfTypeRef other)
-				: m_func_container_size(sizeof(InReturnType(*)(InParams...))), m_fptr_address(nullptr), m_invokable(nullptr)
+				: m_storage(), m_invokable(nullptr), m_manager(nullptr)
 			{
 				*this = other;
 			}
@@ -270,12 +288,23 @@ namespace Forge {
 			 */
 			SelfTypeRef operator =(SelfType&& other)
 			{
+				if (this == &other)
+					return *this;
+
 				Invalidate();
 
-				Memory::MemoryCopy(this, &other, sizeof(SelfType));
-			
-				other.m_func_container_size = 0;
-				other.m_instance_ptr = other.m_fptr_address = other.m_invokable = nullptr;
+				if (other.m_manager)
+					other.m_manager(StorageOperation::MOVE, m_storage, other.m_storage);
+				else
+					memcpy(m_storage, other.m_storage, InInlineSize);
+
+				m_invokable = other.m_invokable;
+				m_manager = other.m_manager;
+
+				other.m_invokable = nullptr;
+				other.m_manager = nullptr;
+
+				memset(other.m_storage, 0, InInlineSize);
 
 				return *this;
 			}
@@ -285,65 +314,67 @@ namespace Forge {
 			 */
 			SelfTypeRef operator =(ConstSelfTypeRef other)
 			{
-				Invalidate();
+				if (this == &other)
+					return *this;
 
-				m_fptr_address = (BytePtr)malloc(other.m_func_container_size);
+				Invalidate();
 
-				Memory::MemoryCopy(this->m_fptr_address, other.m_fptr_address, other.m_func_container_size);
+				if (other.m_manager)
+					other.m_manager(StorageOperation::COPY, m_storage, const_cast<BytePtr>(other.m_storage));
+				else
+					memcpy(m_storage, other.m_storage, InInlineSize);
 
-				m_instance_ptr = other.m_instance_ptr;
-				m_func_container_size = other.m_func_container_size;
 				m_invokable = other.m_invokable;
+				m_manager = other.m_manager;
 
 				return *this;
 			}
 
 		public:
-			/** 
+			/**
 			 * @brief Checks wether the delegate object has a currently bound
-			 * invokable. 
-			 * 
+			 * invokable.
+			 *
 			 * The function pointer must be valid and non-nullptr.
-			 * 
+			 *
 			 * @return True if the delegate object has a bound function.
 			 */
-			Bool IsValid(void)
+			Bool IsValid(void) const
 			{
 				return m_invokable != nullptr;
 			}
-			
+
 			/**
 			 * @brief Checks wether two delegate objects are bound to the same
 			 * invokables, including the same instance.
-			 * 
+			 *
 			 * @param[in] other The other delegate object to check for equality.
-			 * 
+			 *
 			 * @return True if both delegate objects are equal.
 			 */
-			Bool IsEqual(ConstSelfTypeRef other)
+			Bool IsEqual(ConstSelfTypeRef other) const
 			{
-				return this->m_instance_ptr == other.m_instance_ptr &&
-					   this->m_invokable == other.m_invokable &&
-					   Memory::MemoryCompare(this->m_fptr_address, other.m_fptr_address, sizeof(InReturnType(*)(InParams...)));
+				return this->m_invokable == other.m_invokable &&
+					   memcmp(this->m_storage, other.m_storage, InInlineSize) == 0;
 			}
 
 		public:
 			/**
 			 * @brief Releases the currently bound invokable.
-			 * 
+			 *
 			 * This function invalidates the delegate object by resseting its
 			 * inplace memory storage for function address.
 			 */
 			Void Invalidate(void)
 			{
-				if (m_fptr_address)
-				{
-					Memory::MemorySet(m_fptr_address, 0, m_func_container_size);
-					delete m_fptr_address;
-				}
+				if (m_manager)
+					m_manager(StorageOperation::DESTROY, nullptr, m_storage);
+
+				if (m_invokable)
+					memset(m_storage, 0, InInlineSize);
 
-				m_func_container_size = 0;
-				m_instance_ptr = m_fptr_address = m_invokable = nullptr;
+				m_invokable = nullptr;
+				m_manager = nullptr;
 			}
 
 			/**
@@ -352,15 +383,23 @@ namespace Forge {
 			 * @param[in] InParams The parameters to pass to the bound invokable.
 			 *
 			 * @return InReturnType storing the return value of the bound invokable.
-			 * 
+			 *
 			 * @throws InvalidOperationException if the delegate object is invalid.
 			 */
-			InReturnType Invoke(InParams... params)
+			InReturnType Invoke(InParams... params) const
 			{
 				if (!IsValid())
 					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION)
 
-				return (m_invokable)(*this, params...);
+				return (m_invokable)(m_storage, Algorithm::Forward<InParams>(params)...);
+			}
+
+			/**
+			 * @brief Invokes the currently bound invokable.
+			 */
+			InReturnType operator ()(InParams... params) const
+			{
+				return Invoke(Algorithm::Forward<InParams>(params)...);
 			}
 		};
 	}
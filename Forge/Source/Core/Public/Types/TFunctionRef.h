@@ -0,0 +1,95 @@
+#ifndef T_FUNCTION_REF_H
+#define T_FUNCTION_REF_H
+
+#include <memory>
+#include <type_traits>
+
+#include <Core/Public/Common/Common.h>
+#include <Core/Public/Algorithm/GeneralUtilities.h>
+
+namespace Forge {
+	namespace Common
+	{
+		template<typename Type>
+		class TFunctionRef {};
+
+		/**
+		 * @brief A non-owning reference to a callable object with a particular
+		 * parameter list and return type.
+		 *
+		 * A function reference is two pointers, the address of the callable and
+		 * the function invoking it, and is never empty. Binding it never copies
+		 * or allocates the callable, which must outlive the function reference.
+		 * This makes it the cheapest way to pass a callback to a function that
+		 * calls it before returning, such as ForEach(), while TDelegate should be
+		 * used for callbacks that are stored.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename InReturnType, typename... InParams>
+		class TFunctionRef<InReturnType(InParams...)>
+		{
+		private:
+			using SelfType = TFunctionRef<InReturnType(InParams...)>;
+
+		private:
+			using InvokableFunc = InReturnType(*)(VoidPtr, InParams...);
+
+		private:
+			VoidPtr m_callable;
+
+		private:
+			InvokableFunc m_invokable;
+
+		private:
+			/**
+			 * @brief Invokes the referenced callable object.
+			 *
+			 * @param[in] callable The address of the callable object.
+			 * @param[in] params   The parameters to pass to the callable object.
+			 *
+			 * @return InReturnType storing the return value of the callable object.
+			 */
+			template<typename InCallable>
+			static InReturnType InvokeCallable(VoidPtr callable, InParams... params)
+			{
+				return (*reinterpret_cast<InCallable*>(callable))(Algorithm::Forward<InParams>(params)...);
+			}
+
+		public:
+			/**
+			 * @brief Callable constructor.
+			 *
+			 * Constructs a function reference to the passed callable object,
+			 * lambda or function.
+			 */
+			template<typename InCallable, typename = typename TEnableIf<!TAreSameType<typename std::decay<InCallable>::type, SelfType>::Value, Void>::Type>
+			TFunctionRef(InCallable&& callable)
+				: m_callable((VoidPtr)std::addressof(callable)),
+				  m_invokable(&InvokeCallable<typename std::remove_reference<InCallable>::type>) {}
+
+		public:
+			/**
+			 * @brief Invokes the referenced callable object.
+			 *
+			 * @param[in] InParams The parameters to pass to the callable object.
+			 *
+			 * @return InReturnType storing the return value of the callable object.
+			 */
+			FORGE_FORCE_INLINE InReturnType Invoke(InParams... params) const
+			{
+				return m_invokable(m_callable, Algorithm::Forward<InParams>(params)...);
+			}
+
+			/**
+			 * @brief Invokes the referenced callable object.
+			 */
+			FORGE_FORCE_INLINE InReturnType operator ()(InParams... params) const
+			{
+				return m_invokable(m_callable, Algorithm::Forward<InParams>(params)...);
+			}
+		};
+	}
+}
+
+#endif // T_FUNCTION_REF_H
@@ -0,0 +1,270 @@
+#ifndef T_MULTICAST_DELEGATE_H
+#define T_MULTICAST_DELEGATE_H
+
+#include <Core/Public/Common/Common.h>
+#include <Core/Public/Types/TDelegate.h>
+#include <Core/Public/Containers/TDynamicArray.h>
+
+namespace Forge {
+	namespace Common
+	{
+		/**
+		 * @brief Identifies a handler added to a multicast delegate, zero is
+		 * never a valid handle.
+		 */
+		using DelegateHandle = U64;
+
+		template<typename Type>
+		class TMulticastDelegate {};
+
+		/**
+		 * @brief A multicast delegate holds any number of delegates with the
+		 * same parameter list and invokes all of them when broadcast.
+		 *
+		 * Handlers are stored contiguously by value in the order they were
+		 * added, so broadcasting walks a single array and calls each handler
+		 * through its delegate without any virtual dispatch.
+		 *
+		 * Handlers may be added or removed from within a broadcast. Removed
+		 * handlers are skipped right away but only erased once the outermost
+		 * broadcast returns, and added handlers are first invoked by the next
+		 * broadcast.
+		 *
+		 * @author Karim Hisham
+		 */
+		template<typename... InParams>
+		class TMulticastDelegate<Void(InParams...)>
+		{
+		FORGE_CLASS_NONCOPYABLE(TMulticastDelegate)
+
+		public:
+			using DelegateType = TDelegate<Void(InParams...)>;
+
+		private:
+			struct Handler
+			{
+				DelegateHandle m_handle;
+				DelegateType m_delegate;
+			};
+
+		private:
+			Containers::TDynamicArray<Handler> m_handlers;
+
+		private:
+			Containers::TDynamicArray<Handler> m_added_handlers;
+
+		private:
+			DelegateHandle m_next_handle;
+
+		private:
+			Size m_broadcast_depth;
+
+		private:
+			Bool m_has_removed_handlers;
+
+		public:
+			/**
+			 * @brief Default constructor.
+			 *
+			 * Constructs a multicast delegate without handlers.
+			 */
+			TMulticastDelegate(Void)
+				: m_next_handle(1), m_broadcast_depth(0), m_has_removed_handlers(false) {}
+
+		public:
+			~TMulticastDelegate(Void) = default;
+
+		private:
+			/**
+			 * @brief Erases the handlers removed and appends the handlers added
+			 * during a broadcast.
+			 */
+			Void Flush(Void)
+			{
+				if (m_has_removed_handlers)
+				{
+					Size count = 0;
+
+					for (Size i = 0; i < m_handlers.GetCount(); i++)
+						if (m_handlers[i].m_handle)
+						{
+							if (i != count)
+								m_handlers[count] = Move(m_handlers[i]);
+
+							count++;
+						}
+
+					while (m_handlers.GetCount() > count)
+						m_handlers.PopBack();
+
+					m_has_removed_handlers = false;
+				}
+
+				for (Size i = 0; i < m_added_handlers.GetCount(); i++)
+					m_handlers.PushBack(Move(m_added_handlers[i]));
+
+				m_added_handlers.Clear();
+			}
+
+		public:
+			/**
+			 * @brief Gets the number of handlers bound to the multicast
+			 * delegate, including handlers added during a broadcast.
+			 *
+			 * @return Size storing the number of handlers.
+			 */
+			Size GetCount(Void) const
+			{
+				Size count = m_added_handlers.GetCount();
+
+				for (Size i = 0; i < m_handlers.GetCount(); i++)
+					count += m_handlers.GetByIndex(i).m_handle != 0;
+
+				return count;
+			}
+
+			/**
+			 * @brief Checks whether any handler is bound to the multicast
+			 * delegate.
+			 *
+			 * @return True if at least one handler is bound.
+			 */
+			Bool IsBound(Void) const
+			{
+				return GetCount() != 0;
+			}
+
+		public:
+			/**
+			 * @brief Adds a handler to the multicast delegate.
+			 *
+			 * @param[in] delegate The delegate to invoke on broadcast.
+			 *
+			 * @return DelegateHandle identifying the handler, or zero if the
+			 * delegate is invalid.
+			 */
+			DelegateHandle Add(DelegateType delegate)
+			{
+				if (!delegate.IsValid())
+					return 0;
+
+				DelegateHandle handle = m_next_handle++;
+
+				if (m_broadcast_depth)
+					m_added_handlers.PushBack(Handler{ handle, Move(delegate) });
+				else
+					m_handlers.PushBack(Handler{ handle, Move(delegate) });
+
+				return handle;
+			}
+
+			/**
+			 * @brief Removes a handler from the multicast delegate.
+			 *
+			 * @param[in] handle The handle returned when adding the handler.
+			 *
+			 * @return True if the handler was bound and got removed.
+			 */
+			Bool Remove(DelegateHandle handle)
+			{
+				if (!handle)
+					return false;
+
+				for (Size i = 0; i < m_added_handlers.GetCount(); i++)
+					if (m_added_handlers[i].m_handle == handle)
+					{
+						m_added_handlers.RemoveAt(i);
+						return true;
+					}
+
+				for (Size i = 0; i < m_handlers.GetCount(); i++)
+					if (m_handlers[i].m_handle == handle)
+					{
+						if (m_broadcast_depth)
+						{
+							m_handlers[i].m_handle = 0;
+							m_has_removed_handlers = true;
+						}
+						else
+							m_handlers.RemoveAt(i);
+
+						return true;
+					}
+
+				return false;
+			}
+
+			/**
+			 * @brief Removes all the handlers from the multicast delegate.
+			 */
+			Void Clear(Void)
+			{
+				m_added_handlers.Clear();
+
+				if (!m_broadcast_depth)
+				{
+					m_handlers.Clear();
+					return;
+				}
+
+				for (Size i = 0; i < m_handlers.GetCount(); i++)
+					m_handlers[i].m_handle = 0;
+
+				m_has_removed_handlers = m_handlers.GetCount() != 0;
+			}
+
+		public:
+			/**
+			 * @brief Invokes every bound handler in the order they were added.
+			 *
+			 * @param[in] InParams The parameters to pass to every handler.
+			 */
+			Void Broadcast(InParams... params)
+			{
+				m_broadcast_depth++;
+
+				for (Size i = 0; i < m_handlers.GetCount(); i++)
+					if (m_handlers[i].m_handle)
+						m_handlers[i].m_delegate.Invoke(params...);
+
+				if (!--m_broadcast_depth)
+					Flush();
+			}
+
+			/**
+			 * @brief Invokes every bound handler on every element of an array,
+			 * one handler at a time.
+			 *
+			 * Delivering a batch handler by handler keeps each handler's code
+			 * and state hot while it walks the contiguous elements. The
+			 * multicast delegate must take a single parameter that binds to
+			 * the elements.
+			 *
+			 * @param[in] elements The elements to pass to every handler.
+			 * @param[in] count    The number of elements.
+			 */
+			template<typename InElement>
+			Void BroadcastBatch(const InElement* elements, Size count)
+			{
+				static_assert(sizeof...(InParams) == 1, "Batches can only be broadcast to handlers taking a single parameter");
+
+				m_broadcast_depth++;
+
+				/// Handlers added during the broadcast are held apart, so the
+				/// handlers can not move while one of them is being invoked.
+				for (Size i = 0; i < m_handlers.GetCount(); i++)
+				{
+					Handler& handler = m_handlers[i];
+
+					for (Size j = 0; j < count && handler.m_handle; j++)
+						handler.m_delegate.Invoke(elements[j]);
+				}
+
+				if (!--m_broadcast_depth)
+					Flush();
+			}
+		};
+	}
+}
+
+#endif // T_MULTICAST_DELEGATE_H
@@ -0,0 +1,249 @@
+#include <GraphicsDevice/Public/Base/CommandBuffer.h>
+
+namespace Forge {
+	namespace Graphics
+	{
+		CommandBuffer::CommandBuffer(Memory::ConcurrentPoolAllocator& page_allocator)
+			: m_page_allocator(&page_allocator), m_page_size(page_allocator.GetChunktSize()), m_first_page(nullptr), m_last_page(nullptr), m_num_of_commands(0), m_is_overflowed(false), m_is_pending(false)
+		{
+			FORGE_ASSERT(m_page_size % Internal::COMMAND_ALIGNMENT == 0, "The size of command pages must be a multiple of the command alignment.")
+			FORGE_ASSERT(m_page_size >= sizeof(Internal::CommandPage) + sizeof(Internal::WriteHardwareBufferCommand) + Internal::COMMAND_ALIGNMENT, "The size of command pages is too small to hold the largest command.")
+		}
+
+		CommandBuffer::~CommandBuffer(Void)
+		{
+			Reset();
+		}
+
+		BytePtr CommandBuffer::AllocatePage(Size size)
+		{
+			if (m_is_overflowed)
+				return nullptr;
+
+			FORGE_ASSERT(!IsPending(), "A command buffer can not be recorded into while it is pending.")
+
+			Internal::CommandPage* page = static_cast<Internal::CommandPage*>(m_page_allocator->Allocate(m_page_size, Internal::COMMAND_ALIGNMENT));
+
+			if (!page)
+			{
+				/// Forgets the last page, so no later command fits in its tail
+				/// and the commands recorded before the overflow stay a prefix.
+				m_last_page = nullptr;
+				m_is_overflowed = true;
+
+				return nullptr;
+			}
+
+			page->m_next = nullptr;
+			page->m_used = sizeof(Internal::CommandPage) + size;
+
+			if (m_last_page)
+				m_last_page->m_next = page;
+			else
+				m_first_page = page;
+
+			m_last_page = page;
+			m_num_of_commands++;
+
+			return reinterpret_cast<BytePtr>(page) + sizeof(Internal::CommandPage);
+		}
+
+		Size CommandBuffer::GetUsedMemory(Void) const
+		{
+			Size used_memory = 0;
+
+			for (Internal::CommandPage* page = m_first_page; page; page = page->m_next)
+				used_memory += page->m_used;
+
+			return used_memory;
+		}
+
+		Void CommandBuffer::WriteHardwareBuffer(AbstractHardwareBufferPtr hardware_buffer, ConstVoidPtr src, Size offset, Size length)
+		{
+			Size max_length = Algorithm::Min<Size>(m_page_size - sizeof(Internal::CommandPage), Internal::MAX_COMMAND_SIZE) - sizeof(Internal::WriteHardwareBufferCommand);
+
+			ConstBytePtr data = static_cast<ConstBytePtr>(src);
+
+			while (length)
+			{
+				Size chunk_length = Algorithm::Min<Size>(length, max_length);
+
+				Internal::WriteHardwareBufferCommand* command = Record<Internal::WriteHardwareBufferCommand>(Internal::CommandType::WRITE_HARDWARE_BUFFER, chunk_length);
+
+				if (!command)
+					return;
+
+				command->m_length = static_cast<U32>(chunk_length);
+				command->m_hardware_buffer = hardware_buffer;
+				command->m_offset = offset;
+
+				Memory::MemoryCopy(command + 1, const_cast<BytePtr>(data), chunk_length);
+
+				data += chunk_length;
+				offset += chunk_length;
+				length -= chunk_length;
+			}
+		}
+
+		Void CommandBuffer::Execute(AbstractGraphicsContextState& context_state) const
+		{
+			FORGE_ASSERT(!m_is_overflowed, "An overflowed command buffer can not be executed.")
+
+			for (Internal::CommandPage* page = m_first_page; page; page = page->m_next)
+			{
+				BytePtr address = reinterpret_cast<BytePtr>(page) + sizeof(Internal::CommandPage);
+				BytePtr end = reinterpret_cast<BytePtr>(page) + page->m_used;
+
+				while (address < end)
+				{
+					const Internal::CommandHeader* header = reinterpret_cast<const Internal::CommandHeader*>(address);
+
+					FORGE_ASSERT(header->m_size && address + header->m_size <= end, "The command stream is corrupted.")
+
+					switch (header->m_type)
+					{
+					case Internal::CommandType::ENABLE_DEPTH_TEST:
+						context_state.EnableDepthTest(reinterpret_cast<const Internal::BoolCommand*>(header)->m_value);
+						break;
+					case Internal::CommandType::ENABLE_STENCIL_TEST:
+						context_state.EnableStencilTest(reinterpret_cast<const Internal::BoolCommand*>(header)->m_value);
+						break;
+					case Internal::CommandType::ENABLE_SCISSOR_TEST:
+						context_state.EnableScissorTest(reinterpret_cast<const Internal::BoolCommand*>(header)->m_value);
+						break;
+					case Internal::CommandType::ENABLE_FACE_CULLING:
+						context_state.EnableFaceCulling(reinterpret_cast<const Internal::BoolCommand*>(header)->m_value);
+						break;
+					case Internal::CommandType::ENABLE_COLOR_BLENDING:
+						context_state.EnableColorBlending(reinterpret_cast<const Internal::BoolCommand*>(header)->m_value);
+						break;
+					case Internal::CommandType::SET_DEPTH_WRITE_MASK:
+						context_state.SetDepthWriteMask(reinterpret_cast<const Internal::BoolCommand*>(header)->m_value);
+						break;
+					case Internal::CommandType::SET_DEPTH_COMPARISON_FUNCTION:
+						context_state.SetDepthComparisonFunction(reinterpret_cast<const Internal::ComparisonFunctionCommand*>(header)->m_function);
+						break;
+					case Internal::CommandType::SET_STENCIL_WRITE_MASK:
+						context_state.SetStencilWriteMask(reinterpret_cast<const Internal::ByteCommand*>(header)->m_value);
+						break;
+					case Internal::CommandType::SET_STENCIL_COMPARISON_FUNCTION:
+					{
+						const Internal::StencilComparisonFunctionCommand* command = reinterpret_cast<const Internal::StencilComparisonFunctionCommand*>(header);
+						context_state.SetStencilComparisonFunction(command->m_function, command->m_reference, command->m_mask);
+						break;
+					}
+					case Internal::CommandType::SET_SCISSOR_BOUNDING_REGION:
+					{
+						const Internal::ScissorBoundingRegionCommand* command = reinterpret_cast<const Internal::ScissorBoundingRegionCommand*>(header);
+						context_state.SetScissorBoundingRegion(command->m_region[0], command->m_region[1], command->m_region[2], command->m_region[3]);
+						break;
+					}
+					case Internal::CommandType::SET_FACE_CULLING_MODE:
+						context_state.SetFaceCullingMode(reinterpret_cast<const Internal::FaceCullingModeCommand*>(header)->m_mode);
+						break;
+					case Internal::CommandType::SET_COLOR_BLENDING_CONSTANT:
+					{
+						const Internal::ColorCommand* command = reinterpret_cast<const Internal::ColorCommand*>(header);
+						context_state.SetColorBlendingConstant(command->m_color[0], command->m_color[1], command->m_color[2], command->m_color[3]);
+						break;
+					}
+					case Internal::CommandType::SET_COLOR_BLENDING_FUNCTION:
+					{
+						const Internal::BlendFunctionCommand* command = reinterpret_cast<const Internal::BlendFunctionCommand*>(header);
+						context_state.SetColorBlendingFunction(command->m_src_function, command->m_dst_function);
+						break;
+					}
+					case Internal::CommandType::SET_LINE_WIDTH:
+						context_state.SetLineWidth(reinterpret_cast<const Internal::F32Command*>(header)->m_value);
+						break;
+					case Internal::CommandType::SET_ACTIVE_TEXTURE:
+						context_state.SetActiveTexture(reinterpret_cast<const Internal::U32Command*>(header)->m_value);
+						break;
+					case Internal::CommandType::SET_FILL_MODE:
+						context_state.SetFillMode(reinterpret_cast<const Internal::FillModeCommand*>(header)->m_mode);
+						break;
+					case Internal::CommandType::SET_FRONT_FACE:
+						context_state.SetFrontFace(reinterpret_cast<const Internal::FrontFaceCommand*>(header)->m_front_face);
+						break;
+					case Internal::CommandType::SET_PIXEL_STORAGE:
+					{
+						const Internal::PixelStorageCommand* command = reinterpret_cast<const Internal::PixelStorageCommand*>(header);
+						context_state.SetPixelStorage(command->m_mode, command->m_value);
+						break;
+					}
+					case Internal::CommandType::SET_COLOR_CLEAR:
+					{
+						const Internal::ColorCommand* command = reinterpret_cast<const Internal::ColorCommand*>(header);
+						context_state.SetColorClear(command->m_color[0], command->m_color[1], command->m_color[2], command->m_color[3]);
+						break;
+					}
+					case Internal::CommandType::SET_COLOR_WRITE_MASK:
+					{
+						const Internal::ColorCommand* command = reinterpret_cast<const Internal::ColorCommand*>(header);
+						context_state.SetColorWriteMask(command->m_color[0], command->m_color[1], command->m_color[2], command->m_color[3]);
+						break;
+					}
+					case Internal::CommandType::BIND_HARDWARE_BUFFER:
+						context_state.BindHardwareBuffer(reinterpret_cast<const Internal::BindHardwareBufferCommand*>(header)->m_hardware_buffer);
+						break;
+					case Internal::CommandType::BIND_RASTERIZER_STATE:
+						context_state.BindRasterizerState(reinterpret_cast<const Internal::BindRasterizerStateCommand*>(header)->m_state);
+						break;
+					case Internal::CommandType::BIND_BLEND_STATE:
+						context_state.BindBlendState(reinterpret_cast<const Internal::BindBlendStateCommand*>(header)->m_state);
+						break;
+					case Internal::CommandType::BIND_DEPTH_STENCIL_STATE:
+						context_state.BindDepthStencilState(reinterpret_cast<const Internal::BindDepthStencilStateCommand*>(header)->m_state);
+						break;
+					case Internal::CommandType::WRITE_HARDWARE_BUFFER:
+					{
+						const Internal::WriteHardwareBufferCommand* command = reinterpret_cast<const Internal::WriteHardwareBufferCommand*>(header);
+						command->m_hardware_buffer->WriteData(const_cast<Internal::WriteHardwareBufferCommand*>(command) + 1, command->m_offset, command->m_length);
+						break;
+					}
+					case Internal::CommandType::CLEAR:
+						context_state.Clear(reinterpret_cast<const Internal::ClearCommand*>(header)->m_flags);
+						break;
+					case Internal::CommandType::DRAW:
+					{
+						const Internal::DrawCommand* command = reinterpret_cast<const Internal::DrawCommand*>(header);
+						context_state.Draw(command->m_topology, command->m_first_vertex, command->m_vertex_count);
+						break;
+					}
+					case Internal::CommandType::DRAW_INDEXED:
+					{
+						const Internal::DrawIndexedCommand* command = reinterpret_cast<const Internal::DrawIndexedCommand*>(header);
+						context_state.DrawIndexed(command->m_topology, command->m_index_type, command->m_first_index, command->m_index_count, command->m_base_vertex);
+						break;
+					}
+					default:
+						FORGE_ASSERT(false, "The command stream is corrupted.")
+						return;
+					}
+
+					address += header->m_size;
+				}
+			}
+		}
+
+		Void CommandBuffer::Reset(Void)
+		{
+			FORGE_ASSERT(!IsPending(), "A command buffer can not be reset while it is pending.")
+
+			Internal::CommandPage* page = m_first_page;
+
+			while (page)
+			{
+				Internal::CommandPage* next = page->m_next;
+
+				m_page_allocator->Deallocate(page);
+
+				page = next;
+			}
+
+			m_first_page = m_last_page = nullptr;
+			m_num_of_commands = 0;
+			m_is_overflowed = false;
+		}
+	}
+}
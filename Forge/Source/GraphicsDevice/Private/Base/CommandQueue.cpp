@@ -0,0 +1,64 @@
+#include <GraphicsDevice/Public/Base/CommandQueue.h>
+
+namespace Forge {
+	namespace Graphics
+	{
+		Size CommandQueue::GetNumOfSubmissions(Void)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			return m_submissions.GetCount();
+		}
+
+		Void CommandQueue::Submit(CommandBufferRef command_buffer, U32 order)
+		{
+			FORGE_ASSERT(!command_buffer.IsOverflowed(), "An overflowed command buffer can not be submitted.")
+			FORGE_ASSERT(!command_buffer.IsPending(), "A pending command buffer can not be submitted again.")
+
+			command_buffer.m_is_pending.store(true, std::memory_order_relaxed);
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			m_submissions.PushBack(Submission{ &command_buffer, order });
+		}
+
+		Size CommandQueue::Execute(AbstractGraphicsContextState& context_state)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+
+				for (Size i = 0; i < m_submissions.GetCount(); i++)
+					m_executing.PushBack(m_submissions[i]);
+
+				m_submissions.Clear();
+			}
+
+			ConstSize count = m_executing.GetCount();
+
+			/// A frame is split in a handful of command buffers submitted
+			/// almost in order, a stable insertion sort suits them best.
+			for (Size i = 1; i < count; i++)
+			{
+				Submission submission = m_executing[i];
+				Size j = i;
+
+				for (; j > 0 && m_executing[j - 1].m_order > submission.m_order; j--)
+					m_executing[j] = m_executing[j - 1];
+
+				m_executing[j] = submission;
+			}
+
+			for (Size i = 0; i < count; i++)
+			{
+				CommandBufferPtr command_buffer = m_executing[i].m_command_buffer;
+
+				command_buffer->Execute(context_state);
+				command_buffer->m_is_pending.store(false, std::memory_order_release);
+			}
+
+			m_executing.Clear();
+
+			return count;
+		}
+	}
+}
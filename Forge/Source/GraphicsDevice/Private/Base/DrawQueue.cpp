@@ -0,0 +1,205 @@
+#include <GraphicsDevice/Public/Base/DrawQueue.h>
+
+namespace Forge {
+	namespace Graphics
+	{
+		namespace
+		{
+			constexpr U32 RADIX_BITS   = 8;
+			constexpr U32 RADIX_SIZE   = 1u << RADIX_BITS;
+			constexpr U32 RADIX_PASSES = 64 / RADIX_BITS;
+		}
+
+		Void DrawQueue::AddItem(const DrawItem& item, F32 depth)
+		{
+			if (item.m_pipeline_state >= m_pipeline_states.GetCount())
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The pipeline state was not added to the draw queue.")
+
+			if (item.m_material >= m_materials.GetCount())
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The material was not added to the draw queue.")
+
+			m_entries.PushBack(SortEntry{ MakeSortKey(item.m_pipeline_state, item.m_material, item.m_hardware_buffer, depth), static_cast<U32>(m_items.GetCount()) });
+			m_items.PushBack(item);
+		}
+
+		const DrawQueue::SortEntry* DrawQueue::SortEntries(Void)
+		{
+			ConstSize count = m_entries.GetCount();
+
+			if (count < 2)
+				return count ? &m_entries[0] : nullptr;
+
+			/// The scratch entries only grow, so after the first frames sorting
+			/// allocates nothing.
+			while (m_scratch_entries.GetCount() < count)
+				m_scratch_entries.PushBack(SortEntry());
+
+			U32 histograms[RADIX_PASSES][RADIX_SIZE] = {};
+
+			for (Size i = 0; i < count; i++)
+			{
+				U64 key = m_entries[i].m_key;
+
+				for (U32 pass = 0; pass < RADIX_PASSES; pass++)
+					histograms[pass][(key >> (pass * RADIX_BITS)) & (RADIX_SIZE - 1)]++;
+			}
+
+			SortEntry* src = &m_entries[0];
+			SortEntry* dst = &m_scratch_entries[0];
+
+			for (U32 pass = 0; pass < RADIX_PASSES; pass++)
+			{
+				U32* histogram = histograms[pass];
+				U32 shift = pass * RADIX_BITS;
+
+				/// All keys share this byte, the pass would not move any entry.
+				if (histogram[(src[0].m_key >> shift) & (RADIX_SIZE - 1)] == count)
+					continue;
+
+				U32 offset = 0;
+
+				for (U32 digit = 0; digit < RADIX_SIZE; digit++)
+				{
+					U32 digit_count = histogram[digit];
+					histogram[digit] = offset;
+					offset += digit_count;
+				}
+
+				for (Size i = 0; i < count; i++)
+					dst[histogram[(src[i].m_key >> shift) & (RADIX_SIZE - 1)]++] = src[i];
+
+				SortEntry* sorted = dst;
+				dst = src;
+				src = sorted;
+			}
+
+			return src;
+		}
+
+		Void DrawQueue::ApplyPipelineState(AbstractGraphicsContextState& context_state, const DrawPipelineState* previous, const DrawPipelineState& next)
+		{
+			if (!previous || previous->rasterizer_state != next.rasterizer_state)
+			{
+				context_state.BindRasterizerState(next.rasterizer_state);
+				m_statistics.m_num_of_state_binds++;
+			}
+
+			if (!previous || previous->blend_state != next.blend_state)
+			{
+				context_state.BindBlendState(next.blend_state);
+				m_statistics.m_num_of_state_binds++;
+			}
+
+			if (!previous || previous->depth_stencil_state != next.depth_stencil_state)
+			{
+				context_state.BindDepthStencilState(next.depth_stencil_state);
+				m_statistics.m_num_of_state_binds++;
+			}
+		}
+
+		U64 DrawQueue::MakeSortKey(U32 pipeline_state, U32 material, AbstractHardwareBufferPtr hardware_buffer, F32 depth)
+		{
+			constexpr U32 buffer_shift   = DRAW_KEY_DEPTH_BITS;
+			constexpr U32 material_shift = buffer_shift + DRAW_KEY_HARDWARE_BUFFER_BITS;
+			constexpr U32 pipeline_shift = material_shift + DRAW_KEY_MATERIAL_BITS;
+
+			constexpr U64 depth_mask = (1ull << DRAW_KEY_DEPTH_BITS) - 1;
+
+			/// Also maps NaN to zero.
+			if (!(depth > 0.0f))
+				depth = 0.0f;
+			else if (depth > 1.0f)
+				depth = 1.0f;
+
+			/// Hardware buffers are spread over their bits by a Fibonacci hash of
+			/// their address, so buffers allocated next to each other do not
+			/// collide.
+			U64 buffer_bits = (reinterpret_cast<Size>(hardware_buffer) * 0x9E3779B97F4A7C15ull) >> (64 - DRAW_KEY_HARDWARE_BUFFER_BITS);
+			U64 depth_bits = static_cast<U64>(static_cast<F64>(depth) * depth_mask);
+
+			return (static_cast<U64>(pipeline_state) << pipeline_shift) | (static_cast<U64>(material) << material_shift) | (buffer_bits << buffer_shift) | depth_bits;
+		}
+
+		U32 DrawQueue::AddPipelineState(const DrawPipelineState& pipeline_state)
+		{
+			if (!pipeline_state.rasterizer_state || !pipeline_state.blend_state || !pipeline_state.depth_stencil_state)
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The pipeline state is missing a state object.")
+
+			if (m_pipeline_states.GetCount() >= MAX_DRAW_PIPELINE_STATES)
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The draw queue can not hold more pipeline states.")
+
+			m_pipeline_states.PushBack(pipeline_state);
+
+			return static_cast<U32>(m_pipeline_states.GetCount() - 1);
+		}
+		U32 DrawQueue::AddMaterial(DrawMaterialBinder binder)
+		{
+			if (m_materials.GetCount() >= MAX_DRAW_MATERIALS)
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The draw queue can not hold more materials.")
+
+			m_materials.PushBack(Move(binder));
+
+			return static_cast<U32>(m_materials.GetCount() - 1);
+		}
+
+		Void DrawQueue::Submit(U32 pipeline_state, U32 material, AbstractHardwareBufferPtr hardware_buffer, F32 depth, PrimitiveTopologyMask topology, U32 first_vertex, U32 vertex_count)
+		{
+			AddItem(DrawItem{ hardware_buffer, pipeline_state, material, topology, ValueTypeMask::MAX, first_vertex, vertex_count, 0 }, depth);
+		}
+		Void DrawQueue::SubmitIndexed(U32 pipeline_state, U32 material, AbstractHardwareBufferPtr hardware_buffer, F32 depth, PrimitiveTopologyMask topology, ValueTypeMask index_type, U32 first_index, U32 index_count, I32 base_vertex)
+		{
+			AddItem(DrawItem{ hardware_buffer, pipeline_state, material, topology, index_type, first_index, index_count, base_vertex }, depth);
+		}
+
+		const DrawQueueStatistics& DrawQueue::Execute(AbstractGraphicsContextState& context_state, Bool sort_by_key)
+		{
+			m_statistics = DrawQueueStatistics();
+
+			ConstSize count = m_items.GetCount();
+
+			if (!count)
+				return m_statistics;
+
+			const SortEntry* entries = sort_by_key ? SortEntries() : &m_entries[0];
+
+			const DrawItem* previous = nullptr;
+
+			for (Size i = 0; i < count; i++)
+			{
+				const DrawItem& item = m_items[entries[i].m_index];
+
+				if (!previous || previous->m_pipeline_state != item.m_pipeline_state)
+				{
+					ApplyPipelineState(context_state, previous ? &m_pipeline_states[previous->m_pipeline_state] : nullptr, m_pipeline_states[item.m_pipeline_state]);
+					m_statistics.m_num_of_pipeline_changes++;
+				}
+
+				if (!previous || previous->m_material != item.m_material)
+				{
+					m_materials[item.m_material].Invoke(context_state);
+					m_statistics.m_num_of_material_changes++;
+				}
+
+				if (!previous || previous->m_hardware_buffer != item.m_hardware_buffer)
+				{
+					context_state.BindHardwareBuffer(item.m_hardware_buffer);
+					m_statistics.m_num_of_buffer_changes++;
+				}
+
+				if (item.m_index_type == ValueTypeMask::MAX)
+					context_state.Draw(item.m_topology, item.m_first, item.m_count);
+				else
+					context_state.DrawIndexed(item.m_topology, item.m_index_type, item.m_first, item.m_count, item.m_base_vertex);
+
+				m_statistics.m_num_of_draws++;
+
+				previous = &item;
+			}
+
+			m_items.Clear();
+			m_entries.Clear();
+
+			return m_statistics;
+		}
+	}
+}
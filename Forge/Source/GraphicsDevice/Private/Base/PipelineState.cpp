@@ -0,0 +1,167 @@
+#include <GraphicsDevice/Public/Base/PipelineState.h>
+
+namespace Forge {
+	namespace Graphics
+	{
+		U64 RasterizerStateDesc::GetHash(Void) const
+		{
+			/// Folds negative zero into positive zero so both hash the same as
+			/// they compare equal.
+			F32 normalized_line_width = line_width + 0.0f;
+
+			U32 line_width_bits = 0;
+			Memory::MemoryCopy(&line_width_bits, &normalized_line_width, sizeof(F32));
+
+			U64 bits = static_cast<U64>(line_width_bits)               |
+					   static_cast<U64>(front_face_mode)         << 32 |
+					   static_cast<U64>(polygon_fill_mode)       << 40 |
+					   static_cast<U64>(is_face_culling_enabled) << 48 |
+					   static_cast<U64>(face_culling_mode)       << 52 |
+					   static_cast<U64>(is_scissor_test_enabled) << 60;
+
+			return Algorithms::Internal::MixBits(bits);
+		}
+
+		U64 BlendStateDesc::GetHash(Void) const
+		{
+			U64 bits = static_cast<U64>(is_enabled)                |
+					   static_cast<U64>(src_function)        << 8  |
+					   static_cast<U64>(dst_function)        << 16 |
+					   static_cast<U64>(color_write_mask[0]) << 24 |
+					   static_cast<U64>(color_write_mask[1]) << 25 |
+					   static_cast<U64>(color_write_mask[2]) << 26 |
+					   static_cast<U64>(color_write_mask[3]) << 27;
+
+			return Algorithms::Internal::MixBits(bits);
+		}
+
+		U64 DepthStencilStateDesc::GetHash(Void) const
+		{
+			U64 bits = static_cast<U64>(is_depth_test_enabled)                |
+					   static_cast<U64>(depth_write_mask)            << 1  |
+					   static_cast<U64>(depth_comparison_function)   << 8  |
+					   static_cast<U64>(is_stencil_test_enabled)     << 16 |
+					   static_cast<U64>(stencil_write_mask)          << 24 |
+					   static_cast<U64>(stencil_comparison_function) << 32;
+
+			/// The reference and mask do not fit with the other fields, they
+			/// are mixed in as a second word.
+			U64 stencil_bits = static_cast<U64>(static_cast<U32>(stencil_reference)) | static_cast<U64>(stencil_mask) << 32;
+
+			return Algorithms::Internal::MixBits(bits ^ Algorithms::Internal::MixBits(stencil_bits));
+		}
+
+		RasterizerStateDelta ComputeStateDelta(const RasterizerStateDesc& previous, const RasterizerStateDesc& next)
+		{
+			U32 delta = 0;
+
+			if (previous.line_width != next.line_width)
+				delta |= static_cast<U32>(RasterizerStateDelta::FORGE_LINE_WIDTH);
+
+			if (previous.front_face_mode != next.front_face_mode)
+				delta |= static_cast<U32>(RasterizerStateDelta::FORGE_FRONT_FACE);
+
+			if (previous.polygon_fill_mode != next.polygon_fill_mode)
+				delta |= static_cast<U32>(RasterizerStateDelta::FORGE_FILL_MODE);
+
+			if (previous.is_face_culling_enabled != next.is_face_culling_enabled)
+				delta |= static_cast<U32>(RasterizerStateDelta::FORGE_FACE_CULLING);
+
+			if (previous.face_culling_mode != next.face_culling_mode)
+				delta |= static_cast<U32>(RasterizerStateDelta::FORGE_FACE_CULLING_MODE);
+
+			if (previous.is_scissor_test_enabled != next.is_scissor_test_enabled)
+				delta |= static_cast<U32>(RasterizerStateDelta::FORGE_SCISSOR_TEST);
+
+			return static_cast<RasterizerStateDelta>(delta);
+		}
+
+		BlendStateDelta ComputeStateDelta(const BlendStateDesc& previous, const BlendStateDesc& next)
+		{
+			U32 delta = 0;
+
+			if (previous.is_enabled != next.is_enabled)
+				delta |= static_cast<U32>(BlendStateDelta::FORGE_BLENDING);
+
+			if (previous.src_function != next.src_function || previous.dst_function != next.dst_function)
+				delta |= static_cast<U32>(BlendStateDelta::FORGE_FUNCTION);
+
+			for (U32 i = 0; i < 4; i++)
+				if (previous.color_write_mask[i] != next.color_write_mask[i])
+					delta |= static_cast<U32>(BlendStateDelta::FORGE_COLOR_WRITE_MASK);
+
+			return static_cast<BlendStateDelta>(delta);
+		}
+
+		DepthStencilStateDelta ComputeStateDelta(const DepthStencilStateDesc& previous, const DepthStencilStateDesc& next)
+		{
+			U32 delta = 0;
+
+			if (previous.is_depth_test_enabled != next.is_depth_test_enabled)
+				delta |= static_cast<U32>(DepthStencilStateDelta::FORGE_DEPTH_TEST);
+
+			if (previous.depth_write_mask != next.depth_write_mask)
+				delta |= static_cast<U32>(DepthStencilStateDelta::FORGE_DEPTH_WRITE_MASK);
+
+			if (previous.depth_comparison_function != next.depth_comparison_function)
+				delta |= static_cast<U32>(DepthStencilStateDelta::FORGE_DEPTH_FUNCTION);
+
+			if (previous.is_stencil_test_enabled != next.is_stencil_test_enabled)
+				delta |= static_cast<U32>(DepthStencilStateDelta::FORGE_STENCIL_TEST);
+
+			if (previous.stencil_write_mask != next.stencil_write_mask)
+				delta |= static_cast<U32>(DepthStencilStateDelta::FORGE_STENCIL_WRITE_MASK);
+
+			if (previous.stencil_comparison_function != next.stencil_comparison_function ||
+				previous.stencil_reference           != next.stencil_reference           ||
+				previous.stencil_mask                != next.stencil_mask)
+				delta |= static_cast<U32>(DepthStencilStateDelta::FORGE_STENCIL_FUNCTION);
+
+			return static_cast<DepthStencilStateDelta>(delta);
+		}
+
+		std::atomic<U32> PipelineStateCache::s_num_of_caches(0);
+
+		PipelineStateCache::PipelineStateCache(Void)
+			: m_id(s_num_of_caches.fetch_add(1, std::memory_order_relaxed) + 1) {}
+
+		PipelineStateCache::~PipelineStateCache(Void)
+		{
+			for (Size i = 0; i < m_rasterizer_states.GetCount(); i++)
+				delete m_rasterizer_states[i];
+
+			for (Size i = 0; i < m_blend_states.GetCount(); i++)
+				delete m_blend_states[i];
+
+			for (Size i = 0; i < m_depth_stencil_states.GetCount(); i++)
+				delete m_depth_stencil_states[i];
+		}
+
+		template<typename InDesc>
+		const TPipelineStateObject<InDesc>* PipelineStateCache::GetOrCreate(StateMap<InDesc>& map, Containers::TDynamicArray<TPipelineStateObject<InDesc>*>& states, const InDesc& desc)
+		{
+			if (TPipelineStateObject<InDesc>** state = map.Find(desc))
+				return *state;
+
+			TPipelineStateObject<InDesc>* state = new TPipelineStateObject<InDesc>(desc, desc.GetHash(), m_id, static_cast<U32>(states.GetCount()));
+
+			states.PushBack(state);
+			map.Insert(desc, state);
+
+			return state;
+		}
+
+		ConstRasterizerStateObjectPtr PipelineStateCache::GetRasterizerState(const RasterizerStateDesc& desc)
+		{
+			return GetOrCreate(m_rasterizer_state_map, m_rasterizer_states, desc);
+		}
+		ConstBlendStateObjectPtr PipelineStateCache::GetBlendState(const BlendStateDesc& desc)
+		{
+			return GetOrCreate(m_blend_state_map, m_blend_states, desc);
+		}
+		ConstDepthStencilStateObjectPtr PipelineStateCache::GetDepthStencilState(const DepthStencilStateDesc& desc)
+		{
+			return GetOrCreate(m_depth_stencil_state_map, m_depth_stencil_states, desc);
+		}
+	}
+}
@@ -0,0 +1,163 @@
+#include <GraphicsDevice/Public/Base/StreamingBufferRing.h>
+
+namespace Forge {
+	namespace Graphics
+	{
+		StreamingBufferRing::StreamingBufferRing(AbstractHardwareBufferPtr hardware_buffer, U32 max_num_of_frames)
+			: m_hardware_buffer(hardware_buffer), m_data(nullptr), m_head(0), m_used_size(0), m_frame_size(0), m_first_frame(0), m_num_of_frames(0),
+			  m_max_num_of_frames(Clamp(max_num_of_frames, 1u, MAX_STREAMING_FRAMES_IN_FLIGHT)), m_is_in_frame(FORGE_FALSE)
+		{
+			m_data = static_cast<BytePtr>(m_hardware_buffer->Lock(0, m_hardware_buffer->GetSize(), LockModeFlags::FORGE_WRITE_ONLY | LockModeFlags::FORGE_PERSISTENT));
+		}
+
+		StreamingBufferRing::~StreamingBufferRing(Void)
+		{
+			/// A failed wait leaves frames the GPU will never finish, their
+			/// fences are deleted without waiting since destructors can not
+			/// throw.
+			try
+			{
+				while (m_num_of_frames)
+					RetireFrame(FORGE_TRUE);
+			}
+			catch (Debug::Exception&)
+			{
+				for (; m_num_of_frames; m_num_of_frames--)
+				{
+					m_hardware_buffer->DeleteFence(m_frames[m_first_frame].m_fence);
+
+					m_first_frame = (m_first_frame + 1) % MAX_STREAMING_FRAMES_IN_FLIGHT;
+				}
+			}
+
+			m_hardware_buffer->Unlock();
+		}
+
+		Bool StreamingBufferRing::RetireFrame(Bool is_waiting)
+		{
+			FrameFence& frame = m_frames[m_first_frame];
+
+			if (!m_hardware_buffer->WaitFence(frame.m_fence, 0))
+			{
+				if (!is_waiting)
+					return FORGE_FALSE;
+
+				m_statistics.m_num_of_stalls++;
+
+				while (!m_hardware_buffer->WaitFence(frame.m_fence, STREAMING_FENCE_TIMEOUT));
+			}
+
+			m_hardware_buffer->DeleteFence(frame.m_fence);
+
+			m_used_size -= frame.m_size;
+
+			m_first_frame = (m_first_frame + 1) % MAX_STREAMING_FRAMES_IN_FLIGHT;
+			m_num_of_frames--;
+
+			return FORGE_TRUE;
+		}
+
+		Void StreamingBufferRing::BeginFrame(Void)
+		{
+			if (m_is_in_frame)
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The streaming buffer ring frame already began.")
+
+			while (m_num_of_frames && RetireFrame(FORGE_FALSE));
+
+			if (m_num_of_frames == m_max_num_of_frames)
+				RetireFrame(FORGE_TRUE);
+
+			m_is_in_frame = FORGE_TRUE;
+		}
+
+		VoidPtr StreamingBufferRing::Allocate(Size length, Size alignment, Size& offset)
+		{
+			if (!m_is_in_frame)
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The streaming buffer ring frame did not begin.")
+
+			if (!alignment || (alignment & (alignment - 1)))
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The streaming buffer ring allocation alignment is not a power of two.")
+
+			Size size = m_hardware_buffer->GetSize();
+
+			while (FORGE_TRUE)
+			{
+				/// With no bytes in use the ring starts over, so the whole buffer
+				/// is contiguous.
+				if (!m_used_size)
+					m_head = 0;
+
+				Size tail = m_head >= m_used_size ? m_head - m_used_size : m_head + size - m_used_size;
+				Size aligned_head = AlignSizeUpward(m_head, alignment);
+
+				Size consumed_size = 0;
+				Bool is_fitting = FORGE_FALSE;
+
+				if (m_used_size < size)
+				{
+					/// The free bytes either wrap around the end of the buffer,
+					/// or lie between the head and the tail.
+					if (m_head >= tail)
+					{
+						if (aligned_head + length <= size)
+						{
+							offset = aligned_head;
+							consumed_size = aligned_head + length - m_head;
+							is_fitting = FORGE_TRUE;
+						}
+						else if (length <= tail)
+						{
+							offset = 0;
+							consumed_size = size - m_head + length;
+							is_fitting = FORGE_TRUE;
+
+							m_statistics.m_num_of_wraps++;
+						}
+					}
+					else if (aligned_head + length <= tail)
+					{
+						offset = aligned_head;
+						consumed_size = aligned_head + length - m_head;
+						is_fitting = FORGE_TRUE;
+					}
+				}
+
+				if (is_fitting)
+				{
+					m_head = offset + length;
+					m_used_size += consumed_size;
+					m_frame_size += consumed_size;
+
+					m_statistics.m_num_of_allocations++;
+					m_statistics.m_num_of_bytes_allocated += length;
+
+					return m_data + offset;
+				}
+
+				if (!m_num_of_frames)
+					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The allocation does not fit in the streaming buffer beside the current frame.")
+
+				RetireFrame(FORGE_TRUE);
+			}
+		}
+
+		Void StreamingBufferRing::EndFrame(Void)
+		{
+			if (!m_is_in_frame)
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The streaming buffer ring frame did not begin.")
+
+			/// Frames without allocations hold no bytes to guard.
+			if (m_frame_size)
+			{
+				FrameFence& frame = m_frames[(m_first_frame + m_num_of_frames) % MAX_STREAMING_FRAMES_IN_FLIGHT];
+				frame.m_size = m_frame_size;
+				frame.m_fence = m_hardware_buffer->InsertFence();
+
+				m_num_of_frames++;
+				m_frame_size = 0;
+			}
+
+			m_is_in_frame = FORGE_FALSE;
+		}
+	}
+}
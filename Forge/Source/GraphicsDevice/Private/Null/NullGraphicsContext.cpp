@@ -0,0 +1,52 @@
+#include <GraphicsDevice/Public/Null/NullGraphicsContext.h>
+
+namespace Forge {
+	namespace Graphics
+	{
+		NullGraphicsContext::NullGraphicsContext(WindowPtr window)
+			: AbstractGraphicsContext(window), m_is_initialized(false), m_is_current(false) {}
+
+		Bool NullGraphicsContext::Initialize(Void)
+		{
+			m_statistics.m_num_of_initializations++;
+
+			m_is_initialized = true;
+
+			return FORGE_TRUE;
+		}
+		Void NullGraphicsContext::Terminate(Void)
+		{
+			m_statistics.m_num_of_terminations++;
+
+			m_is_initialized = m_is_current = false;
+		}
+
+		Void NullGraphicsContext::SetCurrent(Void)
+		{
+			if (!m_is_initialized)
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The graphics context must be initialized before it is made current.")
+
+			m_statistics.m_num_of_set_currents++;
+
+			m_is_current = true;
+		}
+		Void NullGraphicsContext::EndCurrent(Void)
+		{
+			m_statistics.m_num_of_end_currents++;
+
+			m_is_current = false;
+		}
+
+		Bool NullGraphicsContext::SwapBuffers(I32 swap_interval)
+		{
+			if (!m_is_current)
+				return FORGE_FALSE;
+
+			m_statistics.m_num_of_swaps++;
+
+			SimulateNullDriverLatency(m_latency.m_swap_latency);
+
+			return FORGE_TRUE;
+		}
+	}
+}
@@ -0,0 +1,450 @@
+#include <GraphicsDevice/Public/Null/NullGraphicsContextState.h>
+
+namespace Forge {
+	namespace Graphics
+	{
+		namespace
+		{
+			template<typename InEnum>
+			FORGE_FORCE_INLINE Void ValidateEnum(InEnum value)
+			{
+				if (static_cast<U32>(value) >= static_cast<U32>(InEnum::MAX))
+					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The enumeration value is invalid.")
+			}
+		}
+
+		NullGraphicsContextState::NullGraphicsContextState(AbstractGraphicsContextPtr graphics_context, Bool is_recording)
+			: AbstractGraphicsContextState(graphics_context), m_bound_hardware_buffer(nullptr), m_is_recording(is_recording)
+		{
+			InvalidateCache();
+			InitializeCache();
+		}
+
+		Void NullGraphicsContextState::RecordCall(NullGraphicsCallType type, F64 argument_0, F64 argument_1, F64 argument_2, F64 argument_3, F64 argument_4)
+		{
+			m_statistics.m_num_of_calls_by_type[static_cast<Size>(type)]++;
+			m_statistics.m_num_of_calls++;
+
+			SimulateNullDriverLatency(m_latency.m_call_latency);
+
+			if (m_is_recording)
+				m_calls.PushBack(NullGraphicsCall{ type, nullptr, { argument_0, argument_1, argument_2, argument_3, argument_4 } });
+		}
+
+		Void NullGraphicsContextState::EnableDepthTest(Bool enable)
+		{
+			ResetBoundDepthStencilState();
+
+			RecordCall(NullGraphicsCallType::FORGE_ENABLE_DEPTH_TEST, enable);
+
+			m_rasterizer_state.depth_state.is_enabled = enable;
+		}
+		Void NullGraphicsContextState::EnableStencilTest(Bool enable)
+		{
+			ResetBoundDepthStencilState();
+
+			RecordCall(NullGraphicsCallType::FORGE_ENABLE_STENCIL_TEST, enable);
+
+			m_rasterizer_state.stencil_state.is_enabled = enable;
+		}
+		Void NullGraphicsContextState::EnableScissorTest(Bool enable)
+		{
+			ResetBoundRasterizerState();
+
+			RecordCall(NullGraphicsCallType::FORGE_ENABLE_SCISSOR_TEST, enable);
+
+			m_rasterizer_state.scissor_state.is_enabled = enable;
+		}
+		Void NullGraphicsContextState::EnableFaceCulling(Bool enable)
+		{
+			ResetBoundRasterizerState();
+
+			RecordCall(NullGraphicsCallType::FORGE_ENABLE_FACE_CULLING, enable);
+
+			m_rasterizer_state.face_culling_state.is_enabled = enable;
+		}
+		Void NullGraphicsContextState::EnableColorBlending(Bool enable)
+		{
+			ResetBoundBlendState();
+
+			RecordCall(NullGraphicsCallType::FORGE_ENABLE_COLOR_BLENDING, enable);
+
+			m_rasterizer_state.color_blending_state.is_enabled = enable;
+		}
+
+		Bool NullGraphicsContextState::SetDepthWriteMask(Bool mask)
+		{
+			ResetBoundDepthStencilState();
+
+			RecordCall(NullGraphicsCallType::FORGE_SET_DEPTH_WRITE_MASK, mask);
+
+			if (!m_rasterizer_state.depth_state.is_enabled)
+				return FORGE_FALSE;
+
+			m_rasterizer_state.depth_state.write_mask = mask;
+
+			return FORGE_TRUE;
+		}
+		Bool NullGraphicsContextState::SetDepthComparisonFunction(ComparisonFuncMask function)
+		{
+			ResetBoundDepthStencilState();
+
+			ValidateEnum(function);
+
+			RecordCall(NullGraphicsCallType::FORGE_SET_DEPTH_COMPARISON_FUNCTION, static_cast<U32>(function));
+
+			if (!m_rasterizer_state.depth_state.is_enabled)
+				return FORGE_FALSE;
+
+			m_rasterizer_state.depth_state.comparison_function = function;
+
+			return FORGE_TRUE;
+		}
+
+		Bool NullGraphicsContextState::SetStencilWriteMask(Byte mask)
+		{
+			ResetBoundDepthStencilState();
+
+			RecordCall(NullGraphicsCallType::FORGE_SET_STENCIL_WRITE_MASK, mask);
+
+			if (!m_rasterizer_state.stencil_state.is_enabled)
+				return FORGE_FALSE;
+
+			m_rasterizer_state.stencil_state.write_mask = mask;
+
+			return FORGE_TRUE;
+		}
+		Bool NullGraphicsContextState::SetStencilComparisonFunction(ComparisonFuncMask function, I32 reference, U32 mask)
+		{
+			ResetBoundDepthStencilState();
+
+			ValidateEnum(function);
+
+			RecordCall(NullGraphicsCallType::FORGE_SET_STENCIL_COMPARISON_FUNCTION, static_cast<U32>(function), reference, mask);
+
+			if (!m_rasterizer_state.stencil_state.is_enabled)
+				return FORGE_FALSE;
+
+			m_rasterizer_state.stencil_state.comparison_function = function;
+
+			return FORGE_TRUE;
+		}
+
+		Bool NullGraphicsContextState::SetScissorBoundingRegion(I32 x, I32 y, I32 width, I32 height)
+		{
+			if (width < 0 || height < 0)
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The scissor bounding region can not have a negative size.")
+
+			RecordCall(NullGraphicsCallType::FORGE_SET_SCISSOR_BOUNDING_REGION, x, y, width, height);
+
+			if (!m_rasterizer_state.scissor_state.is_enabled)
+				return FORGE_FALSE;
+
+			m_rasterizer_state.scissor_state.bounding_region[0] = x;
+			m_rasterizer_state.scissor_state.bounding_region[1] = y;
+			m_rasterizer_state.scissor_state.bounding_region[2] = width;
+			m_rasterizer_state.scissor_state.bounding_region[3] = height;
+
+			return FORGE_TRUE;
+		}
+
+		Bool NullGraphicsContextState::SetFaceCullingMode(FaceCullMask mode)
+		{
+			ResetBoundRasterizerState();
+
+			ValidateEnum(mode);
+
+			RecordCall(NullGraphicsCallType::FORGE_SET_FACE_CULLING_MODE, static_cast<U32>(mode));
+
+			if (!m_rasterizer_state.face_culling_state.is_enabled)
+				return FORGE_FALSE;
+
+			m_rasterizer_state.face_culling_state.mode = mode;
+
+			return FORGE_TRUE;
+		}
+
+		Bool NullGraphicsContextState::SetColorBlendingConstant(F32 red, F32 green, F32 blue, F32 alpha)
+		{
+			RecordCall(NullGraphicsCallType::FORGE_SET_COLOR_BLENDING_CONSTANT, red, green, blue, alpha);
+
+			if (!m_rasterizer_state.color_blending_state.is_enabled)
+				return FORGE_FALSE;
+
+			m_rasterizer_state.color_blending_state.constant[0] = red;
+			m_rasterizer_state.color_blending_state.constant[1] = green;
+			m_rasterizer_state.color_blending_state.constant[2] = blue;
+			m_rasterizer_state.color_blending_state.constant[3] = alpha;
+
+			return FORGE_TRUE;
+		}
+		Bool NullGraphicsContextState::SetColorBlendingFunction(BlendFuncMask src_function, BlendFuncMask dst_function)
+		{
+			ResetBoundBlendState();
+
+			ValidateEnum(src_function);
+			ValidateEnum(dst_function);
+
+			RecordCall(NullGraphicsCallType::FORGE_SET_COLOR_BLENDING_FUNCTION, static_cast<U32>(src_function), static_cast<U32>(dst_function));
+
+			if (!m_rasterizer_state.color_blending_state.is_enabled)
+				return FORGE_FALSE;
+
+			m_rasterizer_state.color_blending_state.src_function = src_function;
+			m_rasterizer_state.color_blending_state.dst_function = dst_function;
+
+			return FORGE_TRUE;
+		}
+
+		Void NullGraphicsContextState::SetLineWidth(F32 width)
+		{
+			ResetBoundRasterizerState();
+
+			if (!(width > 0.0f))
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The line width must be positive.")
+
+			RecordCall(NullGraphicsCallType::FORGE_SET_LINE_WIDTH, width);
+
+			m_rasterizer_state.line_width = width;
+		}
+		Void NullGraphicsContextState::SetActiveTexture(U32 index)
+		{
+			RecordCall(NullGraphicsCallType::FORGE_SET_ACTIVE_TEXTURE, index);
+		}
+		Void NullGraphicsContextState::SetFillMode(PolygonFillMask mode)
+		{
+			ResetBoundRasterizerState();
+
+			if (mode != PolygonFillMask::FORGE_WIREFRAME && mode != PolygonFillMask::FORGE_SOLID)
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The enumeration value is invalid.")
+
+			RecordCall(NullGraphicsCallType::FORGE_SET_FILL_MODE, static_cast<U32>(mode));
+
+			m_rasterizer_state.polygon_fill_mode = mode;
+		}
+		Void NullGraphicsContextState::SetFrontFace(FrontFaceMask front_face)
+		{
+			ResetBoundRasterizerState();
+
+			ValidateEnum(front_face);
+
+			RecordCall(NullGraphicsCallType::FORGE_SET_FRONT_FACE, static_cast<U32>(front_face));
+
+			m_rasterizer_state.front_face_mode = front_face;
+		}
+		Void NullGraphicsContextState::SetPixelStorage(PixelStorageMask mode, I32 value)
+		{
+			ValidateEnum(mode);
+
+			RecordCall(NullGraphicsCallType::FORGE_SET_PIXEL_STORAGE, static_cast<U32>(mode), value);
+		}
+		Void NullGraphicsContextState::SetColorClear(F32 red, F32 green, F32 blue, F32 alpha)
+		{
+			RecordCall(NullGraphicsCallType::FORGE_SET_COLOR_CLEAR, red, green, blue, alpha);
+
+			m_rasterizer_state.color_clear[0] = red;
+			m_rasterizer_state.color_clear[1] = green;
+			m_rasterizer_state.color_clear[2] = blue;
+			m_rasterizer_state.color_clear[3] = alpha;
+		}
+		Void NullGraphicsContextState::SetColorWriteMask(F32 red, F32 green, F32 blue, F32 alpha)
+		{
+			ResetBoundBlendState();
+
+			RecordCall(NullGraphicsCallType::FORGE_SET_COLOR_WRITE_MASK, red, green, blue, alpha);
+
+			m_rasterizer_state.color_write_mask[0] = red;
+			m_rasterizer_state.color_write_mask[1] = green;
+			m_rasterizer_state.color_write_mask[2] = blue;
+			m_rasterizer_state.color_write_mask[3] = alpha;
+		}
+
+		Void NullGraphicsContextState::Clear(ClearFlags flags)
+		{
+			ConstSize all_flags = static_cast<Size>(ClearFlags::FORGE_COLOR_BUFFER | ClearFlags::FORGE_DEPTH_BUFFER | ClearFlags::FORGE_STENCIL_BUFFER);
+
+			if (!static_cast<Size>(flags) || (static_cast<Size>(flags) & ~all_flags))
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The clear flags are invalid.")
+
+			RecordCall(NullGraphicsCallType::FORGE_CLEAR, static_cast<U32>(flags));
+		}
+		Void NullGraphicsContextState::Draw(PrimitiveTopologyMask topology, U32 first_vertex, U32 vertex_count)
+		{
+			ValidateEnum(topology);
+
+			if (!m_bound_hardware_buffer)
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "Drawing requires a bound hardware buffer.")
+
+			RecordCall(NullGraphicsCallType::FORGE_DRAW, static_cast<U32>(topology), first_vertex, vertex_count);
+
+			m_statistics.m_num_of_draws++;
+			m_statistics.m_num_of_vertices += vertex_count;
+
+			SimulateNullDriverLatency(m_latency.m_draw_latency);
+		}
+		Void NullGraphicsContextState::DrawIndexed(PrimitiveTopologyMask topology, ValueTypeMask index_type, U32 first_index, U32 index_count, I32 base_vertex)
+		{
+			ValidateEnum(topology);
+
+			if (index_type != ValueTypeMask::FORGE_UBYTE && index_type != ValueTypeMask::FORGE_USHORT && index_type != ValueTypeMask::FORGE_UINT)
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "Indices must be unsigned bytes, shorts or ints.")
+
+			if (!m_bound_hardware_buffer)
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "Drawing requires a bound hardware buffer.")
+
+			RecordCall(NullGraphicsCallType::FORGE_DRAW_INDEXED, static_cast<U32>(topology), static_cast<U32>(index_type), first_index, index_count, base_vertex);
+
+			m_statistics.m_num_of_draws++;
+			m_statistics.m_num_of_vertices += index_count;
+
+			SimulateNullDriverLatency(m_latency.m_draw_latency);
+		}
+
+		Void NullGraphicsContextState::InitializeCache(Void)
+		{
+			m_bound_hardware_buffer = nullptr;
+		}
+		Void NullGraphicsContextState::InvalidateCache(Void)
+		{
+			m_rasterizer_state.depth_state.is_enabled          = true;
+			m_rasterizer_state.stencil_state.is_enabled        = false;
+			m_rasterizer_state.scissor_state.is_enabled        = false;
+			m_rasterizer_state.face_culling_state.is_enabled   = true;
+			m_rasterizer_state.color_blending_state.is_enabled = true;
+
+			m_rasterizer_state.depth_state.write_mask          = true;
+			m_rasterizer_state.depth_state.comparison_function = ComparisonFuncMask::FORGE_LESS;
+
+			m_rasterizer_state.stencil_state.write_mask          = 0xFF;
+			m_rasterizer_state.stencil_state.comparison_function = ComparisonFuncMask::FORGE_ALWAYS;
+
+			m_rasterizer_state.scissor_state.bounding_region[0] = 0;
+			m_rasterizer_state.scissor_state.bounding_region[1] = 0;
+			m_rasterizer_state.scissor_state.bounding_region[2] = 0;
+			m_rasterizer_state.scissor_state.bounding_region[3] = 0;
+
+			m_rasterizer_state.face_culling_state.mode = FaceCullMask::FORGE_BACK;
+
+			m_rasterizer_state.color_blending_state.constant[0]  = 0.0f;
+			m_rasterizer_state.color_blending_state.constant[1]  = 0.0f;
+			m_rasterizer_state.color_blending_state.constant[2]  = 0.0f;
+			m_rasterizer_state.color_blending_state.constant[3]  = 0.0f;
+			m_rasterizer_state.color_blending_state.src_function = BlendFuncMask::FORGE_SRC_ALPHA;
+			m_rasterizer_state.color_blending_state.dst_function = BlendFuncMask::FORGE_ONE_MINUS_SRC_ALPHA;
+
+			m_rasterizer_state.line_width = 1.0f;
+
+			m_rasterizer_state.front_face_mode = FrontFaceMask::FORGE_CW;
+
+			m_rasterizer_state.polygon_fill_mode = PolygonFillMask::FORGE_SOLID;
+
+			m_rasterizer_state.color_clear[0] = 0;
+			m_rasterizer_state.color_clear[1] = 0;
+			m_rasterizer_state.color_clear[2] = 0;
+			m_rasterizer_state.color_clear[3] = 0;
+
+			m_rasterizer_state.color_write_mask[0] = 0xFF;
+			m_rasterizer_state.color_write_mask[1] = 0xFF;
+			m_rasterizer_state.color_write_mask[2] = 0xFF;
+			m_rasterizer_state.color_write_mask[3] = 0xFF;
+
+			m_bound_hardware_buffer = nullptr;
+
+			ResetBoundStates();
+		}
+
+		Void NullGraphicsContextState::BindHardwareBuffer(AbstractHardwareBufferPtr hardware_buffer)
+		{
+			if (hardware_buffer && hardware_buffer->IsLocked())
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "A locked hardware buffer can not be bound.")
+
+			RecordCall(NullGraphicsCallType::FORGE_BIND_HARDWARE_BUFFER);
+
+			if (m_is_recording)
+				m_calls[m_calls.GetCount() - 1].m_hardware_buffer = hardware_buffer;
+
+			m_bound_hardware_buffer = hardware_buffer;
+		}
+
+		Void NullGraphicsContextState::ApplyRasterizerState(const RasterizerStateDesc& desc, RasterizerStateDelta delta)
+		{
+			if (!(desc.line_width > 0.0f))
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The line width must be positive.")
+
+			if (desc.polygon_fill_mode != PolygonFillMask::FORGE_WIREFRAME && desc.polygon_fill_mode != PolygonFillMask::FORGE_SOLID)
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The enumeration value is invalid.")
+
+			ValidateEnum(desc.front_face_mode);
+			ValidateEnum(desc.face_culling_mode);
+
+			RecordCall(NullGraphicsCallType::FORGE_APPLY_RASTERIZER_STATE, static_cast<U32>(delta));
+
+			if (delta & RasterizerStateDelta::FORGE_LINE_WIDTH)
+				m_rasterizer_state.line_width = desc.line_width;
+
+			if (delta & RasterizerStateDelta::FORGE_FRONT_FACE)
+				m_rasterizer_state.front_face_mode = desc.front_face_mode;
+
+			if (delta & RasterizerStateDelta::FORGE_FILL_MODE)
+				m_rasterizer_state.polygon_fill_mode = desc.polygon_fill_mode;
+
+			if (delta & RasterizerStateDelta::FORGE_FACE_CULLING)
+				m_rasterizer_state.face_culling_state.is_enabled = desc.is_face_culling_enabled;
+
+			if (delta & RasterizerStateDelta::FORGE_FACE_CULLING_MODE)
+				m_rasterizer_state.face_culling_state.mode = desc.face_culling_mode;
+
+			if (delta & RasterizerStateDelta::FORGE_SCISSOR_TEST)
+				m_rasterizer_state.scissor_state.is_enabled = desc.is_scissor_test_enabled;
+		}
+		Void NullGraphicsContextState::ApplyBlendState(const BlendStateDesc& desc, BlendStateDelta delta)
+		{
+			ValidateEnum(desc.src_function);
+			ValidateEnum(desc.dst_function);
+
+			RecordCall(NullGraphicsCallType::FORGE_APPLY_BLEND_STATE, static_cast<U32>(delta));
+
+			if (delta & BlendStateDelta::FORGE_BLENDING)
+				m_rasterizer_state.color_blending_state.is_enabled = desc.is_enabled;
+
+			if (delta & BlendStateDelta::FORGE_FUNCTION)
+			{
+				m_rasterizer_state.color_blending_state.src_function = desc.src_function;
+				m_rasterizer_state.color_blending_state.dst_function = desc.dst_function;
+			}
+
+			if (delta & BlendStateDelta::FORGE_COLOR_WRITE_MASK)
+			{
+				m_rasterizer_state.color_write_mask[0] = desc.color_write_mask[0] ? 0xFF : 0;
+				m_rasterizer_state.color_write_mask[1] = desc.color_write_mask[1] ? 0xFF : 0;
+				m_rasterizer_state.color_write_mask[2] = desc.color_write_mask[2] ? 0xFF : 0;
+				m_rasterizer_state.color_write_mask[3] = desc.color_write_mask[3] ? 0xFF : 0;
+			}
+		}
+		Void NullGraphicsContextState::ApplyDepthStencilState(const DepthStencilStateDesc& desc, DepthStencilStateDelta delta)
+		{
+			ValidateEnum(desc.depth_comparison_function);
+			ValidateEnum(desc.stencil_comparison_function);
+
+			RecordCall(NullGraphicsCallType::FORGE_APPLY_DEPTH_STENCIL_STATE, static_cast<U32>(delta));
+
+			if (delta & DepthStencilStateDelta::FORGE_DEPTH_TEST)
+				m_rasterizer_state.depth_state.is_enabled = desc.is_depth_test_enabled;
+
+			if (delta & DepthStencilStateDelta::FORGE_DEPTH_WRITE_MASK)
+				m_rasterizer_state.depth_state.write_mask = desc.depth_write_mask;
+
+			if (delta & DepthStencilStateDelta::FORGE_DEPTH_FUNCTION)
+				m_rasterizer_state.depth_state.comparison_function = desc.depth_comparison_function;
+
+			if (delta & DepthStencilStateDelta::FORGE_STENCIL_TEST)
+				m_rasterizer_state.stencil_state.is_enabled = desc.is_stencil_test_enabled;
+
+			if (delta & DepthStencilStateDelta::FORGE_STENCIL_WRITE_MASK)
+				m_rasterizer_state.stencil_state.write_mask = desc.stencil_write_mask;
+
+			if (delta & DepthStencilStateDelta::FORGE_STENCIL_FUNCTION)
+				m_rasterizer_state.stencil_state.comparison_function = desc.stencil_comparison_function;
+		}
+	}
+}
@@ -0,0 +1,153 @@
+#include <GraphicsDevice/Public/Null/NullHardwareBuffer.h>
+
+namespace Forge {
+	namespace Graphics
+	{
+		NullHardwareBuffer::NullHardwareBuffer(Size size, UsageModeMask usage_mode_mask)
+			: AbstractHardwareBuffer(size, usage_mode_mask, FORGE_TRUE), m_next_fence(1), m_last_signaled_fence(0), m_is_signaling_fences(FORGE_TRUE), m_is_failing_fences(FORGE_FALSE)
+		{
+			m_handle.m_id_ptr = this;
+
+			m_shadow_buffer = Move(TMemoryRegion<Byte>(new Byte[size], size));
+
+			MemorySet(m_shadow_buffer.GetPointer(), 0, size);
+		}
+
+		NullHardwareBuffer::~NullHardwareBuffer(Void)
+		{
+			m_shadow_buffer.Reset();
+		}
+
+		Void NullHardwareBuffer::SimulateLatency(Size length)
+		{
+			SimulateNullDriverLatency(m_latency.m_call_latency + static_cast<U64>(m_latency.m_byte_latency * length));
+		}
+
+		VoidPtr NullHardwareBuffer::Lock(LockModeFlags lock_mode)
+		{
+			return Lock(0, m_size, lock_mode);
+		}
+		VoidPtr NullHardwareBuffer::Lock(Size offset, Size length, LockModeFlags lock_mode)
+		{
+			if (offset + length > m_size)
+				FORGE_EXCEPT(ExceptionType::FORGE_MEMORY_OUT_OF_BOUNDS)
+
+			if (m_is_locked)
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The hardware buffer is already locked.")
+
+			if ((lock_mode & LockModeFlags::FORGE_PERSISTENT) && m_usage_mode_mask != UsageModeMask::FORGE_CPU_TO_GPU_STREAM)
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The hardware buffer storage can not be locked persistently.")
+
+			m_is_locked = true;
+			m_lock_offset = offset;
+			m_lock_length = length;
+
+			m_statistics.m_num_of_locks++;
+			m_statistics.m_num_of_bytes_locked += length;
+
+			SimulateLatency(length);
+
+			return m_shadow_buffer.GetPointer() + offset;
+		}
+
+		Bool NullHardwareBuffer::Unlock(Void)
+		{
+			if (!m_is_locked)
+				return FORGE_FALSE;
+
+			m_is_locked = false;
+			m_lock_offset = m_lock_length = 0;
+
+			return FORGE_TRUE;
+		}
+
+		Void NullHardwareBuffer::ReadData(VoidPtr dst, Size offset, Size length)
+		{
+			if (offset + length > m_size)
+				FORGE_EXCEPT(ExceptionType::FORGE_MEMORY_OUT_OF_BOUNDS)
+
+			if (m_is_locked)
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The hardware buffer can not be read while it is locked.")
+
+			MemoryCopy(dst, m_shadow_buffer.GetPointer() + offset, length);
+
+			m_statistics.m_num_of_reads++;
+			m_statistics.m_num_of_bytes_read += length;
+
+			SimulateLatency(length);
+		}
+		Void NullHardwareBuffer::WriteData(VoidPtr src, Size offset, Size length)
+		{
+			if (offset + length > m_size)
+				FORGE_EXCEPT(ExceptionType::FORGE_MEMORY_OUT_OF_BOUNDS)
+
+			if (m_is_locked)
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The hardware buffer can not be written while it is locked.")
+
+			MemoryCopy(m_shadow_buffer.GetPointer() + offset, src, length);
+
+			m_statistics.m_num_of_writes++;
+			m_statistics.m_num_of_bytes_written += length;
+
+			SimulateLatency(length);
+		}
+		Void NullHardwareBuffer::CopyData(AbstractHardwareBuffer& src, Size src_offset, Size dst_offset, Size length)
+		{
+			if (dst_offset + length > m_size)
+				FORGE_EXCEPT(ExceptionType::FORGE_MEMORY_OUT_OF_BOUNDS)
+
+			if (src_offset + length > src.GetSize())
+				FORGE_EXCEPT(ExceptionType::FORGE_MEMORY_OUT_OF_BOUNDS)
+
+			if (m_is_locked || src.IsLocked() || !src.IsShadowed())
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The hardware buffers can not be copied.")
+
+			MemoryCopy(m_shadow_buffer.GetPointer() + dst_offset, src.GetShadowBuffer().GetPointer() + src_offset, length);
+
+			m_statistics.m_num_of_copies++;
+			m_statistics.m_num_of_bytes_copied += length;
+
+			SimulateLatency(length);
+		}
+
+		AbstractHardwareBuffer::FenceHandle NullHardwareBuffer::InsertFence(Void)
+		{
+			FenceHandle fence;
+			fence.m_id_num = m_next_fence++;
+
+			if (m_is_signaling_fences)
+				m_last_signaled_fence = fence.m_id_num;
+
+			m_statistics.m_num_of_fences++;
+
+			SimulateLatency(0);
+
+			return fence;
+		}
+		Bool NullHardwareBuffer::WaitFence(FenceHandle fence, U64 timeout)
+		{
+			if (m_is_failing_fences)
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "Waiting for the hardware buffer fence failed.")
+
+			if (fence.m_id_num <= m_last_signaled_fence)
+				return FORGE_TRUE;
+
+			if (!timeout)
+				return FORGE_FALSE;
+
+			/// Fences are signaled in order, so the GPU finishing this fence
+			/// finished the ones before it.
+			m_last_signaled_fence = fence.m_id_num;
+
+			m_statistics.m_num_of_fence_stalls++;
+
+			SimulateLatency(0);
+
+			return FORGE_TRUE;
+		}
+		Void NullHardwareBuffer::DeleteFence(FenceHandle fence)
+		{
+
+		}
+	}
+}
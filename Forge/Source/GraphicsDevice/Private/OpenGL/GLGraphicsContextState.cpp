@@ -20,6 +20,8 @@ namespace Forge {
 
 		Void GLGraphicsContextState::EnableDepthTest(Bool enable)
 		{
+			ResetBoundDepthStencilState();
+
 			if (m_rasterizer_state.depth_state.is_enabled != enable)
 			{
 				if (enable)
@@ -36,6 +38,8 @@ namespace Forge {
 		}
 		Void GLGraphicsContextState::EnableStencilTest(Bool enable)
 		{
+			ResetBoundDepthStencilState();
+
 			if (m_rasterizer_state.stencil_state.is_enabled != enable)
 			{
 				if (enable)
@@ -52,6 +56,8 @@ namespace Forge {
 		}
 		Void GLGraphicsContextState::EnableScissorTest(Bool enable)
 		{
+			ResetBoundRasterizerState();
+
 			if (m_rasterizer_state.scissor_state.is_enabled != enable)
 			{
 				if (enable)
@@ -68,6 +74,8 @@ namespace Forge {
 		}
 		Void GLGraphicsContextState::EnableFaceCulling(Bool enable)
 		{
+			ResetBoundRasterizerState();
+
 			if (m_rasterizer_state.face_culling_state.is_enabled != enable)
 			{
 				if (enable)
@@ -84,6 +92,8 @@ namespace Forge {
 		}
 		Void GLGraphicsContextState::EnableColorBlending(Bool enable)
 		{
+			ResetBoundBlendState();
+
 			if (m_rasterizer_state.color_blending_state.is_enabled != enable)
 			{
 				if (enable)
@@ -101,6 +111,8 @@ namespace Forge {
 
 		Bool GLGraphicsContextState::SetDepthWriteMask(Bool mask)
 		{
+			ResetBoundDepthStencilState();
+
 			if (m_rasterizer_state.depth_state.is_enabled)
 			{
 				if (m_rasterizer_state.depth_state.write_mask != mask)
@@ -116,6 +128,8 @@ namespace Forge {
 		}
 		Bool GLGraphicsContextState::SetDepthComparisonFunction(ComparisonFuncMask function)
 		{
+			ResetBoundDepthStencilState();
+
 			if (m_rasterizer_state.depth_state.is_enabled)
 			{
 				if (m_rasterizer_state.depth_state.comparison_function != function)
@@ -132,6 +146,8 @@ namespace Forge {
 
 		Bool GLGraphicsContextState::SetStencilWriteMask(Byte mask)
 		{
+			ResetBoundDepthStencilState();
+
 			if (m_rasterizer_state.stencil_state.is_enabled)
 			{
 				if (m_rasterizer_state.stencil_state.write_mask != mask)
@@ -148,6 +164,8 @@ namespace Forge {
 		}
 		Bool GLGraphicsContextState::SetStencilComparisonFunction(ComparisonFuncMask function, I32 ref, U32 mask)
 		{
+			ResetBoundDepthStencilState();
+
 			if (m_rasterizer_state.stencil_state.is_enabled)
 			{
 				if (m_rasterizer_state.stencil_state.comparison_function != function)
@@ -186,6 +204,8 @@ namespace Forge {
 
 		Bool GLGraphicsContextState::SetFaceCullingMode(FaceCullMask mode)
 		{
+			ResetBoundRasterizerState();
+
 			if (m_rasterizer_state.face_culling_state.is_enabled)
 			{
 				if (m_rasterizer_state.face_culling_state.mode != mode)
@@ -224,6 +244,8 @@ namespace Forge {
 		}
 		Bool GLGraphicsContextState::SetColorBlendingFunction(BlendFuncMask src_function, BlendFuncMask dst_function)
 		{
+			ResetBoundBlendState();
+
 			if (m_rasterizer_state.color_blending_state.is_enabled)
 			{
 				if (m_rasterizer_state.color_blending_state.src_function != src_function ||
@@ -244,6 +266,8 @@ namespace Forge {
 		
 		Void GLGraphicsContextState::SetLineWidth(F32 width)
 		{
+			ResetBoundRasterizerState();
+
 			if (m_rasterizer_state.line_width != width)
 			{
 				FORGE_GL_CHECK_ERROR(glLineWidth(width))
@@ -256,6 +280,8 @@ namespace Forge {
 		}
 		Void GLGraphicsContextState::SetFillMode(PolygonFillMask mode)
 		{
+			ResetBoundRasterizerState();
+
 			if (m_rasterizer_state.polygon_fill_mode != mode)
 			{
 				FORGE_GL_CHECK_ERROR(glPolygonMode(GL_FRONT_AND_BACK, mode == PolygonFillMask::FORGE_SOLID ? GL_FILL : GL_LINE))
@@ -264,6 +290,8 @@ namespace Forge {
 		}
 		Void GLGraphicsContextState::SetFrontFace(FrontFaceMask front_face)
 		{
+			ResetBoundRasterizerState();
+
 			if (m_rasterizer_state.front_face_mode != front_face)
 			{
 				FORGE_GL_CHECK_ERROR(glFrontFace(front_face == FrontFaceMask::FORGE_CW ? GL_CW : GL_CCW))
@@ -290,6 +318,8 @@ namespace Forge {
 		}
 		Void GLGraphicsContextState::SetColorWriteMask(F32 red, F32 green, F32 blue, F32 alpha)
 		{
+			ResetBoundBlendState();
+
 			if (m_rasterizer_state.color_write_mask[0] != red   ||
 				m_rasterizer_state.color_write_mask[1] != green ||
 				m_rasterizer_state.color_write_mask[2] != blue  ||
@@ -303,6 +333,34 @@ namespace Forge {
 			}
 		}
 
+		Void GLGraphicsContextState::Clear(ClearFlags flags)
+		{
+			GLbitfield mask = 0;
+
+			if (flags & ClearFlags::FORGE_COLOR_BUFFER)
+				mask |= GL_COLOR_BUFFER_BIT;
+
+			if (flags & ClearFlags::FORGE_DEPTH_BUFFER)
+				mask |= GL_DEPTH_BUFFER_BIT;
+
+			if (flags & ClearFlags::FORGE_STENCIL_BUFFER)
+				mask |= GL_STENCIL_BUFFER_BIT;
+
+			FORGE_GL_CHECK_ERROR(glClear(mask))
+		}
+		Void GLGraphicsContextState::Draw(PrimitiveTopologyMask topology, U32 first_vertex, U32 vertex_count)
+		{
+			FORGE_GL_CHECK_ERROR(glDrawArrays(ConvertToGLPrimitiveTopology(topology), first_vertex, vertex_count))
+		}
+		Void GLGraphicsContextState::DrawIndexed(PrimitiveTopologyMask topology, ValueTypeMask index_type, U32 first_index, U32 index_count, I32 base_vertex)
+		{
+			Size index_size = index_type == ValueTypeMask::FORGE_UBYTE  ? sizeof(U8)  :
+			                  index_type == ValueTypeMask::FORGE_USHORT ? sizeof(U16) : sizeof(U32);
+
+			FORGE_GL_CHECK_ERROR(glDrawElementsBaseVertex(ConvertToGLPrimitiveTopology(topology), index_count, ConvertToGLValueType(index_type),
+				                                          reinterpret_cast<VoidPtr>(first_index * index_size), base_vertex))
+		}
+
 		Void GLGraphicsContextState::InitializeCache(Void)
 		{
 			if(m_rasterizer_state.depth_state.is_enabled)
@@ -419,11 +477,136 @@ namespace Forge {
 			m_rasterizer_state.color_write_mask[1] = 0xFF;
 			m_rasterizer_state.color_write_mask[2] = 0xFF;
 			m_rasterizer_state.color_write_mask[3] = 0xFF;
+
+			ResetBoundStates();
 		}
 
 		Void GLGraphicsContextState::BindHardwareBuffer(AbstractHardwareBufferPtr hardware_buffer)
 		{
 
 		}
+
+		Void GLGraphicsContextState::ApplyRasterizerState(const RasterizerStateDesc& desc, RasterizerStateDelta delta)
+		{
+			if (delta & RasterizerStateDelta::FORGE_LINE_WIDTH)
+			{
+				FORGE_GL_CHECK_ERROR(glLineWidth(desc.line_width))
+				m_rasterizer_state.line_width = desc.line_width;
+			}
+
+			if (delta & RasterizerStateDelta::FORGE_FRONT_FACE)
+			{
+				FORGE_GL_CHECK_ERROR(glFrontFace(desc.front_face_mode == FrontFaceMask::FORGE_CW ? GL_CW : GL_CCW))
+				m_rasterizer_state.front_face_mode = desc.front_face_mode;
+			}
+
+			if (delta & RasterizerStateDelta::FORGE_FILL_MODE)
+			{
+				FORGE_GL_CHECK_ERROR(glPolygonMode(GL_FRONT_AND_BACK, desc.polygon_fill_mode == PolygonFillMask::FORGE_SOLID ? GL_FILL : GL_LINE))
+				m_rasterizer_state.polygon_fill_mode = desc.polygon_fill_mode;
+			}
+
+			if (delta & RasterizerStateDelta::FORGE_FACE_CULLING)
+			{
+				if (desc.is_face_culling_enabled)
+					FORGE_GL_CHECK_ERROR(glEnable(GL_CULL_FACE))
+				else
+					FORGE_GL_CHECK_ERROR(glDisable(GL_CULL_FACE))
+
+				m_rasterizer_state.face_culling_state.is_enabled = desc.is_face_culling_enabled;
+			}
+
+			if (delta & RasterizerStateDelta::FORGE_FACE_CULLING_MODE)
+			{
+				FORGE_GL_CHECK_ERROR(glCullFace(desc.face_culling_mode == FaceCullMask::FORGE_BACK  ? GL_BACK  :
+					                            desc.face_culling_mode == FaceCullMask::FORGE_FRONT ? GL_FRONT : GL_FRONT_AND_BACK))
+				m_rasterizer_state.face_culling_state.mode = desc.face_culling_mode;
+			}
+
+			if (delta & RasterizerStateDelta::FORGE_SCISSOR_TEST)
+			{
+				if (desc.is_scissor_test_enabled)
+					FORGE_GL_CHECK_ERROR(glEnable(GL_SCISSOR_TEST))
+				else
+					FORGE_GL_CHECK_ERROR(glDisable(GL_SCISSOR_TEST))
+
+				m_rasterizer_state.scissor_state.is_enabled = desc.is_scissor_test_enabled;
+			}
+		}
+		Void GLGraphicsContextState::ApplyBlendState(const BlendStateDesc& desc, BlendStateDelta delta)
+		{
+			if (delta & BlendStateDelta::FORGE_BLENDING)
+			{
+				if (desc.is_enabled)
+					FORGE_GL_CHECK_ERROR(glEnable(GL_BLEND))
+				else
+					FORGE_GL_CHECK_ERROR(glDisable(GL_BLEND))
+
+				m_rasterizer_state.color_blending_state.is_enabled = desc.is_enabled;
+			}
+
+			if (delta & BlendStateDelta::FORGE_FUNCTION)
+			{
+				FORGE_GL_CHECK_ERROR(glBlendFunc(ConvertToGLBlendFunction(desc.src_function), 
+					                             ConvertToGLBlendFunction(desc.dst_function)))
+				m_rasterizer_state.color_blending_state.src_function = desc.src_function;
+				m_rasterizer_state.color_blending_state.dst_function = desc.dst_function;
+			}
+
+			if (delta & BlendStateDelta::FORGE_COLOR_WRITE_MASK)
+			{
+				FORGE_GL_CHECK_ERROR(glColorMask(desc.color_write_mask[0], desc.color_write_mask[1], desc.color_write_mask[2], desc.color_write_mask[3]))
+				m_rasterizer_state.color_write_mask[0] = desc.color_write_mask[0] ? 0xFF : 0;
+				m_rasterizer_state.color_write_mask[1] = desc.color_write_mask[1] ? 0xFF : 0;
+				m_rasterizer_state.color_write_mask[2] = desc.color_write_mask[2] ? 0xFF : 0;
+				m_rasterizer_state.color_write_mask[3] = desc.color_write_mask[3] ? 0xFF : 0;
+			}
+		}
+		Void GLGraphicsContextState::ApplyDepthStencilState(const DepthStencilStateDesc& desc, DepthStencilStateDelta delta)
+		{
+			if (delta & DepthStencilStateDelta::FORGE_DEPTH_TEST)
+			{
+				if (desc.is_depth_test_enabled)
+					FORGE_GL_CHECK_ERROR(glEnable(GL_DEPTH_TEST))
+				else
+					FORGE_GL_CHECK_ERROR(glDisable(GL_DEPTH_TEST))
+
+				m_rasterizer_state.depth_state.is_enabled = desc.is_depth_test_enabled;
+			}
+
+			if (delta & DepthStencilStateDelta::FORGE_DEPTH_WRITE_MASK)
+			{
+				FORGE_GL_CHECK_ERROR(glDepthMask(desc.depth_write_mask))
+				m_rasterizer_state.depth_state.write_mask = desc.depth_write_mask;
+			}
+
+			if (delta & DepthStencilStateDelta::FORGE_DEPTH_FUNCTION)
+			{
+				FORGE_GL_CHECK_ERROR(glDepthFunc(ConvertToGLCompareFunction(desc.depth_comparison_function)))
+				m_rasterizer_state.depth_state.comparison_function = desc.depth_comparison_function;
+			}
+
+			if (delta & DepthStencilStateDelta::FORGE_STENCIL_TEST)
+			{
+				if (desc.is_stencil_test_enabled)
+					FORGE_GL_CHECK_ERROR(glEnable(GL_STENCIL_TEST))
+				else
+					FORGE_GL_CHECK_ERROR(glDisable(GL_STENCIL_TEST))
+
+				m_rasterizer_state.stencil_state.is_enabled = desc.is_stencil_test_enabled;
+			}
+
+			if (delta & DepthStencilStateDelta::FORGE_STENCIL_WRITE_MASK)
+			{
+				FORGE_GL_CHECK_ERROR(glStencilMask(desc.stencil_write_mask))
+				m_rasterizer_state.stencil_state.write_mask = desc.stencil_write_mask;
+			}
+
+			if (delta & DepthStencilStateDelta::FORGE_STENCIL_FUNCTION)
+			{
+				FORGE_GL_CHECK_ERROR(glStencilFunc(ConvertToGLCompareFunction(desc.stencil_comparison_function), desc.stencil_reference, desc.stencil_mask))
+				m_rasterizer_state.stencil_state.comparison_function = desc.stencil_comparison_function;
+			}
+		}
 	}
 }
@@ -6,7 +6,7 @@ namespace Forge {
 	namespace Graphics
 	{
 		GLHardwareBuffer::GLHardwareBuffer(GLenum buffer_target, Size size, UsageModeMask usage_mode_mask, Bool is_shadowed)
-			: m_buffer_target(buffer_target), AbstractHardwareBuffer(size, usage_mode_mask, is_shadowed)
+			: m_buffer_target(buffer_target), m_is_persistent(FORGE_FALSE), AbstractHardwareBuffer(size, usage_mode_mask, is_shadowed)
 		{
 			if (m_is_shadowed)
 				m_shadow_buffer = Move(TMemoryRegion<Byte>(new Byte[size], size));
@@ -14,7 +14,17 @@ namespace Forge {
 			FORGE_GL_CHECK_ERROR(glGenBuffers(1, &m_handle.m_id_num))
 
 			FORGE_GL_CHECK_ERROR(glBindBuffer(m_buffer_target, m_handle.m_id_num))
-			FORGE_GL_CHECK_ERROR(glBufferData(m_buffer_target, m_size, nullptr, ConvertToGLBufferUsage(m_usage_mode_mask)))
+
+			/// Stream buffers get immutable storage so they can stay mapped
+			/// while the GPU reads them, without a driver copy per lock. The
+			/// dynamic storage bit keeps WriteData valid on them.
+			if (m_usage_mode_mask == UsageModeMask::FORGE_CPU_TO_GPU_STREAM && GLEW_ARB_buffer_storage)
+			{
+				FORGE_GL_CHECK_ERROR(glBufferStorage(m_buffer_target, m_size, nullptr, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT | GL_DYNAMIC_STORAGE_BIT))
+				m_is_persistent = FORGE_TRUE;
+			}
+			else
+				FORGE_GL_CHECK_ERROR(glBufferData(m_buffer_target, m_size, nullptr, ConvertToGLBufferUsage(m_usage_mode_mask)))
 
 			FORGE_GL_CHECK_ERROR(glBindBuffer(m_buffer_target, 0));
 		}
@@ -49,12 +59,24 @@ namespace Forge {
 			
 			if((lock_mode & LockModeFlags::FORGE_READ_ONLY) && !(lock_mode & LockModeFlags::FORGE_DISCARD))
 				gl_lock_mode |= GL_MAP_READ_BIT;
+
+			if (lock_mode & LockModeFlags::FORGE_PERSISTENT)
+			{
+				if (!m_is_persistent)
+					FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "The hardware buffer storage can not be locked persistently.")
+
+				gl_lock_mode = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			}
 			
 			FORGE_GL_CHECK_ERROR(glBindBuffer(m_buffer_target, m_handle.m_id_num))
 			FORGE_GL_CHECK_ERROR(buffer = glMapBufferRange(m_buffer_target, offset, length, gl_lock_mode))
 
 			FORGE_GL_CHECK_ERROR(glBindBuffer(m_buffer_target, 0))
 
+			m_is_locked = FORGE_TRUE;
+			m_lock_offset = offset;
+			m_lock_length = length;
+
 			return buffer;
 		}
 
@@ -67,6 +89,9 @@ namespace Forge {
 
 			FORGE_GL_CHECK_ERROR(glBindBuffer(m_buffer_target, 0))
 
+			m_is_locked = FORGE_FALSE;
+			m_lock_offset = m_lock_length = 0;
+
 			return result;
 		}
 
@@ -111,7 +136,10 @@ namespace Forge {
 				MemoryCopy(m_shadow_buffer.GetPointer() + dst_offset, src.GetShadowBuffer().GetPointer() + src_offset, length);
 
 			FORGE_GL_CHECK_ERROR(glBindBuffer(m_buffer_target, m_handle.m_id_num))
-			FORGE_GL_CHECK_ERROR(glBufferData(m_buffer_target, length, nullptr, ConvertToGLBufferUsage(m_usage_mode_mask)))
+
+			/// Immutable storage can not be respecified.
+			if (!m_is_persistent)
+				FORGE_GL_CHECK_ERROR(glBufferData(m_buffer_target, length, nullptr, ConvertToGLBufferUsage(m_usage_mode_mask)))
 
 			FORGE_GL_CHECK_ERROR(glBindBuffer(GL_COPY_READ_BUFFER, src.GetNativeHandle().m_id_num))
 			FORGE_GL_CHECK_ERROR(glBindBuffer(GL_COPY_WRITE_BUFFER, m_handle.m_id_num))
@@ -121,5 +149,29 @@ namespace Forge {
 			FORGE_GL_CHECK_ERROR(glBindBuffer(GL_COPY_READ_BUFFER, 0))
 			FORGE_GL_CHECK_ERROR(glBindBuffer(GL_COPY_WRITE_BUFFER, 0))
 		}
+
+		AbstractHardwareBuffer::FenceHandle GLHardwareBuffer::InsertFence(Void)
+		{
+			FenceHandle fence;
+
+			FORGE_GL_CHECK_ERROR(fence.m_id_ptr = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0))
+
+			return fence;
+		}
+		Bool GLHardwareBuffer::WaitFence(FenceHandle fence, U64 timeout)
+		{
+			GLenum result;
+
+			FORGE_GL_CHECK_ERROR(result = glClientWaitSync(static_cast<GLsync>(fence.m_id_ptr), GL_SYNC_FLUSH_COMMANDS_BIT, timeout))
+
+			if (result == GL_WAIT_FAILED)
+				FORGE_EXCEPT(ExceptionType::FORGE_INVALID_OPERATION, "Waiting for the hardware buffer fence failed.")
+
+			return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+		}
+		Void GLHardwareBuffer::DeleteFence(FenceHandle fence)
+		{
+			FORGE_GL_CHECK_ERROR(glDeleteSync(static_cast<GLsync>(fence.m_id_ptr)))
+		}
 	}
 }
@@ -1,20 +1,12 @@
 #ifndef ABSTRACT_GRAPHICS_CONTEXT_STATE_H
 #define ABSTRACT_GRAPHICS_CONTEXT_STATE_H
 
-// Placeholder until I implement a Containers::HashTable.
-
-#include <utility>
-#include <unordered_map>
-
-#define HashTable(KeyType, ValueType) std::unordered_map<KeyType, ValueType>
-
-#define Insert(Key, Value) insert({Key, Value})
-
-
 #include <Core/Public/Common/Common.h>
 #include <Core/Public/Types/SmartPointer.h>
+#include <Core/Public/Containers/THashMap.h>
 
 #include <GraphicsDevice/Public/GraphicsTypes.h>
+#include <GraphicsDevice/Public/Base/PipelineState.h>
 #include <GraphicsDevice/Public/Base/AbstractHardwareBuffer.h>
 #include <GraphicsDevice/Public/Base/AbstractGraphicsContext.h>
 
@@ -151,7 +143,19 @@ namespace Forge {
 			AbstractGraphicsContextPtr m_graphics_context;
 
 		protected:
-			HashTable(U32, TWeakPtr<AbstractHardwareBuffer>) m_bound_buffers;
+			Containers::THashMap<U32, TWeakPtr<AbstractHardwareBuffer>> m_bound_buffers;
+
+		protected:
+			/// The bound states are kept by unique ID and a copy of their
+			/// description, so their cache may be destroyed while they are
+			/// bound. An ID of zero means no state is bound.
+			U64 m_bound_rasterizer_state_id;
+			U64 m_bound_blend_state_id;
+			U64 m_bound_depth_stencil_state_id;
+
+			RasterizerStateDesc   m_bound_rasterizer_desc;
+			BlendStateDesc        m_bound_blend_desc;
+			DepthStencilStateDesc m_bound_depth_stencil_desc;
 
 		public:
 			/**
@@ -353,6 +357,38 @@ namespace Forge {
 			 */
 			virtual Void SetColorWriteMask(F32 red, F32 green, F32 blue, F32 alpha) = 0;
 
+		public:
+			/**
+			 * @brief Clears buffers of the current framebuffer to their clear
+			 * values.
+			 *
+			 * @param flags[in] The buffers to clear.
+			 */
+			virtual Void Clear(ClearFlags flags) = 0;
+
+			/**
+			 * @brief Renders primitives from consecutive vertices of the bound
+			 * vertex buffers.
+			 *
+			 * @param topology[in]     The kind of primitives to render.
+			 * @param first_vertex[in] The index of the first vertex to render.
+			 * @param vertex_count[in] The number of vertices to render.
+			 */
+			virtual Void Draw(PrimitiveTopologyMask topology, U32 first_vertex, U32 vertex_count) = 0;
+
+			/**
+			 * @brief Renders primitives from vertices of the bound vertex buffers
+			 * indexed by the bound index buffer.
+			 *
+			 * @param topology[in]    The kind of primitives to render.
+			 * @param index_type[in]  The type of the indices, an unsigned byte,
+			 * short or int.
+			 * @param first_index[in] The position of the first index to render.
+			 * @param index_count[in] The number of indices to render.
+			 * @param base_vertex[in] The constant added to every index.
+			 */
+			virtual Void DrawIndexed(PrimitiveTopologyMask topology, ValueTypeMask index_type, U32 first_index, U32 index_count, I32 base_vertex) = 0;
+
 		public:
 			/**
 			 * @brief Initializes the entire context state with default values and
@@ -366,6 +402,66 @@ namespace Forge {
 			 */
 			virtual Void InvalidateCache(Void) = 0;
 
+		public:
+			/**
+			 * @brief Binds a rasterizer state object.
+			 *
+			 * Binding the bound state costs an integer compare, otherwise only
+			 * the fields differing from the bound state are applied, or every
+			 * field if none is bound. The per-field setters forget the bound
+			 * state of the fields they set, so the next bind applies every
+			 * field of that state.
+			 *
+			 * @param state[in] The state to bind, or nullptr to forget the
+			 * bound state.
+			 */
+			Void BindRasterizerState(ConstRasterizerStateObjectPtr state);
+
+			/**
+			 * @brief Binds a blend state object, see BindRasterizerState.
+			 *
+			 * @param state[in] The state to bind, or nullptr to forget the
+			 * bound state.
+			 */
+			Void BindBlendState(ConstBlendStateObjectPtr state);
+
+			/**
+			 * @brief Binds a depth stencil state object, see
+			 * BindRasterizerState.
+			 *
+			 * @param state[in] The state to bind, or nullptr to forget the
+			 * bound state.
+			 */
+			Void BindDepthStencilState(ConstDepthStencilStateObjectPtr state);
+
+		protected:
+			/**
+			 * @brief Applies the fields of a state object set in the delta.
+			 *
+			 * Unlike the per-field setters, parameters of a disabled feature
+			 * are applied too, so they hold once the feature is enabled.
+			 *
+			 * @param desc[in]  The description of the state being bound.
+			 * @param delta[in] The fields which differ from the bound state.
+			 */
+			virtual Void ApplyRasterizerState(const RasterizerStateDesc& desc, RasterizerStateDelta delta) = 0;
+			virtual Void ApplyBlendState(const BlendStateDesc& desc, BlendStateDelta delta) = 0;
+			virtual Void ApplyDepthStencilState(const DepthStencilStateDesc& desc, DepthStencilStateDelta delta) = 0;
+
+			/**
+			 * @brief Forgets the bound state objects, so the next binds apply
+			 * every field.
+			 */
+			Void ResetBoundStates(Void);
+
+			/**
+			 * @brief Forgets a single bound state object, called by the
+			 * per-field setters of its fields.
+			 */
+			Void ResetBoundRasterizerState(Void);
+			Void ResetBoundBlendState(Void);
+			Void ResetBoundDepthStencilState(Void);
+
 		public:
 			// virtual Void BindTexture(TexturePtr texture) = 0;
 			
@@ -381,7 +477,67 @@ namespace Forge {
 		FORGE_TYPEDEF_DECL(AbstractGraphicsContextState)
 
 		FORGE_FORCE_INLINE AbstractGraphicsContextState::AbstractGraphicsContextState(AbstractGraphicsContextPtr graphics_context)
-			: m_graphics_context(graphics_context) {}
+			: m_graphics_context(graphics_context), m_bound_rasterizer_state_id(0), m_bound_blend_state_id(0), m_bound_depth_stencil_state_id(0) {}
+
+		FORGE_FORCE_INLINE Void AbstractGraphicsContextState::BindRasterizerState(ConstRasterizerStateObjectPtr state)
+		{
+			if (!state)
+			{
+				m_bound_rasterizer_state_id = 0;
+				return;
+			}
+
+			if (state->GetUniqueID() == m_bound_rasterizer_state_id)
+				return;
+
+			ApplyRasterizerState(state->GetDesc(), m_bound_rasterizer_state_id ? ComputeStateDelta(m_bound_rasterizer_desc, state->GetDesc()) : RasterizerStateDelta::FORGE_ALL);
+
+			m_bound_rasterizer_state_id = state->GetUniqueID();
+			m_bound_rasterizer_desc     = state->GetDesc();
+		}
+		FORGE_FORCE_INLINE Void AbstractGraphicsContextState::BindBlendState(ConstBlendStateObjectPtr state)
+		{
+			if (!state)
+			{
+				m_bound_blend_state_id = 0;
+				return;
+			}
+
+			if (state->GetUniqueID() == m_bound_blend_state_id)
+				return;
+
+			ApplyBlendState(state->GetDesc(), m_bound_blend_state_id ? ComputeStateDelta(m_bound_blend_desc, state->GetDesc()) : BlendStateDelta::FORGE_ALL);
+
+			m_bound_blend_state_id = state->GetUniqueID();
+			m_bound_blend_desc     = state->GetDesc();
+		}
+		FORGE_FORCE_INLINE Void AbstractGraphicsContextState::BindDepthStencilState(ConstDepthStencilStateObjectPtr state)
+		{
+			if (!state)
+			{
+				m_bound_depth_stencil_state_id = 0;
+				return;
+			}
+
+			if (state->GetUniqueID() == m_bound_depth_stencil_state_id)
+				return;
+
+			ApplyDepthStencilState(state->GetDesc(), m_bound_depth_stencil_state_id ? ComputeStateDelta(m_bound_depth_stencil_desc, state->GetDesc()) : DepthStencilStateDelta::FORGE_ALL);
+
+			m_bound_depth_stencil_state_id = state->GetUniqueID();
+			m_bound_depth_stencil_desc     = state->GetDesc();
+		}
+
+		FORGE_FORCE_INLINE Void AbstractGraphicsContextState::ResetBoundStates(Void)
+		{
+			m_bound_rasterizer_state_id    = 0;
+			m_bound_blend_state_id         = 0;
+			m_bound_depth_stencil_state_id = 0;
+		}
+
+		FORGE_FORCE_INLINE Void AbstractGraphicsContextState::ResetBoundRasterizerState(Void)   { m_bound_rasterizer_state_id = 0;    }
+		FORGE_FORCE_INLINE Void AbstractGraphicsContextState::ResetBoundBlendState(Void)        { m_bound_blend_state_id = 0;         }
+		FORGE_FORCE_INLINE Void AbstractGraphicsContextState::ResetBoundDepthStencilState(Void) { m_bound_depth_stencil_state_id = 0; }
 	}
 }
 
@@ -22,6 +22,17 @@ namespace Forge {
 		 */
 		class FORGE_API AbstractHardwareBuffer
 		{
+		public:
+			/**
+			 * @brief The native handle of a fence inserted into the GPU command
+			 * stream.
+			 */
+			union FenceHandle
+			{
+				U64 m_id_num;
+				VoidPtr m_id_ptr;
+			};
+
 		protected:
 			union Handle
 			{
@@ -206,6 +217,38 @@ namespace Forge {
 			 * region.
 			 */
 			virtual Void CopyData(AbstractHardwareBuffer& src, Size src_offset, Size dst_offset, Size length) = 0;
+
+		public:
+			/**
+			 * @brief Inserts a fence signaled once the GPU finished every
+			 * command issued before it, so the regions of the buffer those
+			 * commands read can be written again.
+			 *
+			 * @returns FenceHandle storing the native handle of the fence.
+			 */
+			virtual FenceHandle InsertFence(Void) = 0;
+
+			/**
+			 * @brief Waits for a fence to be signaled.
+			 *
+			 * @param fence[in]   The fence to wait for.
+			 * @param timeout[in] The most nanoseconds to wait, zero only polls
+			 * the fence.
+			 *
+			 * @returns True if the fence was signaled, otherwise false if the
+			 * timeout expired.
+			 *
+			 * @throws InvalidOperationException if waiting failed, so waiting
+			 * again never spins on a fence which can not be signaled.
+			 */
+			virtual Bool WaitFence(FenceHandle fence, U64 timeout) = 0;
+
+			/**
+			 * @brief Deletes a fence, whether it was signaled or not.
+			 *
+			 * @param fence[in] The fence to delete.
+			 */
+			virtual Void DeleteFence(FenceHandle fence) = 0;
 		};
 
 		FORGE_TYPEDEF_DECL(AbstractHardwareBuffer)
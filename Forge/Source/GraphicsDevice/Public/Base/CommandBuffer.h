@@ -0,0 +1,632 @@
+#ifndef COMMAND_BUFFER_H
+#define COMMAND_BUFFER_H
+
+#include <atomic>
+
+#include <Core/Public/Debug/Debug.h>
+#include <Core/Public/Common/Common.h>
+#include <Core/Public/Memory/MemoryUtilities.h>
+#include <Core/Public/Memory/ConcurrentPoolAllocator.h>
+
+#include <GraphicsDevice/Public/GraphicsTypes.h>
+#include <GraphicsDevice/Public/Base/AbstractHardwareBuffer.h>
+#include <GraphicsDevice/Public/Base/AbstractGraphicsContextState.h>
+
+namespace Forge {
+	namespace Graphics
+	{
+		/**
+		 * @brief The recommended number of bytes of a command page, which is
+		 * the chunk size of the allocator command buffers take pages from.
+		 */
+		constexpr Size COMMAND_PAGE_SIZE = 16 * 1024;
+
+		namespace Internal
+		{
+			/**
+			 * @brief The alignment of every command in a command page.
+			 */
+			constexpr Size COMMAND_ALIGNMENT = sizeof(VoidPtr);
+
+			/**
+			 * @brief The largest size of a single command in bytes.
+			 */
+			constexpr Size MAX_COMMAND_SIZE = 0xFFFF & ~(COMMAND_ALIGNMENT - 1);
+
+			enum class CommandType : U16
+			{
+				ENABLE_DEPTH_TEST,
+				ENABLE_STENCIL_TEST,
+				ENABLE_SCISSOR_TEST,
+				ENABLE_FACE_CULLING,
+				ENABLE_COLOR_BLENDING,
+				SET_DEPTH_WRITE_MASK,
+				SET_DEPTH_COMPARISON_FUNCTION,
+				SET_STENCIL_WRITE_MASK,
+				SET_STENCIL_COMPARISON_FUNCTION,
+				SET_SCISSOR_BOUNDING_REGION,
+				SET_FACE_CULLING_MODE,
+				SET_COLOR_BLENDING_CONSTANT,
+				SET_COLOR_BLENDING_FUNCTION,
+				SET_LINE_WIDTH,
+				SET_ACTIVE_TEXTURE,
+				SET_FILL_MODE,
+				SET_FRONT_FACE,
+				SET_PIXEL_STORAGE,
+				SET_COLOR_CLEAR,
+				SET_COLOR_WRITE_MASK,
+				BIND_HARDWARE_BUFFER,
+				BIND_RASTERIZER_STATE,
+				BIND_BLEND_STATE,
+				BIND_DEPTH_STENCIL_STATE,
+				WRITE_HARDWARE_BUFFER,
+				CLEAR,
+				DRAW,
+				DRAW_INDEXED,
+				MAX
+			};
+
+			/**
+			 * @brief Header of every command, the size includes the header and
+			 * the padding up to the next command.
+			 */
+			struct CommandHeader
+			{
+				CommandType m_type;
+				U16 m_size;
+			};
+
+			/**
+			 * @brief Header of a command page, the commands follow the header in
+			 * the same chunk.
+			 */
+			struct CommandPage
+			{
+				CommandPage* m_next;
+				Size m_used;
+			};
+
+			struct BoolCommand                      { CommandHeader m_header; Bool m_value; };
+			struct ByteCommand                      { CommandHeader m_header; Byte m_value; };
+			struct U32Command                       { CommandHeader m_header; U32 m_value; };
+			struct F32Command                       { CommandHeader m_header; F32 m_value; };
+			struct ColorCommand                     { CommandHeader m_header; F32 m_color[4]; };
+			struct ComparisonFunctionCommand        { CommandHeader m_header; ComparisonFuncMask m_function; };
+			struct StencilComparisonFunctionCommand { CommandHeader m_header; ComparisonFuncMask m_function; I32 m_reference; U32 m_mask; };
+			struct ScissorBoundingRegionCommand     { CommandHeader m_header; I32 m_region[4]; };
+			struct FaceCullingModeCommand           { CommandHeader m_header; FaceCullMask m_mode; };
+			struct BlendFunctionCommand             { CommandHeader m_header; BlendFuncMask m_src_function; BlendFuncMask m_dst_function; };
+			struct FillModeCommand                  { CommandHeader m_header; PolygonFillMask m_mode; };
+			struct FrontFaceCommand                 { CommandHeader m_header; FrontFaceMask m_front_face; };
+			struct PixelStorageCommand              { CommandHeader m_header; PixelStorageMask m_mode; I32 m_value; };
+			struct ClearCommand                     { CommandHeader m_header; ClearFlags m_flags; };
+			struct DrawCommand                      { CommandHeader m_header; PrimitiveTopologyMask m_topology; U32 m_first_vertex; U32 m_vertex_count; };
+			struct DrawIndexedCommand               { CommandHeader m_header; PrimitiveTopologyMask m_topology; ValueTypeMask m_index_type; U32 m_first_index; U32 m_index_count; I32 m_base_vertex; };
+			struct BindHardwareBufferCommand        { CommandHeader m_header; AbstractHardwareBufferPtr m_hardware_buffer; };
+			struct BindRasterizerStateCommand       { CommandHeader m_header; ConstRasterizerStateObjectPtr m_state; };
+			struct BindBlendStateCommand            { CommandHeader m_header; ConstBlendStateObjectPtr m_state; };
+			struct BindDepthStencilStateCommand     { CommandHeader m_header; ConstDepthStencilStateObjectPtr m_state; };
+
+			/**
+			 * @brief Writes data to a hardware buffer, the data follows the
+			 * command in the same page.
+			 */
+			struct WriteHardwareBufferCommand       { CommandHeader m_header; U32 m_length; AbstractHardwareBufferPtr m_hardware_buffer; Size m_offset; };
+		}
+
+		class CommandQueue;
+
+		/**
+		 * @brief Records graphics commands to be executed later by a context
+		 * state on the thread owning the graphics context.
+		 *
+		 * Commands are packed back to back with their arguments into pages
+		 * taken from a concurrent pool allocator, so recording never takes a
+		 * lock or allocates from the heap, and any number of threads can
+		 * record into their own command buffers in parallel while sharing the
+		 * same pool. Data written to hardware buffers is copied into the pages
+		 * as well, so the source memory can be reused right after recording.
+		 *
+		 * Once the pool runs out of pages the command buffer is overflowed,
+		 * the commands recorded from then on are dropped and the command
+		 * buffer can not be submitted until it is reset. Reset() returns the
+		 * pages of a command buffer to the pool.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API CommandBuffer
+		{
+		FORGE_CLASS_NONCOPYABLE(CommandBuffer)
+
+		private:
+			friend class CommandQueue;
+
+		private:
+			Memory::ConcurrentPoolAllocator* m_page_allocator;
+			Size m_page_size;
+
+		private:
+			Internal::CommandPage* m_first_page;
+			Internal::CommandPage* m_last_page;
+
+		private:
+			Size m_num_of_commands;
+			Bool m_is_overflowed;
+
+		private:
+			std::atomic<Bool> m_is_pending;
+
+		public:
+			/**
+			 * @brief Constructs an empty command buffer.
+			 *
+			 * @param[in] page_allocator The allocator to take command pages from,
+			 * its chunk size is the size of a page and must be at least a few
+			 * hundred bytes and a multiple of the command alignment.
+			 */
+			CommandBuffer(Memory::ConcurrentPoolAllocator& page_allocator);
+
+		public:
+			/**
+			 * @brief Returns the pages of the command buffer to the allocator.
+			 */
+			~CommandBuffer(Void);
+
+		private:
+			/**
+			 * @brief Takes a new page from the allocator and allocates a command
+			 * in it, or overflows the command buffer.
+			 */
+			BytePtr AllocatePage(Size size);
+
+			/**
+			 * @brief Allocates a command in the last page.
+			 */
+			BytePtr Allocate(Size size);
+
+			/**
+			 * @brief Allocates and initializes the header of a command followed
+			 * by a number of bytes.
+			 */
+			template<typename InCommand>
+			InCommand* Record(Internal::CommandType type, Size extra_size = 0)
+			{
+				Size size = (sizeof(InCommand) + extra_size + Internal::COMMAND_ALIGNMENT - 1) & ~(Internal::COMMAND_ALIGNMENT - 1);
+
+				InCommand* command = reinterpret_cast<InCommand*>(Allocate(size));
+
+				if (command)
+				{
+					command->m_header.m_type = type;
+					command->m_header.m_size = static_cast<U16>(size);
+				}
+
+				return command;
+			}
+
+		public:
+			/**
+			 * @brief Gets the number of recorded commands.
+			 *
+			 * @return Size storing the number of recorded commands.
+			 */
+			Size GetNumOfCommands(Void) const;
+
+			/**
+			 * @brief Gets the number of bytes used by the recorded commands,
+			 * including the page headers.
+			 *
+			 * @return Size storing the number of used bytes.
+			 */
+			Size GetUsedMemory(Void) const;
+
+			/**
+			 * @brief Checks whether the command buffer ran out of pages.
+			 *
+			 * @return True if commands were dropped, otherwise false.
+			 */
+			Bool IsOverflowed(Void) const;
+
+			/**
+			 * @brief Checks whether the command buffer was submitted to a queue
+			 * and is not executed yet.
+			 *
+			 * A pending command buffer must not be recorded into or reset.
+			 *
+			 * @return True if the command buffer is pending, otherwise false.
+			 */
+			Bool IsPending(Void) const;
+
+		public:
+			/**
+			 * @brief Records enabling or disabling depth test.
+			 */
+			Void EnableDepthTest(Bool enable);
+
+			/**
+			 * @brief Records enabling or disabling stencil test.
+			 */
+			Void EnableStencilTest(Bool enable);
+
+			/**
+			 * @brief Records enabling or disabling scissor test.
+			 */
+			Void EnableScissorTest(Bool enable);
+
+			/**
+			 * @brief Records enabling or disabling face culling.
+			 */
+			Void EnableFaceCulling(Bool enable);
+
+			/**
+			 * @brief Records enabling or disabling color blending.
+			 */
+			Void EnableColorBlending(Bool enable);
+
+		public:
+			/**
+			 * @brief Records setting the depth write mask.
+			 */
+			Void SetDepthWriteMask(Bool mask);
+
+			/**
+			 * @brief Records setting the depth comparison function.
+			 */
+			Void SetDepthComparisonFunction(ComparisonFuncMask function);
+
+			/**
+			 * @brief Records setting the stencil write mask.
+			 */
+			Void SetStencilWriteMask(Byte mask);
+
+			/**
+			 * @brief Records setting the stencil comparison function and
+			 * reference value.
+			 */
+			Void SetStencilComparisonFunction(ComparisonFuncMask function, I32 reference, U32 mask);
+
+			/**
+			 * @brief Records setting the scissor bounding region.
+			 */
+			Void SetScissorBoundingRegion(I32 x, I32 y, I32 width, I32 height);
+
+			/**
+			 * @brief Records setting the face culling mode.
+			 */
+			Void SetFaceCullingMode(FaceCullMask mode);
+
+			/**
+			 * @brief Records setting the constant blend color.
+			 */
+			Void SetColorBlendingConstant(F32 red, F32 green, F32 blue, F32 alpha);
+
+			/**
+			 * @brief Records setting the blend function.
+			 */
+			Void SetColorBlendingFunction(BlendFuncMask src_function, BlendFuncMask dst_function);
+
+			/**
+			 * @brief Records setting the width of rasterized lines.
+			 */
+			Void SetLineWidth(F32 width);
+
+			/**
+			 * @brief Records setting the active texture unit.
+			 */
+			Void SetActiveTexture(U32 index);
+
+			/**
+			 * @brief Records setting the fill rasterization mode.
+			 */
+			Void SetFillMode(PolygonFillMask mode);
+
+			/**
+			 * @brief Records setting the orientation of front facing polygons.
+			 */
+			Void SetFrontFace(FrontFaceMask front_face);
+
+			/**
+			 * @brief Records setting a pixel storage mode.
+			 */
+			Void SetPixelStorage(PixelStorageMask mode, I32 value);
+
+			/**
+			 * @brief Records setting the clear color.
+			 */
+			Void SetColorClear(F32 red, F32 green, F32 blue, F32 alpha);
+
+			/**
+			 * @brief Records setting the color write mask.
+			 */
+			Void SetColorWriteMask(F32 red, F32 green, F32 blue, F32 alpha);
+
+		public:
+			/**
+			 * @brief Records binding a hardware buffer.
+			 *
+			 * @param[in] hardware_buffer The hardware buffer to bind, it must
+			 * stay alive until the command buffer is executed.
+			 */
+			Void BindHardwareBuffer(AbstractHardwareBufferPtr hardware_buffer);
+
+			/**
+			 * @brief Records binding a rasterizer state object.
+			 *
+			 * @param[in] state The state to bind, or nullptr to forget the bound
+			 * state, it must stay alive until the command buffer is executed.
+			 */
+			Void BindRasterizerState(ConstRasterizerStateObjectPtr state);
+
+			/**
+			 * @brief Records binding a blend state object.
+			 *
+			 * @param[in] state The state to bind, or nullptr to forget the bound
+			 * state, it must stay alive until the command buffer is executed.
+			 */
+			Void BindBlendState(ConstBlendStateObjectPtr state);
+
+			/**
+			 * @brief Records binding a depth stencil state object.
+			 *
+			 * @param[in] state The state to bind, or nullptr to forget the bound
+			 * state, it must stay alive until the command buffer is executed.
+			 */
+			Void BindDepthStencilState(ConstDepthStencilStateObjectPtr state);
+
+			/**
+			 * @brief Records writing data to a hardware buffer, the data is
+			 * copied into the command buffer.
+			 *
+			 * Data larger than a page is split into several commands.
+			 *
+			 * @param[in] hardware_buffer The hardware buffer to write to, it must
+			 * stay alive until the command buffer is executed.
+			 * @param[in] src             The data to write.
+			 * @param[in] offset          The byte offset from the start of the
+			 * hardware buffer.
+			 * @param[in] length          The size of the data in bytes.
+			 */
+			Void WriteHardwareBuffer(AbstractHardwareBufferPtr hardware_buffer, ConstVoidPtr src, Size offset, Size length);
+
+		public:
+			/**
+			 * @brief Records clearing buffers of the current framebuffer.
+			 */
+			Void Clear(ClearFlags flags);
+
+			/**
+			 * @brief Records rendering primitives from consecutive vertices.
+			 */
+			Void Draw(PrimitiveTopologyMask topology, U32 first_vertex, U32 vertex_count);
+
+			/**
+			 * @brief Records rendering primitives from indexed vertices.
+			 */
+			Void DrawIndexed(PrimitiveTopologyMask topology, ValueTypeMask index_type, U32 first_index, U32 index_count, I32 base_vertex);
+
+		public:
+			/**
+			 * @brief Replays the recorded commands, in recording order, on a
+			 * context state.
+			 *
+			 * Must be called by the thread owning the graphics context of the
+			 * context state. The commands stay recorded, so a command buffer can
+			 * be executed many times.
+			 *
+			 * @param[in] context_state The context state to replay the commands
+			 * on.
+			 */
+			Void Execute(AbstractGraphicsContextState& context_state) const;
+
+			/**
+			 * @brief Drops the recorded commands and returns the pages to the
+			 * allocator.
+			 */
+			Void Reset(Void);
+		};
+
+		FORGE_TYPEDEF_DECL(CommandBuffer)
+
+		FORGE_FORCE_INLINE BytePtr CommandBuffer::Allocate(Size size)
+		{
+			Internal::CommandPage* page = m_last_page;
+
+			if (page && page->m_used + size <= m_page_size)
+			{
+				BytePtr address = reinterpret_cast<BytePtr>(page) + page->m_used;
+
+				page->m_used += size;
+				m_num_of_commands++;
+
+				return address;
+			}
+
+			return AllocatePage(size);
+		}
+
+		FORGE_FORCE_INLINE Size CommandBuffer::GetNumOfCommands(Void) const { return m_num_of_commands;                          }
+		FORGE_FORCE_INLINE Bool CommandBuffer::IsOverflowed(Void) const     { return m_is_overflowed;                            }
+		FORGE_FORCE_INLINE Bool CommandBuffer::IsPending(Void) const        { return m_is_pending.load(std::memory_order_acquire); }
+
+		FORGE_FORCE_INLINE Void CommandBuffer::EnableDepthTest(Bool enable)
+		{
+			if (Internal::BoolCommand* command = Record<Internal::BoolCommand>(Internal::CommandType::ENABLE_DEPTH_TEST))
+				command->m_value = enable;
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::EnableStencilTest(Bool enable)
+		{
+			if (Internal::BoolCommand* command = Record<Internal::BoolCommand>(Internal::CommandType::ENABLE_STENCIL_TEST))
+				command->m_value = enable;
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::EnableScissorTest(Bool enable)
+		{
+			if (Internal::BoolCommand* command = Record<Internal::BoolCommand>(Internal::CommandType::ENABLE_SCISSOR_TEST))
+				command->m_value = enable;
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::EnableFaceCulling(Bool enable)
+		{
+			if (Internal::BoolCommand* command = Record<Internal::BoolCommand>(Internal::CommandType::ENABLE_FACE_CULLING))
+				command->m_value = enable;
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::EnableColorBlending(Bool enable)
+		{
+			if (Internal::BoolCommand* command = Record<Internal::BoolCommand>(Internal::CommandType::ENABLE_COLOR_BLENDING))
+				command->m_value = enable;
+		}
+
+		FORGE_FORCE_INLINE Void CommandBuffer::SetDepthWriteMask(Bool mask)
+		{
+			if (Internal::BoolCommand* command = Record<Internal::BoolCommand>(Internal::CommandType::SET_DEPTH_WRITE_MASK))
+				command->m_value = mask;
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::SetDepthComparisonFunction(ComparisonFuncMask function)
+		{
+			if (Internal::ComparisonFunctionCommand* command = Record<Internal::ComparisonFunctionCommand>(Internal::CommandType::SET_DEPTH_COMPARISON_FUNCTION))
+				command->m_function = function;
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::SetStencilWriteMask(Byte mask)
+		{
+			if (Internal::ByteCommand* command = Record<Internal::ByteCommand>(Internal::CommandType::SET_STENCIL_WRITE_MASK))
+				command->m_value = mask;
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::SetStencilComparisonFunction(ComparisonFuncMask function, I32 reference, U32 mask)
+		{
+			if (Internal::StencilComparisonFunctionCommand* command = Record<Internal::StencilComparisonFunctionCommand>(Internal::CommandType::SET_STENCIL_COMPARISON_FUNCTION))
+			{
+				command->m_function = function;
+				command->m_reference = reference;
+				command->m_mask = mask;
+			}
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::SetScissorBoundingRegion(I32 x, I32 y, I32 width, I32 height)
+		{
+			if (Internal::ScissorBoundingRegionCommand* command = Record<Internal::ScissorBoundingRegionCommand>(Internal::CommandType::SET_SCISSOR_BOUNDING_REGION))
+			{
+				command->m_region[0] = x;
+				command->m_region[1] = y;
+				command->m_region[2] = width;
+				command->m_region[3] = height;
+			}
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::SetFaceCullingMode(FaceCullMask mode)
+		{
+			if (Internal::FaceCullingModeCommand* command = Record<Internal::FaceCullingModeCommand>(Internal::CommandType::SET_FACE_CULLING_MODE))
+				command->m_mode = mode;
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::SetColorBlendingConstant(F32 red, F32 green, F32 blue, F32 alpha)
+		{
+			if (Internal::ColorCommand* command = Record<Internal::ColorCommand>(Internal::CommandType::SET_COLOR_BLENDING_CONSTANT))
+			{
+				command->m_color[0] = red;
+				command->m_color[1] = green;
+				command->m_color[2] = blue;
+				command->m_color[3] = alpha;
+			}
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::SetColorBlendingFunction(BlendFuncMask src_function, BlendFuncMask dst_function)
+		{
+			if (Internal::BlendFunctionCommand* command = Record<Internal::BlendFunctionCommand>(Internal::CommandType::SET_COLOR_BLENDING_FUNCTION))
+			{
+				command->m_src_function = src_function;
+				command->m_dst_function = dst_function;
+			}
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::SetLineWidth(F32 width)
+		{
+			if (Internal::F32Command* command = Record<Internal::F32Command>(Internal::CommandType::SET_LINE_WIDTH))
+				command->m_value = width;
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::SetActiveTexture(U32 index)
+		{
+			if (Internal::U32Command* command = Record<Internal::U32Command>(Internal::CommandType::SET_ACTIVE_TEXTURE))
+				command->m_value = index;
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::SetFillMode(PolygonFillMask mode)
+		{
+			if (Internal::FillModeCommand* command = Record<Internal::FillModeCommand>(Internal::CommandType::SET_FILL_MODE))
+				command->m_mode = mode;
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::SetFrontFace(FrontFaceMask front_face)
+		{
+			if (Internal::FrontFaceCommand* command = Record<Internal::FrontFaceCommand>(Internal::CommandType::SET_FRONT_FACE))
+				command->m_front_face = front_face;
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::SetPixelStorage(PixelStorageMask mode, I32 value)
+		{
+			if (Internal::PixelStorageCommand* command = Record<Internal::PixelStorageCommand>(Internal::CommandType::SET_PIXEL_STORAGE))
+			{
+				command->m_mode = mode;
+				command->m_value = value;
+			}
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::SetColorClear(F32 red, F32 green, F32 blue, F32 alpha)
+		{
+			if (Internal::ColorCommand* command = Record<Internal::ColorCommand>(Internal::CommandType::SET_COLOR_CLEAR))
+			{
+				command->m_color[0] = red;
+				command->m_color[1] = green;
+				command->m_color[2] = blue;
+				command->m_color[3] = alpha;
+			}
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::SetColorWriteMask(F32 red, F32 green, F32 blue, F32 alpha)
+		{
+			if (Internal::ColorCommand* command = Record<Internal::ColorCommand>(Internal::CommandType::SET_COLOR_WRITE_MASK))
+			{
+				command->m_color[0] = red;
+				command->m_color[1] = green;
+				command->m_color[2] = blue;
+				command->m_color[3] = alpha;
+			}
+		}
+
+		FORGE_FORCE_INLINE Void CommandBuffer::BindHardwareBuffer(AbstractHardwareBufferPtr hardware_buffer)
+		{
+			if (Internal::BindHardwareBufferCommand* command = Record<Internal::BindHardwareBufferCommand>(Internal::CommandType::BIND_HARDWARE_BUFFER))
+				command->m_hardware_buffer = hardware_buffer;
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::BindRasterizerState(ConstRasterizerStateObjectPtr state)
+		{
+			if (Internal::BindRasterizerStateCommand* command = Record<Internal::BindRasterizerStateCommand>(Internal::CommandType::BIND_RASTERIZER_STATE))
+				command->m_state = state;
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::BindBlendState(ConstBlendStateObjectPtr state)
+		{
+			if (Internal::BindBlendStateCommand* command = Record<Internal::BindBlendStateCommand>(Internal::CommandType::BIND_BLEND_STATE))
+				command->m_state = state;
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::BindDepthStencilState(ConstDepthStencilStateObjectPtr state)
+		{
+			if (Internal::BindDepthStencilStateCommand* command = Record<Internal::BindDepthStencilStateCommand>(Internal::CommandType::BIND_DEPTH_STENCIL_STATE))
+				command->m_state = state;
+		}
+
+		FORGE_FORCE_INLINE Void CommandBuffer::Clear(ClearFlags flags)
+		{
+			if (Internal::ClearCommand* command = Record<Internal::ClearCommand>(Internal::CommandType::CLEAR))
+				command->m_flags = flags;
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::Draw(PrimitiveTopologyMask topology, U32 first_vertex, U32 vertex_count)
+		{
+			if (Internal::DrawCommand* command = Record<Internal::DrawCommand>(Internal::CommandType::DRAW))
+			{
+				command->m_topology = topology;
+				command->m_first_vertex = first_vertex;
+				command->m_vertex_count = vertex_count;
+			}
+		}
+		FORGE_FORCE_INLINE Void CommandBuffer::DrawIndexed(PrimitiveTopologyMask topology, ValueTypeMask index_type, U32 first_index, U32 index_count, I32 base_vertex)
+		{
+			if (Internal::DrawIndexedCommand* command = Record<Internal::DrawIndexedCommand>(Internal::CommandType::DRAW_INDEXED))
+			{
+				command->m_topology = topology;
+				command->m_index_type = index_type;
+				command->m_first_index = first_index;
+				command->m_index_count = index_count;
+				command->m_base_vertex = base_vertex;
+			}
+		}
+	}
+}
+
+#endif // COMMAND_BUFFER_H
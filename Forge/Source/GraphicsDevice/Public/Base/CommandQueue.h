@@ -0,0 +1,100 @@
+#ifndef COMMAND_QUEUE_H
+#define COMMAND_QUEUE_H
+
+#include <mutex>
+
+#include <Core/Public/Debug/Debug.h>
+#include <Core/Public/Common/Common.h>
+#include <Core/Public/Containers/TDynamicArray.h>
+
+#include <GraphicsDevice/Public/Base/CommandBuffer.h>
+#include <GraphicsDevice/Public/Base/AbstractGraphicsContextState.h>
+
+namespace Forge {
+	namespace Graphics
+	{
+		/**
+		 * @brief Collects command buffers submitted from any thread and
+		 * executes them on the thread owning the graphics context.
+		 *
+		 * Every submission carries an order, command buffers are executed by
+		 * increasing order and in submission order for equal orders. Threads
+		 * recording the parts of a frame in parallel pass the index of their
+		 * part, so the frame is executed in the same order whichever thread
+		 * finishes first.
+		 *
+		 * A submitted command buffer stays pending until it was executed, it
+		 * may then be reset and recorded again, or submitted again as is.
+		 *
+		 * @author Karim Hisham
+		 */
+		class FORGE_API CommandQueue
+		{
+		FORGE_CLASS_NONCOPYABLE(CommandQueue)
+
+		private:
+			struct Submission
+			{
+				CommandBufferPtr m_command_buffer;
+				U32 m_order;
+			};
+
+		private:
+			std::mutex m_mutex;
+
+		private:
+			Containers::TDynamicArray<Submission> m_submissions;
+			Containers::TDynamicArray<Submission> m_executing;
+
+		public:
+			/**
+			 * @brief Default constructor.
+			 */
+			CommandQueue(Void) = default;
+
+		public:
+			/**
+			 * @brief Default destructor.
+			 */
+			~CommandQueue(Void) = default;
+
+		public:
+			/**
+			 * @brief Gets the number of command buffers waiting to be executed.
+			 *
+			 * @return Size storing the number of submitted command buffers.
+			 */
+			Size GetNumOfSubmissions(Void);
+
+		public:
+			/**
+			 * @brief Submits a command buffer to be executed, may be called by
+			 * any thread.
+			 *
+			 * @param[in] command_buffer The command buffer to submit, it must not
+			 * be pending or overflowed.
+			 * @param[in] order          The position of the command buffer among
+			 * the command buffers executed together.
+			 */
+			Void Submit(CommandBufferRef command_buffer, U32 order = 0);
+
+			/**
+			 * @brief Executes the submitted command buffers on a context state,
+			 * must be called by the thread owning its graphics context.
+			 *
+			 * Command buffers submitted while executing are executed by the
+			 * next call.
+			 *
+			 * @param[in] context_state The context state to execute the command
+			 * buffers on.
+			 *
+			 * @return Size storing the number of executed command buffers.
+			 */
+			Size Execute(AbstractGraphicsContextState& context_state);
+		};
+
+		FORGE_TYPEDEF_DECL(CommandQueue)
+	}
+}
+
+#endif // COMMAND_QUEUE_H
@@ -0,0 +1,259 @@
+#ifndef DRAW_QUEUE_H
+#define DRAW_QUEUE_H
+
+#include <Core/Public/Debug/Debug.h>
+#include <Core/Public/Common/Common.h>
+#include <Core/Public/Types/TDelegate.h>
+#include <Core/Public/Memory/MemoryUtilities.h>
+#include <Core/Public/Containers/TDynamicArray.h>
+#include <Core/Public/Debug/Exception/ExceptionFactory.h>
+
+#include <GraphicsDevice/Public/GraphicsTypes.h>
+#include <GraphicsDevice/Public/Base/PipelineState.h>
+#include <GraphicsDevice/Public/Base/AbstractHardwareBuffer.h>
+#include <GraphicsDevice/Public/Base/AbstractGraphicsContextState.h>
+
+namespace Forge {
+	namespace Graphics
+	{
+		/**
+		 * @brief The number of bits of each field of a draw sort key, from the
+		 * least significant field to the most significant one.
+		 *
+		 * Pipeline states are the most expensive to change so they take the
+		 * most significant bits, then materials, then hardware buffers. The
+		 * depth sorts draws sharing all of them front to back.
+		 */
+		constexpr U32 DRAW_KEY_DEPTH_BITS           = 24;
+		constexpr U32 DRAW_KEY_HARDWARE_BUFFER_BITS = 12;
+		constexpr U32 DRAW_KEY_MATERIAL_BITS        = 16;
+		constexpr U32 DRAW_KEY_PIPELINE_STATE_BITS  = 12;
+
+		static_assert(DRAW_KEY_DEPTH_BITS + DRAW_KEY_HARDWARE_BUFFER_BITS + DRAW_KEY_MATERIAL_BITS + DRAW_KEY_PIPELINE_STATE_BITS == 64, "The draw sort key fields must fill 64 bits.");
+
+		/**
+		 * @brief The most pipeline states and materials a draw queue holds.
+		 */
+		constexpr U32 MAX_DRAW_PIPELINE_STATES = 1u << DRAW_KEY_PIPELINE_STATE_BITS;
+		constexpr U32 MAX_DRAW_MATERIALS       = 1u << DRAW_KEY_MATERIAL_BITS;
+
+		/**
+		 * @brief The fixed function state a draw is rendered with, as the
+		 * state objects of a pipeline state cache, which must outlive the
+		 * draw queue.
+		 */
+		struct DrawPipelineState
+		{
+			ConstRasterizerStateObjectPtr   rasterizer_state    = nullptr;
+			ConstBlendStateObjectPtr        blend_state         = nullptr;
+			ConstDepthStencilStateObjectPtr depth_stencil_state = nullptr;
+		};
+
+		/**
+		 * @brief Binds the resources of a material, the programs, textures and
+		 * constants its draws are rendered with.
+		 */
+		using DrawMaterialBinder = Common::TDelegate<Void(AbstractGraphicsContextState&)>;
+
+		/**
+		 * @brief The transitions replayed by the last executed frame of a draw
+		 * queue.
+		 */
+		struct DrawQueueStatistics
+		{
+			U64 m_num_of_draws             = 0;
+			U64 m_num_of_pipeline_changes  = 0;
+			U64 m_num_of_material_changes  = 0;
+			U64 m_num_of_buffer_changes    = 0;
+
+			/**
+			 * @brief The number of state objects bound to change pipeline
+			 * states.
+			 */
+			U64 m_num_of_state_binds       = 0;
+		};
+
+		/**
+		 * @brief Collects the draws of a frame and replays them ordered to
+		 * minimize state transitions.
+		 *
+		 * Every draw is tagged with a 64-bit sort key packing its pipeline
+		 * state, material, hardware buffer and quantized depth. Executing the
+		 * queue radix sorts the keys, so draws sharing a pipeline state and
+		 * material are replayed next to each other, then changes only what
+		 * differs from the previous draw. Pipeline state transitions bind only
+		 * the state objects which differ, found by comparing pointers.
+		 *
+		 * The key only orders the draws, the replayed transitions compare the
+		 * draws themselves, so hardware buffers sharing key bits are still
+		 * bound correctly.
+		 *
+		 * @author Karim Hisham.
+		 */
+		class FORGE_API DrawQueue
+		{
+		FORGE_CLASS_NONCOPYABLE(DrawQueue)
+
+		private:
+			struct DrawItem
+			{
+				AbstractHardwareBufferPtr m_hardware_buffer;
+
+				U32 m_pipeline_state;
+				U32 m_material;
+
+				PrimitiveTopologyMask m_topology;
+
+				/**
+				 * @brief The index type of an indexed draw, otherwise MAX.
+				 */
+				ValueTypeMask m_index_type;
+
+				U32 m_first;
+				U32 m_count;
+				I32 m_base_vertex;
+			};
+
+			struct SortEntry
+			{
+				U64 m_key;
+				U32 m_index;
+			};
+
+		private:
+			Containers::TDynamicArray<DrawPipelineState>  m_pipeline_states;
+			Containers::TDynamicArray<DrawMaterialBinder> m_materials;
+
+		private:
+			Containers::TDynamicArray<DrawItem>  m_items;
+			Containers::TDynamicArray<SortEntry> m_entries;
+			Containers::TDynamicArray<SortEntry> m_scratch_entries;
+
+		private:
+			DrawQueueStatistics m_statistics;
+
+		public:
+			/**
+			 * @brief Default Constructor.
+			 */
+			DrawQueue(Void) = default;
+
+		private:
+			/**
+			 * @brief Appends a draw and its sort key.
+			 */
+			Void AddItem(const DrawItem& item, F32 depth);
+
+			/**
+			 * @brief Stable sorts the entries by their key, least significant
+			 * byte first, skipping the bytes all keys share.
+			 *
+			 * @returns SortEntry pointer to the sorted entries, which are either
+			 * the entries or the scratch entries.
+			 */
+			const SortEntry* SortEntries(Void);
+
+			/**
+			 * @brief Binds the state objects of a pipeline state which differ
+			 * from the previous one, or every state object if there is none.
+			 */
+			Void ApplyPipelineState(AbstractGraphicsContextState& context_state, const DrawPipelineState* previous, const DrawPipelineState& next);
+
+		public:
+			/**
+			 * @brief Packs the sort key of a draw.
+			 *
+			 * @param pipeline_state[in]  The pipeline state index.
+			 * @param material[in]        The material index.
+			 * @param hardware_buffer[in] The hardware buffer of the draw.
+			 * @param depth[in]           The normalized view depth in [0, 1],
+			 * clamped.
+			 *
+			 * @returns U64 storing the sort key.
+			 */
+			static U64 MakeSortKey(U32 pipeline_state, U32 material, AbstractHardwareBufferPtr hardware_buffer, F32 depth);
+
+		public:
+			/**
+			 * @brief Gets the number of draws submitted since the last execute.
+			 *
+			 * @returns Size storing the number of draws.
+			 */
+			Size GetNumOfDraws(Void) const;
+
+			/**
+			 * @brief Gets the transitions replayed by the last executed frame.
+			 *
+			 * @returns DrawQueueStatistics storing the counters.
+			 */
+			const DrawQueueStatistics& GetStatistics(Void) const;
+
+		public:
+			/**
+			 * @brief Adds a pipeline state draws can be submitted with.
+			 *
+			 * @param pipeline_state[in] The pipeline state to add.
+			 *
+			 * @returns U32 storing the index of the pipeline state.
+			 *
+			 * @throws InvalidOperationException if a state object is nullptr,
+			 * or if MAX_DRAW_PIPELINE_STATES pipeline states were already
+			 * added.
+			 */
+			U32 AddPipelineState(const DrawPipelineState& pipeline_state);
+
+			/**
+			 * @brief Adds a material draws can be submitted with.
+			 *
+			 * @param binder[in] The binder invoked whenever a draw changes to
+			 * the material.
+			 *
+			 * @returns U32 storing the index of the material.
+			 *
+			 * @throws InvalidOperationException if MAX_DRAW_MATERIALS materials
+			 * were already added.
+			 */
+			U32 AddMaterial(DrawMaterialBinder binder);
+
+		public:
+			/**
+			 * @brief Submits a draw of consecutive vertices.
+			 *
+			 * @throws InvalidOperationException if the pipeline state or the
+			 * material was not added.
+			 */
+			Void Submit(U32 pipeline_state, U32 material, AbstractHardwareBufferPtr hardware_buffer, F32 depth, PrimitiveTopologyMask topology, U32 first_vertex, U32 vertex_count);
+
+			/**
+			 * @brief Submits a draw of indexed vertices.
+			 *
+			 * @throws InvalidOperationException if the pipeline state or the
+			 * material was not added.
+			 */
+			Void SubmitIndexed(U32 pipeline_state, U32 material, AbstractHardwareBufferPtr hardware_buffer, F32 depth, PrimitiveTopologyMask topology, ValueTypeMask index_type, U32 first_index, U32 index_count, I32 base_vertex);
+
+		public:
+			/**
+			 * @brief Replays the submitted draws and empties the queue.
+			 *
+			 * The first draw sets its whole pipeline state and binds its
+			 * material and hardware buffer, later draws only change what differs
+			 * from the previous draw.
+			 *
+			 * @param context_state[in] The context state to replay the draws on.
+			 * @param sort_by_key[in]   Whether to sort the draws by key, or
+			 * replay them in submission order to measure the sort against.
+			 *
+			 * @returns DrawQueueStatistics storing the replayed transitions.
+			 */
+			const DrawQueueStatistics& Execute(AbstractGraphicsContextState& context_state, Bool sort_by_key = FORGE_TRUE);
+		};
+
+		FORGE_TYPEDEF_DECL(DrawQueue)
+
+		FORGE_FORCE_INLINE Size DrawQueue::GetNumOfDraws(Void) const                       { return m_items.GetCount(); }
+		FORGE_FORCE_INLINE const DrawQueueStatistics& DrawQueue::GetStatistics(Void) const { return m_statistics;       }
+	}
+}
+
+#endif // DRAW_QUEUE_H
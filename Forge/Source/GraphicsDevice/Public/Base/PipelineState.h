@@ -0,0 +1,355 @@
+#ifndef PIPELINE_STATE_H
+#define PIPELINE_STATE_H
+
+#include <atomic>
+
+#include <Core/Public/Common/Common.h>
+#include <Core/Public/Memory/MemoryUtilities.h>
+#include <Core/Public/Containers/THashMap.h>
+#include <Core/Public/Containers/TDynamicArray.h>
+
+#include <GraphicsDevice/Public/GraphicsTypes.h>
+
+namespace Forge {
+	namespace Graphics
+	{
+		/**
+		 * @brief Describes how primitives are rasterized.
+		 */
+		struct RasterizerStateDesc
+		{
+			F32 line_width = 1.0f;
+
+			FrontFaceMask front_face_mode = FrontFaceMask::FORGE_CW;
+			PolygonFillMask polygon_fill_mode = PolygonFillMask::FORGE_SOLID;
+
+			Bool is_face_culling_enabled = true;
+			FaceCullMask face_culling_mode = FaceCullMask::FORGE_BACK;
+
+			Bool is_scissor_test_enabled = false;
+
+		public:
+			Bool operator ==(const RasterizerStateDesc& other) const;
+
+			/**
+			 * @brief Hashes every field of the description.
+			 */
+			U64 GetHash(Void) const;
+		};
+
+		/**
+		 * @brief Describes how fragment colors are blended with the color
+		 * buffer.
+		 */
+		struct BlendStateDesc
+		{
+			Bool is_enabled = false;
+
+			BlendFuncMask src_function = BlendFuncMask::FORGE_SRC_ALPHA;
+			BlendFuncMask dst_function = BlendFuncMask::FORGE_ONE_MINUS_SRC_ALPHA;
+
+			Bool color_write_mask[4] = { true, true, true, true };
+
+		public:
+			Bool operator ==(const BlendStateDesc& other) const;
+
+			/**
+			 * @brief Hashes every field of the description.
+			 */
+			U64 GetHash(Void) const;
+		};
+
+		/**
+		 * @brief Describes the depth and stencil tests.
+		 */
+		struct DepthStencilStateDesc
+		{
+			Bool is_depth_test_enabled = true;
+			Bool depth_write_mask = true;
+			ComparisonFuncMask depth_comparison_function = ComparisonFuncMask::FORGE_LESS;
+
+			Bool is_stencil_test_enabled = false;
+			Byte stencil_write_mask = 0xFF;
+			ComparisonFuncMask stencil_comparison_function = ComparisonFuncMask::FORGE_ALWAYS;
+			I32 stencil_reference = 0;
+			U32 stencil_mask = 0xFFFFFFFF;
+
+		public:
+			Bool operator ==(const DepthStencilStateDesc& other) const;
+
+			/**
+			 * @brief Hashes every field of the description.
+			 */
+			U64 GetHash(Void) const;
+		};
+
+		/**
+		 * @brief The fields which differ between two rasterizer states.
+		 */
+		enum class RasterizerStateDelta : U32
+		{
+			FORGE_ENUM_DECL(FORGE_NONE,              0)
+			FORGE_ENUM_DECL(FORGE_LINE_WIDTH,        FORGE_BIT(0))
+			FORGE_ENUM_DECL(FORGE_FRONT_FACE,        FORGE_BIT(1))
+			FORGE_ENUM_DECL(FORGE_FILL_MODE,         FORGE_BIT(2))
+			FORGE_ENUM_DECL(FORGE_FACE_CULLING,      FORGE_BIT(3))
+			FORGE_ENUM_DECL(FORGE_FACE_CULLING_MODE, FORGE_BIT(4))
+			FORGE_ENUM_DECL(FORGE_SCISSOR_TEST,      FORGE_BIT(5))
+			FORGE_ENUM_DECL(FORGE_ALL,               FORGE_BIT(6) - 1)
+		};
+
+		/**
+		 * @brief The fields which differ between two blend states.
+		 */
+		enum class BlendStateDelta : U32
+		{
+			FORGE_ENUM_DECL(FORGE_NONE,             0)
+			FORGE_ENUM_DECL(FORGE_BLENDING,         FORGE_BIT(0))
+			FORGE_ENUM_DECL(FORGE_FUNCTION,         FORGE_BIT(1))
+			FORGE_ENUM_DECL(FORGE_COLOR_WRITE_MASK, FORGE_BIT(2))
+			FORGE_ENUM_DECL(FORGE_ALL,              FORGE_BIT(3) - 1)
+		};
+
+		/**
+		 * @brief The fields which differ between two depth stencil states,
+		 * the stencil function covers its reference and mask.
+		 */
+		enum class DepthStencilStateDelta : U32
+		{
+			FORGE_ENUM_DECL(FORGE_NONE,               0)
+			FORGE_ENUM_DECL(FORGE_DEPTH_TEST,         FORGE_BIT(0))
+			FORGE_ENUM_DECL(FORGE_DEPTH_WRITE_MASK,   FORGE_BIT(1))
+			FORGE_ENUM_DECL(FORGE_DEPTH_FUNCTION,     FORGE_BIT(2))
+			FORGE_ENUM_DECL(FORGE_STENCIL_TEST,       FORGE_BIT(3))
+			FORGE_ENUM_DECL(FORGE_STENCIL_WRITE_MASK, FORGE_BIT(4))
+			FORGE_ENUM_DECL(FORGE_STENCIL_FUNCTION,   FORGE_BIT(5))
+			FORGE_ENUM_DECL(FORGE_ALL,                FORGE_BIT(6) - 1)
+		};
+
+		FORGE_FLAG_DECL(RasterizerStateDelta)
+		FORGE_FLAG_DECL(BlendStateDelta)
+		FORGE_FLAG_DECL(DepthStencilStateDelta)
+
+		/**
+		 * @brief Computes the fields which differ between two descriptions.
+		 *
+		 * @param previous[in] The description of the bound state.
+		 * @param next[in]     The description of the state to bind.
+		 *
+		 * @returns The delta bitset of the differing fields.
+		 */
+		FORGE_API RasterizerStateDelta ComputeStateDelta(const RasterizerStateDesc& previous, const RasterizerStateDesc& next);
+		FORGE_API BlendStateDelta ComputeStateDelta(const BlendStateDesc& previous, const BlendStateDesc& next);
+		FORGE_API DepthStencilStateDelta ComputeStateDelta(const DepthStencilStateDesc& previous, const DepthStencilStateDesc& next);
+
+		class PipelineStateCache;
+
+		/**
+		 * @brief An immutable pipeline state object created once per unique
+		 * description by a pipeline state cache.
+		 *
+		 * Since equal descriptions share one object, two states are equal
+		 * exactly when their unique IDs are, so binding compares a single
+		 * integer. Unique IDs are never reused, even by states of another
+		 * cache created after their cache was destroyed.
+		 *
+		 * @author Karim Hisham.
+		 */
+		template<typename InDesc>
+		class TPipelineStateObject
+		{
+		FORGE_CLASS_NONCOPYABLE(TPipelineStateObject)
+
+		private:
+			friend class PipelineStateCache;
+
+		private:
+			const InDesc m_desc;
+			const U64 m_hash;
+			const U32 m_cache_id;
+			const U32 m_id;
+
+		private:
+			TPipelineStateObject(const InDesc& desc, U64 hash, U32 cache_id, U32 id)
+				: m_desc(desc), m_hash(hash), m_cache_id(cache_id), m_id(id) {}
+
+		public:
+			/**
+			 * @brief Gets the description the state was created from.
+			 */
+			const InDesc& GetDesc(Void) const { return m_desc; }
+
+			/**
+			 * @brief Gets the hash of the description.
+			 */
+			U64 GetHash(Void) const { return m_hash; }
+
+			/**
+			 * @brief Gets the index of the state in creation order, unique
+			 * among the states of its kind in a cache.
+			 */
+			U32 GetID(Void) const { return m_id; }
+
+			/**
+			 * @brief Gets the ID of the cache in the high bits and the ID of
+			 * the state in the low bits, unique among the states of its kind
+			 * in every cache and never zero.
+			 */
+			U64 GetUniqueID(Void) const { return static_cast<U64>(m_cache_id) << 32 | m_id; }
+		};
+
+		using RasterizerStateObject   = TPipelineStateObject<RasterizerStateDesc>;
+		using BlendStateObject        = TPipelineStateObject<BlendStateDesc>;
+		using DepthStencilStateObject = TPipelineStateObject<DepthStencilStateDesc>;
+
+		FORGE_TYPEDEF_DECL(RasterizerStateObject)
+		FORGE_TYPEDEF_DECL(BlendStateObject)
+		FORGE_TYPEDEF_DECL(DepthStencilStateObject)
+
+		namespace Internal
+		{
+			template<typename InDesc>
+			struct TPipelineStateDescHasher
+			{
+				U64 operator ()(const InDesc& desc) const { return desc.GetHash(); }
+			};
+		}
+
+		/**
+		 * @brief Creates and owns the pipeline state objects, one per unique
+		 * description.
+		 *
+		 * States are looked up by the hash of their description and are
+		 * created on the first request, the same object is returned for every
+		 * later request of an equal description. States live until the cache
+		 * is destroyed, context states only keep the unique ID and a copy of
+		 * the description of the bound states, so a cache may be destroyed
+		 * while its states are bound. The cache is not thread safe, states
+		 * are meant to be created while loading.
+		 *
+		 * @author Karim Hisham.
+		 */
+		class FORGE_API PipelineStateCache
+		{
+		FORGE_CLASS_NONCOPYABLE(PipelineStateCache)
+
+		private:
+			template<typename InDesc>
+			using StateMap = Containers::THashMap<InDesc, TPipelineStateObject<InDesc>*, Internal::TPipelineStateDescHasher<InDesc>>;
+
+		private:
+			StateMap<RasterizerStateDesc>   m_rasterizer_state_map;
+			StateMap<BlendStateDesc>        m_blend_state_map;
+			StateMap<DepthStencilStateDesc> m_depth_stencil_state_map;
+
+		private:
+			static std::atomic<U32> s_num_of_caches;
+
+		private:
+			const U32 m_id;
+
+		private:
+			Containers::TDynamicArray<RasterizerStateObjectPtr>   m_rasterizer_states;
+			Containers::TDynamicArray<BlendStateObjectPtr>        m_blend_states;
+			Containers::TDynamicArray<DepthStencilStateObjectPtr> m_depth_stencil_states;
+
+		public:
+			/**
+			 * @brief Default Constructor.
+			 */
+			PipelineStateCache(Void);
+
+			/**
+			 * @brief Destructor, destroys every created state.
+			 */
+		   ~PipelineStateCache(Void);
+
+		private:
+			template<typename InDesc>
+			const TPipelineStateObject<InDesc>* GetOrCreate(StateMap<InDesc>& map, Containers::TDynamicArray<TPipelineStateObject<InDesc>*>& states, const InDesc& desc);
+
+		public:
+			/**
+			 * @brief Gets the rasterizer state of a description, creating it on
+			 * the first request.
+			 *
+			 * @param desc[in] The description of the state.
+			 *
+			 * @returns ConstRasterizerStateObjectPtr storing the unique state of
+			 * the description.
+			 */
+			ConstRasterizerStateObjectPtr GetRasterizerState(const RasterizerStateDesc& desc);
+
+			/**
+			 * @brief Gets the blend state of a description, creating it on the
+			 * first request.
+			 *
+			 * @param desc[in] The description of the state.
+			 *
+			 * @returns ConstBlendStateObjectPtr storing the unique state of
+			 * the description.
+			 */
+			ConstBlendStateObjectPtr GetBlendState(const BlendStateDesc& desc);
+
+			/**
+			 * @brief Gets the depth stencil state of a description, creating it
+			 * on the first request.
+			 *
+			 * @param desc[in] The description of the state.
+			 *
+			 * @returns ConstDepthStencilStateObjectPtr storing the unique state of
+			 * the description.
+			 */
+			ConstDepthStencilStateObjectPtr GetDepthStencilState(const DepthStencilStateDesc& desc);
+
+		public:
+			/**
+			 * @brief Gets the number of created states of every kind.
+			 */
+			Size GetNumOfRasterizerStates(Void) const;
+			Size GetNumOfBlendStates(Void) const;
+			Size GetNumOfDepthStencilStates(Void) const;
+		};
+
+		FORGE_TYPEDEF_DECL(PipelineStateCache)
+
+		FORGE_FORCE_INLINE Bool RasterizerStateDesc::operator ==(const RasterizerStateDesc& other) const
+		{
+			return line_width              == other.line_width              &&
+				   front_face_mode         == other.front_face_mode         &&
+				   polygon_fill_mode       == other.polygon_fill_mode       &&
+				   is_face_culling_enabled == other.is_face_culling_enabled &&
+				   face_culling_mode       == other.face_culling_mode       &&
+				   is_scissor_test_enabled == other.is_scissor_test_enabled;
+		}
+
+		FORGE_FORCE_INLINE Bool BlendStateDesc::operator ==(const BlendStateDesc& other) const
+		{
+			return is_enabled          == other.is_enabled          &&
+				   src_function        == other.src_function        &&
+				   dst_function        == other.dst_function        &&
+				   color_write_mask[0] == other.color_write_mask[0] &&
+				   color_write_mask[1] == other.color_write_mask[1] &&
+				   color_write_mask[2] == other.color_write_mask[2] &&
+				   color_write_mask[3] == other.color_write_mask[3];
+		}
+
+		FORGE_FORCE_INLINE Bool DepthStencilStateDesc::operator ==(const DepthStencilStateDesc& other) const
+		{
+			return is_depth_test_enabled       == other.is_depth_test_enabled       &&
+				   depth_write_mask            == other.depth_write_mask            &&
+				   depth_comparison_function   == other.depth_comparison_function   &&
+				   is_stencil_test_enabled     == other.is_stencil_test_enabled     &&
+				   stencil_write_mask          == other.stencil_write_mask          &&
+				   stencil_comparison_function == other.stencil_comparison_function &&
+				   stencil_reference           == other.stencil_reference           &&
+				   stencil_mask                == other.stencil_mask;
+		}
+
+		FORGE_FORCE_INLINE Size PipelineStateCache::GetNumOfRasterizerStates(Void) const   { return m_rasterizer_states.GetCount();    }
+		FORGE_FORCE_INLINE Size PipelineStateCache::GetNumOfBlendStates(Void) const        { return m_blend_states.GetCount();         }
+		FORGE_FORCE_INLINE Size PipelineStateCache::GetNumOfDepthStencilStates(Void) const { return m_depth_stencil_states.GetCount(); }
+	}
+}
+
+#endif // PIPELINE_STATE_H
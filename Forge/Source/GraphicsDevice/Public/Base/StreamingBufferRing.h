@@ -0,0 +1,212 @@
+#ifndef STREAMING_BUFFER_RING_H
+#define STREAMING_BUFFER_RING_H
+
+#include <Core/Public/Debug/Debug.h>
+#include <Core/Public/Common/Common.h>
+#include <Core/Public/Memory/MemoryUtilities.h>
+#include <Core/Public/Debug/Exception/ExceptionFactory.h>
+
+#include <GraphicsDevice/Public/GraphicsTypes.h>
+#include <GraphicsDevice/Public/Base/AbstractHardwareBuffer.h>
+
+namespace Forge {
+	namespace Graphics
+	{
+		/**
+		 * @brief The most frames a streaming buffer ring lets the GPU lag
+		 * behind the CPU.
+		 */
+		constexpr U32 MAX_STREAMING_FRAMES_IN_FLIGHT = 4;
+
+		/**
+		 * @brief The nanoseconds a streaming buffer ring waits on a fence
+		 * before waiting again.
+		 */
+		constexpr U64 STREAMING_FENCE_TIMEOUT = 1000000000;
+
+		/**
+		 * @brief The allocations counted by a streaming buffer ring since it
+		 * was created or its statistics were reset.
+		 */
+		struct StreamingBufferRingStatistics
+		{
+			U64 m_num_of_allocations     = 0;
+			U64 m_num_of_bytes_allocated = 0;
+
+			/**
+			 * @brief The number of allocations which skipped the end of the
+			 * buffer to start over at its beginning.
+			 */
+			U64 m_num_of_wraps           = 0;
+
+			/**
+			 * @brief The number of waits on a frame the GPU had not finished
+			 * reading yet.
+			 */
+			U64 m_num_of_stalls          = 0;
+		};
+
+		/**
+		 * @brief Streams dynamic vertex and index data through a hardware
+		 * buffer locked persistently once.
+		 *
+		 * The buffer is sub-allocated as a ring, every allocation hands out a
+		 * raw write pointer and the offset the draws read it at, so writing
+		 * costs no lock, bind or driver copy. A fence is inserted at the end
+		 * of every frame, and the bytes of a frame are reused only once its
+		 * fence is signaled. Allocations wait for the oldest frame only when
+		 * the ring is full, and frames wait for the oldest one only when
+		 * MAX_STREAMING_FRAMES_IN_FLIGHT are in flight.
+		 *
+		 * The hardware buffer must be created with FORGE_CPU_TO_GPU_STREAM
+		 * usage and outlive the ring. The ring is not thread safe.
+		 *
+		 * @author Karim Hisham.
+		 */
+		class FORGE_API StreamingBufferRing
+		{
+		FORGE_CLASS_NONCOPYABLE(StreamingBufferRing)
+
+		private:
+			struct FrameFence
+			{
+				/**
+				 * @brief The bytes the frame consumed, padding included.
+				 */
+				Size m_size;
+
+				AbstractHardwareBuffer::FenceHandle m_fence;
+			};
+
+		private:
+			AbstractHardwareBufferPtr m_hardware_buffer;
+			BytePtr m_data;
+
+		private:
+			Size m_head;
+			Size m_used_size;
+			Size m_frame_size;
+
+		private:
+			FrameFence m_frames[MAX_STREAMING_FRAMES_IN_FLIGHT];
+			U32 m_first_frame;
+			U32 m_num_of_frames;
+			U32 m_max_num_of_frames;
+
+		private:
+			Bool m_is_in_frame;
+
+		private:
+			StreamingBufferRingStatistics m_statistics;
+
+		public:
+			/**
+			 * @brief Constructor, locks the hardware buffer persistently.
+			 *
+			 * @param hardware_buffer[in]   The hardware buffer to stream through.
+			 * @param max_num_of_frames[in] The most frames in flight, clamped to
+			 * [1, MAX_STREAMING_FRAMES_IN_FLIGHT].
+			 *
+			 * @throws InvalidOperationException if the hardware buffer can not
+			 * be locked persistently.
+			 */
+			StreamingBufferRing(AbstractHardwareBufferPtr hardware_buffer, U32 max_num_of_frames = 3);
+
+		public:
+			/**
+			 * @brief Destructor, waits for the frames in flight unless waiting
+			 * fails, and unlocks the hardware buffer.
+			 */
+		   ~StreamingBufferRing(Void);
+
+		private:
+			/**
+			 * @brief Frees the bytes of the oldest frame in flight once its
+			 * fence is signaled.
+			 *
+			 * @param is_waiting[in] Whether to wait for the fence, or only poll
+			 * it.
+			 *
+			 * @returns True if the frame was retired, otherwise false.
+			 */
+			Bool RetireFrame(Bool is_waiting);
+
+		public:
+			/**
+			 * @brief Gets the hardware buffer the draws read the allocations
+			 * from.
+			 */
+			AbstractHardwareBufferPtr GetHardwareBuffer(Void) const;
+
+			/**
+			 * @brief Gets the number of frames the GPU may still be reading.
+			 */
+			U32 GetNumOfFramesInFlight(Void) const;
+
+			/**
+			 * @brief Gets the number of bytes of the frames in flight and of the
+			 * current frame.
+			 */
+			Size GetUsedSize(Void) const;
+
+			/**
+			 * @brief Gets the allocations counted since the ring was created or
+			 * its statistics were reset.
+			 *
+			 * @returns StreamingBufferRingStatistics storing the counters.
+			 */
+			const StreamingBufferRingStatistics& GetStatistics(Void) const;
+
+		public:
+			/**
+			 * @brief Resets the counters to zero.
+			 */
+			Void ResetStatistics(Void);
+
+		public:
+			/**
+			 * @brief Begins a frame, freeing the bytes of the finished frames.
+			 *
+			 * @throws InvalidOperationException if a frame already began.
+			 */
+			Void BeginFrame(Void);
+
+			/**
+			 * @brief Allocates bytes for the current frame.
+			 *
+			 * @param length[in]    The size of the allocation in bytes.
+			 * @param alignment[in] The alignment of the offset, must be power
+			 * of two.
+			 * @param offset[out]   The offset of the allocation in the hardware
+			 * buffer.
+			 *
+			 * @returns VoidPtr storing the address to write the allocation at,
+			 * valid until the frame ends.
+			 *
+			 * @throws InvalidOperationException if no frame began, if the
+			 * alignment is not a power of two, or if the allocation does not
+			 * fit in the buffer beside the current frame.
+			 */
+			VoidPtr Allocate(Size length, Size alignment, Size& offset);
+
+			/**
+			 * @brief Ends the frame, fencing its bytes once the draws reading
+			 * them were issued.
+			 *
+			 * @throws InvalidOperationException if no frame began.
+			 */
+			Void EndFrame(Void);
+		};
+
+		FORGE_TYPEDEF_DECL(StreamingBufferRing)
+
+		FORGE_FORCE_INLINE AbstractHardwareBufferPtr StreamingBufferRing::GetHardwareBuffer(Void) const            { return m_hardware_buffer; }
+		FORGE_FORCE_INLINE U32 StreamingBufferRing::GetNumOfFramesInFlight(Void) const                            { return m_num_of_frames;   }
+		FORGE_FORCE_INLINE Size StreamingBufferRing::GetUsedSize(Void) const                                      { return m_used_size;       }
+		FORGE_FORCE_INLINE const StreamingBufferRingStatistics& StreamingBufferRing::GetStatistics(Void) const    { return m_statistics;      }
+
+		FORGE_FORCE_INLINE Void StreamingBufferRing::ResetStatistics(Void) { m_statistics = StreamingBufferRingStatistics(); }
+	}
+}
+
+#endif // STREAMING_BUFFER_RING_H
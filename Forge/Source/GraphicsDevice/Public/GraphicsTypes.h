@@ -81,6 +81,13 @@ namespace Forge {
 			 */
 			FORGE_ENUM_DECL(FORGE_WRITE_ONLY, FORGE_BIT(2))
 
+			/**
+			 * @brief Indicates that the buffer will stay locked while the GPU
+			 * reads from it, writes are visible to the GPU without unlocking.
+			 * The buffer must be created with FORGE_CPU_TO_GPU_STREAM usage.
+			 */
+			FORGE_ENUM_DECL(FORGE_PERSISTENT, FORGE_BIT(3))
+
 			MAX
 		};
 
@@ -118,6 +125,12 @@ namespace Forge {
 			 */
 			FORGE_ENUM_DECL(FORGE_CPU_TO_GPU_WRITE_ONLY, 3)
 
+			/**
+			 * @brief Indicates that the buffer's data will be rewritten every
+			 * frame through a persistent lock, and can not be read from.
+			 */
+			FORGE_ENUM_DECL(FORGE_CPU_TO_GPU_STREAM,     4)
+
 			MAX
 		};
 
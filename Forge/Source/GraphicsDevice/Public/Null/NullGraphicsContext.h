@@ -0,0 +1,158 @@
+#ifndef NULL_GRAPHICS_CONTEXT_H
+#define NULL_GRAPHICS_CONTEXT_H
+
+#include <Core/Public/Common/Common.h>
+#include <Core/Public/Debug/Exception/ExceptionFactory.h>
+
+#include <GraphicsDevice/Public/Null/NullUtilities.h>
+#include <GraphicsDevice/Public/Base/AbstractGraphicsContext.h>
+
+namespace Forge {
+	namespace Graphics
+	{
+		/**
+		 * @brief The calls counted by a null graphics context since it was
+		 * created or its statistics were reset.
+		 */
+		struct NullGraphicsContextStatistics
+		{
+			U64 m_num_of_initializations = 0;
+			U64 m_num_of_terminations    = 0;
+			U64 m_num_of_set_currents    = 0;
+			U64 m_num_of_end_currents    = 0;
+
+			/**
+			 * @brief The number of successful buffer swaps, the number of
+			 * presented frames.
+			 */
+			U64 m_num_of_swaps           = 0;
+		};
+
+		/**
+		 * @brief Graphics context implementation that creates no render API
+		 * context, for running the graphics device without a GPU or window.
+		 *
+		 * The null context follows the life cycle of a real context, it must
+		 * be initialized before it is made current, and buffers are only
+		 * swapped while it is current. Every call is counted and the buffer
+		 * swap may spend a simulated driver latency.
+		 *
+		 * @author Karim Hisham.
+		 */
+		class FORGE_API NullGraphicsContext final : public AbstractGraphicsContext
+		{
+		private:
+			NullGraphicsContextStatistics m_statistics;
+
+		private:
+			NullDriverLatency m_latency;
+
+		private:
+			Bool m_is_initialized;
+			Bool m_is_current;
+
+		public:
+			/**
+			 * @brief Default Constructor.
+			 *
+			 * @param window[in] The window of the context, may be nullptr.
+			 */
+			NullGraphicsContext(WindowPtr window = nullptr);
+
+		public:
+			/**
+			 * @brief Gets the calls counted since the context was created or its
+			 * statistics were reset.
+			 *
+			 * @returns NullGraphicsContextStatistics storing the counters.
+			 */
+			const NullGraphicsContextStatistics& GetStatistics(Void) const;
+
+			/**
+			 * @brief Gets the simulated driver latency.
+			 *
+			 * @returns NullDriverLatency storing the latency of the calls.
+			 */
+			const NullDriverLatency& GetLatency(Void) const;
+
+			/**
+			 * @brief Checks whether the context is initialized.
+			 *
+			 * @returns True if initialized, otherwise false.
+			 */
+			Bool IsInitialized(Void) const;
+
+			/**
+			 * @brief Checks whether the context is current.
+			 *
+			 * @returns True if current, otherwise false.
+			 */
+			Bool IsCurrent(Void) const;
+
+		public:
+			/**
+			 * @brief Resets the counters to zero.
+			 */
+			Void ResetStatistics(Void);
+
+			/**
+			 * @brief Sets the simulated driver latency of the calls.
+			 *
+			 * @param latency[in] The latency, only the swap latency applies to
+			 * the context.
+			 */
+			Void SetLatency(const NullDriverLatency& latency);
+
+		public:
+			/**
+			 * @brief Initializes the graphics context.
+			 *
+			 * @returns True, initializing a null context always succeeds.
+			 */
+			Bool Initialize(Void) override;
+
+			/**
+			 * @brief Terminates the graphics context, ending it first if
+			 * current.
+			 */
+			Void Terminate(Void) override;
+
+		public:
+			/**
+			 * @brief Sets the graphics context as the current context.
+			 *
+			 * @throws InvalidOperationException if the context is not
+			 * initialized.
+			 */
+			Void SetCurrent(Void) override;
+
+			/**
+			 * @brief Ends the graphics context but does not release it.
+			 */
+			Void EndCurrent(Void) override;
+
+		public:
+			/**
+			 * @brief Presents a frame, spending the simulated swap latency.
+			 *
+			 * @param swap_interval[in] Ignored, there is no display to
+			 * synchronize with.
+			 *
+			 * @returns True if the context is current, otherwise false.
+			 */
+			Bool SwapBuffers(I32 swap_interval = 0) override;
+		};
+
+		FORGE_TYPEDEF_DECL(NullGraphicsContext)
+
+		FORGE_FORCE_INLINE const NullGraphicsContextStatistics& NullGraphicsContext::GetStatistics(Void) const { return m_statistics;     }
+		FORGE_FORCE_INLINE const NullDriverLatency& NullGraphicsContext::GetLatency(Void) const                { return m_latency;        }
+		FORGE_FORCE_INLINE Bool NullGraphicsContext::IsInitialized(Void) const                                 { return m_is_initialized; }
+		FORGE_FORCE_INLINE Bool NullGraphicsContext::IsCurrent(Void) const                                     { return m_is_current;     }
+
+		FORGE_FORCE_INLINE Void NullGraphicsContext::ResetStatistics(Void)                        { m_statistics = NullGraphicsContextStatistics(); }
+		FORGE_FORCE_INLINE Void NullGraphicsContext::SetLatency(const NullDriverLatency& latency) { m_latency = latency;                             }
+	}
+}
+
+#endif // NULL_GRAPHICS_CONTEXT_H
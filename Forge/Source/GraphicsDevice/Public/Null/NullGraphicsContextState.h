@@ -0,0 +1,293 @@
+#ifndef NULL_GRAPHICS_CONTEXT_STATE_H
+#define NULL_GRAPHICS_CONTEXT_STATE_H
+
+#include <Core/Public/Common/Common.h>
+#include <Core/Public/Memory/MemoryUtilities.h>
+#include <Core/Public/Containers/TDynamicArray.h>
+#include <Core/Public/Debug/Exception/ExceptionFactory.h>
+
+#include <GraphicsDevice/Public/Null/NullUtilities.h>
+#include <GraphicsDevice/Public/Base/AbstractGraphicsContextState.h>
+
+namespace Forge {
+	namespace Graphics
+	{
+		/**
+		 * @brief The context state functions recorded by the null context
+		 * state.
+		 */
+		enum class NullGraphicsCallType : Byte
+		{
+			FORGE_ENUM_DECL(FORGE_ENABLE_DEPTH_TEST,               0)
+			FORGE_ENUM_DECL(FORGE_ENABLE_STENCIL_TEST,             1)
+			FORGE_ENUM_DECL(FORGE_ENABLE_SCISSOR_TEST,             2)
+			FORGE_ENUM_DECL(FORGE_ENABLE_FACE_CULLING,             3)
+			FORGE_ENUM_DECL(FORGE_ENABLE_COLOR_BLENDING,           4)
+			FORGE_ENUM_DECL(FORGE_SET_DEPTH_WRITE_MASK,            5)
+			FORGE_ENUM_DECL(FORGE_SET_DEPTH_COMPARISON_FUNCTION,   6)
+			FORGE_ENUM_DECL(FORGE_SET_STENCIL_WRITE_MASK,          7)
+			FORGE_ENUM_DECL(FORGE_SET_STENCIL_COMPARISON_FUNCTION, 8)
+			FORGE_ENUM_DECL(FORGE_SET_SCISSOR_BOUNDING_REGION,     9)
+			FORGE_ENUM_DECL(FORGE_SET_FACE_CULLING_MODE,           10)
+			FORGE_ENUM_DECL(FORGE_SET_COLOR_BLENDING_CONSTANT,     11)
+			FORGE_ENUM_DECL(FORGE_SET_COLOR_BLENDING_FUNCTION,     12)
+			FORGE_ENUM_DECL(FORGE_SET_LINE_WIDTH,                  13)
+			FORGE_ENUM_DECL(FORGE_SET_ACTIVE_TEXTURE,              14)
+			FORGE_ENUM_DECL(FORGE_SET_FILL_MODE,                   15)
+			FORGE_ENUM_DECL(FORGE_SET_FRONT_FACE,                  16)
+			FORGE_ENUM_DECL(FORGE_SET_PIXEL_STORAGE,               17)
+			FORGE_ENUM_DECL(FORGE_SET_COLOR_CLEAR,                 18)
+			FORGE_ENUM_DECL(FORGE_SET_COLOR_WRITE_MASK,            19)
+			FORGE_ENUM_DECL(FORGE_BIND_HARDWARE_BUFFER,            20)
+			FORGE_ENUM_DECL(FORGE_CLEAR,                           21)
+			FORGE_ENUM_DECL(FORGE_DRAW,                            22)
+			FORGE_ENUM_DECL(FORGE_DRAW_INDEXED,                    23)
+			FORGE_ENUM_DECL(FORGE_APPLY_RASTERIZER_STATE,          24)
+			FORGE_ENUM_DECL(FORGE_APPLY_BLEND_STATE,               25)
+			FORGE_ENUM_DECL(FORGE_APPLY_DEPTH_STENCIL_STATE,       26)
+
+			MAX
+		};
+
+		/**
+		 * @brief A context state function call recorded by the null context
+		 * state, with its arguments in declaration order.
+		 */
+		struct NullGraphicsCall
+		{
+			/**
+			 * @brief The called function.
+			 */
+			NullGraphicsCallType m_type;
+
+			/**
+			 * @brief The bound hardware buffer of a bind call, otherwise nullptr.
+			 */
+			AbstractHardwareBufferPtr m_hardware_buffer;
+
+			/**
+			 * @brief The numeric arguments, enumerations and booleans are stored
+			 * as their underlying values. State object applies store their
+			 * delta bits as the only argument.
+			 */
+			F64 m_arguments[5];
+		};
+
+		/**
+		 * @brief The calls counted by a null context state since it was
+		 * created or its statistics were reset.
+		 */
+		struct NullGraphicsContextStateStatistics
+		{
+			/**
+			 * @brief The number of calls of every function.
+			 */
+			U64 m_num_of_calls_by_type[static_cast<Size>(NullGraphicsCallType::MAX)] = {};
+
+			/**
+			 * @brief The number of calls of all functions.
+			 */
+			U64 m_num_of_calls = 0;
+
+			/**
+			 * @brief The number of draw and indexed draw calls.
+			 */
+			U64 m_num_of_draws = 0;
+
+			/**
+			 * @brief The number of vertices and indices submitted by the draws.
+			 */
+			U64 m_num_of_vertices = 0;
+		};
+
+		/**
+		 * @brief Context state implementation that executes nothing, for
+		 * running the graphics device without a GPU.
+		 *
+		 * The null context state tracks the rasterizer state like a real
+		 * backend and validates every call like a strict driver would. Calls
+		 * with invalid enumerations, draws without a bound hardware buffer and
+		 * indexed draws with a non-index type throw. Every call is counted and
+		 * may spend a simulated driver latency. While recording, every call is
+		 * also appended to a log that tests compare against the expected
+		 * command stream.
+		 *
+		 * @author Karim Hisham.
+		 */
+		class FORGE_API NullGraphicsContextState final : public AbstractGraphicsContextState
+		{
+		private:
+			Containers::TDynamicArray<NullGraphicsCall> m_calls;
+
+		private:
+			AbstractHardwareBufferPtr m_bound_hardware_buffer;
+
+		private:
+			NullGraphicsContextStateStatistics m_statistics;
+
+		private:
+			NullDriverLatency m_latency;
+
+		private:
+			Bool m_is_recording;
+
+		public:
+			/**
+			 * @brief Default Constructor.
+			 *
+			 * @param graphics_context[in] The graphics context of the state, may
+			 * be nullptr.
+			 * @param is_recording[in]     Whether to record the calls.
+			 */
+			NullGraphicsContextState(AbstractGraphicsContextPtr graphics_context = nullptr, Bool is_recording = FORGE_TRUE);
+
+		private:
+			/**
+			 * @brief Counts a call, spends its simulated latency and appends it
+			 * to the log while recording.
+			 */
+			Void RecordCall(NullGraphicsCallType type, F64 argument_0 = 0.0, F64 argument_1 = 0.0, F64 argument_2 = 0.0, F64 argument_3 = 0.0, F64 argument_4 = 0.0);
+
+		public:
+			/**
+			 * @brief Gets the number of recorded calls.
+			 *
+			 * @return Size storing the number of recorded calls.
+			 */
+			Size GetNumOfCalls(Void) const;
+
+			/**
+			 * @brief Gets a recorded call.
+			 *
+			 * @param index[in] The position of the call in call order.
+			 *
+			 * @return NullGraphicsCall storing the recorded call.
+			 */
+			const NullGraphicsCall& GetCall(Size index) const;
+
+			/**
+			 * @brief Gets the bound hardware buffer.
+			 *
+			 * @return AbstractHardwareBufferPtr storing the last bound hardware
+			 * buffer, or nullptr.
+			 */
+			AbstractHardwareBufferPtr GetBoundHardwareBuffer(Void) const;
+
+			/**
+			 * @brief Checks whether the calls are recorded.
+			 *
+			 * @return True if recording, otherwise false.
+			 */
+			Bool IsRecording(Void) const;
+
+			/**
+			 * @brief Gets the calls counted since the state was created or its
+			 * statistics were reset, whether recording or not.
+			 *
+			 * @return NullGraphicsContextStateStatistics storing the counters.
+			 */
+			const NullGraphicsContextStateStatistics& GetStatistics(Void) const;
+
+			/**
+			 * @brief Gets the simulated driver latency.
+			 *
+			 * @return NullDriverLatency storing the latency of the calls.
+			 */
+			const NullDriverLatency& GetLatency(Void) const;
+
+		public:
+			/**
+			 * @brief Starts or stops recording the calls.
+			 *
+			 * @param is_recording[in] Whether to record the calls.
+			 */
+			Void SetRecording(Bool is_recording);
+
+			/**
+			 * @brief Drops the recorded calls.
+			 */
+			Void ClearCalls(Void);
+
+			/**
+			 * @brief Resets the counters to zero.
+			 */
+			Void ResetStatistics(Void);
+
+			/**
+			 * @brief Sets the simulated driver latency of the calls.
+			 *
+			 * @param latency[in] The latency, only the call and draw latencies
+			 * apply to the context state.
+			 */
+			Void SetLatency(const NullDriverLatency& latency);
+
+		public:
+			Void EnableDepthTest(Bool enable) override;
+			Void EnableStencilTest(Bool enable) override;
+			Void EnableScissorTest(Bool enable) override;
+			Void EnableFaceCulling(Bool enable) override;
+			Void EnableColorBlending(Bool enable) override;
+
+		public:
+			Bool SetDepthWriteMask(Bool mask) override;
+			Bool SetDepthComparisonFunction(ComparisonFuncMask function) override;
+
+		public:
+			Bool SetStencilWriteMask(Byte mask) override;
+			Bool SetStencilComparisonFunction(ComparisonFuncMask function, I32 reference, U32 mask) override;
+
+		public:
+			Bool SetScissorBoundingRegion(I32 x, I32 y, I32 width, I32 height) override;
+
+		public:
+			Bool SetFaceCullingMode(FaceCullMask mode) override;
+
+		public:
+			Bool SetColorBlendingConstant(F32 red, F32 green, F32 blue, F32 alpha) override;
+			Bool SetColorBlendingFunction(BlendFuncMask src_function, BlendFuncMask dst_function) override;
+
+		public:
+			Void SetLineWidth(F32 width) override;
+			Void SetActiveTexture(U32 index) override;
+			Void SetFillMode(PolygonFillMask mode) override;
+			Void SetFrontFace(FrontFaceMask front_face) override;
+			Void SetPixelStorage(PixelStorageMask mode, I32 value) override;
+			Void SetColorClear(F32 red, F32 green, F32 blue, F32 alpha) override;
+			Void SetColorWriteMask(F32 red, F32 green, F32 blue, F32 alpha) override;
+
+		public:
+			Void Clear(ClearFlags flags) override;
+			Void Draw(PrimitiveTopologyMask topology, U32 first_vertex, U32 vertex_count) override;
+			Void DrawIndexed(PrimitiveTopologyMask topology, ValueTypeMask index_type, U32 first_index, U32 index_count, I32 base_vertex) override;
+
+		public:
+			Void InitializeCache(Void) override;
+			Void InvalidateCache(Void) override;
+
+		public:
+			Void BindHardwareBuffer(AbstractHardwareBufferPtr hardware_buffer) override;
+
+		protected:
+			Void ApplyRasterizerState(const RasterizerStateDesc& desc, RasterizerStateDelta delta) override;
+			Void ApplyBlendState(const BlendStateDesc& desc, BlendStateDelta delta) override;
+			Void ApplyDepthStencilState(const DepthStencilStateDesc& desc, DepthStencilStateDelta delta) override;
+		};
+
+		FORGE_TYPEDEF_DECL(NullGraphicsContextState)
+
+		FORGE_FORCE_INLINE Size NullGraphicsContextState::GetNumOfCalls(Void) const                              { return m_calls.GetCount();         }
+		FORGE_FORCE_INLINE const NullGraphicsCall& NullGraphicsContextState::GetCall(Size index) const            { return m_calls.GetByIndex(index); }
+		FORGE_FORCE_INLINE AbstractHardwareBufferPtr NullGraphicsContextState::GetBoundHardwareBuffer(Void) const { return m_bound_hardware_buffer;    }
+		FORGE_FORCE_INLINE Bool NullGraphicsContextState::IsRecording(Void) const                                { return m_is_recording;             }
+
+		FORGE_FORCE_INLINE const NullGraphicsContextStateStatistics& NullGraphicsContextState::GetStatistics(Void) const { return m_statistics; }
+		FORGE_FORCE_INLINE const NullDriverLatency& NullGraphicsContextState::GetLatency(Void) const                     { return m_latency;    }
+
+		FORGE_FORCE_INLINE Void NullGraphicsContextState::SetRecording(Bool is_recording)              { m_is_recording = is_recording;                         }
+		FORGE_FORCE_INLINE Void NullGraphicsContextState::ClearCalls(Void)                             { m_calls.Clear();                                       }
+		FORGE_FORCE_INLINE Void NullGraphicsContextState::ResetStatistics(Void)                        { m_statistics = NullGraphicsContextStateStatistics(); }
+		FORGE_FORCE_INLINE Void NullGraphicsContextState::SetLatency(const NullDriverLatency& latency) { m_latency = latency;                                    }
+	}
+}
+
+#endif // NULL_GRAPHICS_CONTEXT_STATE_H
@@ -0,0 +1,238 @@
+#ifndef NULL_HARDWARE_BUFFER_H
+#define NULL_HARDWARE_BUFFER_H
+
+#include <Core/Public/Common/Common.h>
+#include <Core/Public/Debug/Exception/ExceptionFactory.h>
+
+#include <GraphicsDevice/Public/Null/NullUtilities.h>
+#include <GraphicsDevice/Public/Base/AbstractHardwareBuffer.h>
+
+namespace Forge {
+	namespace Graphics
+	{
+		/**
+		 * @brief The accesses counted by a null hardware buffer since it was
+		 * created or its statistics were reset.
+		 */
+		struct NullHardwareBufferStatistics
+		{
+			U64 m_num_of_locks          = 0;
+			U64 m_num_of_reads          = 0;
+			U64 m_num_of_writes         = 0;
+			U64 m_num_of_copies         = 0;
+
+			U64 m_num_of_bytes_locked   = 0;
+			U64 m_num_of_bytes_read     = 0;
+			U64 m_num_of_bytes_written  = 0;
+			U64 m_num_of_bytes_copied   = 0;
+
+			U64 m_num_of_fences         = 0;
+
+			/**
+			 * @brief The number of waits on a fence which was not signaled yet.
+			 */
+			U64 m_num_of_fence_stalls   = 0;
+		};
+
+		/**
+		 * @brief Hardware buffer implementation storing its data in system
+		 * memory, for running the graphics device without a GPU.
+		 *
+		 * The data is always kept in the shadow buffer. Every access is checked
+		 * like a driver would, out of bounds accesses throw and so do accesses
+		 * while the buffer is locked. Every access is counted along with the
+		 * bytes it transfers, and may spend a simulated driver latency.
+		 *
+		 * Fences are numbered in insertion order and signaled as soon as they
+		 * are inserted, since there is no GPU to wait for. Tests of fence
+		 * guarded code can hold the fences pending and signal them as a GPU
+		 * would finish, a wait on a pending fence counts a stall and signals
+		 * the fences up to it.
+		 *
+		 * @author Karim Hisham.
+		 */
+		class FORGE_API NullHardwareBuffer final : public AbstractHardwareBuffer
+		{
+		private:
+			NullHardwareBufferStatistics m_statistics;
+
+		private:
+			NullDriverLatency m_latency;
+
+		private:
+			U64 m_next_fence;
+			U64 m_last_signaled_fence;
+
+			Bool m_is_signaling_fences;
+			Bool m_is_failing_fences;
+
+		public:
+			/**
+			 * @brief Default constructor.
+			 */
+			NullHardwareBuffer(Size size, UsageModeMask usage_mode_mask = UsageModeMask::FORGE_GPU_ONLY);
+
+		public:
+			/**
+			 * @brief Default destructor.
+			 */
+			~NullHardwareBuffer(Void);
+
+		private:
+			/**
+			 * @brief Spends the simulated latency of an access transferring
+			 * the specified number of bytes.
+			 */
+			Void SimulateLatency(Size length);
+
+		public:
+			/**
+			 * @brief Gets the accesses counted since the buffer was created or
+			 * its statistics were reset.
+			 *
+			 * @returns NullHardwareBufferStatistics storing the counters.
+			 */
+			const NullHardwareBufferStatistics& GetStatistics(Void) const;
+
+			/**
+			 * @brief Gets the simulated driver latency.
+			 *
+			 * @returns NullDriverLatency storing the latency of the accesses.
+			 */
+			const NullDriverLatency& GetLatency(Void) const;
+
+		public:
+			/**
+			 * @brief Resets the counters to zero.
+			 */
+			Void ResetStatistics(Void);
+
+			/**
+			 * @brief Sets the simulated driver latency of the accesses.
+			 *
+			 * @param latency[in] The latency, only the call and byte latencies
+			 * apply to hardware buffers.
+			 */
+			Void SetLatency(const NullDriverLatency& latency);
+
+		public:
+			/**
+			 * @brief Sets whether fences are signaled when inserted, or held
+			 * pending until signaled or waited for.
+			 *
+			 * @param is_signaling_fences[in] True to signal fences when inserted.
+			 */
+			Void SetSignalingFences(Bool is_signaling_fences);
+
+			/**
+			 * @brief Signals the pending fences, as a GPU finishing every
+			 * command issued so far would.
+			 */
+			Void SignalFences(Void);
+
+			/**
+			 * @brief Sets whether waiting for a fence fails, as it would once
+			 * the device is lost.
+			 *
+			 * @param is_failing_fences[in] True to throw on every fence wait.
+			 */
+			Void SetFailingFences(Bool is_failing_fences);
+
+		public:
+			/**
+			 * @brief Locks the hardware buffer by mapping its data.
+			 *
+			 * @param lock_mode[in] The lock mode of the hardware buffer.
+			 *
+			 * @returns VoidPtr storing the starting address of the hardware
+			 * buffer data.
+			 *
+			 * @throws InvalidOperationException if the buffer is already locked,
+			 * or if the lock is persistent and the buffer is not a stream buffer.
+			 */
+			VoidPtr Lock(LockModeFlags lock_mode) override;
+
+			/**
+			 * @brief Locks a region of the hardware buffer by mapping its data.
+			 *
+			 * @param offset[in]    The byte offset from the start of the hardware buffer.
+			 * @param length[in]    The size of the region in bytes.
+			 * @param lock_mode[in] The lock mode of the hardware buffer.
+			 *
+			 * @returns VoidPtr storing the starting address of the region.
+			 *
+			 * @throws MemoryOutOfBoundsException if the region is beyond the
+			 * buffer, InvalidOperationException if the buffer is already locked,
+			 * or if the lock is persistent and the buffer is not a stream buffer.
+			 */
+			VoidPtr Lock(Size offset, Size length, LockModeFlags lock_mode) override;
+
+		public:
+			/**
+			 * @brief Unlocks the hardware buffer.
+			 *
+			 * @returns True if the buffer was locked, otherwise false.
+			 */
+			Bool Unlock(Void) override;
+
+		public:
+			/**
+			 * @brief Reads data from the hardware buffer.
+			 *
+			 * @throws MemoryOutOfBoundsException if the region is beyond the
+			 * buffer, InvalidOperationException if the buffer is locked.
+			 */
+			Void ReadData(VoidPtr dst, Size offset, Size length) override;
+
+			/**
+			 * @brief Writes data to the hardware buffer.
+			 *
+			 * @throws MemoryOutOfBoundsException if the region is beyond the
+			 * buffer, InvalidOperationException if the buffer is locked.
+			 */
+			Void WriteData(VoidPtr src, Size offset, Size length) override;
+
+			/**
+			 * @brief Copies data from another hardware buffer.
+			 *
+			 * @throws MemoryOutOfBoundsException if a region is beyond its
+			 * buffer, InvalidOperationException if a buffer is locked or the
+			 * source has no shadow buffer.
+			 */
+			Void CopyData(AbstractHardwareBuffer& src, Size src_offset, Size dst_offset, Size length) override;
+
+		public:
+			/**
+			 * @brief Inserts a fence, signaled right away unless fences are held
+			 * pending.
+			 */
+			FenceHandle InsertFence(Void) override;
+
+			/**
+			 * @brief Checks a fence, a pending fence is signaled along with the
+			 * fences before it and counted as a stall, unless only polled.
+			 * Throws if fences are set to fail.
+			 */
+			Bool WaitFence(FenceHandle fence, U64 timeout) override;
+
+			/**
+			 * @brief Deletes a fence, fences hold no resources.
+			 */
+			Void DeleteFence(FenceHandle fence) override;
+		};
+
+		FORGE_TYPEDEF_DECL(NullHardwareBuffer)
+
+		FORGE_FORCE_INLINE const NullHardwareBufferStatistics& NullHardwareBuffer::GetStatistics(Void) const { return m_statistics; }
+		FORGE_FORCE_INLINE const NullDriverLatency& NullHardwareBuffer::GetLatency(Void) const               { return m_latency;    }
+
+		FORGE_FORCE_INLINE Void NullHardwareBuffer::ResetStatistics(Void)                        { m_statistics = NullHardwareBufferStatistics(); }
+		FORGE_FORCE_INLINE Void NullHardwareBuffer::SetLatency(const NullDriverLatency& latency) { m_latency = latency;                            }
+
+		FORGE_FORCE_INLINE Void NullHardwareBuffer::SetSignalingFences(Bool is_signaling_fences) { m_is_signaling_fences = is_signaling_fences;  }
+		FORGE_FORCE_INLINE Void NullHardwareBuffer::SignalFences(Void)                           { m_last_signaled_fence = m_next_fence - 1;    }
+		FORGE_FORCE_INLINE Void NullHardwareBuffer::SetFailingFences(Bool is_failing_fences)     { m_is_failing_fences = is_failing_fences;    }
+	}
+}
+
+#endif // NULL_HARDWARE_BUFFER_H
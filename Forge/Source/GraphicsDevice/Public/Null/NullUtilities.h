@@ -0,0 +1,61 @@
+#ifndef NULL_UTILITIES_H
+#define NULL_UTILITIES_H
+
+#include <chrono>
+
+#include <Core/Public/Common/Common.h>
+
+namespace Forge {
+	namespace Graphics
+	{
+		/**
+		 * @brief The driver latency simulated by the null backend.
+		 *
+		 * The latency is spent busy waiting on the calling thread, the same
+		 * way a driver spends CPU time validating and translating calls, so
+		 * that benchmarks of the render front-end see a realistic cost per
+		 * call without a GPU. All latencies are zero by default.
+		 */
+		struct NullDriverLatency
+		{
+			/**
+			 * @brief The nanoseconds spent in every call.
+			 */
+			U64 m_call_latency = 0;
+
+			/**
+			 * @brief The nanoseconds spent in every draw call, on top of the call
+			 * latency.
+			 */
+			U64 m_draw_latency = 0;
+
+			/**
+			 * @brief The nanoseconds spent per byte transferred to or from a
+			 * hardware buffer.
+			 */
+			F64 m_byte_latency = 0.0;
+
+			/**
+			 * @brief The nanoseconds spent swapping the buffers.
+			 */
+			U64 m_swap_latency = 0;
+		};
+
+		/**
+		 * @brief Busy waits on the calling thread.
+		 *
+		 * @param nanoseconds[in] The time to wait in nanoseconds.
+		 */
+		FORGE_FORCE_INLINE Void SimulateNullDriverLatency(U64 nanoseconds)
+		{
+			if (!nanoseconds)
+				return;
+
+			const auto end = std::chrono::steady_clock::now() + std::chrono::nanoseconds(nanoseconds);
+
+			while (std::chrono::steady_clock::now() < end);
+		}
+	}
+}
+
+#endif // NULL_UTILITIES_H
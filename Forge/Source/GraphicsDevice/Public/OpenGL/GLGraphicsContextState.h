@@ -254,6 +254,37 @@ namespace Forge {
 			 */
 			Void SetColorWriteMask(F32 red, F32 green, F32 blue, F32 alpha) override;
 
+		public:
+			/**
+			 * @brief Clears buffers of the current framebuffer to their clear
+			 * values.
+			 *
+			 * @param flags The buffers to clear.
+			 */
+			Void Clear(ClearFlags flags) override;
+
+			/**
+			 * @brief Renders primitives from consecutive vertices of the bound
+			 * vertex buffers.
+			 *
+			 * @param topology     The kind of primitives to render.
+			 * @param first_vertex The index of the first vertex to render.
+			 * @param vertex_count The number of vertices to render.
+			 */
+			Void Draw(PrimitiveTopologyMask topology, U32 first_vertex, U32 vertex_count) override;
+
+			/**
+			 * @brief Renders primitives from vertices of the bound vertex buffers
+			 * indexed by the bound index buffer.
+			 *
+			 * @param topology    The kind of primitives to render.
+			 * @param index_type  The type of the indices.
+			 * @param first_index The position of the first index to render.
+			 * @param index_count The number of indices to render.
+			 * @param base_vertex The constant added to every index.
+			 */
+			Void DrawIndexed(PrimitiveTopologyMask topology, ValueTypeMask index_type, U32 first_index, U32 index_count, I32 base_vertex) override;
+
 		public:
 			/**
 			 * @brief Gets the context limits.
@@ -285,6 +316,18 @@ namespace Forge {
 			virtual Void BindHardwareBuffer(AbstractHardwareBufferPtr hardware_buffer) override;
 
 			// virtual Void BindVertexDecleration(VertexDeclerationPtr vertex_decleration) override;
+
+		protected:
+			/**
+			 * @brief Applies the fields of a state object set in the delta,
+			 * issuing one GL call per differing field.
+			 *
+			 * @param desc  The description of the state being bound.
+			 * @param delta The fields which differ from the bound state.
+			 */
+			Void ApplyRasterizerState(const RasterizerStateDesc& desc, RasterizerStateDelta delta) override;
+			Void ApplyBlendState(const BlendStateDesc& desc, BlendStateDelta delta) override;
+			Void ApplyDepthStencilState(const DepthStencilStateDesc& desc, DepthStencilStateDelta delta) override;
 		};
 
 		FORGE_TYPEDEF_DECL(GLGraphicsContextState)
@@ -19,6 +19,18 @@ namespace Forge {
 		protected:
 			GLenum m_buffer_target;
 
+		protected:
+			/**
+			 * @brief Whether the storage is immutable and can be locked
+			 * persistently, only stream buffers on drivers supporting
+			 * ARB_buffer_storage are.
+			 *
+			 * The storage is created with dynamic storage, so ReadData,
+			 * WriteData and CopyData keep working on it, including the
+			 * writes replayed from command buffers.
+			 */
+			Bool m_is_persistent;
+
 		public:
 			/**
 			 * @brief Default constructor.
@@ -60,7 +72,8 @@ namespace Forge {
 			 * 
 			 * @throws MemoryOutOfBoundsException if the length passed is larger
 			 * than the size of the buffer or if the offset is beyond the buffer
-			 * region.
+			 * region, InvalidOperationException if the lock is persistent and
+			 * the storage is not.
 			 */
 			VoidPtr Lock(Size offset, Size length, LockModeFlags lock_mode) override;
 
@@ -123,6 +136,23 @@ namespace Forge {
 			 * region.
 			 */
 			Void CopyData(AbstractHardwareBufferRef src, Size src_offset, Size dst_offset, Size length) override;
+
+		public:
+			/**
+			 * @brief Inserts a sync object into the command stream.
+			 */
+			FenceHandle InsertFence(Void) override;
+
+			/**
+			 * @brief Waits on the client for a sync object, flushing the
+			 * commands before it.
+			 */
+			Bool WaitFence(FenceHandle fence, U64 timeout) override;
+
+			/**
+			 * @brief Deletes a sync object.
+			 */
+			Void DeleteFence(FenceHandle fence) override;
 		};
 
 		FORGE_TYPEDEF_DECL(GLHardwareBuffer)
@@ -81,6 +81,7 @@ namespace Forge {
 			case UsageModeMask::FORGE_CPU_TO_GPU:              gl_usage_mode = GL_DYNAMIC_READ; break;
 			case UsageModeMask::FORGE_GPU_ONLY:                gl_usage_mode = GL_STATIC_DRAW;  break;
 			case UsageModeMask::FORGE_CPU_TO_GPU_WRITE_ONLY:   gl_usage_mode = GL_DYNAMIC_DRAW; break;
+			case UsageModeMask::FORGE_CPU_TO_GPU_STREAM:       gl_usage_mode = GL_STREAM_DRAW;  break;
 			}
 
 			return gl_usage_mode;
@@ -143,6 +144,36 @@ namespace Forge {
 
 			return gl_function;
 		}
+
+		/**
+		 * @brief Converts Engine API primitive topology to Opengl primitive
+		 * mode.
+		 *
+		 * @param topology The engine API primitive topology to convert.
+		 *
+		 * @returns GLenum storing Opengl primitive mode.
+		 */
+		FORGE_FORCE_INLINE GLenum ConvertToGLPrimitiveTopology(PrimitiveTopologyMask topology)
+		{
+			GLenum gl_topology;
+
+			switch (topology)
+			{
+			case PrimitiveTopologyMask::FORGE_POINT:                    gl_topology = GL_POINTS;                   break;
+			case PrimitiveTopologyMask::FORGE_LINE:                     gl_topology = GL_LINES;                    break;
+			case PrimitiveTopologyMask::FORGE_LINE_LOOP:                gl_topology = GL_LINE_LOOP;                break;
+			case PrimitiveTopologyMask::FORGE_LINE_STRIP:               gl_topology = GL_LINE_STRIP;               break;
+			case PrimitiveTopologyMask::FORGE_TRIANGLE:                 gl_topology = GL_TRIANGLES;                break;
+			case PrimitiveTopologyMask::FORGE_TRIANGLE_FAN:             gl_topology = GL_TRIANGLE_FAN;             break;
+			case PrimitiveTopologyMask::FORGE_TRIANGLE_STRIP:           gl_topology = GL_TRIANGLE_STRIP;           break;
+			case PrimitiveTopologyMask::FORGE_LINE_ADJACENCY:           gl_topology = GL_LINES_ADJACENCY;          break;
+			case PrimitiveTopologyMask::FORGE_LINE_STRIP_ADJACENCY:     gl_topology = GL_LINE_STRIP_ADJACENCY;     break;
+			case PrimitiveTopologyMask::FORGE_TRIANGLE_ADJACENCY:       gl_topology = GL_TRIANGLES_ADJACENCY;      break;
+			case PrimitiveTopologyMask::FORGE_TRIANGLE_STRIP_ADJACENCY: gl_topology = GL_TRIANGLE_STRIP_ADJACENCY; break;
+			}
+
+			return gl_topology;
+		}
 	}
 }
 
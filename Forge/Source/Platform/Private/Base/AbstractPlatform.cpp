@@ -23,7 +23,11 @@ namespace Forge {
 		{
 			Error(message);
 
+#if defined(FORGE_PLATFORM_WINDOWS)
 			ExitProcess(-1);
+#else
+			exit(-1);
+#endif
 		}
 
 		Void AbstractPlatform::Crash(I32 line, ConstCharPtr file)
@@ -1,4 +1,4 @@
-#include <Platform/Public/Windows/WindowsPlatform.h>
+#include <Platform/Public/Platform.h>
 #include <Platform/Public/Base/AbstractWindow.h>
 
 namespace Forge {
@@ -0,0 +1,392 @@
+#include "Platform/Public/Linux/LinuxPlatform.h"
+
+#if defined(FORGE_PLATFORM_LINUX)
+
+#include <time.h>
+#include <fcntl.h>
+#include <dlfcn.h>
+#include <errno.h>
+#include <spawn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/sysinfo.h>
+#include <sys/wait.h>
+#include <sys/syscall.h>
+
+#if defined(FORGE_CPU_X86)
+	#include <x86intrin.h>
+#endif
+
+namespace Forge {
+	namespace Platform
+	{
+		namespace
+		{
+			/// Reads a small pseudo file such as /proc/self/statm with a single
+			/// read, avoiding the buffering of the standard streams.
+			Size ReadSystemFile(ConstCharPtr filename, CharPtr buffer, Size buffer_size)
+			{
+				I32 file = open(filename, O_RDONLY | O_CLOEXEC);
+
+				if (file < 0)
+					return 0;
+
+				ssize_t length = read(file, buffer, buffer_size - 1);
+
+				close(file);
+
+				if (length < 0)
+					return 0;
+
+				buffer[length] = '\0';
+
+				return static_cast<Size>(length);
+			}
+
+			/// Spawns a process searched in PATH, splitting the arguments at
+			/// blanks outside double quotes. Returns the process id, or -1 if
+			/// the process could not be spawned.
+			pid_t SpawnProcess(ConstCharPtr filename, ConstCharPtr args, ConstCharPtr working_directory)
+			{
+				Size args_length = args ? strlen(args) : 0;
+
+				CharPtr buffer = static_cast<CharPtr>(malloc(args_length + 1));
+				CharPtr* argv = static_cast<CharPtr*>(malloc((args_length / 2 + 3) * sizeof(CharPtr)));
+
+				if (!buffer || !argv)
+				{
+					free(buffer);
+					free(argv);
+
+					return -1;
+				}
+
+				Size argc = 0;
+				argv[argc++] = const_cast<CharPtr>(filename);
+
+				CharPtr write = buffer;
+
+				for (ConstCharPtr read = args; read && *read;)
+				{
+					while (*read == ' ' || *read == '\t')
+						read++;
+
+					if (!*read)
+						break;
+
+					argv[argc++] = write;
+
+					Bool is_quoted = FORGE_FALSE;
+
+					for (; *read && (is_quoted || (*read != ' ' && *read != '\t')); read++)
+						if (*read == '"')
+							is_quoted = !is_quoted;
+						else
+							*write++ = *read;
+
+					*write++ = '\0';
+				}
+
+				argv[argc] = nullptr;
+
+				posix_spawn_file_actions_t file_actions;
+				posix_spawn_file_actions_init(&file_actions);
+
+				if (working_directory)
+					posix_spawn_file_actions_addchdir_np(&file_actions, working_directory);
+
+				pid_t process_id;
+
+				if (posix_spawnp(&process_id, filename, &file_actions, nullptr, argv, environ) != 0)
+					process_id = -1;
+
+				posix_spawn_file_actions_destroy(&file_actions);
+
+				free(buffer);
+				free(argv);
+
+				return process_id;
+			}
+		}
+
+		LinuxPlatform::MemoryStats LinuxPlatform::GetMemoryStats(Void)
+		{
+			MemoryStats memory_stats;
+
+			struct sysinfo system_info;
+
+			if (sysinfo(&system_info) != 0)
+				return memory_stats;
+
+			U64 unit = system_info.mem_unit;
+
+			memory_stats.total_physical_memory = system_info.totalram * unit;
+			memory_stats.used_physical_memory  = (system_info.totalram - system_info.freeram - system_info.bufferram) * unit;
+			memory_stats.total_virtual_memory  = (system_info.totalram + system_info.totalswap) * unit;
+			memory_stats.used_virtual_memory   = memory_stats.used_physical_memory + (system_info.totalswap - system_info.freeswap) * unit;
+
+			return memory_stats;
+		}
+		LinuxPlatform::ProcessMemoryStats LinuxPlatform::GetProcessMemoryStats(Void)
+		{
+			ProcessMemoryStats process_memory_stats;
+
+			Char buffer[128];
+
+			if (!ReadSystemFile("/proc/self/statm", buffer, sizeof(buffer)))
+				return process_memory_stats;
+
+			CharPtr end = nullptr;
+
+			U64 virtual_pages  = strtoull(buffer, &end, 10);
+			U64 resident_pages = strtoull(end, nullptr, 10);
+
+			process_memory_stats.used_virtual_memory  = virtual_pages * GetPageSize();
+			process_memory_stats.used_physical_memory = resident_pages * GetPageSize();
+
+			return process_memory_stats;
+		}
+
+		I32 LinuxPlatform::GetPrimaryMonitorDPI(Void)
+		{
+			return 0;
+		}
+		F32 LinuxPlatform::GetPrimiaryMonitorDPIScale(Void)
+		{
+			return 0;
+		}
+		Vector2 LinuxPlatform::GetPrimaryMonitorSize(Void)
+		{
+			return Vector2();
+		}
+		Vector2 LinuxPlatform::GetVirtualMonitorSize(Void)
+		{
+			return Vector2();
+		}
+
+		U64 LinuxPlatform::GetCurrentThreadID(Void)
+		{
+			return static_cast<U64>(syscall(SYS_gettid));
+		}
+		U64 LinuxPlatform::GetCurrentProcessID(Void)
+		{
+			return static_cast<U64>(getpid());
+		}
+
+		U64 LinuxPlatform::GetSystemTimeCycles(Void)
+		{
+#if defined(FORGE_CPU_X86)
+			return __rdtsc();
+#else
+			struct timespec time;
+			clock_gettime(CLOCK_MONOTONIC_RAW, &time);
+
+			return static_cast<U64>(time.tv_sec) * 1000000000ull + time.tv_nsec;
+#endif
+		}
+		F64 LinuxPlatform::GetSystemTimeSeconds(Void)
+		{
+			struct timespec time;
+			clock_gettime(CLOCK_MONOTONIC, &time);
+
+			return static_cast<F64>(time.tv_sec) + static_cast<F64>(time.tv_nsec) * 1e-9;
+		}
+		Void LinuxPlatform::GetSystemTimeDate(I32& year, I32& month, I32& week,
+											  I32& day, I32& hour, I32& minute, I32& second, I32& millisecond)
+		{
+			struct timespec time;
+			clock_gettime(CLOCK_REALTIME, &time);
+
+			struct tm local_time;
+			localtime_r(&time.tv_sec, &local_time);
+
+			year        = local_time.tm_year + 1900;
+			month       = local_time.tm_mon + 1;
+			week        = local_time.tm_wday;
+			day         = local_time.tm_mday;
+			hour        = local_time.tm_hour;
+			minute      = local_time.tm_min;
+			second      = local_time.tm_sec;
+			millisecond = static_cast<I32>(time.tv_nsec / 1000000);
+		}
+
+		Bool LinuxPlatform::Initialize(VoidPtr handle)
+		{
+			m_instance_handle = handle;
+
+			{
+				m_cpu_info.processor_logical_count   = static_cast<U32>(sysconf(_SC_NPROCESSORS_ONLN));
+				m_cpu_info.processor_core_count      = m_cpu_info.processor_logical_count;
+				m_cpu_info.processor_package_count   = 1;
+				m_cpu_info.processor_l1_cache_size   = static_cast<F32>(sysconf(_SC_LEVEL1_DCACHE_SIZE));
+				m_cpu_info.processor_l2_cache_size   = static_cast<F32>(sysconf(_SC_LEVEL2_CACHE_SIZE));
+				m_cpu_info.processor_l3_cache_size   = static_cast<F32>(sysconf(_SC_LEVEL3_CACHE_SIZE));
+				m_cpu_info.processor_cache_line_size = static_cast<F32>(sysconf(_SC_LEVEL1_DCACHE_LINESIZE));
+
+				Char buffer[64];
+
+				if (ReadSystemFile("/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq", buffer, sizeof(buffer)))
+					m_cpu_info.processor_clock_speed = static_cast<F32>(strtoull(buffer, nullptr, 10)) * 1000.0f;
+			}
+
+			{
+				ConstCharPtr user_name   = getenv("USER");
+				ConstCharPtr locale_name = getenv("LANG");
+
+				m_user_name = (CharPtr)AllocateMemory(256, 8);
+				strncpy(m_user_name, user_name ? user_name : "", 255);
+				m_user_name[255] = '\0';
+
+				m_locale_name = (CharPtr)AllocateMemory(256, 8);
+				strncpy(m_locale_name, locale_name ? locale_name : "C", 255);
+				m_locale_name[255] = '\0';
+
+				m_machine_name = (CharPtr)AllocateMemory(256, 8);
+				if (gethostname(m_machine_name, 256) != 0)
+				{
+					// Fatal("Linux: Failed to get host name");
+
+					return FORGE_FALSE;
+				}
+				m_machine_name[255] = '\0';
+			}
+
+			return FORGE_TRUE;
+		}
+		Bool LinuxPlatform::Terminate(Void)
+		{
+			DeallocateMemory(m_user_name);
+			DeallocateMemory(m_locale_name);
+			DeallocateMemory(m_machine_name);
+
+			return FORGE_TRUE;
+		}
+		Bool LinuxPlatform::PumpMessages(Void)
+		{
+			return FORGE_TRUE;
+		}
+
+		Void LinuxPlatform::PrefetchMemory(VoidPtr address)
+		{
+			__builtin_prefetch(address);
+		}
+		VoidPtr LinuxPlatform::AllocateMemory(Size size, Size alignment)
+		{
+			VoidPtr address = nullptr;
+
+			if (posix_memalign(&address, alignment < sizeof(VoidPtr) ? sizeof(VoidPtr) : alignment, size) != 0)
+				return nullptr;
+
+			return address;
+		}
+		Void LinuxPlatform::DeallocateMemory(VoidPtr address)
+		{
+			free(address);
+		}
+		Size LinuxPlatform::GetPageSize(Void)
+		{
+			static const Size page_size = static_cast<Size>(sysconf(_SC_PAGESIZE));
+
+			return page_size;
+		}
+		VoidPtr LinuxPlatform::AllocatePages(Size count, Size size)
+		{
+			VoidPtr address = mmap(nullptr, count * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+			return address != MAP_FAILED ? address : nullptr;
+		}
+		Void LinuxPlatform::DeallocatePages(VoidPtr address, Size count, Size size)
+		{
+			munmap(address, count * size);
+		}
+		Bool LinuxPlatform::CommitPages(VoidPtr address, Size count, Size size)
+		{
+			/// Physical pages are only assigned on first touch, making the
+			/// range accessible is enough.
+			return mprotect(address, count * size, PROT_READ | PROT_WRITE) == 0;
+		}
+		Void LinuxPlatform::DecommitPages(VoidPtr address, Size count, Size size)
+		{
+			madvise(address, count * size, MADV_DONTNEED);
+			mprotect(address, count * size, PROT_NONE);
+		}
+
+		I32 LinuxPlatform::StartProcess(ConstCharPtr filename, ConstCharPtr args, ConstCharPtr working_directory)
+		{
+			return SpawnProcess(filename, args, working_directory);
+		}
+		I32 LinuxPlatform::ExecuteProcess(ConstCharPtr filename, ConstCharPtr args, ConstCharPtr working_directory)
+		{
+			pid_t process_id = SpawnProcess(filename, args, working_directory);
+
+			if (process_id < 0)
+				return -1;
+
+			I32 status;
+
+			while (waitpid(process_id, &status, 0) < 0)
+				if (errno != EINTR)
+					return -1;
+
+			/// Like a shell, a process killed by a signal reports 128 plus the
+			/// signal number.
+			return WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+		}
+
+		WindowPtr LinuxPlatform::ConstructWindow(WindowDesc& description)
+		{
+			return nullptr;
+		}
+		WindowPtr LinuxPlatform::ConstructWindow(ConstCharPtr title)
+		{
+			return nullptr;
+		}
+		WindowPtr LinuxPlatform::ConstructWindow(ConstCharPtr title, const Vector2& position)
+		{
+			return nullptr;
+		}
+		WindowPtr LinuxPlatform::ConstructWindow(ConstCharPtr title, const Vector2& position, const Vector2& size)
+		{
+			return nullptr;
+		}
+
+		MessageBoxResult LinuxPlatform::ShowMessageBox(WindowPtr parent, ConstCharPtr text, ConstCharPtr caption, MessageBoxButton button, MessageBoxIcon icon)
+		{
+			fprintf(stderr, "[%s] %s\n", caption, text);
+
+			return MessageBoxResult::FORGE_OK;
+		}
+
+		VoidPtr LinuxPlatform::LoadExternalLibrary(ConstCharPtr filename)
+		{
+			return dlopen(filename, RTLD_NOW | RTLD_LOCAL);
+		}
+		Bool LinuxPlatform::FreeExternalLibrary(VoidPtr handle)
+		{
+			return dlclose(handle) == 0;
+		}
+		VoidPtr LinuxPlatform::GetExternalLibrarySymbol(VoidPtr handle, ConstCharPtr symbol)
+		{
+			return dlsym(handle, symbol);
+		}
+
+		Void LinuxPlatform::Sleep(I32 milliseconds)
+		{
+			struct timespec duration;
+
+			milliseconds = milliseconds > 0 ? milliseconds : 0;
+
+			duration.tv_sec  = milliseconds / 1000;
+			duration.tv_nsec = (milliseconds % 1000) * 1000000L;
+
+			/// Signals interrupt the sleep, which resumes with the remaining
+			/// duration.
+			while (nanosleep(&duration, &duration) != 0 && errno == EINTR) {}
+		}
+	}
+}
+
+#endif
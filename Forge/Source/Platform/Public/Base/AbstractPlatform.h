@@ -256,22 +256,22 @@ namespace Forge {
 				/**
 				 * @brief The amount of total physical memory in bytes.
 				 */
-				U32 total_physical_memory = 0;
+				U64 total_physical_memory = 0;
 
 				/**
 				 * @brief The amount of used physical memory in bytes.
 				 */
-				U32 used_physical_memory = 0;
+				U64 used_physical_memory = 0;
 
 				/**
 				 * @brief The amount of total virtual memory in bytes.
 				 */
-				U32 total_virtual_memory = 0;
+				U64 total_virtual_memory = 0;
 
 				/**
 				 * @brief The amount of used virtual memory in bytes.
 				 */
-				U32 used_virtual_memory = 0;
+				U64 used_virtual_memory = 0;
 			};
 
 			struct ProcessMemoryStats
@@ -279,12 +279,12 @@ namespace Forge {
 				/**
 				 * @brief The amount of used physical memory in bytes.
 				 */
-				U32 used_physical_memory = 0;
+				U64 used_physical_memory = 0;
 
 				/**
 				 * @brief The amount of used virtual memory in bytes.
 				 */
-				U32 used_virtual_memory = 0;
+				U64 used_virtual_memory = 0;
 			};
 		
 		protected:
@@ -696,27 +696,63 @@ namespace Forge {
 			virtual Void DeallocateMemory(VoidPtr address) = 0;
 
 			/**
-			 * @brief Allocates a number of pages with a specified size.
+			 * @brief Gets the size of a virtual memory page.
 			 *
-			 * This function allocates pages on the virtual memory using the
-			 * platform dependant allocation routine.
+			 * @returns Size storing the page size in bytes.
+			 */
+			virtual Size GetPageSize(Void) = 0;
+
+			/**
+			 * @brief Reserves a number of pages with a specified size.
 			 *
-			 * @param count The number of pages to allocate.
-			 * @param size The size of the allocated page in bytes.
+			 * This function reserves a range of the virtual address space using
+			 * the platform dependant allocation routine. Reserved pages are not
+			 * backed by physical memory and must be committed before access.
 			 *
-			 * @returns VoidPtr storing the address of the allocated pages.
+			 * @param count The number of pages to reserve.
+			 * @param size The size of the reserved page in bytes, must be a
+			 * multiple of the page size.
+			 *
+			 * @returns VoidPtr storing the address of the reserved pages, or
+			 * nullptr if the address space is exhausted.
 			 */
 			virtual VoidPtr AllocatePages(Size count, Size size) = 0;
 
 			/**
-			 * @brief Deallocates a block of allocated pages.
+			 * @brief Releases a block of reserved pages.
 			 *
-			 * This function deallocates pages on the virtual memory segment using
-			 * the platform dependant deallocation routine.
+			 * This function releases pages on the virtual address space using the
+			 * platform dependant deallocation routine, committed pages within the
+			 * range are decommitted as well.
 			 * 
-			 * @param address The address of the allocated pages.
+			 * @param address The address of the reserved pages.
+			 * @param count The number of pages to release.
+			 * @param size The size of the released page in bytes.
+			 */
+			virtual Void DeallocatePages(VoidPtr address, Size count, Size size) = 0;
+
+			/**
+			 * @brief Backs a number of reserved pages with physical memory.
+			 *
+			 * Committed pages are readable, writable and initially zeroed.
+			 *
+			 * @param address The page aligned address of the pages to commit.
+			 * @param count The number of pages to commit.
+			 * @param size The size of the committed page in bytes.
+			 *
+			 * @returns Bool true if the pages were committed successfully.
+			 */
+			virtual Bool CommitPages(VoidPtr address, Size count, Size size) = 0;
+
+			/**
+			 * @brief Returns the physical memory backing a number of committed
+			 * pages to the system, keeping their address range reserved.
+			 *
+			 * @param address The page aligned address of the pages to decommit.
+			 * @param count The number of pages to decommit.
+			 * @param size The size of the decommitted page in bytes.
 			 */
-			virtual Void DeallocatePages(VoidPtr address) = 0;
+			virtual Void DecommitPages(VoidPtr address, Size count, Size size) = 0;
 			
 		public:
 			/**
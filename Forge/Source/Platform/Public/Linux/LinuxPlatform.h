@@ -0,0 +1,368 @@
+#ifndef LINUX_PLATFORM_H
+#define LINUX_PLATFORM_H
+
+#include <Platform/Public/Base/AbstractPlatform.h>
+
+#if defined(FORGE_PLATFORM_LINUX)
+
+namespace Forge {
+	namespace Platform
+	{
+		/**
+		 * @brief Linux runtime platform service implemenation.
+		 * 
+		 * Timing, memory and library routines map directly onto POSIX and
+		 * Linux system calls. Windowing is not supported, the window
+		 * construction functions return nullptr and message boxes are
+		 * printed to the standard error stream.
+		 * 
+		 * @author Karim Hisham.
+		 */
+		class FORGE_API LinuxPlatform : public AbstractPlatform, public TSingleton<LinuxPlatform>
+		{
+		FORGE_CLASS_SINGLETON(LinuxPlatform)
+
+		public:
+			/**
+			 * @brief Gets the system memory statistics.
+			 *
+			 * @returns MemoryStats storing memory statistics.
+			 */
+			MemoryStats GetMemoryStats(Void) override;
+
+			/**
+			 * @brief Gets the current process memory statistics.
+			 *
+			 * @returns ProcessMemoryStats storing memory statistics.
+			 */
+			ProcessMemoryStats GetProcessMemoryStats(Void) override;
+
+		public:
+			/**
+			 * @brief Gets the DPI of the primary display monitor.
+			 *
+			 * @returns I32 storing the DPI of the primary display monitor.
+			 */
+			I32 GetPrimaryMonitorDPI(Void) override;
+
+			/**
+			 * @brief Gets the size of the primary display monitor in pixels.
+			 *
+			 * @returns Vector2 storing the size of the primary display monitor.
+			 */
+			F32 GetPrimiaryMonitorDPIScale(Void) override;
+
+			/**
+			 * @brief Gets the size of the primary display monitor in pixels.
+			 *
+			 * @returns Vector2 storing the size of the primary display monitor.
+			 */
+			Vector2 GetPrimaryMonitorSize(Void) override;
+
+			/**
+			 * @brief Gets the virtual size of all display monitors output
+			 * attached.
+			 *
+			 * @returns Vector2 storing the size of all display monitors.
+			 */
+			Vector2 GetVirtualMonitorSize(Void) override;
+
+		public:
+			/**
+			 * @brief Gets the current thread unique identifier.
+			 *
+			 * @returns U64 storing the thread unique identifier.
+			 */
+			U64 GetCurrentThreadID(Void) override;
+
+			/**
+			 * @brief Gets the current process unique identifier.
+			 *
+			 * @returns U64 storing the process unique identifier.
+			 */
+			U64 GetCurrentProcessID(Void) override;
+
+		public:
+			/**
+			 * @brief Gets the current time as CPU cycles counter.
+			 *
+			 * @returns U64 storing the CPU cycles counter value.
+			 */
+			U64 GetSystemTimeCycles(Void) override;
+
+			/**
+			 * @brief Gets the current time in seconds.
+			 *
+			 * @returns U64 storing the time in seconds.
+			 */
+			F64 GetSystemTimeSeconds(Void) override;
+
+			/**
+			 * @brief Gets the current system time based on the computer
+			 * settings.
+			 *
+			 * @param year The result year value.
+			 * @param month The result month value.
+			 * @param week The result week value.
+			 * @param day The result day value.
+			 * @param hour The result hour value.
+			 * @param minute The result minute value.
+			 * @param second The result second value.
+			 * @param millisecond The result millisecond value.
+			 */
+			Void GetSystemTimeDate(I32& year, I32& month, I32& week, 
+								   I32& day, I32& hour, I32& minute, 
+								   I32& second, I32& millisecond) override;
+
+		public:
+			/**
+			 * @brief Initializes the runtime platform service.
+			 *
+			 * This function should be called at the very start of the engine start up.
+			 *
+			 * @param handle The handle of the process if required by the platfrom
+			 * service.
+			 *
+			 * @returns True if platform initialization was succesful, otherwise false.
+			 */
+			Bool Initialize(VoidPtr handle) override;
+
+			/**
+			 * @brief Terminates the runtime platform service.
+			 *
+			 * This function should be called at the very end of the engine shut down.
+			 *
+			 * @returns True if platform termination was succesful, otherwise false.
+			 */
+			Bool Terminate(Void) override;
+
+			/**
+			 * @brief Retrieves messages from the platform message queue and
+			 * dispatches them to the window associated with the current thread.
+			 *
+			 * In order to recieve system and input events this function should
+			 * be called inside the engine main loop.
+			 */
+			Bool PumpMessages(Void) override;
+
+		public:
+			/**
+			 * @brief Indicates to the processor that a cache line will be needed
+			 * in the near future..
+			 *
+			 * @param address The address of the cache line to be loaded.
+			 */
+			Void PrefetchMemory(VoidPtr address) override;
+
+			/**
+			 * @brief Allocates a block of memory with a specified alignment
+			 * boundry.
+			 *
+			 * This function allocates memory on the heap memory segment using the
+			 * platform dependant allocation routine.
+			 *
+			 * @param size The number of bytes to allocate.
+			 * @param alignment The alignment boundry of the allocated memory block.
+			 *
+			 * @returns VoidPtr storing the address of the allocated memory block.
+			 */
+			VoidPtr AllocateMemory(Size size, Size alignment) override;
+
+			/**
+			 * @brief Deallocates a block of allocated memory.
+			 *
+			 * This function deallocates memory on the heap memory segment using
+			 * the platform dependant deallocation routine.
+			 *
+			 * @param address The address of the allocated memory block.
+			 */
+			Void DeallocateMemory(VoidPtr address) override;
+
+			/**
+			 * @brief Gets the size of a virtual memory page.
+			 *
+			 * @returns Size storing the page size in bytes.
+			 */
+			Size GetPageSize(Void) override;
+
+			/**
+			 * @brief Reserves a number of pages with a specified size.
+			 *
+			 * This function reserves a range of the virtual address space using
+			 * an inaccessible anonymous mapping.
+			 *
+			 * @param count The number of pages to reserve.
+			 * @param size The size of the reserved page in bytes.
+			 *
+			 * @returns VoidPtr storing the address of the reserved pages.
+			 */
+			VoidPtr AllocatePages(Size count, Size size) override;
+
+			/**
+			 * @brief Releases a block of reserved pages.
+			 *
+			 * @param address The address of the reserved pages.
+			 * @param count The number of pages to release.
+			 * @param size The size of the released page in bytes.
+			 */
+			Void DeallocatePages(VoidPtr address, Size count, Size size) override;
+
+			/**
+			 * @brief Backs a number of reserved pages with physical memory.
+			 *
+			 * @param address The page aligned address of the pages to commit.
+			 * @param count The number of pages to commit.
+			 * @param size The size of the committed page in bytes.
+			 *
+			 * @returns Bool true if the pages were committed successfully.
+			 */
+			Bool CommitPages(VoidPtr address, Size count, Size size) override;
+
+			/**
+			 * @brief Returns the physical memory backing a number of committed
+			 * pages to the system.
+			 *
+			 * @param address The page aligned address of the pages to decommit.
+			 * @param count The number of pages to decommit.
+			 * @param size The size of the decommitted page in bytes.
+			 */
+			Void DecommitPages(VoidPtr address, Size count, Size size) override;
+
+		public:
+			/**
+			 * @brief Creates a new process that runs simultaneously with the
+			 * current process.
+			 *
+			 * @param filename The filename of the process to create.
+			 * @param args The command line arguments of the process to create.
+			 * @param working_directory The working directory of the process,
+			 * or nullptr to inherit the current one.
+			 *
+			 * @returns I32 storing the id of the created process, or -1 if it
+			 * could not be created. The process must be waited for with
+			 * waitpid to be reaped.
+			 */
+			I32 StartProcess(ConstCharPtr filename, ConstCharPtr args, ConstCharPtr working_directory) override;
+
+			/**
+			 * @brief Executes a new process that blocks execution of the current
+			 * process until it finishes.
+			 *
+			 * @param filename The filename of the process to create.
+			 * @param args The command line arguments of the process to create.
+			 * @param working_directory The working directory of the process,
+			 * or nullptr to inherit the current one.
+			 *
+			 * @returns I32 storing the exit status of the created process, 128
+			 * plus the signal number if a signal killed it, or -1 if it could
+			 * not be created.
+			 */
+			I32 ExecuteProcess(ConstCharPtr filename, ConstCharPtr args, ConstCharPtr working_directory) override;
+
+		public:
+			/**
+			 * @brief Creates a platform native window object.
+			 *
+			 * @param description The window description.
+			 *
+			 * @returns WindowPtr storing the address of the created window.
+			 */
+			WindowPtr ConstructWindow(WindowDesc& description) override;
+
+			/**
+			 * @brief Creates a platform native window object.
+			 *
+			 * @param title The window title.
+			 *
+			 * @returns WindowPtr storing the address of the created window.
+			 */
+			WindowPtr ConstructWindow(ConstCharPtr title) override;
+
+			/**
+			 * @brief Creates a platform native window object.
+			 *
+			 * @param title The window title.
+			 * @param position The window position.
+			 *
+			 * @returns WindowPtr storing the address of the created window.
+			 */
+			WindowPtr ConstructWindow(ConstCharPtr title, const Vector2& position) override;
+
+			/**
+			 * @brief Creates a platform native window object.
+			 *
+			 * @param title The window title.
+			 * @param position The window position.
+			 * @param size The window size.
+			 *
+			 * @returns WindowPtr storing the address of the created window.
+			 */
+			WindowPtr ConstructWindow(ConstCharPtr title, const Vector2& position, const Vector2& size) override;
+
+		public:
+			/**
+			 * @brief Displays a message box with a specified text, caption,
+			 * buttons and icon.
+			 *
+			 * @param parent The parent window to the message box.
+			 * @param text The text to display in the message box.
+			 * @param caption The caption to display in the message box.
+			 * @param button The button to display in the message box.
+			 * @param icon The icon to display in the message box.
+			 *
+			 * @returns MessageBoxResult storing the message box dialog result.
+			 */
+			MessageBoxResult ShowMessageBox(WindowPtr parent, ConstCharPtr text, ConstCharPtr caption, MessageBoxButton button, MessageBoxIcon icon) override;
+
+		public:
+			/**
+			 * @brief Loads the specified library into the address space of the
+			 * process.
+			 *
+			 * @param filename The filename of the library.
+			 *
+			 * @returns VoidPtr storing the handle of the loaded library.
+			 */
+			VoidPtr LoadExternalLibrary(ConstCharPtr filename) override;
+
+			/**
+			 * @brief Frees the specified library from the address space of the
+			 * process.
+			 *
+			 * @param handle The handle of the library.
+			 *
+			 * @returns True if freeing was succesful, otherwise false.
+			 */
+		    Bool FreeExternalLibrary(VoidPtr handle) override;
+
+			/**
+			 * @brief Gets the specified symbol from loaded library.
+			 *
+			 * A symbol may be an external function or variable.
+			 *
+			 * @param handle The handle of the library.
+			 * @param symbol The symbol to retreive from the library.
+			 *
+			 * @returns VoidPtr storing the address of the symbol.
+			 */
+			VoidPtr GetExternalLibrarySymbol(VoidPtr handle, ConstCharPtr symbol) override;
+
+		public:
+			/**
+			 * @brief Suspends the execution of the current thread, until the time
+			 * out interval elapses.
+			 *
+			 * @param milliseconds The time interval for which execution is
+			 * suspended, in milliseconds, negative intervals do not suspend.
+			 */
+			Void Sleep(I32 milliseconds) override;
+		};
+
+		using Platform = LinuxPlatform;
+		FORGE_TYPEDEF_DECL(Platform)
+	}
+}
+
+#endif
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef LINUX_WINDOW_H
+#define LINUX_WINDOW_H
+
+#include "Platform/Public/Base/AbstractWindow.h"
+
+#if defined(FORGE_PLATFORM_LINUX)
+
+namespace Forge {
+	namespace Platform
+	{
+		/**
+		 * Linux builds are headless for now, there is no native window
+		 * implementation and the platform never constructs windows.
+		 */
+		using Window = AbstractWindow;
+		FORGE_TYPEDEF_DECL(Window)
+	}
+}
+
+#endif
+
+#endif
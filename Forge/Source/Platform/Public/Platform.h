@@ -5,6 +5,8 @@
 
 #if defined(FORGE_PLATFORM_WINDOWS)
 		#include "Windows/WindowsPlatform.h"
+#elif defined(FORGE_PLATFORM_LINUX)
+		#include "Linux/LinuxPlatform.h"
 #endif
 
 #endif
@@ -5,6 +5,8 @@
 
 #if defined(FORGE_PLATFORM_WINDOWS)
 		#include "Windows/WindowsWindow.h"
+#elif defined(FORGE_PLATFORM_LINUX)
+		#include "Linux/LinuxWindow.h"
 #endif
 
 #endif
@@ -179,27 +179,54 @@ namespace Forge {
 			Void DeallocateMemory(VoidPtr address) override;
 
 			/**
-			 * @brief Allocates a number of pages with a specified size.
+			 * @brief Gets the size of a virtual memory page.
 			 *
-			 * This function allocates pages on the memory using the
-			 * platform dependant allocation routine.
+			 * @returns Size storing the page size in bytes.
+			 */
+			Size GetPageSize(Void) override;
+
+			/**
+			 * @brief Reserves a number of pages with a specified size.
 			 *
-			 * @param count The number of pages to allocate.
-			 * @param size The size of the allocated page in bytes.
+			 * This function reserves a range of the virtual address space using
+			 * VirtualAlloc without committing it.
 			 *
-			 * @returns VoidPtr storing the address of the allocated pages.
+			 * @param count The number of pages to reserve.
+			 * @param size The size of the reserved page in bytes.
+			 *
+			 * @returns VoidPtr storing the address of the reserved pages.
 			 */
 			VoidPtr AllocatePages(Size count, Size size) override;
 
 			/**
-			 * @brief Deallocates a block of allocated pages.
+			 * @brief Releases a block of reserved pages.
 			 *
-			 * This function deallocates pages on the memory segment using
-			 * the platform dependant deallocation routine.
+			 * @param address The address of the reserved pages.
+			 * @param count The number of pages to release.
+			 * @param size The size of the released page in bytes.
+			 */
+			Void DeallocatePages(VoidPtr address, Size count, Size size) override;
+
+			/**
+			 * @brief Backs a number of reserved pages with physical memory.
+			 *
+			 * @param address The page aligned address of the pages to commit.
+			 * @param count The number of pages to commit.
+			 * @param size The size of the committed page in bytes.
+			 *
+			 * @returns Bool true if the pages were committed successfully.
+			 */
+			Bool CommitPages(VoidPtr address, Size count, Size size) override;
+
+			/**
+			 * @brief Returns the physical memory backing a number of committed
+			 * pages to the system.
 			 *
-			 * @param address The address of the allocated pages.
+			 * @param address The page aligned address of the pages to decommit.
+			 * @param count The number of pages to decommit.
+			 * @param size The size of the decommitted page in bytes.
 			 */
-			Void DeallocatePages(VoidPtr address) override;
+			Void DecommitPages(VoidPtr address, Size count, Size size) override;
 
 		public:
 			/**
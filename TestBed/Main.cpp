@@ -1,12 +1,66 @@
 #include <gtest/gtest.h>
 
+#include "Source/Core/Algorithm/XXH3HashTest.h"
+#include "Source/Core/Algorithm/XXH3HashBenchmark.h"
+#include "Source/Core/Algorithm/ConstStringHashTest.h"
+
 #include "Source/Core/Common/TDelegateTest.h"
+#include "Source/Core/Common/TDelegateBenchmark.h"
+#include "Source/Core/Common/TFunctionRefTest.h"
+#include "Source/Core/Common/TMulticastDelegateTest.h"
+#include "Source/Core/Common/EventBusTest.h"
+#include "Source/Core/Common/EventBusBenchmark.h"
+
+#include "Source/Core/Debug/ProfilerTest.h"
 
 #include "Source/Core/Containers/TLinkedListTest.h"
 #include "Source/Core/Containers/TStaticArrayTest.h"
 #include "Source/Core/Containers/TDynamicStackTest.h"
 #include "Source/Core/Containers/TDynamicQueueTest.h"
 #include "Source/Core/Containers/TDynamicArrayTest.h"
+#include "Source/Core/Containers/THashMapTest.h"
+#include "Source/Core/Containers/THashSetTest.h"
+#include "Source/Core/Containers/THashMapBenchmark.h"
+#include "Source/Core/Containers/ContainerBenchmark.h"
+#include "Source/Core/Containers/TDynamicArrayGrowthBenchmark.h"
+
+#include "Source/Core/Memory/ConcurrentPoolAllocatorTest.h"
+#include "Source/Core/Memory/ConcurrentPoolAllocatorBenchmark.h"
+#include "Source/Core/Memory/FrameAllocatorTest.h"
+#include "Source/Core/Memory/FreeListAllocatorTest.h"
+#include "Source/Core/Memory/FreeListAllocatorBenchmark.h"
+#include "Source/Core/Memory/LinearAllocatorTest.h"
+#include "Source/Core/Memory/ThreadCachingAllocatorTest.h"
+#include "Source/Core/Memory/ThreadCachingAllocatorBenchmark.h"
+
+#include "Source/Core/RTTI/TypeInfoTest.h"
+#include "Source/Core/RTTI/TypeInfoBenchmark.h"
+#include "Source/Core/RTTI/ObjectTest.h"
+#include "Source/Core/RTTI/RefCountedTest.h"
+#include "Source/Core/RTTI/RefCountedBenchmark.h"
+
+#include "Source/Core/Threading/JobSystemTest.h"
+#include "Source/Core/Threading/JobSystemBenchmark.h"
+
+#include "Source/Core/Types/StringTest.h"
+#include "Source/Core/Types/StringViewTest.h"
+#include "Source/Core/Types/StringBuilderTest.h"
+#include "Source/Core/Types/StringBenchmark.h"
+#include "Source/Core/Types/SmartPointerTest.h"
+#include "Source/Core/Types/SmartPointerBenchmark.h"
+
+#include "Source/GraphicsDevice/CommandBufferTest.h"
+#include "Source/GraphicsDevice/CommandBufferBenchmark.h"
+#include "Source/GraphicsDevice/DrawQueueTest.h"
+#include "Source/GraphicsDevice/DrawQueueBenchmark.h"
+#include "Source/GraphicsDevice/NullBackendTest.h"
+#include "Source/GraphicsDevice/NullBackendBenchmark.h"
+#include "Source/GraphicsDevice/PipelineStateTest.h"
+#include "Source/GraphicsDevice/PipelineStateBenchmark.h"
+#include "Source/GraphicsDevice/StreamingBufferRingTest.h"
+#include "Source/GraphicsDevice/StreamingBufferRingBenchmark.h"
+
+#include "Source/Platform/LinuxPlatformTest.h"
 
 int main(int argc, char** args)
 {
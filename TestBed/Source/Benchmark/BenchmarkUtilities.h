@@ -0,0 +1,216 @@
+#ifndef BENCHMARK_UTILITIES_H
+#define BENCHMARK_UTILITIES_H
+
+#include <ctime>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+/**
+ * Benchmarks are registered as disabled tests so they never slow down the
+ * regular test run. Run them explicitly with:
+ *
+ *   TestBed --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+ *
+ * Every recorded measurement is also collected into a JSON report written
+ * when the process exits, to BenchmarkResults.json or to the path stored in
+ * the FORGE_BENCHMARK_OUTPUT environment variable. The optional
+ * FORGE_BENCHMARK_REVISION variable is copied into the report so results
+ * can be tracked across commits.
+ */
+namespace BenchmarkUtilities
+{
+	/**
+	 * Collects measurements and writes them as a JSON document once all
+	 * benchmarks finished running.
+	 */
+	class JsonReport
+	{
+	private:
+		struct Measurement
+		{
+			std::string suite;
+			std::string test;
+			std::string name;
+			std::string unit;
+			double value;
+		};
+
+	private:
+		std::vector<Measurement> m_measurements;
+
+	private:
+		JsonReport() = default;
+
+	public:
+		~JsonReport()
+		{
+			if (!m_measurements.empty())
+				Write(GetEnvironment("FORGE_BENCHMARK_OUTPUT", "BenchmarkResults.json"));
+		}
+
+	private:
+		static const char* GetEnvironment(const char* name, const char* fallback)
+		{
+			const char* value = std::getenv(name);
+			return value && *value ? value : fallback;
+		}
+
+		static void WriteString(FILE* file, const std::string& string)
+		{
+			std::fputc('"', file);
+
+			for (char c : string)
+			{
+				if (c == '"' || c == '\\')
+					std::fprintf(file, "\\%c", c);
+				else if (static_cast<unsigned char>(c) < 0x20)
+					std::fprintf(file, "\\u%04x", c);
+				else
+					std::fputc(c, file);
+			}
+
+			std::fputc('"', file);
+		}
+
+	public:
+		static JsonReport& GetInstance()
+		{
+			static JsonReport report;
+			return report;
+		}
+
+	public:
+		void Add(const std::string& name, double value, const char* unit)
+		{
+			const ::testing::TestInfo* info = ::testing::UnitTest::GetInstance()->current_test_info();
+
+			m_measurements.push_back({ info ? info->test_case_name() : "", info ? info->name() : "", name, unit, value });
+		}
+
+		bool Write(const std::string& path) const
+		{
+			FILE* file = std::fopen(path.c_str(), "w");
+
+			if (!file)
+				return false;
+
+			std::fprintf(file, "{\n  \"revision\": ");
+			WriteString(file, GetEnvironment("FORGE_BENCHMARK_REVISION", ""));
+			std::fprintf(file, ",\n  \"timestamp\": %lld,\n", static_cast<long long>(std::time(nullptr)));
+#if defined(NDEBUG)
+			std::fprintf(file, "  \"configuration\": \"Release\",\n");
+#else
+			std::fprintf(file, "  \"configuration\": \"Debug\",\n");
+#endif
+			std::fprintf(file, "  \"measurements\": [");
+
+			for (size_t i = 0; i < m_measurements.size(); i++)
+			{
+				const Measurement& measurement = m_measurements[i];
+
+				std::fprintf(file, "%s\n    { \"suite\": ", i ? "," : "");
+				WriteString(file, measurement.suite);
+				std::fprintf(file, ", \"test\": ");
+				WriteString(file, measurement.test);
+				std::fprintf(file, ", \"name\": ");
+				WriteString(file, measurement.name);
+				std::fprintf(file, ", \"value\": %.4f, \"unit\": ", measurement.value);
+				WriteString(file, measurement.unit);
+				std::fprintf(file, " }");
+			}
+
+			std::fprintf(file, "\n  ]\n}\n");
+
+			return std::fclose(file) == 0;
+		}
+	};
+
+	/**
+	 * Measures the wall-clock time taken by a callable in nanoseconds.
+	 */
+	template<typename InCallable>
+	double MeasureNanoseconds(InCallable&& callable)
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		callable();
+
+		auto end = std::chrono::steady_clock::now();
+
+		return std::chrono::duration<double, std::nano>(end - start).count();
+	}
+
+	/**
+	 * Runs a callable on every thread, passing it the index of the thread,
+	 * and measures the wall-clock time until all of them finished in
+	 * nanoseconds.
+	 */
+	template<typename InCallable>
+	double MeasureThreadedNanoseconds(int thread_count, InCallable&& callable)
+	{
+		std::vector<std::thread> threads;
+
+		return MeasureNanoseconds([&]()
+		{
+			for (int t = 0; t < thread_count; t++)
+				threads.emplace_back(callable, t);
+
+			for (std::thread& thread : threads)
+				thread.join();
+		});
+	}
+
+	/**
+	 * Allocator guarded by a single mutex, the baseline every thread of a
+	 * contention benchmark contends on.
+	 */
+	template<typename InAllocator>
+	class LockedAllocator
+	{
+	private:
+		std::mutex m_mutex;
+		InAllocator m_allocator;
+
+	public:
+		template<typename... InArgs>
+		LockedAllocator(InArgs&&... args)
+			: m_allocator(std::forward<InArgs>(args)...) {}
+
+	public:
+		void* Allocate(size_t size)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_allocator.Allocate(size);
+		}
+
+		void Deallocate(void* address)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_allocator.Deallocate(address);
+		}
+	};
+
+	/**
+	 * Prints a measurement and records it as a property of the running test,
+	 * so it is also written to the report produced by --gtest_output, and to
+	 * the JSON benchmark report.
+	 */
+	inline void RecordMeasurement(const std::string& name, double value, const char* unit)
+	{
+		std::printf("[ BENCHMARK] %-56s %14.2f %s\n", name.c_str(), value, unit);
+
+		::testing::Test::RecordProperty(name, std::to_string(value));
+
+		JsonReport::GetInstance().Add(name, value, unit);
+	}
+}
+
+#endif
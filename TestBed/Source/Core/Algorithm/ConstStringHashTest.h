@@ -0,0 +1,81 @@
+#ifndef CONST_STRING_HASH_TEST_H
+#define CONST_STRING_HASH_TEST_H
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Algorithm/Hash/ConstStringHash.h"
+#include "Core/Public/Algorithm/Hash/FNV1aHash.h"
+#include "Core/Public/Containers/THashMap.h"
+
+using namespace Forge::Algorithms;
+
+namespace ConstStringHashTest
+{
+	/**
+	 * Tests that hashes of literals are constant expressions matching the
+	 * reference FNV-1a digests.
+	 */
+	TEST(ConstStringHashTest, CompileTime)
+	{
+		constexpr ConstStringHash empty("");
+		constexpr ConstStringHash a("a");
+		constexpr ConstStringHash foobar("foobar");
+
+		static_assert(empty.GetValue() == 0xCBF29CE484222325ULL, "FNV-1a digest of an empty string");
+		static_assert(a.GetValue() == 0xAF63DC4C8601EC8CULL, "FNV-1a digest of \"a\"");
+		static_assert(foobar.GetValue() == 0x85944171F73967E8ULL, "FNV-1a digest of \"foobar\"");
+		static_assert(ConstStringHash("foobar") == ConstStringHash("foobarbaz", 6), "Hash of a prefix");
+
+		EXPECT_EQ(ConstStringHash().GetValue(), 0);
+	}
+
+	/**
+	 * Tests that hashes computed at run time match the compile time ones
+	 * and FNV1aHash.
+	 */
+	TEST(ConstStringHashTest, RunTime)
+	{
+		std::string name = "Textures/Stone.dds";
+
+		ConstStringHash hash(name.c_str());
+
+		EXPECT_EQ(hash, ConstStringHash("Textures/Stone.dds"));
+		EXPECT_EQ(hash.GetValue(), FNV1aHash::Hash(name.data(), name.size()));
+		EXPECT_NE(hash, ConstStringHash("Textures/Stone.png"));
+	}
+
+	/**
+	 * Tests hashes as keys of a hash map.
+	 */
+	TEST(ConstStringHashTest, HashMapKey)
+	{
+		Forge::Containers::THashMap<ConstStringHash, int> events;
+
+		events.Insert(ConstStringHash("OnLoad"), 1);
+		events.Insert(ConstStringHash("OnUnload"), 2);
+
+		EXPECT_EQ(*events.Find(ConstStringHash("OnLoad")), 1);
+		EXPECT_EQ(*events.Find(ConstStringHash("OnUnload")), 2);
+		EXPECT_EQ(events.Find(ConstStringHash("OnSave")), nullptr);
+	}
+
+	/**
+	 * Tests that the registry accepts the same string twice and, in debug
+	 * builds, rejects a different string with the same hash.
+	 */
+	TEST(ConstStringHashTest, Register)
+	{
+		ConstStringHash hash("ConstStringHashTest.Register");
+
+		EXPECT_EQ(ConstStringHash::Register(hash, "ConstStringHashTest.Register"), true);
+		EXPECT_EQ(ConstStringHash::Register(hash, "ConstStringHashTest.Register"), true);
+
+#if defined(FORGE_BUILD_DEBUG)
+		EXPECT_EQ(ConstStringHash::Register(hash, "ConstStringHashTest.Collision"), false);
+#endif
+	}
+}
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef XXH3_HASH_BENCHMARK_H
+#define XXH3_HASH_BENCHMARK_H
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+
+#include <gtest/gtest.h>
+
+#include "Source/Benchmark/BenchmarkUtilities.h"
+
+#include "Core/Public/Algorithm/Hash/XXH3Hash.h"
+#include "Core/Public/Algorithm/Hash/FNV1aHash.h"
+
+using namespace Forge::Algorithms;
+
+/**
+ * Measures hashing throughput in GB/s for input sizes from 16 bytes to
+ * 16 MiB. Every size hashes roughly the same total number of bytes, so
+ * small sizes measure per-call latency and large sizes measure the bulk
+ * stripe loop.
+ */
+namespace XXH3HashBenchmark
+{
+	namespace Internal
+	{
+		const size_t s_sizes[] = { 16, 64, 256, 1024, 4096, 64 * 1024, 1024 * 1024, 16 * 1024 * 1024 };
+
+		const size_t BYTES_PER_SIZE = size_t(256) * 1024 * 1024;
+
+		template<typename InCallable>
+		void Run(const char* name, InCallable&& hash, size_t max_size = ~size_t(0))
+		{
+			std::vector<unsigned char> buffer(s_sizes[sizeof(s_sizes) / sizeof(s_sizes[0]) - 1]);
+
+			for (size_t i = 0; i < buffer.size(); i++)
+				buffer[i] = static_cast<unsigned char>(i * 2654435761U >> 24);
+
+			for (size_t size : s_sizes)
+			{
+				if (size > max_size)
+					break;
+
+				size_t repetitions = BYTES_PER_SIZE / size;
+				volatile unsigned long long sink = 0;
+
+				double elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+				{
+					for (size_t i = 0; i < repetitions; i++)
+						sink = sink + hash(buffer.data(), size, i);
+				});
+
+				char measurement[64];
+				std::snprintf(measurement, sizeof(measurement), "%s/%zuB", name, size);
+
+				BenchmarkUtilities::RecordMeasurement(measurement, static_cast<double>(size) * repetitions / elapsed, "GB/s");
+			}
+		}
+	}
+
+	/**
+	 * Measures the one-shot 64-bit XXH3 hash.
+	 */
+	TEST(XXH3HashBenchmark, DISABLED_XXH3Hash64)
+	{
+		Internal::Run("XXH3Hash", [](const unsigned char* data, size_t size, size_t seed)
+		{
+			return XXH3Hash::Hash(data, size, seed);
+		});
+	}
+
+	/**
+	 * Measures the one-shot 128-bit XXH3 hash.
+	 */
+	TEST(XXH3HashBenchmark, DISABLED_XXH3Hash128)
+	{
+		Internal::Run("XXH3Hash128", [](const unsigned char* data, size_t size, size_t seed)
+		{
+			return XXH3Hash128::Hash(data, size, seed).GetLow();
+		});
+	}
+
+	/**
+	 * Measures the streaming 64-bit XXH3 hash fed in 4 KiB chunks.
+	 */
+	TEST(XXH3HashBenchmark, DISABLED_XXH3HashStreaming)
+	{
+		XXH3Hash hash;
+
+		Internal::Run("XXH3Hash/Streaming", [&](const unsigned char* data, size_t size, size_t seed)
+		{
+			hash.Reset(seed);
+
+			for (size_t offset = 0; offset < size; offset += 4096)
+				hash.Update(data + offset, size - offset < 4096 ? size - offset : 4096);
+
+			return hash.Finalize().GetLow();
+		});
+	}
+
+	/**
+	 * Measures FNV-1a for comparison, limited to 64 KiB inputs as it
+	 * processes a single byte per step.
+	 */
+	TEST(XXH3HashBenchmark, DISABLED_FNV1aHash)
+	{
+		Internal::Run("FNV1aHash", [](const unsigned char* data, size_t size, size_t seed)
+		{
+			return FNV1aHash::Hash(data, size, seed);
+		}, 64 * 1024);
+	}
+}
+
+#endif // XXH3_HASH_BENCHMARK_H
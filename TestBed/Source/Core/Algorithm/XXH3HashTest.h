@@ -0,0 +1,167 @@
+#ifndef XXH3_HASH_TEST_H
+#define XXH3_HASH_TEST_H
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Algorithm/Hash/XXH3Hash.h"
+#include "Core/Public/Algorithm/Hash/FNV1aHash.h"
+
+using namespace Forge::Algorithms;
+
+namespace XXH3HashTest
+{
+	struct Vector
+	{
+		size_t size;
+		unsigned long long seed;
+		unsigned long long hash64;
+		unsigned long long hash128_low;
+		unsigned long long hash128_high;
+	};
+
+	/**
+	 * Reference digests produced by the xxHash 0.8 library over the sanity
+	 * buffer below, covering every size class of the algorithm.
+	 */
+	const Vector s_vectors[] =
+	{
+		{    0, 0x0000000000000000ULL, 0x2D06800538D394C2ULL, 0x6001C324468D497FULL, 0x99AA06D3014798D8ULL },
+		{    1, 0x0000000000000000ULL, 0xC44BDFF4074EECDBULL, 0xC44BDFF4074EECDBULL, 0xA6CD5E9392000F6AULL },
+		{    3, 0x0000000000000000ULL, 0x54247382A8D6B94DULL, 0x54247382A8D6B94DULL, 0x20EFC49FF02422EAULL },
+		{    4, 0x0000000000000000ULL, 0xE5DC74BC51848A51ULL, 0x2E7D8D6876A39FE9ULL, 0x970D585AC632BF8EULL },
+		{    8, 0x0000000000000000ULL, 0x24CCC9ACAA9F65E4ULL, 0x64C69CAB4BB21DC5ULL, 0x47A7F080D82BB456ULL },
+		{    9, 0x0000000000000000ULL, 0x14D5001C15DD3F2BULL, 0xED7CCBC501EB7501ULL, 0x564EF6078950D457ULL },
+		{   16, 0x0000000000000000ULL, 0x981B17D36C7498C9ULL, 0x562980258A998629ULL, 0xC68C368ECF8A9C05ULL },
+		{   17, 0x0000000000000000ULL, 0x796F5ACD3A60F862ULL, 0xABBC12D11973D7DBULL, 0x955FA78643ED3669ULL },
+		{  128, 0x0000000000000000ULL, 0xFCFF24126754D861ULL, 0xEBB15E34A7FB5AB1ULL, 0x39992220E045260AULL },
+		{  129, 0x0000000000000000ULL, 0x98F1B0A679A2CA29ULL, 0x86C9E3BC8F0A3B5CULL, 0x03815FC91F1B30B6ULL },
+		{  240, 0x0000000000000000ULL, 0x81C3C2B67F568CCFULL, 0x5C9AAE94C8EBE5A0ULL, 0xAA4202DAA2769DC8ULL },
+		{  241, 0x0000000000000000ULL, 0xC5A639ECD2030E5EULL, 0xC5A639ECD2030E5EULL, 0x99A80ECF0ECFC647ULL },
+		{ 1024, 0x0000000000000000ULL, 0xDD85C9B5C1109C5CULL, 0xDD85C9B5C1109C5CULL, 0x0D30D24071C64C57ULL },
+		{ 1025, 0x0000000000000000ULL, 0xD870C0FA13211C6AULL, 0xD870C0FA13211C6AULL, 0xFD3EE4FE7F2954C6ULL },
+		{ 4096, 0x0000000000000000ULL, 0xE91206429D1F48F9ULL, 0xE91206429D1F48F9ULL, 0xB9CFAEA2CA5626A4ULL },
+		{    0, 0x9E3779B185EBCA8DULL, 0xA8A6B918B2F0364AULL, 0xA986DFC5D7605BFEULL, 0x00FEAA732A3CE25EULL },
+		{    1, 0x9E3779B185EBCA8DULL, 0x032BE332DD766EF8ULL, 0x032BE332DD766EF8ULL, 0x20E49ABCC53B3842ULL },
+		{    3, 0x9E3779B185EBCA8DULL, 0x634B8990B4976373ULL, 0x634B8990B4976373ULL, 0x1C7ECF6A308CF00EULL },
+		{    4, 0x9E3779B185EBCA8DULL, 0xAA2E7ECCB0C8F747ULL, 0xBFAF51F1E67E0B0FULL, 0x3D53E5DFD837D927ULL },
+		{    8, 0x9E3779B185EBCA8DULL, 0x8F973410999B8F6BULL, 0x7B29471DC729B5FFULL, 0xF50CEC145BCD5C5AULL },
+		{    9, 0x9E3779B185EBCA8DULL, 0xB3AE7333D9013F60ULL, 0xAEF5DFC0AC9F9044ULL, 0x6B380B43FFA61042ULL },
+		{   16, 0x9E3779B185EBCA8DULL, 0x663F29333B4DB6B1ULL, 0x0346D13A7A5498C7ULL, 0x6FFCB80CD33085C8ULL },
+		{   17, 0x9E3779B185EBCA8DULL, 0xF3EC5067F4306DB3ULL, 0x980A14119985A7DFULL, 0xD77681219E464828ULL },
+		{  128, 0x9E3779B185EBCA8DULL, 0x73FDE75280646649ULL, 0x8394F5C51F1D8246ULL, 0xA0F7CCB68EE02ADDULL },
+		{  129, 0x9E3779B185EBCA8DULL, 0x21FFFDBCA099C844ULL, 0xD4AAE26FCEC7DC03ULL, 0xAD559266067C0BF3ULL },
+		{  240, 0x9E3779B185EBCA8DULL, 0xCC0F58C27EF3D8EEULL, 0x604E98DB085C1864ULL, 0x29D2133D6EA58C5BULL },
+		{  241, 0x9E3779B185EBCA8DULL, 0xDDA9B0A161D4829AULL, 0xDDA9B0A161D4829AULL, 0xEC64AFAE6A137582ULL },
+		{ 1024, 0x9E3779B185EBCA8DULL, 0xEF368A8A2EBABAEFULL, 0xEF368A8A2EBABAEFULL, 0x17600EFE2B493A18ULL },
+		{ 1025, 0x9E3779B185EBCA8DULL, 0x96792BCF9AF88519ULL, 0x96792BCF9AF88519ULL, 0x2C383949F57BF7E1ULL },
+		{ 4096, 0x9E3779B185EBCA8DULL, 0x2A3BBB20A5439DCDULL, 0x2A3BBB20A5439DCDULL, 0x8FBC8FD4D526D1BDULL },
+	};
+
+	std::vector<unsigned char> MakeSanityBuffer(size_t size)
+	{
+		std::vector<unsigned char> buffer(size);
+		unsigned long long generator = 2654435761ULL;
+
+		for (unsigned char& byte : buffer)
+		{
+			byte = static_cast<unsigned char>(generator >> 56);
+			generator *= 11400714785074694797ULL;
+		}
+
+		return buffer;
+	}
+
+	/**
+	 * Tests the one-shot 64-bit and 128-bit digests against the reference.
+	 */
+	TEST(XXH3HashTest, ReferenceVectors)
+	{
+		std::vector<unsigned char> buffer = MakeSanityBuffer(4096);
+
+		for (const Vector& vector : s_vectors)
+		{
+			SCOPED_TRACE(vector.size);
+
+			EXPECT_EQ(XXH3Hash::Hash(buffer.data(), vector.size, vector.seed), vector.hash64);
+			EXPECT_EQ(XXH3Hash128::Hash(buffer.data(), vector.size, vector.seed), HashResult(vector.hash128_low, vector.hash128_high));
+		}
+	}
+
+	/**
+	 * Tests that streaming the input in uneven chunks produces the one-shot
+	 * digest, including chunks crossing block and buffer boundaries.
+	 */
+	TEST(XXH3HashTest, StreamingMatchesOneShot)
+	{
+		const size_t chunk_sizes[] = { 1, 7, 64, 255, 256, 257, 1000, 5000 };
+
+		std::vector<unsigned char> buffer = MakeSanityBuffer(20000);
+
+		for (size_t size : { size_t(0), size_t(100), size_t(240), size_t(241), size_t(1024), size_t(4097), size_t(20000) })
+		{
+			for (size_t chunk_size : chunk_sizes)
+			{
+				SCOPED_TRACE(size);
+				SCOPED_TRACE(chunk_size);
+
+				XXH3Hash hash64(42);
+				XXH3Hash128 hash128(42);
+
+				for (size_t offset = 0; offset < size; offset += chunk_size)
+				{
+					size_t count = size - offset < chunk_size ? size - offset : chunk_size;
+
+					hash64.Update(buffer.data() + offset, count);
+					hash128.Update(buffer.data() + offset, count);
+				}
+
+				EXPECT_EQ(hash64.Finalize().GetLow(), XXH3Hash::Hash(buffer.data(), size, 42));
+				EXPECT_EQ(hash128.Finalize(), XXH3Hash128::Hash(buffer.data(), size, 42));
+			}
+		}
+	}
+
+	/**
+	 * Tests that finalizing leaves the state usable and that resetting
+	 * starts a new digest.
+	 */
+	TEST(XXH3HashTest, FinalizeAndReset)
+	{
+		std::vector<unsigned char> buffer = MakeSanityBuffer(1000);
+
+		XXH3Hash hash;
+		hash.Update(buffer.data(), 500);
+
+		EXPECT_EQ(hash.Finalize().GetLow(), XXH3Hash::Hash(buffer.data(), 500));
+
+		hash.Update(buffer.data() + 500, 500);
+		EXPECT_EQ(hash.Finalize().GetLow(), XXH3Hash::Hash(buffer.data(), 1000));
+
+		hash.Reset(7);
+		hash.Update(buffer.data(), 10);
+		EXPECT_EQ(hash.Finalize().GetLow(), XXH3Hash::Hash(buffer.data(), 10, 7));
+
+		AbstractHash& abstract_hash = hash;
+		EXPECT_EQ(abstract_hash.Compute(buffer.data(), 300, 3).GetLow(), XXH3Hash::Hash(buffer.data(), 300, 3));
+	}
+
+	/**
+	 * Tests the FNV-1a reference digests and its streaming interface.
+	 */
+	TEST(XXH3HashTest, FNV1a)
+	{
+		EXPECT_EQ(FNV1aHash::Hash("", 0), 0xCBF29CE484222325ULL);
+		EXPECT_EQ(FNV1aHash::Hash("a", 1), 0xAF63DC4C8601EC8CULL);
+		EXPECT_EQ(FNV1aHash::Hash("foobar", 6), 0x85944171F73967E8ULL);
+
+		FNV1aHash hash;
+		hash.Update("foo", 3);
+		hash.Update("bar", 3);
+
+		EXPECT_EQ(hash.Finalize().GetLow(), 0x85944171F73967E8ULL);
+	}
+}
+
+#endif // XXH3_HASH_TEST_H
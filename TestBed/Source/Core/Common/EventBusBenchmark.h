@@ -0,0 +1,131 @@
+#ifndef EVENT_BUS_BENCHMARK_H
+#define EVENT_BUS_BENCHMARK_H
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Source/Benchmark/BenchmarkUtilities.h"
+
+#include "Core/Public/Types/EventBus.h"
+
+/**
+ * Measures an event storm of 64K input events a frame delivered to eight
+ * handlers, each updating its own 32KB table at a position derived from the
+ * event. Three deliveries are compared: a virtual listener interface called
+ * for every event as it happens, sending every event through the event bus
+ * as it happens, and publishing every event to the event bus and
+ * dispatching them in a batch at the end of the frame.
+ */
+namespace EventBusBenchmark
+{
+	namespace Internal
+	{
+		const size_t EVENT_COUNT = 1 << 16;
+		const size_t HANDLER_COUNT = 8;
+		const size_t FRAMES = 16;
+
+		const size_t TABLE_SIZE = 8192;
+
+		struct MouseMoveEvent
+		{
+			unsigned m_x;
+			unsigned m_y;
+		};
+
+		class AbstractListener
+		{
+		public:
+			unsigned m_table[TABLE_SIZE] = {};
+
+		public:
+			virtual ~AbstractListener() = default;
+			virtual void OnMouseMove(const MouseMoveEvent& event) = 0;
+		};
+
+		template<size_t InIndex>
+		class Listener : public AbstractListener
+		{
+		public:
+			void OnMouseMove(const MouseMoveEvent& event) override { m_table[(event.m_x * 2654435761u + InIndex) % TABLE_SIZE] += event.m_y; }
+		};
+
+		template<size_t... InIndices>
+		void AddListeners(std::vector<std::unique_ptr<AbstractListener>>& listeners, std::index_sequence<InIndices...>)
+		{
+			(listeners.emplace_back(new Listener<InIndices>()), ...);
+		}
+
+		template<size_t... InIndices>
+		void SubscribeListeners(Forge::Common::EventBus& bus, std::vector<std::unique_ptr<AbstractListener>>& listeners, std::index_sequence<InIndices...>)
+		{
+			/// The qualified call binds each handler to its listener's function
+			/// without going through the virtual table.
+			(bus.Subscribe<MouseMoveEvent>([listener = static_cast<Listener<InIndices>*>(listeners[InIndices].get())](const MouseMoveEvent& event)
+			{
+				listener->Listener<InIndices>::OnMouseMove(event);
+			}), ...);
+		}
+
+		template<typename InFrame>
+		void Run(const char* name, InFrame frame)
+		{
+			double elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t f = 0; f < FRAMES; f++)
+					frame();
+			});
+
+			BenchmarkUtilities::RecordMeasurement(name, elapsed / (FRAMES * EVENT_COUNT), "ns/event");
+		}
+	}
+
+	TEST(EventBusBenchmark, DISABLED_EventStorm)
+	{
+		using Forge::Common::EventBus;
+
+		std::vector<std::unique_ptr<Internal::AbstractListener>> listeners;
+		Internal::AddListeners(listeners, std::make_index_sequence<Internal::HANDLER_COUNT>());
+
+		Internal::Run("VirtualListener/Immediate", [&]()
+		{
+			for (size_t i = 0; i < Internal::EVENT_COUNT; i++)
+			{
+				Internal::MouseMoveEvent event = { (unsigned)i, 1 };
+
+				for (std::unique_ptr<Internal::AbstractListener>& listener : listeners)
+					listener->OnMouseMove(event);
+			}
+		});
+
+		EventBus bus(Internal::EVENT_COUNT * sizeof(Internal::MouseMoveEvent) * 2);
+
+		Internal::SubscribeListeners(bus, listeners, std::make_index_sequence<Internal::HANDLER_COUNT>());
+
+		Internal::Run("EventBus/Send", [&]()
+		{
+			for (size_t i = 0; i < Internal::EVENT_COUNT; i++)
+				bus.Send(Internal::MouseMoveEvent{ (unsigned)i, 1 });
+		});
+
+		Internal::Run("EventBus/Publish+Dispatch", [&]()
+		{
+			for (size_t i = 0; i < Internal::EVENT_COUNT; i++)
+				bus.Publish<Internal::MouseMoveEvent>(Internal::MouseMoveEvent{ (unsigned)i, 1 });
+
+			bus.Dispatch();
+		});
+
+		size_t sum = 0;
+
+		for (std::unique_ptr<Internal::AbstractListener>& listener : listeners)
+			for (size_t i = 0; i < Internal::TABLE_SIZE; i++)
+				sum += listener->m_table[i];
+
+		EXPECT_EQ(sum, Internal::HANDLER_COUNT * Internal::EVENT_COUNT * Internal::FRAMES * 3);
+	}
+}
+
+#endif
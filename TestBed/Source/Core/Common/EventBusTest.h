@@ -0,0 +1,182 @@
+#ifndef EVENT_BUS_TEST_H
+#define EVENT_BUS_TEST_H
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Types/EventBus.h"
+
+using namespace Forge::Common;
+
+namespace EventBusUnitTest
+{
+	namespace Internal
+	{
+		struct ResizeEvent
+		{
+			int m_width;
+			int m_height;
+
+			ResizeEvent(int width, int height)
+				: m_width(width), m_height(height) {}
+		};
+
+		struct KeyEvent
+		{
+			int m_key;
+		};
+
+		struct TrackedEvent
+		{
+			std::shared_ptr<int> m_payload;
+		};
+	}
+
+	/**
+	 * Tests that published events are held until the sync point and then
+	 * delivered in order to every subscriber of their type only.
+	 */
+	TEST(EventBusTest, PublishIsDeferredToDispatch)
+	{
+		EventBus bus;
+		std::vector<int> widths;
+		int keys = 0;
+
+		bus.Subscribe<Internal::ResizeEvent>([&widths](const Internal::ResizeEvent& event) { widths.push_back(event.m_width); });
+		bus.Subscribe<Internal::KeyEvent>([&keys](const Internal::KeyEvent& event) { keys += event.m_key; });
+
+		EXPECT_TRUE(bus.Publish<Internal::ResizeEvent>(640, 480));
+		EXPECT_TRUE(bus.Publish<Internal::ResizeEvent>(800, 600));
+		EXPECT_TRUE(bus.Publish<Internal::KeyEvent>(Internal::KeyEvent{ 7 }));
+
+		EXPECT_EQ(bus.GetNumOfQueuedEvents(), 3);
+		EXPECT_TRUE(widths.empty());
+
+		bus.Dispatch();
+
+		EXPECT_EQ(widths, (std::vector<int>{ 640, 800 }));
+		EXPECT_EQ(keys, 7);
+		EXPECT_EQ(bus.GetNumOfQueuedEvents(), 0);
+
+		bus.Dispatch();
+
+		EXPECT_EQ(widths.size(), 2);
+	}
+
+	/**
+	 * Tests that sent events are delivered immediately and unsubscribed
+	 * handlers receive nothing.
+	 */
+	TEST(EventBusTest, SendAndUnsubscribe)
+	{
+		EventBus bus;
+		int keys = 0;
+
+		bus.Send(Internal::KeyEvent{ 1 });
+
+		DelegateHandle handle = bus.Subscribe<Internal::KeyEvent>([&keys](const Internal::KeyEvent& event) { keys += event.m_key; });
+
+		bus.Send(Internal::KeyEvent{ 2 });
+
+		EXPECT_EQ(keys, 2);
+
+		EXPECT_TRUE(bus.Unsubscribe<Internal::KeyEvent>(handle));
+		EXPECT_FALSE(bus.Unsubscribe<Internal::KeyEvent>(handle));
+		EXPECT_FALSE(bus.Unsubscribe<Internal::ResizeEvent>(handle));
+
+		bus.Publish<Internal::KeyEvent>(Internal::KeyEvent{ 4 });
+		bus.Dispatch();
+
+		EXPECT_EQ(keys, 2);
+	}
+
+	/**
+	 * Tests that events published by a handler are delivered at the next
+	 * sync point rather than the current one.
+	 */
+	TEST(EventBusTest, PublishDuringDispatch)
+	{
+		EventBus bus;
+		int keys = 0;
+
+		bus.Subscribe<Internal::KeyEvent>([&](const Internal::KeyEvent& event)
+		{
+			keys++;
+
+			if (event.m_key)
+				bus.Publish<Internal::KeyEvent>(Internal::KeyEvent{ event.m_key - 1 });
+		});
+
+		bus.Publish<Internal::KeyEvent>(Internal::KeyEvent{ 2 });
+
+		bus.Dispatch();
+		EXPECT_EQ(keys, 1);
+
+		bus.Dispatch();
+		EXPECT_EQ(keys, 2);
+
+		bus.Dispatch();
+		EXPECT_EQ(keys, 3);
+
+		bus.Dispatch();
+		EXPECT_EQ(keys, 3);
+	}
+
+	/**
+	 * Tests that events spanning many pages are all delivered, and that both
+	 * dispatched and never dispatched events are destroyed.
+	 */
+	TEST(EventBusTest, ManyEventsAreDeliveredAndDestroyed)
+	{
+		std::shared_ptr<int> payload = std::make_shared<int>(1);
+		size_t received = 0;
+
+		{
+			EventBus bus;
+
+			bus.Subscribe<Internal::TrackedEvent>([&received](const Internal::TrackedEvent& event) { received += *event.m_payload; });
+
+			for (size_t i = 0; i < 1000; i++)
+				EXPECT_TRUE(bus.Publish<Internal::TrackedEvent>(Internal::TrackedEvent{ payload }));
+
+			EXPECT_EQ(payload.use_count(), 1001);
+
+			bus.Dispatch();
+
+			EXPECT_EQ(received, 1000);
+			EXPECT_EQ(payload.use_count(), 1);
+
+			bus.Publish<Internal::TrackedEvent>(Internal::TrackedEvent{ payload });
+
+			EXPECT_EQ(payload.use_count(), 2);
+		}
+
+		EXPECT_EQ(received, 1000);
+		EXPECT_EQ(payload.use_count(), 1);
+	}
+
+	/**
+	 * Tests that publishing fails once the event queue is out of memory.
+	 */
+	TEST(EventBusTest, QueueOutOfMemory)
+	{
+#if !defined(FORGE_BUILD_DEBUG)
+		EventBus bus(Forge::Common::EVENT_PAGE_SIZE);
+		size_t queued = 0;
+
+		while (bus.Publish<Internal::KeyEvent>(Internal::KeyEvent{ 1 }))
+			queued++;
+
+		EXPECT_GT(queued, 0);
+		EXPECT_EQ(bus.GetNumOfQueuedEvents(), queued);
+
+		bus.Dispatch();
+
+		EXPECT_TRUE(bus.Publish<Internal::KeyEvent>(Internal::KeyEvent{ 1 }));
+#endif
+	}
+}
+
+#endif
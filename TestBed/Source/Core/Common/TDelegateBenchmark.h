@@ -0,0 +1,100 @@
+#ifndef T_DELEGATE_BENCHMARK_H
+#define T_DELEGATE_BENCHMARK_H
+
+#include <functional>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Source/Benchmark/BenchmarkUtilities.h"
+
+#include "Core/Public/Types/TDelegate.h"
+#include "Core/Public/Types/TFunctionRef.h"
+
+/**
+ * Measures binding a lambda capturing 8, 24 and 40 bytes and invoking it,
+ * through TDelegate, std::function, and TFunctionRef for invocation.
+ */
+namespace TDelegateBenchmark
+{
+	namespace Internal
+	{
+		const size_t ITERATIONS = 1 << 20;
+
+		template<size_t InCount>
+		struct Capture
+		{
+			size_t m_values[InCount];
+		};
+
+		template<typename InFunction, size_t InCount>
+		void RunBind(const char* name)
+		{
+			Capture<InCount> capture = {};
+			std::vector<InFunction> functions(64);
+
+			size_t sum = 0;
+
+			double elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t i = 0; i < ITERATIONS; i++)
+				{
+					capture.m_values[0] = i;
+					functions[i & 63] = [capture](size_t value) { return capture.m_values[0] + value; };
+				}
+			});
+
+			for (InFunction& function : functions)
+				sum += function(1);
+
+			EXPECT_NE(sum, 0);
+
+			BenchmarkUtilities::RecordMeasurement(name, elapsed / ITERATIONS, "ns/op");
+		}
+
+		template<typename InFunction>
+		void RunInvoke(const char* name, const InFunction& function)
+		{
+			size_t sum = 0;
+
+			double elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t i = 0; i < ITERATIONS; i++)
+					sum += function(i);
+			});
+
+			EXPECT_NE(sum, 0);
+
+			BenchmarkUtilities::RecordMeasurement(name, elapsed / ITERATIONS, "ns/op");
+		}
+	}
+
+	TEST(TDelegateBenchmark, DISABLED_Bind)
+	{
+		using Forge::Common::TDelegate;
+
+		Internal::RunBind<TDelegate<size_t(size_t)>, 1>("TDelegate/8B");
+		Internal::RunBind<std::function<size_t(size_t)>, 1>("std::function/8B");
+		Internal::RunBind<TDelegate<size_t(size_t)>, 3>("TDelegate/24B");
+		Internal::RunBind<std::function<size_t(size_t)>, 3>("std::function/24B");
+		Internal::RunBind<TDelegate<size_t(size_t)>, 5>("TDelegate/40B");
+		Internal::RunBind<TDelegate<size_t(size_t), 48>, 5>("TDelegate48/40B");
+		Internal::RunBind<std::function<size_t(size_t)>, 5>("std::function/40B");
+	}
+
+	TEST(TDelegateBenchmark, DISABLED_Invoke)
+	{
+		using Forge::Common::TDelegate;
+		using Forge::Common::TFunctionRef;
+
+		Internal::Capture<3> capture = { { 1, 2, 3 } };
+
+		auto lambda = [capture](size_t value) { return capture.m_values[2] + value; };
+
+		Internal::RunInvoke("TDelegate", TDelegate<size_t(size_t)>(lambda));
+		Internal::RunInvoke("std::function", std::function<size_t(size_t)>(lambda));
+		Internal::RunInvoke("TFunctionRef", TFunctionRef<size_t(size_t)>(lambda));
+	}
+}
+
+#endif // T_DELEGATE_BENCHMARK_H
@@ -1,6 +1,8 @@
 #ifndef T_DELEGATE_TEST_H
 #define T_DELEGATE_TEST_H
 
+#include <memory>
+
 #include <gtest/gtest.h>
 
 #include "Core/Public/Types/TDelegate.h"
@@ -206,6 +208,68 @@ namespace DelegateUnitTest
 
 		EXPECT_EQ(d.IsValid(), false);
 	}
+
+	/**
+	 * Tests that lambdas capturing up to the inline size are stored inside
+	 * the delegate object, and larger lambdas still work from the heap.
+	 */
+	TEST(DelegateTest, InlineStorage)
+	{
+		struct Small { void* m_pointers[4]; };
+		struct Large { void* m_pointers[5]; };
+
+		Small small = {};
+		Large large = {};
+
+		auto small_lambda = [small]() { return sizeof(small); };
+		auto large_lambda = [large]() { return sizeof(large); };
+
+		static_assert(TDelegate<size_t()>::IsStoredInline<decltype(small_lambda)>(), "Lambdas capturing 32 bytes must be stored inline");
+		static_assert(!TDelegate<size_t()>::IsStoredInline<decltype(large_lambda)>(), "Lambdas capturing 40 bytes must not fit 32 bytes");
+		static_assert(TDelegate<size_t(), 48>::IsStoredInline<decltype(large_lambda)>(), "Lambdas capturing 40 bytes must fit 48 bytes");
+
+		TDelegate<size_t()> d1 = small_lambda;
+		TDelegate<size_t()> d2 = large_lambda;
+		TDelegate<size_t(), 48> d3 = large_lambda;
+
+		EXPECT_EQ(d1.Invoke(), sizeof(Small));
+		EXPECT_EQ(d2.Invoke(), sizeof(Large));
+		EXPECT_EQ(d3.Invoke(), sizeof(Large));
+
+		TDelegate<size_t()> d4 = d2;
+		TDelegate<size_t()> d5 = std::move(d2);
+
+		EXPECT_EQ(d2.IsValid(), false);
+		EXPECT_EQ(d4.Invoke(), sizeof(Large));
+		EXPECT_EQ(d5.Invoke(), sizeof(Large));
+	}
+
+	/**
+	 * Tests that invokables with non-trivial captures are copied, moved and
+	 * destroyed exactly as many times as the delegate objects holding them.
+	 */
+	TEST(DelegateTest, NonTrivialCaptureLifetime)
+	{
+		std::shared_ptr<int> value = std::make_shared<int>(3);
+
+		{
+			TDelegate<int()> d1 = [value]() { return *value; };
+			TDelegate<int()> d2 = d1;
+
+			EXPECT_EQ(value.use_count(), 3);
+
+			TDelegate<int()> d3 = std::move(d1);
+
+			EXPECT_EQ(value.use_count(), 3);
+			EXPECT_EQ(d3.Invoke() + d2(), 6);
+
+			d2.Invalidate();
+
+			EXPECT_EQ(value.use_count(), 2);
+		}
+
+		EXPECT_EQ(value.use_count(), 1);
+	}
 }
 
 #endif // T_DELEGATE_TEST_H
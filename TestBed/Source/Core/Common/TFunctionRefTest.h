@@ -0,0 +1,77 @@
+#ifndef T_FUNCTION_REF_TEST_H
+#define T_FUNCTION_REF_TEST_H
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Types/TDelegate.h"
+#include "Core/Public/Types/TFunctionRef.h"
+#include "Core/Public/Containers/TDynamicArray.h"
+
+using Forge::Common::TDelegate;
+using Forge::Common::TFunctionRef;
+
+namespace FunctionRefUnitTest
+{
+	namespace Internal
+	{
+		int TestFunc(int value) { return value * 2; }
+
+		int Apply(TFunctionRef<int(int)> function, int value) { return function(value); }
+	}
+
+	/**
+	 * Tests that a function reference is two pointers wide.
+	 */
+	TEST(FunctionRefTest, Size)
+	{
+		EXPECT_EQ(sizeof(TFunctionRef<int(int)>), 2 * sizeof(void*));
+	}
+
+	/**
+	 * Tests function references to lambdas, global functions and delegates.
+	 */
+	TEST(FunctionRefTest, Invoke)
+	{
+		int offset = 5;
+
+		EXPECT_EQ(Internal::Apply([offset](int value) { return value + offset; }, 1), 6);
+		EXPECT_EQ(Internal::Apply(Internal::TestFunc, 4), 8);
+
+		TDelegate<int(int)> d = Internal::TestFunc;
+
+		EXPECT_EQ(Internal::Apply(d, 5), 10);
+	}
+
+	/**
+	 * Tests that a function reference invokes the referenced callable itself
+	 * rather than a copy.
+	 */
+	TEST(FunctionRefTest, ReferencesCallable)
+	{
+		int calls = 0;
+
+		auto counter = [&calls]() mutable { return ++calls; };
+
+		TFunctionRef<int()> f = counter;
+
+		f(); f(); f.Invoke();
+
+		EXPECT_EQ(calls, 3);
+	}
+
+	/**
+	 * Tests ForEach() taking a function reference.
+	 */
+	TEST(FunctionRefTest, ForEach)
+	{
+		Forge::Containers::TDynamicArray<int> array = { 1, 2, 3, 4 };
+
+		int sum = 0;
+
+		array.ForEach([&sum](int& element) { sum += element; });
+
+		EXPECT_EQ(sum, 10);
+	}
+}
+
+#endif // T_FUNCTION_REF_TEST_H
@@ -0,0 +1,117 @@
+#ifndef T_MULTICAST_DELEGATE_TEST_H
+#define T_MULTICAST_DELEGATE_TEST_H
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Types/TMulticastDelegate.h"
+
+using namespace Forge::Common;
+
+namespace MulticastDelegateUnitTest
+{
+	/**
+	 * Tests that a broadcast invokes every handler in the order they were
+	 * added.
+	 */
+	TEST(MulticastDelegateTest, BroadcastInvokesHandlersInOrder)
+	{
+		TMulticastDelegate<void(int)> multicast;
+		std::vector<int> calls;
+
+		EXPECT_FALSE(multicast.IsBound());
+
+		multicast.Add([&calls](int value) { calls.push_back(value); });
+		multicast.Add([&calls](int value) { calls.push_back(value * 10); });
+
+		EXPECT_EQ(multicast.GetCount(), 2);
+
+		multicast.Broadcast(3);
+
+		EXPECT_EQ(calls, (std::vector<int>{ 3, 30 }));
+	}
+
+	/**
+	 * Tests that removing a handler by its handle stops it from being
+	 * invoked, and that invalid delegates and handles are rejected.
+	 */
+	TEST(MulticastDelegateTest, Remove)
+	{
+		TMulticastDelegate<void(int)> multicast;
+		int sum = 0;
+
+		DelegateHandle first = multicast.Add([&sum](int value) { sum += value; });
+		DelegateHandle second = multicast.Add([&sum](int value) { sum += value * 100; });
+
+		EXPECT_NE(first, 0);
+		EXPECT_NE(first, second);
+		EXPECT_EQ(multicast.Add(TDelegate<void(int)>()), 0);
+
+		EXPECT_TRUE(multicast.Remove(first));
+		EXPECT_FALSE(multicast.Remove(first));
+		EXPECT_FALSE(multicast.Remove(0));
+
+		multicast.Broadcast(1);
+
+		EXPECT_EQ(sum, 100);
+		EXPECT_EQ(multicast.GetCount(), 1);
+
+		multicast.Clear();
+		multicast.Broadcast(1);
+
+		EXPECT_EQ(sum, 100);
+		EXPECT_FALSE(multicast.IsBound());
+	}
+
+	/**
+	 * Tests that handlers removed during a broadcast are skipped right away,
+	 * and handlers added during a broadcast are first invoked by the next
+	 * one.
+	 */
+	TEST(MulticastDelegateTest, ModifyDuringBroadcast)
+	{
+		TMulticastDelegate<void(void)> multicast;
+		std::vector<int> calls;
+		DelegateHandle second = 0;
+
+		multicast.Add([&]()
+		{
+			calls.push_back(1);
+
+			multicast.Remove(second);
+			multicast.Add([&calls]() { calls.push_back(3); });
+		});
+
+		second = multicast.Add([&calls]() { calls.push_back(2); });
+
+		multicast.Broadcast();
+
+		EXPECT_EQ(calls, (std::vector<int>{ 1 }));
+		EXPECT_EQ(multicast.GetCount(), 2);
+
+		calls.clear();
+		multicast.Broadcast();
+
+		EXPECT_EQ(calls, (std::vector<int>{ 1, 3 }));
+	}
+
+	/**
+	 * Tests that a batch is delivered to each handler in turn.
+	 */
+	TEST(MulticastDelegateTest, BroadcastBatch)
+	{
+		TMulticastDelegate<void(const int&)> multicast;
+		std::vector<int> calls;
+		const int values[] = { 1, 2, 3 };
+
+		multicast.Add([&calls](const int& value) { calls.push_back(value); });
+		multicast.Add([&calls](const int& value) { calls.push_back(-value); });
+
+		multicast.BroadcastBatch(values, 3);
+
+		EXPECT_EQ(calls, (std::vector<int>{ 1, 2, 3, -1, -2, -3 }));
+	}
+}
+
+#endif
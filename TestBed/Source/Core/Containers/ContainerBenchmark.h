@@ -0,0 +1,580 @@
+#ifndef CONTAINER_BENCHMARK_H
+#define CONTAINER_BENCHMARK_H
+
+#include <list>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include "Source/Benchmark/BenchmarkUtilities.h"
+
+#include "Core/Public/Containers/TLinkedList.h"
+#include "Core/Public/Containers/TStaticArray.h"
+#include "Core/Public/Containers/TDynamicArray.h"
+#include "Core/Public/Containers/TDynamicQueue.h"
+#include "Core/Public/Containers/TDynamicStack.h"
+
+using namespace Forge::Containers;
+
+/**
+ * Compares every Core container against its closest standard library
+ * equivalent for a POD and a non-trivial element type, at sizes from 16 up
+ * to 10M elements. Set FORGE_BENCHMARK_MAX_ELEMENTS to cap the largest size
+ * on machines with little memory.
+ */
+namespace ContainerBenchmark
+{
+	namespace Internal
+	{
+		/**
+		 * Element owning a heap allocation, so that copies, moves and
+		 * destruction all run user code.
+		 */
+		struct NonTrivialElement
+		{
+			int* m_value;
+
+			NonTrivialElement() : m_value(nullptr) {}
+			NonTrivialElement(int value) : m_value(new int(value)) {}
+			NonTrivialElement(const NonTrivialElement& other) : m_value(other.m_value ? new int(*other.m_value) : nullptr) {}
+			NonTrivialElement(NonTrivialElement&& other) : m_value(other.m_value) { other.m_value = nullptr; }
+		   ~NonTrivialElement() { delete m_value; }
+
+			NonTrivialElement& operator =(const NonTrivialElement& other)
+			{
+				if (this != &other)
+				{
+					delete m_value;
+					m_value = other.m_value ? new int(*other.m_value) : nullptr;
+				}
+
+				return *this;
+			}
+
+			NonTrivialElement& operator =(NonTrivialElement&& other)
+			{
+				std::swap(m_value, other.m_value);
+				return *this;
+			}
+
+			bool operator ==(const NonTrivialElement& other) const
+			{
+				return m_value && other.m_value ? *m_value == *other.m_value : m_value == other.m_value;
+			}
+		};
+
+		inline long long ValueOf(const int& element) { return element; }
+		inline long long ValueOf(const NonTrivialElement& element) { return element.m_value ? *element.m_value : 0; }
+
+		template<typename InElement> const char* GetElementName();
+		template<> inline const char* GetElementName<int>() { return "int"; }
+		template<> inline const char* GetElementName<NonTrivialElement>() { return "NonTrivial"; }
+
+		/// Sink for computed results so the optimizer cannot drop the loops.
+		volatile long long s_sink = 0;
+
+		const size_t ELEMENT_COUNTS[] = { 16, 256, 4096, 65536, 1 << 20, 10000000 };
+
+		/// Bounds on the total work per measurement, in touched elements.
+		const size_t ITERATION_BUDGET = size_t(1) << 24;
+		const size_t LINEAR_BUDGET    = size_t(1) << 28;
+
+		inline size_t GetMaxElementCount()
+		{
+			const char* value = std::getenv("FORGE_BENCHMARK_MAX_ELEMENTS");
+			return value ? static_cast<size_t>(std::strtoull(value, nullptr, 10)) : ~size_t(0);
+		}
+
+		inline size_t GetRepetitions(size_t budget, size_t count)
+		{
+			return std::max<size_t>(1, budget / count);
+		}
+
+		template<typename InElement>
+		struct DynamicArrayAdapter
+		{
+			using Container = TDynamicArray<InElement>;
+
+			static const char* GetName() { return "TDynamicArray"; }
+			static Container* Create() { return new Container(); }
+
+			static void Push(Container& c, const InElement& e) { c.PushBack(e); }
+			static void Pop(Container& c) { c.PopBack(); }
+			static void InsertAt(Container& c, size_t i, const InElement& e) { c.InsertAt(i, e); }
+			static void RemoveAt(Container& c, size_t i) { c.RemoveAt(i); }
+			static long long IndexOf(const Container& c, const InElement& e) { return c.FirstIndexOf(e); }
+
+			static long long Iterate(Container& c)
+			{
+				long long sum = 0;
+				for (auto itr = c.GetStartItr(), end = c.GetEndItr(); itr != end; ++itr)
+					sum += ValueOf(*itr);
+				return sum;
+			}
+
+			static long long ForEach(Container& c)
+			{
+				long long sum = 0;
+				c.ForEach([&sum](InElement& e) -> void { sum += ValueOf(e); });
+				return sum;
+			}
+		};
+
+		template<typename InElement>
+		struct LinkedListAdapter
+		{
+			using Container = TLinkedList<InElement>;
+
+			static const char* GetName() { return "TLinkedList"; }
+			static Container* Create() { return new Container(); }
+
+			static void Push(Container& c, const InElement& e) { c.PushBack(e); }
+			static void Pop(Container& c) { c.PopBack(); }
+			static void InsertAt(Container& c, size_t i, const InElement& e) { c.InsertAt(i, e); }
+			static void RemoveAt(Container& c, size_t i) { c.RemoveAt(i); }
+			static long long IndexOf(const Container& c, const InElement& e) { return c.FirstIndexOf(e); }
+
+			static long long Iterate(Container& c)
+			{
+				long long sum = 0;
+				for (auto itr = c.GetStartItr(), end = c.GetEndItr(); itr != end; ++itr)
+					sum += ValueOf(*itr);
+				return sum;
+			}
+
+			static long long ForEach(Container& c)
+			{
+				long long sum = 0;
+				c.ForEach([&sum](InElement& e) -> void { sum += ValueOf(e); });
+				return sum;
+			}
+		};
+
+		template<typename InElement, size_t InMaxSize>
+		struct StaticArrayAdapter
+		{
+			using Container = TStaticArray<InElement, InMaxSize>;
+
+			static const char* GetName() { return "TStaticArray"; }
+			static Container* Create() { return new Container(); }
+
+			static void Push(Container& c, const InElement& e) { c.PushBack(e); }
+			static void Pop(Container& c) { c.PopBack(); }
+			static void InsertAt(Container& c, size_t i, const InElement& e) { c.InsertAt(i, e); }
+			static void RemoveAt(Container& c, size_t i) { c.RemoveAt(i); }
+			static long long IndexOf(const Container& c, const InElement& e) { return c.FirstIndexOf(e); }
+
+			static long long Iterate(Container& c)
+			{
+				long long sum = 0;
+				for (auto itr = c.GetStartItr(), end = c.GetEndItr(); itr != end; ++itr)
+					sum += ValueOf(*itr);
+				return sum;
+			}
+
+			static long long ForEach(Container& c)
+			{
+				long long sum = 0;
+				c.ForEach([&sum](InElement& e) -> void { sum += ValueOf(e); });
+				return sum;
+			}
+		};
+
+		template<typename InElement>
+		struct DynamicQueueAdapter
+		{
+			using Container = TDynamicQueue<InElement>;
+
+			static const char* GetName() { return "TDynamicQueue"; }
+			static Container* Create() { return new Container(); }
+
+			static void Push(Container& c, const InElement& e) { c.Push(e); }
+			static void Pop(Container& c) { c.Pop(); }
+			static long long IndexOf(const Container& c, const InElement& e) { return c.FirstIndexOf(e); }
+
+			static long long ForEach(Container& c)
+			{
+				long long sum = 0;
+				c.ForEach([&sum](InElement& e) -> void { sum += ValueOf(e); });
+				return sum;
+			}
+		};
+
+		template<typename InElement>
+		struct DynamicStackAdapter
+		{
+			using Container = TDynamicStack<InElement>;
+
+			static const char* GetName() { return "TDynamicStack"; }
+			static Container* Create() { return new Container(); }
+
+			static void Push(Container& c, const InElement& e) { c.Push(e); }
+			static void Pop(Container& c) { c.Pop(); }
+			static long long IndexOf(const Container& c, const InElement& e) { return c.FirstIndexOf(e); }
+
+			static long long ForEach(Container& c)
+			{
+				long long sum = 0;
+				c.ForEach([&sum](InElement& e) -> void { sum += ValueOf(e); });
+				return sum;
+			}
+		};
+
+		template<typename InContainer> struct StdName;
+		template<typename InElement> struct StdName<std::vector<InElement>> { static const char* Get() { return "std::vector"; } };
+		template<typename InElement> struct StdName<std::list<InElement>> { static const char* Get() { return "std::list"; } };
+		template<typename InElement> struct StdName<std::deque<InElement>> { static const char* Get() { return "std::deque"; } };
+
+		/**
+		 * Adapts a standard sequence container. Pops happen at the back
+		 * unless InPopFront is set, matching queue semantics, and InReserve
+		 * preallocates vectors to match fixed-capacity containers.
+		 */
+		template<typename InContainer, bool InPopFront = false, size_t InReserve = 0>
+		struct StdAdapter
+		{
+			using Container = InContainer;
+			using Element   = typename InContainer::value_type;
+
+			static const char* GetName() { return InReserve ? "std::vector(reserved)" : StdName<InContainer>::Get(); }
+
+			static Container* Create()
+			{
+				Container* c = new Container();
+				Reserve(c, InReserve);
+				return c;
+			}
+
+			template<typename InType>
+			static auto Reserve(InType* c, size_t capacity) -> decltype(c->reserve(capacity), void()) { if (capacity) c->reserve(capacity); }
+			static void Reserve(...) {}
+
+			static void Push(Container& c, const Element& e) { c.push_back(e); }
+
+			static void Pop(Container& c)
+			{
+				if (InPopFront)
+					PopFront(&c);
+				else
+					c.pop_back();
+			}
+
+			template<typename InType>
+			static auto PopFront(InType* c) -> decltype(c->pop_front(), void()) { c->pop_front(); }
+			static void PopFront(...) {}
+
+			static void InsertAt(Container& c, size_t i, const Element& e) { c.insert(std::next(c.begin(), i), e); }
+			static void RemoveAt(Container& c, size_t i) { c.erase(std::next(c.begin(), i)); }
+
+			static long long IndexOf(const Container& c, const Element& e)
+			{
+				auto itr = std::find(c.begin(), c.end(), e);
+				return itr == c.end() ? -1 : static_cast<long long>(std::distance(c.begin(), itr));
+			}
+
+			static long long Iterate(Container& c)
+			{
+				long long sum = 0;
+				for (auto itr = c.begin(), end = c.end(); itr != end; ++itr)
+					sum += ValueOf(*itr);
+				return sum;
+			}
+
+			static long long ForEach(Container& c)
+			{
+				long long sum = 0;
+				std::for_each(c.begin(), c.end(), [&sum](Element& e) { sum += ValueOf(e); });
+				return sum;
+			}
+		};
+
+		template<typename InAdapter>
+		std::unique_ptr<typename InAdapter::Container> CreateFilled(size_t count)
+		{
+			std::unique_ptr<typename InAdapter::Container> container(InAdapter::Create());
+
+			for (size_t i = 0; i < count; i++)
+				InAdapter::Push(*container, static_cast<int>(i));
+
+			return container;
+		}
+
+		template<typename InAdapter, typename InElement>
+		void Record(size_t count, const char* operation, double value, const char* unit)
+		{
+			BenchmarkUtilities::RecordMeasurement(std::string(InAdapter::GetName()) + "/" + GetElementName<InElement>() + "/" +
+				std::to_string(count) + "/" + operation, value, unit);
+		}
+
+		template<typename InAdapter, typename InElement>
+		void BenchmarkPush(size_t count)
+		{
+			size_t repetitions = GetRepetitions(ITERATION_BUDGET, count);
+			InElement element(1);
+
+			double elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t r = 0; r < repetitions; r++)
+				{
+					std::unique_ptr<typename InAdapter::Container> container(InAdapter::Create());
+
+					for (size_t i = 0; i < count; i++)
+						InAdapter::Push(*container, element);
+				}
+			});
+
+			Record<InAdapter, InElement>(count, "PushBack", elapsed / (repetitions * count), "ns/element");
+		}
+
+		template<typename InAdapter, typename InElement>
+		void BenchmarkPop(size_t count)
+		{
+			auto container = CreateFilled<InAdapter>(count);
+
+			double elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t i = 0; i < count; i++)
+					InAdapter::Pop(*container);
+			});
+
+			Record<InAdapter, InElement>(count, "Pop", elapsed / count, "ns/element");
+		}
+
+		/**
+		 * Inserts and then removes elements in the middle of a filled
+		 * container, keeping the total amount of shifted or walked elements
+		 * within the linear budget.
+		 */
+		template<typename InAdapter, typename InElement>
+		void BenchmarkInsertRemove(size_t count, size_t max_count = ~size_t(0))
+		{
+			auto container = CreateFilled<InAdapter>(count);
+
+			size_t operations = std::min<size_t>(4096, GetRepetitions(LINEAR_BUDGET, count));
+			size_t batch      = std::min(std::min(operations, count), max_count - count);
+			size_t batches    = std::max<size_t>(1, operations / std::max<size_t>(1, batch));
+
+			if (batch == 0)
+				return;
+
+			InElement element(1);
+			double insert_elapsed = 0.0;
+			double remove_elapsed = 0.0;
+
+			for (size_t b = 0; b < batches; b++)
+			{
+				insert_elapsed += BenchmarkUtilities::MeasureNanoseconds([&]()
+				{
+					for (size_t i = 0; i < batch; i++)
+						InAdapter::InsertAt(*container, count / 2, element);
+				});
+
+				remove_elapsed += BenchmarkUtilities::MeasureNanoseconds([&]()
+				{
+					for (size_t i = 0; i < batch; i++)
+						InAdapter::RemoveAt(*container, count / 2);
+				});
+			}
+
+			Record<InAdapter, InElement>(count, "InsertAt", insert_elapsed / (batches * batch), "ns/op");
+			Record<InAdapter, InElement>(count, "RemoveAt", remove_elapsed / (batches * batch), "ns/op");
+		}
+
+		template<typename InAdapter, typename InElement>
+		void BenchmarkIndexOf(size_t count)
+		{
+			auto container = CreateFilled<InAdapter>(count);
+
+			size_t repetitions = std::min<size_t>(4096, GetRepetitions(LINEAR_BUDGET, count));
+			InElement missing(-1);
+
+			double elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t r = 0; r < repetitions; r++)
+					s_sink = s_sink + InAdapter::IndexOf(*container, missing);
+			});
+
+			Record<InAdapter, InElement>(count, "IndexOf", elapsed / (repetitions * count), "ns/element");
+		}
+
+		template<typename InAdapter, typename InElement>
+		void BenchmarkIteration(size_t count)
+		{
+			auto container = CreateFilled<InAdapter>(count);
+			size_t repetitions = GetRepetitions(ITERATION_BUDGET, count);
+
+			double elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t r = 0; r < repetitions; r++)
+					s_sink = s_sink + InAdapter::Iterate(*container);
+			});
+
+			Record<InAdapter, InElement>(count, "Iteration", elapsed / (repetitions * count), "ns/element");
+		}
+
+		template<typename InAdapter, typename InElement>
+		void BenchmarkForEach(size_t count)
+		{
+			auto container = CreateFilled<InAdapter>(count);
+			size_t repetitions = GetRepetitions(ITERATION_BUDGET, count);
+
+			double elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t r = 0; r < repetitions; r++)
+					s_sink = s_sink + InAdapter::ForEach(*container);
+			});
+
+			Record<InAdapter, InElement>(count, "ForEach", elapsed / (repetitions * count), "ns/element");
+		}
+
+		template<typename InAdapter, typename InElement>
+		void BenchmarkCopyMove(size_t count)
+		{
+			using Container = typename InAdapter::Container;
+
+			auto container = CreateFilled<InAdapter>(count);
+			size_t repetitions = std::max<size_t>(1, GetRepetitions(ITERATION_BUDGET, count) / 4);
+
+			double copy_elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t r = 0; r < repetitions; r++)
+				{
+					std::unique_ptr<Container> copy(new Container(*container));
+					s_sink = s_sink + reinterpret_cast<long long>(copy.get());
+				}
+			});
+
+			double move_elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t r = 0; r < repetitions; r++)
+				{
+					std::unique_ptr<Container> moved(new Container(std::move(*container)));
+					container.reset(new Container(std::move(*moved)));
+				}
+			});
+
+			Record<InAdapter, InElement>(count, "Copy", copy_elapsed / (repetitions * count), "ns/element");
+			Record<InAdapter, InElement>(count, "Move", move_elapsed / (repetitions * 2), "ns/op");
+		}
+
+		template<typename InAdapter, typename InElement>
+		void BenchmarkSequence(size_t count, size_t max_count = ~size_t(0))
+		{
+			BenchmarkPush<InAdapter, InElement>(count);
+			BenchmarkInsertRemove<InAdapter, InElement>(count, max_count);
+			BenchmarkIndexOf<InAdapter, InElement>(count);
+			BenchmarkIteration<InAdapter, InElement>(count);
+			BenchmarkForEach<InAdapter, InElement>(count);
+			BenchmarkCopyMove<InAdapter, InElement>(count);
+		}
+
+		template<typename InAdapter, typename InElement>
+		void BenchmarkAdaptor(size_t count)
+		{
+			BenchmarkPush<InAdapter, InElement>(count);
+			BenchmarkPop<InAdapter, InElement>(count);
+			BenchmarkIndexOf<InAdapter, InElement>(count);
+			BenchmarkForEach<InAdapter, InElement>(count);
+			BenchmarkCopyMove<InAdapter, InElement>(count);
+		}
+
+		template<template<typename> class InForgeAdapter, typename InStdAdapter, typename InElement>
+		void RunSequence()
+		{
+			for (size_t count : ELEMENT_COUNTS)
+			{
+				if (count > GetMaxElementCount())
+					break;
+
+				BenchmarkSequence<InForgeAdapter<InElement>, InElement>(count);
+				BenchmarkSequence<InStdAdapter, InElement>(count);
+			}
+		}
+
+		template<template<typename> class InForgeAdapter, typename InStdAdapter, typename InElement>
+		void RunAdaptor()
+		{
+			for (size_t count : ELEMENT_COUNTS)
+			{
+				if (count > GetMaxElementCount())
+					break;
+
+				BenchmarkAdaptor<InForgeAdapter<InElement>, InElement>(count);
+				BenchmarkAdaptor<InStdAdapter, InElement>(count);
+			}
+		}
+
+		/**
+		 * Static arrays are heap allocated to stay off the stack, and only
+		 * fill their capacity up to half so that InsertAt has room to grow.
+		 */
+		template<typename InElement, size_t InMaxSize>
+		void RunStatic()
+		{
+			if (InMaxSize / 2 > GetMaxElementCount())
+				return;
+
+			using StdVector = StdAdapter<std::vector<InElement>, false, InMaxSize>;
+
+			BenchmarkSequence<StaticArrayAdapter<InElement, InMaxSize>, InElement>(InMaxSize / 2, InMaxSize);
+			BenchmarkSequence<StdVector, InElement>(InMaxSize / 2, InMaxSize);
+		}
+	}
+
+	/**
+	 * Compares TDynamicArray against std::vector.
+	 */
+	TEST(ContainerBenchmark, DISABLED_TDynamicArray)
+	{
+		Internal::RunSequence<Internal::DynamicArrayAdapter, Internal::StdAdapter<std::vector<int>>, int>();
+		Internal::RunSequence<Internal::DynamicArrayAdapter, Internal::StdAdapter<std::vector<Internal::NonTrivialElement>>, Internal::NonTrivialElement>();
+	}
+
+	/**
+	 * Compares TLinkedList against std::list.
+	 */
+	TEST(ContainerBenchmark, DISABLED_TLinkedList)
+	{
+		Internal::RunSequence<Internal::LinkedListAdapter, Internal::StdAdapter<std::list<int>>, int>();
+		Internal::RunSequence<Internal::LinkedListAdapter, Internal::StdAdapter<std::list<Internal::NonTrivialElement>>, Internal::NonTrivialElement>();
+	}
+
+	/**
+	 * Compares TDynamicQueue against std::deque used as a queue.
+	 */
+	TEST(ContainerBenchmark, DISABLED_TDynamicQueue)
+	{
+		Internal::RunAdaptor<Internal::DynamicQueueAdapter, Internal::StdAdapter<std::deque<int>, true>, int>();
+		Internal::RunAdaptor<Internal::DynamicQueueAdapter, Internal::StdAdapter<std::deque<Internal::NonTrivialElement>, true>, Internal::NonTrivialElement>();
+	}
+
+	/**
+	 * Compares TDynamicStack against std::vector used as a stack.
+	 */
+	TEST(ContainerBenchmark, DISABLED_TDynamicStack)
+	{
+		Internal::RunAdaptor<Internal::DynamicStackAdapter, Internal::StdAdapter<std::vector<int>>, int>();
+		Internal::RunAdaptor<Internal::DynamicStackAdapter, Internal::StdAdapter<std::vector<Internal::NonTrivialElement>>, Internal::NonTrivialElement>();
+	}
+
+	/**
+	 * Compares TStaticArray against a std::vector with the same reserved
+	 * capacity, the closest standard container with a fixed capacity and
+	 * PushBack. Sizes are limited to what a fixed-capacity array is used for,
+	 * and only POD elements are measured since the static array stores
+	 * constructed slots and moves itself bitwise.
+	 */
+	TEST(ContainerBenchmark, DISABLED_TStaticArray)
+	{
+		Internal::RunStatic<int, 32>();
+		Internal::RunStatic<int, 4096>();
+		Internal::RunStatic<int, 65536>();
+	}
+}
+
+#endif
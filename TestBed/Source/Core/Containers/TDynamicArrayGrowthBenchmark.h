@@ -0,0 +1,161 @@
+#ifndef T_DYNAMIC_ARRAY_GROWTH_BENCHMARK_H
+#define T_DYNAMIC_ARRAY_GROWTH_BENCHMARK_H
+
+#include <string>
+#include <utility>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+
+#include <gtest/gtest.h>
+
+#include "Source/Benchmark/BenchmarkUtilities.h"
+
+#include "Core/Public/Containers/TDynamicArray.h"
+
+using namespace Forge::Containers;
+
+/**
+ * Measures TDynamicArray growth against std::vector by pushing 1M, 10M and
+ * 100M elements into an empty container without reserving capacity first,
+ * so every reallocation is part of the measurement.
+ *
+ * Trivially relocatable elements are grown through HeapReallocate(), which
+ * remaps pages of large blocks instead of copying them, while std::vector
+ * moves every element into a new block. Sizes whose final footprint is
+ * above 1 GiB are skipped, set FORGE_BENCHMARK_MAX_ELEMENTS to cap the
+ * largest size on machines with little memory.
+ */
+namespace TDynamicArrayGrowthBenchmark
+{
+	namespace Internal
+	{
+		/**
+		 * A cache line sized POD element.
+		 */
+		struct Particle
+		{
+			float m_position[4];
+			float m_velocity[4];
+			float m_color[4];
+			float m_lifetime[4];
+		};
+
+		/**
+		 * Element owning a heap allocation, not trivially copyable but safe
+		 * to relocate with a memory copy. Benchmarks push empty handles so
+		 * only the cost of growing is measured.
+		 */
+		struct Handle
+		{
+			int* m_value;
+
+			Handle() : m_value(nullptr) {}
+			Handle(int value) : m_value(new int(value)) {}
+			Handle(const Handle& other) : m_value(other.m_value ? new int(*other.m_value) : nullptr) {}
+			Handle(Handle&& other) noexcept : m_value(other.m_value) { other.m_value = nullptr; }
+		   ~Handle() { delete m_value; }
+
+			Handle& operator =(const Handle& other)
+			{
+				if (this != &other)
+				{
+					delete m_value;
+					m_value = other.m_value ? new int(*other.m_value) : nullptr;
+				}
+
+				return *this;
+			}
+
+			Handle& operator =(Handle&& other) noexcept
+			{
+				std::swap(m_value, other.m_value);
+				return *this;
+			}
+		};
+
+		template<typename InElement> InElement MakeElement(size_t i);
+		template<> inline int MakeElement<int>(size_t i) { return static_cast<int>(i); }
+		template<> inline Particle MakeElement<Particle>(size_t i) { return Particle{ { static_cast<float>(i) } }; }
+		template<> inline Handle MakeElement<Handle>(size_t i) { return Handle(); }
+
+		template<typename InElement> const char* GetElementName();
+		template<> inline const char* GetElementName<int>() { return "int"; }
+		template<> inline const char* GetElementName<Particle>() { return "Particle"; }
+		template<> inline const char* GetElementName<Handle>() { return "Handle"; }
+
+		const size_t ELEMENT_COUNTS[] = { 1000000, 10000000, 100000000 };
+
+		const size_t MAX_FOOTPRINT = size_t(1) << 30;
+
+		inline size_t GetMaxElementCount()
+		{
+			const char* value = std::getenv("FORGE_BENCHMARK_MAX_ELEMENTS");
+			return value ? static_cast<size_t>(std::strtoull(value, nullptr, 10)) : ~size_t(0);
+		}
+
+		inline void Record(const char* container, const char* element, size_t count, double elapsed)
+		{
+			char name[96];
+			std::snprintf(name, sizeof(name), "%s<%s>/PushBack/%zu", container, element, count);
+
+			BenchmarkUtilities::RecordMeasurement(name, elapsed / count, "ns/op");
+		}
+
+		template<typename InElement>
+		void Run(void)
+		{
+			for (size_t count : ELEMENT_COUNTS)
+			{
+				if (count > GetMaxElementCount() || count * sizeof(InElement) > MAX_FOOTPRINT)
+					continue;
+
+				{
+					TDynamicArray<InElement> array;
+
+					double elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+					{
+						for (size_t i = 0; i < count; i++)
+							array.PushBack(MakeElement<InElement>(i));
+					});
+
+					ASSERT_EQ(array.GetCount(), count);
+
+					Record("TDynamicArray", GetElementName<InElement>(), count, elapsed);
+				}
+
+				{
+					std::vector<InElement> vector;
+
+					double elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+					{
+						for (size_t i = 0; i < count; i++)
+							vector.push_back(MakeElement<InElement>(i));
+					});
+
+					ASSERT_EQ(vector.size(), count);
+
+					Record("std::vector", GetElementName<InElement>(), count, elapsed);
+				}
+			}
+		}
+	}
+}
+
+FORGE_DECLARE_TRIVIALLY_RELOCATABLE(TDynamicArrayGrowthBenchmark::Internal::Handle)
+
+namespace TDynamicArrayGrowthBenchmark
+{
+	/**
+	 * Pushes elements of a trivially copyable, a cache line sized and a
+	 * relocatable owning type.
+	 */
+	TEST(TDynamicArrayGrowthBenchmark, DISABLED_PushBack)
+	{
+		Internal::Run<int>();
+		Internal::Run<Internal::Particle>();
+		Internal::Run<Internal::Handle>();
+	}
+}
+
+#endif
@@ -3,10 +3,70 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include "Core/Public/Containers/TDynamicArray.h"
+#include "Core/Public/Memory/CAllocator.h"
+#include "Core/Public/Memory/LinearAllocator.h"
+#include "Core/Public/Memory/StackAllocator.h"
+#include "Core/Public/Memory/FreeListAllocator.h"
 
 using namespace Forge::Containers;
 
+namespace TDynamicArrayTest
+{
+	/**
+	 * Element pointing into itself, relocating it with a memory copy would
+	 * leave the pointer dangling.
+	 */
+	struct SelfReferencing
+	{
+		int  m_value;
+		int* m_self;
+
+		SelfReferencing(int value = 0) : m_value(value), m_self(&m_value) {}
+		SelfReferencing(const SelfReferencing& other) : m_value(other.m_value), m_self(&m_value) {}
+
+		SelfReferencing& operator =(const SelfReferencing& other)
+		{
+			m_value = other.m_value;
+			return *this;
+		}
+	};
+
+	/**
+	 * Element counting its move constructions, declared trivially
+	 * relocatable below.
+	 */
+	struct Relocatable
+	{
+		static int s_num_of_moves;
+
+		int* m_value;
+
+		Relocatable(int value = 0) : m_value(new int(value)) {}
+		Relocatable(Relocatable&& other) : m_value(other.m_value) { other.m_value = nullptr; s_num_of_moves++; }
+		Relocatable(const Relocatable& other) : m_value(new int(*other.m_value)) {}
+	   ~Relocatable() { delete m_value; }
+
+		Relocatable& operator =(Relocatable&& other)
+		{
+			std::swap(m_value, other.m_value);
+			return *this;
+		}
+
+		Relocatable& operator =(const Relocatable& other)
+		{
+			*m_value = *other.m_value;
+			return *this;
+		}
+	};
+
+	int Relocatable::s_num_of_moves = 0;
+}
+
+FORGE_DECLARE_TRIVIALLY_RELOCATABLE(TDynamicArrayTest::Relocatable)
+
 namespace TDynamicArrayTest
 {
 	/**
@@ -449,7 +509,199 @@ namespace TDynamicArrayTest
 		EXPECT_EQ(a.GetCount(), 0);
 		EXPECT_EQ(a.IsEmpty(), true);
 	}
+
+	/**
+	 * Tests copy assignment over a dynamic array already storing elements.
+	 */
+	TEST(TDynamicArrayTest, CopyAssignmentOverElements)
+	{
+		TDynamicArray<std::string> a1 = { "one", "two" };
+		TDynamicArray<std::string> a2 = { "three", "four", "five" };
+
+		a2 = a1;
+
+		EXPECT_EQ(a2.GetCount(), 2);
+		EXPECT_EQ(a2[0], "one");
+		EXPECT_EQ(a2[1], "two");
+
+		a1 = a2;
+		a1.PushBack("six");
+		a2 = a1;
+
+		EXPECT_EQ(a2.GetCount(), 3);
+		EXPECT_EQ(a2[2], "six");
+	}
+
+	/**
+	 * Tests that a dynamic array obtains and returns its memory through the
+	 * allocator it was constructed with.
+	 */
+	TEST(TDynamicArrayTest, Allocator)
+	{
+		Forge::Memory::CAllocator allocator;
+
+		{
+			TDynamicArray<int> a(&allocator);
+
+			EXPECT_EQ(a.GetAllocator(), &allocator);
+
+			for (int i = 0; i < 1000; i++)
+				a.PushBack(i);
+
+			EXPECT_GT(allocator.GetNumOfAllocs(), 0);
+
+			for (int i = 0; i < 1000; i++)
+				EXPECT_EQ(a[i], i);
+
+			TDynamicArray<int> copy = a;
+
+			EXPECT_EQ(copy.GetAllocator(), &allocator);
+			EXPECT_EQ(copy.IsEqual(a), true);
+		}
+
+		EXPECT_EQ(allocator.GetNumOfAllocs(), 0);
+	}
+
+	/**
+	 * Tests growth with an allocator that does not support reallocation.
+	 */
+	TEST(TDynamicArrayTest, AllocatorWithoutReallocation)
+	{
+		Forge::Memory::LinearAllocator allocator(1 << 16);
+
+		TDynamicArray<int> a(&allocator);
+
+		for (int i = 0; i < 1000; i++)
+			a.PushBack(i);
+
+		for (int i = 0; i < 1000; i++)
+			EXPECT_EQ(a[i], i);
+	}
+
+	/**
+	 * Tests that arrays growing side by side in one allocator never share
+	 * memory.
+	 */
+	TEST(TDynamicArrayTest, AllocatorSharedByArrays)
+	{
+		Forge::Memory::FreeListAllocator allocator(1 << 16, Forge::Memory::FreeListPolicy::FORGE_BEST_FIT);
+
+		TDynamicArray<int> a(&allocator);
+		TDynamicArray<int> b(&allocator);
+
+		for (int i = 0; i < 100; i++)
+		{
+			a.PushBack(i);
+			b.PushBack(-i);
+		}
+
+		for (int i = 0; i < 100; i++)
+		{
+			EXPECT_EQ(a[i], i);
+			EXPECT_EQ(b[i], -i);
+		}
+	}
+
+	/**
+	 * Tests that a stack allocator resizes the array on top of it in place.
+	 */
+	TEST(TDynamicArrayTest, StackAllocatorGrowth)
+	{
+		Forge::Memory::StackAllocator allocator(1 << 16);
+
+		TDynamicArray<int> a(&allocator);
+
+		a.PushBack(0);
+
+		const int* block = a.GetRawData();
+
+		for (int i = 1; i < 1000; i++)
+			a.PushBack(i);
+
+		EXPECT_EQ(a.GetRawData(), block);
+		EXPECT_EQ(allocator.GetNumOfAllocs(), 1);
+
+		for (int i = 0; i < 1000; i++)
+			EXPECT_EQ(a[i], i);
+	}
+
+	/**
+	 * Tests that growing past an exhausted allocator throws and keeps the
+	 * elements.
+	 */
+	TEST(TDynamicArrayTest, ExhaustedAllocator)
+	{
+		Forge::Memory::LinearAllocator allocator(256);
+
+		TDynamicArray<int> a(&allocator);
+
+		EXPECT_THROW(
+			for (int i = 0; i < 1000; i++)
+				a.PushBack(i);
+		, Forge::Debug::BadAllocationException);
+
+		ASSERT_GT(a.GetCount(), 0);
+
+		for (int i = 0; i < a.GetCount(); i++)
+			EXPECT_EQ(a[i], i);
+	}
+
+	/**
+	 * Tests growth of elements that are not trivially relocatable.
+	 */
+	TEST(TDynamicArrayTest, GrowNonRelocatable)
+	{
+		TDynamicArray<SelfReferencing> a;
+
+		for (int i = 0; i < 100; i++)
+			a.PushBack(SelfReferencing(i));
+
+		for (int i = 0; i < 100; i++)
+		{
+			EXPECT_EQ(a[i].m_value, i);
+			EXPECT_EQ(a[i].m_self, &a[i].m_value);
+		}
+	}
+
+	/**
+	 * Tests that growth relocates trivially relocatable elements without
+	 * moving them one by one.
+	 */
+	TEST(TDynamicArrayTest, GrowRelocatable)
+	{
+		TDynamicArray<Relocatable> a;
+
+		a.ReserveCapacity(1);
+
+		Relocatable::s_num_of_moves = 0;
+
+		for (int i = 0; i < 100; i++)
+			a.PushBack(Relocatable(i));
+
+		EXPECT_EQ(Relocatable::s_num_of_moves, 100);
+
+		for (int i = 0; i < 100; i++)
+			EXPECT_EQ(*a[i].m_value, i);
+	}
+
+	/**
+	 * Tests growth of a block past the size it is mapped from the system at.
+	 */
+	TEST(TDynamicArrayTest, GrowPastMappingThreshold)
+	{
+		const int count = static_cast<int>(Forge::Memory::HEAP_MAPPING_THRESHOLD / sizeof(int)) * 4;
+
+		TDynamicArray<int> a;
+
+		for (int i = 0; i < count; i++)
+			a.PushBack(i);
+
+		EXPECT_EQ(a.GetCount(), count);
+		EXPECT_GE(a.GetCapacity(), static_cast<size_t>(count));
+
+		for (int i = 0; i < count; i++)
+			ASSERT_EQ(a[i], i);
+	}
 }
 
 #endif
-
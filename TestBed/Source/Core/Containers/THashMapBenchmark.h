@@ -0,0 +1,194 @@
+#ifndef T_HASH_MAP_BENCHMARK_H
+#define T_HASH_MAP_BENCHMARK_H
+
+#include <string>
+#include <random>
+#include <vector>
+#include <cstdlib>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include "Source/Benchmark/BenchmarkUtilities.h"
+
+#include "Core/Public/Containers/THashMap.h"
+
+using namespace Forge::Containers;
+
+/**
+ * Compares THashMap against std::unordered_map on insert, successful find,
+ * unsuccessful find and erase of random 64-bit keys.
+ *
+ * Both tables are sized up front so that they hold the keys at a fixed
+ * load factor between 0.5 and 0.9 without rehashing during the measured
+ * phase. The table holds 2^20 slots, set FORGE_BENCHMARK_MAX_ELEMENTS to
+ * use a smaller table on machines with little memory.
+ */
+namespace THashMapBenchmark
+{
+	namespace Internal
+	{
+		inline size_t GetCapacity(void)
+		{
+			const char* value = std::getenv("FORGE_BENCHMARK_MAX_ELEMENTS");
+			size_t max_elements = value ? static_cast<size_t>(std::strtoull(value, nullptr, 10)) : ~size_t(0);
+
+			size_t capacity = size_t(1) << 20;
+
+			while (capacity > 1024 && capacity > max_elements)
+				capacity >>= 1;
+
+			return capacity;
+		}
+
+		struct Workload
+		{
+			std::vector<unsigned long long> keys;
+			std::vector<unsigned long long> missing_keys;
+		};
+
+		Workload MakeWorkload(size_t count)
+		{
+			std::mt19937_64 generator(42);
+
+			Workload workload;
+			workload.keys.resize(count);
+			workload.missing_keys.resize(count);
+
+			// Odd keys are inserted, even keys are guaranteed to miss.
+			for (size_t i = 0; i < count; i++)
+			{
+				workload.keys[i]         = generator() | 1;
+				workload.missing_keys[i] = generator() & ~1ULL;
+			}
+
+			return workload;
+		}
+
+		std::string MakeName(const char* container, const char* operation, float load_factor)
+		{
+			char name[64];
+			std::snprintf(name, sizeof(name), "%s/%s/LoadFactor%.1f", container, operation, load_factor);
+
+			return name;
+		}
+
+		void Record(const char* container, const char* operation, float load_factor, double elapsed, size_t count)
+		{
+			BenchmarkUtilities::RecordMeasurement(MakeName(container, operation, load_factor), elapsed / count, "ns/op");
+		}
+
+		void RunForgeHashMap(const Workload& workload, size_t capacity, float load_factor)
+		{
+			const size_t count = workload.keys.size();
+
+			THashMap<unsigned long long, unsigned long long> map;
+			map.SetMaxLoadFactor(0.95f);
+			map.Reserve(count);
+
+			ASSERT_EQ(map.GetCapacity(), capacity);
+
+			double insert = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t i = 0; i < count; i++)
+					map.Insert(workload.keys[i], i);
+			});
+
+			unsigned long long checksum = 0;
+
+			double find_hit = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t i = 0; i < count; i++)
+					checksum += *map.Find(workload.keys[i]);
+			});
+
+			size_t num_of_misses = 0;
+
+			double find_miss = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t i = 0; i < count; i++)
+					num_of_misses += map.Find(workload.missing_keys[i]) == nullptr;
+			});
+
+			double erase = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t i = 0; i < count; i++)
+					map.Remove(workload.keys[i]);
+			});
+
+			EXPECT_EQ(checksum, count * (count - 1) / 2);
+			EXPECT_EQ(num_of_misses, count);
+			EXPECT_TRUE(map.IsEmpty());
+
+			Record("THashMap", "Insert", load_factor, insert, count);
+			Record("THashMap", "FindHit", load_factor, find_hit, count);
+			Record("THashMap", "FindMiss", load_factor, find_miss, count);
+			Record("THashMap", "Erase", load_factor, erase, count);
+		}
+
+		void RunStdUnorderedMap(const Workload& workload, size_t capacity, float load_factor)
+		{
+			const size_t count = workload.keys.size();
+
+			std::unordered_map<unsigned long long, unsigned long long> map;
+			map.max_load_factor(1.0f);
+			map.rehash(capacity);
+
+			double insert = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t i = 0; i < count; i++)
+					map.emplace(workload.keys[i], i);
+			});
+
+			unsigned long long checksum = 0;
+
+			double find_hit = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t i = 0; i < count; i++)
+					checksum += map.find(workload.keys[i])->second;
+			});
+
+			size_t num_of_misses = 0;
+
+			double find_miss = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t i = 0; i < count; i++)
+					num_of_misses += map.find(workload.missing_keys[i]) == map.end();
+			});
+
+			double erase = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t i = 0; i < count; i++)
+					map.erase(workload.keys[i]);
+			});
+
+			EXPECT_EQ(checksum, count * (count - 1) / 2);
+			EXPECT_EQ(num_of_misses, count);
+			EXPECT_TRUE(map.empty());
+
+			Record("std::unordered_map", "Insert", load_factor, insert, count);
+			Record("std::unordered_map", "FindHit", load_factor, find_hit, count);
+			Record("std::unordered_map", "FindMiss", load_factor, find_miss, count);
+			Record("std::unordered_map", "Erase", load_factor, erase, count);
+		}
+	}
+
+	/**
+	 * Measures insert, find and erase at load factors from 0.5 to 0.9.
+	 */
+	TEST(THashMapBenchmark, DISABLED_LoadFactors)
+	{
+		const size_t capacity = Internal::GetCapacity();
+		const float load_factors[] = { 0.5f, 0.6f, 0.7f, 0.8f, 0.9f };
+
+		for (float load_factor : load_factors)
+		{
+			Internal::Workload workload = Internal::MakeWorkload(static_cast<size_t>(capacity * load_factor));
+
+			Internal::RunForgeHashMap(workload, capacity, load_factor);
+			Internal::RunStdUnorderedMap(workload, capacity, load_factor);
+		}
+	}
+}
+
+#endif // T_HASH_MAP_BENCHMARK_H
@@ -0,0 +1,306 @@
+#ifndef T_HASH_MAP_TEST_H
+#define T_HASH_MAP_TEST_H
+
+#include <string>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Containers/THashMap.h"
+#include "Core/Public/Memory/FreeListAllocator.h"
+#include "Core/Public/Types/String/String.h"
+
+using namespace Forge::Containers;
+
+namespace THashMapTest
+{
+	/**
+	 * Hashes every key to the same few buckets so tests exercise long
+	 * clusters, displacement and backward shifting.
+	 */
+	struct CollidingHasher
+	{
+		unsigned long long operator ()(int key) const
+		{
+			return static_cast<unsigned long long>(key & 3);
+		}
+	};
+
+	struct StringHasher
+	{
+		unsigned long long operator ()(const std::string& key) const
+		{
+			return std::hash<std::string>()(key);
+		}
+	};
+
+	/**
+	 * Tests the default constructor of a hash map object.
+	 */
+	TEST(THashMapTest, DefaultConstructor)
+	{
+		THashMap<int, int> m;
+
+		EXPECT_EQ(m.GetCount(), 0);
+		EXPECT_EQ(m.GetCapacity(), 0);
+		EXPECT_TRUE(m.IsEmpty());
+		EXPECT_EQ(m.Find(1), nullptr);
+		EXPECT_FALSE(m.Remove(1));
+	}
+
+	/**
+	 * Tests that inserting an existing key leaves its value untouched and
+	 * that InsertOrAssign overwrites it.
+	 */
+	TEST(THashMapTest, InsertAndFind)
+	{
+		THashMap<int, int> m;
+
+		EXPECT_TRUE(m.Insert(1, 10));
+		EXPECT_TRUE(m.Insert(2, 20));
+		EXPECT_FALSE(m.Insert(1, 30));
+
+		EXPECT_EQ(m.GetCount(), 2);
+		EXPECT_EQ(*m.Find(1), 10);
+		EXPECT_EQ(*m.Find(2), 20);
+		EXPECT_EQ(m.Find(3), nullptr);
+
+		EXPECT_FALSE(m.InsertOrAssign(1, 30));
+		EXPECT_EQ(*m.Find(1), 30);
+	}
+
+	/**
+	 * Tests that the subscript operator default constructs missing values.
+	 */
+	TEST(THashMapTest, SubscriptOperator)
+	{
+		THashMap<int, int> m;
+
+		m[5]++;
+		m[5]++;
+		m[7] = 3;
+
+		EXPECT_EQ(m.GetCount(), 2);
+		EXPECT_EQ(m[5], 2);
+		EXPECT_EQ(m[7], 3);
+	}
+
+	/**
+	 * Tests that the map grows while staying below its maximum load factor
+	 * and keeps every entry reachable.
+	 */
+	TEST(THashMapTest, Growth)
+	{
+		const int count = 100000;
+
+		THashMap<int, int> m;
+
+		for (int i = 0; i < count; i++)
+			EXPECT_TRUE(m.Insert(i * 7, i));
+
+		EXPECT_EQ(m.GetCount(), count);
+		EXPECT_LE(m.GetLoadFactor(), m.GetMaxLoadFactor());
+
+		for (int i = 0; i < count; i++)
+		{
+			ASSERT_NE(m.Find(i * 7), nullptr);
+			EXPECT_EQ(*m.Find(i * 7), i);
+			EXPECT_EQ(m.Find(i * 7 + 1), nullptr);
+		}
+	}
+
+	/**
+	 * Tests removal from heavily colliding clusters against a reference map.
+	 */
+	TEST(THashMapTest, RemoveWithCollisions)
+	{
+		THashMap<int, int, CollidingHasher> m;
+		std::unordered_map<int, int> reference;
+
+		for (int i = 0; i < 400; i++)
+		{
+			m.Insert(i, i * 2);
+			reference[i] = i * 2;
+		}
+
+		for (int i = 0; i < 400; i += 3)
+		{
+			EXPECT_TRUE(m.Remove(i));
+			EXPECT_FALSE(m.Remove(i));
+			reference.erase(i);
+		}
+
+		EXPECT_EQ(m.GetCount(), reference.size());
+
+		for (int i = 0; i < 400; i++)
+		{
+			if (reference.count(i))
+			{
+				ASSERT_NE(m.Find(i), nullptr);
+				EXPECT_EQ(*m.Find(i), reference[i]);
+			}
+			else
+			{
+				EXPECT_EQ(m.Find(i), nullptr);
+			}
+		}
+	}
+
+	/**
+	 * Tests that strings are hashed over their characters, so equal strings
+	 * stored in distinct buffers find the same entry.
+	 */
+	TEST(THashMapTest, StringKeys)
+	{
+		THashMap<Forge::Type::String, int> m;
+
+		m.Insert(Forge::Type::String("short"), 1);
+		m.Insert(Forge::Type::String("a string too long to be stored inline"), 2);
+
+		ASSERT_NE(m.Find(Forge::Type::String("short")), nullptr);
+		ASSERT_NE(m.Find(Forge::Type::String("a string too long to be stored inline")), nullptr);
+
+		EXPECT_EQ(*m.Find(Forge::Type::String("short")), 1);
+		EXPECT_EQ(*m.Find(Forge::Type::String("a string too long to be stored inline")), 2);
+		EXPECT_EQ(m.Find(Forge::Type::String("other")), nullptr);
+	}
+
+	/**
+	 * Tests random insertions and removals against a reference map.
+	 */
+	TEST(THashMapTest, RandomOperations)
+	{
+		THashMap<unsigned, unsigned> m;
+		std::unordered_map<unsigned, unsigned> reference;
+
+		unsigned state = 12345;
+
+		for (int i = 0; i < 200000; i++)
+		{
+			state = state * 1664525u + 1013904223u;
+			unsigned key = (state >> 8) % 5000;
+
+			if (state & 1)
+			{
+				EXPECT_EQ(m.Insert(key, i), reference.emplace(key, i).second);
+			}
+			else
+			{
+				EXPECT_EQ(m.Remove(key), reference.erase(key) == 1);
+			}
+		}
+
+		EXPECT_EQ(m.GetCount(), reference.size());
+
+		for (const auto& pair : reference)
+		{
+			ASSERT_NE(m.Find(pair.first), nullptr);
+			EXPECT_EQ(*m.Find(pair.first), pair.second);
+		}
+	}
+
+	/**
+	 * Tests that non-trivial keys and values are copied, moved and destroyed
+	 * correctly.
+	 */
+	TEST(THashMapTest, NonTrivialEntries)
+	{
+		THashMap<std::string, std::string, StringHasher> m1;
+
+		for (int i = 0; i < 1000; i++)
+			m1.Insert("key " + std::to_string(i), std::string(64, 'a' + i % 26));
+
+		for (int i = 0; i < 1000; i += 2)
+			EXPECT_TRUE(m1.Remove("key " + std::to_string(i)));
+
+		THashMap<std::string, std::string, StringHasher> m2(m1);
+		THashMap<std::string, std::string, StringHasher> m3(std::move(m1));
+
+		EXPECT_EQ(m1.GetCount(), 0);
+		EXPECT_EQ(m2.GetCount(), 500);
+		EXPECT_EQ(m3.GetCount(), 500);
+
+		for (int i = 1; i < 1000; i += 2)
+		{
+			ASSERT_NE(m2.Find("key " + std::to_string(i)), nullptr);
+			EXPECT_EQ(*m2.Find("key " + std::to_string(i)), std::string(64, 'a' + i % 26));
+			EXPECT_TRUE(m3.Contains("key " + std::to_string(i)));
+		}
+
+		m1 = m2;
+		EXPECT_EQ(m1.GetCount(), 500);
+	}
+
+	/**
+	 * Tests that iteration and ForEach visit every entry once.
+	 */
+	TEST(THashMapTest, Iteration)
+	{
+		THashMap<int, int> m;
+
+		for (int i = 0; i < 100; i++)
+			m.Insert(i, i);
+
+		int sum = 0, count = 0;
+
+		for (auto& entry : m)
+		{
+			EXPECT_EQ(entry.m_key, entry.m_value);
+			sum += entry.m_value;
+			count++;
+		}
+
+		EXPECT_EQ(count, 100);
+		EXPECT_EQ(sum, 4950);
+
+		int for_each_sum = 0;
+		m.ForEach([&](THashMapEntry<int, int>& entry) { for_each_sum += entry.m_value; });
+
+		EXPECT_EQ(for_each_sum, 4950);
+	}
+
+	/**
+	 * Tests that the map obtains its storage from the provided allocator.
+	 */
+	TEST(THashMapTest, CustomAllocator)
+	{
+		Forge::Memory::FreeListAllocator allocator(1 << 20);
+
+		{
+			THashMap<int, int> m(&allocator);
+
+			for (int i = 0; i < 1000; i++)
+				m.Insert(i, i);
+
+			EXPECT_EQ(m.GetAllocator(), &allocator);
+			EXPECT_GT(allocator.GetUsedMemory(), 1000 * sizeof(THashMapEntry<int, int>));
+
+			m.Clear();
+			EXPECT_TRUE(m.IsEmpty());
+			EXPECT_EQ(m.Find(1), nullptr);
+		}
+
+		EXPECT_EQ(allocator.GetNumOfAllocs(), allocator.GetNumOfDeallocs());
+	}
+
+	/**
+	 * Tests that lowering the maximum load factor rehashes the map.
+	 */
+	TEST(THashMapTest, MaxLoadFactor)
+	{
+		THashMap<int, int> m;
+
+		for (int i = 0; i < 1000; i++)
+			m.Insert(i, i);
+
+		m.SetMaxLoadFactor(0.5f);
+
+		EXPECT_FLOAT_EQ(m.GetMaxLoadFactor(), 0.5f);
+		EXPECT_LT(m.GetLoadFactor(), 0.5f);
+
+		for (int i = 0; i < 1000; i++)
+			EXPECT_TRUE(m.Contains(i));
+	}
+}
+
+#endif // T_HASH_MAP_TEST_H
@@ -0,0 +1,64 @@
+#ifndef T_HASH_SET_TEST_H
+#define T_HASH_SET_TEST_H
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Containers/THashSet.h"
+
+using namespace Forge::Containers;
+
+namespace THashSetTest
+{
+	enum class Color { RED, GREEN, BLUE };
+
+	/**
+	 * Tests insertion, lookup and removal of unique keys.
+	 */
+	TEST(THashSetTest, InsertContainsRemove)
+	{
+		THashSet<int> s;
+
+		EXPECT_TRUE(s.Insert(1));
+		EXPECT_TRUE(s.Insert(2));
+		EXPECT_FALSE(s.Insert(1));
+
+		EXPECT_EQ(s.GetCount(), 2);
+		EXPECT_TRUE(s.Contains(1));
+		EXPECT_FALSE(s.Contains(3));
+
+		EXPECT_TRUE(s.Remove(1));
+		EXPECT_FALSE(s.Contains(1));
+		EXPECT_EQ(s.GetCount(), 1);
+	}
+
+	/**
+	 * Tests the default hasher on pointer, enum and floating point keys.
+	 */
+	TEST(THashSetTest, ScalarKeys)
+	{
+		int values[3];
+
+		THashSet<int*> pointers;
+		THashSet<Color> colors;
+		THashSet<double> doubles;
+
+		for (int i = 0; i < 3; i++)
+			EXPECT_TRUE(pointers.Insert(values + i));
+
+		EXPECT_TRUE(colors.Insert(Color::RED));
+		EXPECT_TRUE(colors.Insert(Color::BLUE));
+		EXPECT_FALSE(colors.Insert(Color::RED));
+
+		EXPECT_TRUE(doubles.Insert(0.0));
+		EXPECT_FALSE(doubles.Insert(-0.0));
+		EXPECT_TRUE(doubles.Insert(1.5));
+
+		EXPECT_EQ(pointers.GetCount(), 3);
+		EXPECT_EQ(colors.GetCount(), 2);
+		EXPECT_EQ(doubles.GetCount(), 2);
+		EXPECT_TRUE(pointers.Contains(values + 1));
+		EXPECT_FALSE(colors.Contains(Color::GREEN));
+	}
+}
+
+#endif // T_HASH_SET_TEST_H
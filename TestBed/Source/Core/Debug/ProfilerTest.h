@@ -0,0 +1,253 @@
+#ifndef PROFILER_TEST_H
+#define PROFILER_TEST_H
+
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Debug/Profiler.h"
+
+using namespace Forge::Debug;
+
+namespace ProfilerTest
+{
+	struct TraceEvent
+	{
+		std::string name;
+		unsigned thread;
+		unsigned depth;
+		unsigned long long begin;
+		unsigned long long end;
+	};
+
+	template<typename InType>
+	bool ReadValue(std::ifstream& stream, InType& value)
+	{
+		return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(InType)));
+	}
+
+	bool ReadString(std::ifstream& stream, std::string& value)
+	{
+		unsigned short length = 0;
+
+		if (!ReadValue(stream, length))
+			return false;
+
+		value.resize(length);
+		return length == 0 || static_cast<bool>(stream.read(&value[0], length));
+	}
+
+	bool ReadBinaryTrace(const char* path, std::vector<TraceEvent>& events)
+	{
+		std::ifstream stream(path, std::ios::binary);
+
+		unsigned magic, version, num_of_zones, num_of_threads;
+		unsigned long long frequency;
+
+		if (!ReadValue(stream, magic) || !ReadValue(stream, version) || !ReadValue(stream, frequency) ||
+			!ReadValue(stream, num_of_zones) || !ReadValue(stream, num_of_threads))
+			return false;
+
+		if (magic != Profiler::BINARY_MAGIC || version != Profiler::BINARY_VERSION || frequency == 0)
+			return false;
+
+		std::map<unsigned, std::string> zones;
+
+		for (unsigned i = 0; i < num_of_zones; i++)
+		{
+			unsigned id, line;
+			std::string name, file;
+
+			if (!ReadValue(stream, id) || !ReadValue(stream, line) || !ReadString(stream, name) || !ReadString(stream, file))
+				return false;
+
+			zones[id] = name;
+		}
+
+		for (unsigned i = 0; i < num_of_threads; i++)
+		{
+			unsigned thread, count;
+
+			if (!ReadValue(stream, thread) || !ReadValue(stream, count))
+				return false;
+
+			for (unsigned j = 0; j < count; j++)
+			{
+				unsigned zone;
+				TraceEvent event;
+				event.thread = thread;
+
+				if (!ReadValue(stream, zone) || !ReadValue(stream, event.depth) || !ReadValue(stream, event.begin) || !ReadValue(stream, event.end))
+					return false;
+
+				event.name = zones[zone];
+				events.push_back(event);
+			}
+		}
+
+		return stream.peek() == EOF;
+	}
+
+	/**
+	 * Tests that nested scopes are recorded with their depth and that inner
+	 * zones are contained within their parents.
+	 */
+	TEST(ProfilerTest, BinaryTraceRecordsNestedScopes)
+	{
+		Profiler::GetInstance().Clear();
+
+		{
+			FORGE_PROFILE_SCOPE("Outer");
+			{
+				FORGE_PROFILE_SCOPE("Inner");
+			}
+		}
+
+		std::vector<TraceEvent> events;
+		ASSERT_TRUE(Profiler::GetInstance().WriteBinaryTrace("ProfilerTest.bin"));
+		ASSERT_TRUE(ReadBinaryTrace("ProfilerTest.bin", events));
+		std::remove("ProfilerTest.bin");
+
+		ASSERT_EQ(events.size(), 2u);
+
+		EXPECT_EQ(events[0].name, "Inner");
+		EXPECT_EQ(events[0].depth, 1u);
+		EXPECT_EQ(events[1].name, "Outer");
+		EXPECT_EQ(events[1].depth, 0u);
+
+		EXPECT_LE(events[1].begin, events[0].begin);
+		EXPECT_GE(events[1].end, events[0].end);
+	}
+
+	/**
+	 * Tests that the Chrome trace output contains complete events with
+	 * escaped zone names.
+	 */
+	TEST(ProfilerTest, ChromeTraceContainsEscapedZones)
+	{
+		Profiler::GetInstance().Clear();
+
+		{
+			FORGE_PROFILE_SCOPE("Quoted \"Zone\"");
+		}
+
+		ASSERT_TRUE(Profiler::GetInstance().WriteChromeTrace("ProfilerTest.json"));
+
+		std::stringstream contents;
+		contents << std::ifstream("ProfilerTest.json").rdbuf();
+		std::remove("ProfilerTest.json");
+
+		std::string json = contents.str();
+
+		EXPECT_EQ(json.front(), '{');
+		EXPECT_NE(json.find("\"traceEvents\":["), std::string::npos);
+		EXPECT_NE(json.find("\"name\":\"Quoted \\\"Zone\\\"\""), std::string::npos);
+		EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+		EXPECT_NE(json.find("]}"), std::string::npos);
+	}
+
+	/**
+	 * Tests that every thread records into its own buffer and that all of
+	 * them are drained on flush.
+	 */
+	TEST(ProfilerTest, MultiThreadedRecording)
+	{
+		const size_t num_of_threads = 4;
+		const size_t num_of_zones   = 1000;
+
+		Profiler::GetInstance().Clear();
+
+		std::vector<std::thread> threads;
+
+		for (size_t i = 0; i < num_of_threads; i++)
+		{
+			threads.emplace_back([&]()
+			{
+				for (size_t j = 0; j < num_of_zones; j++)
+				{
+					FORGE_PROFILE_SCOPE("Worker");
+				}
+			});
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		std::vector<TraceEvent> events;
+		ASSERT_TRUE(Profiler::GetInstance().WriteBinaryTrace("ProfilerTest.bin"));
+		ASSERT_TRUE(ReadBinaryTrace("ProfilerTest.bin", events));
+		std::remove("ProfilerTest.bin");
+
+		std::map<unsigned, size_t> per_thread;
+
+		for (const TraceEvent& event : events)
+		{
+			EXPECT_EQ(event.name, "Worker");
+			per_thread[event.thread]++;
+		}
+
+		EXPECT_EQ(per_thread.size(), num_of_threads);
+
+		for (const auto& pair : per_thread)
+			EXPECT_EQ(pair.second, num_of_zones);
+	}
+
+	/**
+	 * Tests that overrunning a thread buffer keeps the most recent events and
+	 * counts the lost ones.
+	 */
+	TEST(ProfilerTest, OverrunDropsOldestEvents)
+	{
+		const size_t overrun = 100;
+
+		Profiler& profiler = Profiler::GetInstance();
+		profiler.Clear();
+
+		unsigned long long dropped_events = profiler.GetNumOfDroppedEvents();
+
+		for (size_t i = 0; i < ProfileThreadBuffer::CAPACITY + overrun; i++)
+		{
+			FORGE_PROFILE_SCOPE("Overrun");
+		}
+
+		std::vector<TraceEvent> events;
+		ASSERT_TRUE(profiler.WriteBinaryTrace("ProfilerTest.bin"));
+		ASSERT_TRUE(ReadBinaryTrace("ProfilerTest.bin", events));
+		std::remove("ProfilerTest.bin");
+
+		// One slot is always reserved for the event being written.
+		EXPECT_EQ(events.size(), static_cast<size_t>(ProfileThreadBuffer::CAPACITY - 1));
+		EXPECT_EQ(profiler.GetNumOfDroppedEvents() - dropped_events, overrun + 1);
+	}
+
+	/**
+	 * Tests that no events are recorded while the profiler is disabled.
+	 */
+	TEST(ProfilerTest, DisabledProfilerRecordsNothing)
+	{
+		Profiler& profiler = Profiler::GetInstance();
+		profiler.Clear();
+		profiler.SetEnabled(false);
+
+		{
+			FORGE_PROFILE_SCOPE("Disabled");
+		}
+
+		profiler.SetEnabled(true);
+
+		std::vector<TraceEvent> events;
+		ASSERT_TRUE(profiler.WriteBinaryTrace("ProfilerTest.bin"));
+		ASSERT_TRUE(ReadBinaryTrace("ProfilerTest.bin", events));
+		std::remove("ProfilerTest.bin");
+
+		EXPECT_TRUE(events.empty());
+	}
+}
+
+#endif // PROFILER_TEST_H
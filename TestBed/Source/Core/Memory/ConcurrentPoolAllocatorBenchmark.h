@@ -0,0 +1,67 @@
+#ifndef CONCURRENT_POOL_ALLOCATOR_BENCHMARK_H
+#define CONCURRENT_POOL_ALLOCATOR_BENCHMARK_H
+
+#include <gtest/gtest.h>
+
+#include "Source/Benchmark/BenchmarkUtilities.h"
+
+#include "Core/Public/Memory/PoolAllocator.h"
+#include "Core/Public/Memory/ConcurrentPoolAllocator.h"
+
+using namespace Forge::Memory;
+
+namespace ConcurrentPoolAllocatorBenchmark
+{
+	namespace Internal
+	{
+		/**
+		 * Has every thread repeatedly allocate a small batch of chunks and free
+		 * it again, returning the average nanoseconds per allocation/free pair.
+		 */
+		template<typename InAllocator>
+		double RunContentionWorkload(InAllocator& allocator, int thread_count, int operations)
+		{
+			double elapsed = BenchmarkUtilities::MeasureThreadedNanoseconds(thread_count, [&](int)
+			{
+				void* chunks[8];
+
+				for (int i = 0; i < operations; i += 8)
+				{
+					for (void*& chunk : chunks)
+						chunk = allocator.Allocate(64);
+
+					for (void* chunk : chunks)
+						allocator.Deallocate(chunk);
+				}
+			});
+
+			return elapsed / (static_cast<double>(operations) * thread_count);
+		}
+	}
+
+	/**
+	 * Compares a mutex guarded pool allocator against the lock-free pool as
+	 * the number of contending threads grows.
+	 */
+	TEST(ConcurrentPoolAllocatorBenchmark, DISABLED_Contention)
+	{
+		const int operations = 400000;
+
+		int thread_counts[] = { 1, 2, 4, 8, 16 };
+
+		for (int thread_count : thread_counts)
+		{
+			BenchmarkUtilities::LockedAllocator<PoolAllocator> locked(64, 64 * 8 * thread_count);
+			ConcurrentPoolAllocator concurrent(64, 64 * 8 * thread_count);
+
+			std::string suffix = "/" + std::to_string(thread_count) + "Threads/NanosecondsPerOperation";
+
+			BenchmarkUtilities::RecordMeasurement("Locked" + suffix, Internal::RunContentionWorkload(locked, thread_count, operations), "ns");
+			BenchmarkUtilities::RecordMeasurement("LockFree" + suffix, Internal::RunContentionWorkload(concurrent, thread_count, operations), "ns");
+
+			EXPECT_EQ(concurrent.GetUsedMemory(), 0);
+		}
+	}
+}
+
+#endif
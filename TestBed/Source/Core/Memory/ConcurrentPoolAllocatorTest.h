@@ -0,0 +1,101 @@
+#ifndef CONCURRENT_POOL_ALLOCATOR_TEST_H
+#define CONCURRENT_POOL_ALLOCATOR_TEST_H
+
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Memory/ConcurrentPoolAllocator.h"
+
+using namespace Forge::Memory;
+
+namespace ConcurrentPoolAllocatorTest
+{
+	/**
+	 * Tests that every chunk of the pool is handed out exactly once before
+	 * the pool reports exhaustion, and that reset makes them available again.
+	 */
+	TEST(ConcurrentPoolAllocatorTest, ExhaustAndReset)
+	{
+		ConcurrentPoolAllocator allocator(32, 32 * 64);
+
+		std::set<void*> addresses;
+
+		while (void* address = allocator.Allocate(32))
+			addresses.insert(address);
+
+		EXPECT_EQ(addresses.size(), 64);
+		EXPECT_EQ(allocator.GetUsedMemory(), 32 * 64);
+
+		allocator.Reset();
+
+		EXPECT_EQ(allocator.GetUsedMemory(), 0);
+		EXPECT_NE(allocator.Allocate(32), nullptr);
+	}
+
+	/**
+	 * Tests that chunks allocated and freed concurrently are never owned by
+	 * two threads at the same time.
+	 */
+	TEST(ConcurrentPoolAllocatorTest, MultiThreadedStress)
+	{
+		const int thread_count = 8;
+		const int iterations   = 50000;
+		const int held_chunks  = 16;
+
+		ConcurrentPoolAllocator allocator(64, 64 * thread_count * held_chunks);
+
+		std::vector<int> corruptions(thread_count, 0);
+		std::vector<std::thread> threads;
+
+		for (int t = 0; t < thread_count; t++)
+		{
+			threads.emplace_back([&, t]()
+			{
+				unsigned long long* chunks[held_chunks] = {};
+				unsigned long long tag = t + 1;
+
+				for (int i = 0; i < iterations; i++)
+				{
+					unsigned long long*& chunk = chunks[i % held_chunks];
+
+					if (chunk)
+					{
+						for (int j = 0; j < 8; j++)
+							if (chunk[j] != tag)
+								corruptions[t]++;
+
+						allocator.Deallocate(chunk);
+					}
+
+					chunk = static_cast<unsigned long long*>(allocator.Allocate(64));
+
+					if (!chunk)
+					{
+						corruptions[t]++;
+						continue;
+					}
+
+					for (int j = 0; j < 8; j++)
+						chunk[j] = tag;
+				}
+
+				for (unsigned long long* chunk : chunks)
+					allocator.Deallocate(chunk);
+			});
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		for (int t = 0; t < thread_count; t++)
+			EXPECT_EQ(corruptions[t], 0);
+
+		EXPECT_EQ(allocator.GetUsedMemory(), 0);
+		EXPECT_EQ(allocator.GetNumOfAllocs(), allocator.GetNumOfDeallocs());
+	}
+}
+
+#endif
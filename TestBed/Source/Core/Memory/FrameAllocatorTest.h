@@ -0,0 +1,89 @@
+#ifndef FRAME_ALLOCATOR_TEST_H
+#define FRAME_ALLOCATOR_TEST_H
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Memory/FrameAllocator.h"
+
+using namespace Forge::Memory;
+
+namespace FrameAllocatorTest
+{
+	/**
+	 * Tests that data written during a frame survives the following frame
+	 * and that its memory is recycled the frame after.
+	 */
+	TEST(FrameAllocatorTest, DataLivesForOneExtraFrame)
+	{
+		FrameAllocator allocator(4096);
+
+		char* first = static_cast<char*>(allocator.Allocate(64, 8));
+		std::strcpy(first, "frame zero");
+
+		allocator.NextFrame();
+
+		char* second = static_cast<char*>(allocator.Allocate(64, 8));
+		std::strcpy(second, "frame one");
+
+		EXPECT_STREQ(first, "frame zero");
+		EXPECT_NE(first, second);
+
+		allocator.NextFrame();
+
+		EXPECT_EQ(allocator.Allocate(64, 8), first);
+		EXPECT_STREQ(second, "frame one");
+		EXPECT_EQ(allocator.GetFrameIndex(), 2);
+	}
+
+	/**
+	 * Tests that allocations exceeding the frame size overflow into the free
+	 * list allocator and are released once the frame is recycled.
+	 */
+	TEST(FrameAllocatorTest, OverflowFallback)
+	{
+		FreeListAllocator overflow(1 << 16, FreeListPolicy::FORGE_SEGREGATED_FIT);
+		FrameAllocator allocator(1024, &overflow);
+
+		EXPECT_NE(allocator.Allocate(1000, 8), nullptr);
+
+		void* spilled = allocator.Allocate(512, 64);
+
+		EXPECT_NE(spilled, nullptr);
+		EXPECT_EQ(reinterpret_cast<unsigned long long>(spilled) % 64, 0);
+		EXPECT_EQ(allocator.GetFrameStats().m_num_of_overflow_allocs, 1);
+		EXPECT_EQ(allocator.GetFrameStats().m_overflow_memory, 512);
+		EXPECT_GT(overflow.GetUsedMemory(), 0);
+
+		allocator.NextFrame();
+
+		EXPECT_EQ(allocator.GetLastFrameStats().m_num_of_allocs, 2);
+		EXPECT_GE(allocator.GetLastFrameStats().m_peak_size, 1512);
+		EXPECT_GT(overflow.GetUsedMemory(), 0);
+
+		allocator.NextFrame();
+
+		EXPECT_EQ(overflow.GetUsedMemory(), 0);
+		EXPECT_EQ(allocator.GetLastFrameStats().m_num_of_allocs, 0);
+	}
+
+	/**
+	 * Tests that a full frame without an overflow allocator fails the
+	 * allocation instead of handing out memory of the previous frame.
+	 */
+	TEST(FrameAllocatorTest, ExhaustionWithoutOverflow)
+	{
+		FrameAllocator allocator(256);
+
+		EXPECT_NE(allocator.Allocate(200, 8), nullptr);
+		EXPECT_EQ(allocator.Allocate(200, 8), nullptr);
+
+		allocator.Reset();
+
+		EXPECT_NE(allocator.Allocate(200, 8), nullptr);
+		EXPECT_EQ(allocator.GetUsedMemory(), 200);
+	}
+}
+
+#endif
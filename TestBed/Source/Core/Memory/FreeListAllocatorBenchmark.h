@@ -0,0 +1,103 @@
+#ifndef FREE_LIST_ALLOCATOR_BENCHMARK_H
+#define FREE_LIST_ALLOCATOR_BENCHMARK_H
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Source/Benchmark/BenchmarkUtilities.h"
+
+#include "Core/Public/Memory/FreeListAllocator.h"
+
+using namespace Forge::Memory;
+
+namespace FreeListAllocatorBenchmark
+{
+	namespace Internal
+	{
+		const char* GetPolicyName(FreeListPolicy policy)
+		{
+			return policy == FreeListPolicy::FORGE_BEST_FIT ? "BestFit" : "SegregatedFit";
+		}
+
+		/**
+		 * Fragments the pool by allocating a large number of random sized
+		 * blocks and freeing every other one, then measures a steady state of
+		 * random frees and allocations on top of the fragmented pool.
+		 */
+		void RunFragmentationWorkload(FreeListPolicy policy, int live_blocks, int operations)
+		{
+			FreeListAllocator allocator(64 * 1024 * 1024, policy);
+
+			std::mt19937 generator(42);
+			std::uniform_int_distribution<int> size_distribution(16, 512);
+
+			std::vector<void*> addresses(live_blocks, nullptr);
+			std::vector<int> sizes(operations);
+			std::vector<int> slots(operations);
+
+			for (int i = 0; i < operations; i++)
+			{
+				sizes[i] = size_distribution(generator);
+				slots[i] = generator() % live_blocks;
+			}
+
+			for (int i = 0; i < live_blocks; i++)
+				addresses[i] = allocator.Allocate(size_distribution(generator), 8);
+
+			for (int i = 0; i < live_blocks; i += 2)
+			{
+				allocator.Deallocate(addresses[i]);
+				addresses[i] = nullptr;
+			}
+
+			int failed_allocations = 0;
+
+			double elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (int i = 0; i < operations; i++)
+				{
+					void*& address = addresses[slots[i]];
+
+					if (address)
+						allocator.Deallocate(address);
+
+					address = allocator.Allocate(sizes[i], 8);
+
+					if (!address)
+						failed_allocations++;
+				}
+			});
+
+			std::string prefix = std::string(GetPolicyName(policy)) + "/" + std::to_string(live_blocks) + "Blocks";
+
+			BenchmarkUtilities::RecordMeasurement(prefix + "/NanosecondsPerOperation", elapsed / operations, "ns");
+			BenchmarkUtilities::RecordMeasurement(prefix + "/UsedMemory", static_cast<double>(allocator.GetUsedMemory()), "bytes");
+			BenchmarkUtilities::RecordMeasurement(prefix + "/FailedAllocations", failed_allocations, "allocs");
+
+			for (void* address : addresses)
+				if (address)
+					allocator.Deallocate(address);
+
+			EXPECT_EQ(allocator.GetUsedMemory(), 0);
+		}
+	}
+
+	/**
+	 * Compares the best fit walk against the segregated fit bins as the
+	 * number of free blocks grows.
+	 */
+	TEST(FreeListAllocatorBenchmark, DISABLED_Fragmentation)
+	{
+		int live_block_counts[] = { 1000, 4000, 16000 };
+
+		for (int live_blocks : live_block_counts)
+		{
+			Internal::RunFragmentationWorkload(FreeListPolicy::FORGE_BEST_FIT, live_blocks, 20000);
+			Internal::RunFragmentationWorkload(FreeListPolicy::FORGE_SEGREGATED_FIT, live_blocks, 20000);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,168 @@
+#ifndef FREE_LIST_ALLOCATOR_TEST_H
+#define FREE_LIST_ALLOCATOR_TEST_H
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Memory/FreeListAllocator.h"
+
+using namespace Forge::Memory;
+
+namespace FreeListAllocatorTest
+{
+	/**
+	 * Tests that a segregated fit allocation returns properly aligned
+	 * addresses for every supported alignment.
+	 */
+	TEST(FreeListAllocatorTest, SegregatedFitAlignment)
+	{
+		FreeListAllocator allocator(1 << 16, FreeListPolicy::FORGE_SEGREGATED_FIT);
+
+		for (int alignment = 1; alignment <= 128; alignment <<= 1)
+		{
+			void* address = allocator.Allocate(24, alignment);
+
+			EXPECT_NE(address, nullptr);
+			EXPECT_EQ(reinterpret_cast<unsigned long long>(address) % alignment, 0);
+		}
+	}
+
+	/**
+	 * Tests that a segregated fit allocator coalesces freed blocks so the
+	 * whole pool can be allocated again.
+	 */
+	TEST(FreeListAllocatorTest, SegregatedFitCoalescing)
+	{
+		FreeListAllocator allocator(1 << 16, FreeListPolicy::FORGE_SEGREGATED_FIT);
+
+		void* addresses[64];
+
+		for (int i = 0; i < 64; i++)
+			addresses[i] = allocator.Allocate(100);
+
+		for (int i = 0; i < 64; i += 2)
+			allocator.Deallocate(addresses[i]);
+
+		for (int i = 1; i < 64; i += 2)
+			allocator.Deallocate(addresses[i]);
+
+		EXPECT_EQ(allocator.GetUsedMemory(), 0);
+		EXPECT_NE(allocator.Allocate((1 << 16) - 64), nullptr);
+	}
+
+	/**
+	 * Tests that a segregated fit reallocation to a smaller size with a
+	 * stricter alignment copies only what fits in the new block, leaving the
+	 * allocation after it intact.
+	 */
+	TEST(FreeListAllocatorTest, SegregatedFitShrinkingReallocate)
+	{
+		FreeListAllocator allocator(1 << 16, FreeListPolicy::FORGE_SEGREGATED_FIT);
+
+		/// The hole is the smallest free block fitting the reallocation, so
+		/// the new block lands right before the guard.
+		unsigned char* address = static_cast<unsigned char*>(allocator.Allocate(400, 1));
+		void* hole = allocator.Allocate(240, 1);
+		unsigned char* guard = static_cast<unsigned char*>(allocator.Allocate(64, 1));
+
+		for (int i = 0; i < 400; i++)
+			address[i] = static_cast<unsigned char>(i);
+
+		for (int i = 0; i < 64; i++)
+			guard[i] = 0xEE;
+
+		allocator.Deallocate(hole);
+
+		unsigned char* reallocated = static_cast<unsigned char*>(allocator.Reallocate(address, 16, 128));
+
+		EXPECT_EQ(reinterpret_cast<unsigned long long>(reallocated) % 128, 0);
+
+		for (int i = 0; i < 16; i++)
+			EXPECT_EQ(reallocated[i], i);
+
+		for (int i = 0; i < 64; i++)
+			EXPECT_EQ(guard[i], 0xEE);
+	}
+
+	/**
+	 * Tests that a best fit reallocation keeps a block that still fits, and
+	 * otherwise moves the content to a new block without touching the
+	 * allocation after the old one.
+	 */
+	TEST(FreeListAllocatorTest, BestFitReallocate)
+	{
+		FreeListAllocator allocator(1 << 16, FreeListPolicy::FORGE_BEST_FIT);
+
+		unsigned char* address = static_cast<unsigned char*>(allocator.Allocate(64));
+		unsigned char* guard = static_cast<unsigned char*>(allocator.Allocate(64));
+
+		for (int i = 0; i < 64; i++)
+		{
+			address[i] = static_cast<unsigned char>(i);
+			guard[i] = 0xEE;
+		}
+
+		EXPECT_EQ(allocator.Reallocate(address, 32), address);
+
+		unsigned char* reallocated = static_cast<unsigned char*>(allocator.Reallocate(address, 1024));
+
+		ASSERT_NE(reallocated, nullptr);
+		EXPECT_NE(reallocated, address);
+
+		for (int i = 0; i < 64; i++)
+		{
+			EXPECT_EQ(reallocated[i], i);
+			EXPECT_EQ(guard[i], 0xEE);
+		}
+
+		/// The old block is free again, so an allocation of its size fits
+		/// before the guard.
+		EXPECT_EQ(allocator.Allocate(64), address);
+
+		EXPECT_EQ(allocator.GetNumOfAllocs() - allocator.GetNumOfDeallocs(), 3);
+	}
+
+	/**
+	 * Tests that both policies keep allocations intact under a mixed
+	 * allocation and deallocation workload.
+	 */
+	TEST(FreeListAllocatorTest, MixedWorkload)
+	{
+		FreeListPolicy policies[] = { FreeListPolicy::FORGE_BEST_FIT, FreeListPolicy::FORGE_SEGREGATED_FIT };
+
+		for (FreeListPolicy policy : policies)
+		{
+			FreeListAllocator allocator(1 << 18, policy);
+
+			unsigned char* addresses[128] = {};
+
+			for (int round = 0; round < 16; round++)
+			{
+				for (int i = round % 2; i < 128; i += 2)
+				{
+					if (addresses[i])
+					{
+						for (int j = 0; j < 16 + i; j++)
+							EXPECT_EQ(addresses[i][j], i);
+
+						allocator.Deallocate(addresses[i]);
+					}
+
+					addresses[i] = reinterpret_cast<unsigned char*>(allocator.Allocate(16 + i, 8));
+
+					ASSERT_NE(addresses[i], nullptr);
+
+					for (int j = 0; j < 16 + i; j++)
+						addresses[i][j] = i;
+				}
+			}
+
+			for (int i = 0; i < 128; i++)
+				if (addresses[i])
+					allocator.Deallocate(addresses[i]);
+
+			EXPECT_EQ(allocator.GetUsedMemory(), 0);
+		}
+	}
+}
+
+#endif
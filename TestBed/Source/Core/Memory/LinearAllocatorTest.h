@@ -0,0 +1,81 @@
+#ifndef LINEAR_ALLOCATOR_TEST_H
+#define LINEAR_ALLOCATOR_TEST_H
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Memory/LinearAllocator.h"
+
+#include "Platform/Public/Platform.h"
+
+using namespace Forge::Memory;
+using namespace Forge::Platform;
+
+namespace LinearAllocatorTest
+{
+	/**
+	 * Tests that a fixed size linear allocator fails once the pool is full
+	 * and serves allocations again after a reset.
+	 */
+	TEST(LinearAllocatorTest, FixedSizeExhaustion)
+	{
+		LinearAllocator allocator(1024);
+
+		EXPECT_NE(allocator.Allocate(1000, 8), nullptr);
+		EXPECT_EQ(allocator.Allocate(100, 8), nullptr);
+
+		allocator.Reset();
+
+		EXPECT_NE(allocator.Allocate(100, 8), nullptr);
+	}
+
+#if defined(FORGE_PLATFORM_WINDOWS) || defined(FORGE_PLATFORM_LINUX)
+	/**
+	 * Tests that a virtual memory backed linear allocator commits pages only
+	 * as allocations advance, and decommits pages above the retained size on
+	 * reset.
+	 */
+	TEST(LinearAllocatorTest, GrowableCommitAndDecommit)
+	{
+		AbstractPlatform* platform = &Forge::Platform::Platform::GetInstance();
+
+		size_t page_size = platform->GetPageSize();
+
+		LinearAllocator allocator(platform, 256 * 1024 * 1024, 256 * 1024);
+
+		EXPECT_EQ(allocator.GetCommittedSize(), 0);
+		EXPECT_EQ(allocator.GetTotalSize(), 256 * 1024 * 1024);
+
+		unsigned char* address = static_cast<unsigned char*>(allocator.Allocate(16, 16));
+
+		EXPECT_NE(address, nullptr);
+		EXPECT_GE(allocator.GetCommittedSize(), page_size);
+		EXPECT_LT(allocator.GetCommittedSize(), 1024 * 1024);
+
+		for (int i = 0; i < 64; i++)
+		{
+			unsigned char* block = static_cast<unsigned char*>(allocator.Allocate(1024 * 1024, 16));
+
+			ASSERT_NE(block, nullptr);
+
+			block[0] = 0xAB;
+			block[1024 * 1024 - 1] = 0xCD;
+		}
+
+		EXPECT_GE(allocator.GetCommittedSize(), 64 * 1024 * 1024);
+
+		allocator.Reset();
+
+		EXPECT_EQ(allocator.GetCommittedSize(), 256 * 1024);
+		EXPECT_EQ(allocator.GetUsedMemory(), 0);
+
+		address = static_cast<unsigned char*>(allocator.Allocate(64, 16));
+
+		for (int i = 0; i < 64; i++)
+			EXPECT_EQ(address[i], 0);
+
+		EXPECT_EQ(allocator.Allocate(512 * 1024 * 1024, 16), nullptr);
+	}
+#endif
+}
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef THREAD_CACHING_ALLOCATOR_BENCHMARK_H
+#define THREAD_CACHING_ALLOCATOR_BENCHMARK_H
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "Source/Benchmark/BenchmarkUtilities.h"
+
+#include "Core/Public/Memory/FreeListAllocator.h"
+#include "Core/Public/Memory/ThreadCachingAllocator.h"
+
+using namespace Forge::Memory;
+
+namespace ThreadCachingAllocatorBenchmark
+{
+	namespace Internal
+	{
+		/**
+		 * Runs the same small-object churn on every thread and returns the
+		 * average number of nanoseconds per allocation/free pair.
+		 */
+		template<typename InAllocator>
+		double RunChurnWorkload(InAllocator& allocator, int thread_count, int operations)
+		{
+			double elapsed = BenchmarkUtilities::MeasureThreadedNanoseconds(thread_count, [&](int t)
+			{
+				unsigned int seed = 42 + t;
+				void* addresses[64] = {};
+
+				for (int i = 0; i < operations; i++)
+				{
+					seed = seed * 1664525u + 1013904223u;
+
+					void*& address = addresses[(seed >> 8) % 64];
+
+					if (address)
+						allocator.Deallocate(address);
+
+					address = allocator.Allocate(16 + (seed >> 16) % 240);
+				}
+
+				for (void* address : addresses)
+					if (address)
+						allocator.Deallocate(address);
+			});
+
+			return elapsed / (static_cast<double>(operations) * thread_count);
+		}
+	}
+
+	/**
+	 * Compares a mutex guarded free list allocator against the thread caching
+	 * front-end from one thread up to the number of hardware threads.
+	 */
+	TEST(ThreadCachingAllocatorBenchmark, DISABLED_Scaling)
+	{
+		const int operations = 200000;
+
+		int max_thread_count = static_cast<int>(std::thread::hardware_concurrency());
+
+		for (int thread_count = 1; thread_count <= max_thread_count || thread_count == 1; thread_count *= 2)
+		{
+			BenchmarkUtilities::LockedAllocator<FreeListAllocator> locked(64 * 1024 * 1024, FreeListPolicy::FORGE_SEGREGATED_FIT);
+
+			FreeListAllocator backing(64 * 1024 * 1024, FreeListPolicy::FORGE_SEGREGATED_FIT);
+			ThreadCachingAllocator cached(&backing);
+
+			std::string suffix = "/" + std::to_string(thread_count) + "Threads/NanosecondsPerOperation";
+
+			BenchmarkUtilities::RecordMeasurement("Locked" + suffix, Internal::RunChurnWorkload(locked, thread_count, operations), "ns");
+			BenchmarkUtilities::RecordMeasurement("ThreadCaching" + suffix, Internal::RunChurnWorkload(cached, thread_count, operations), "ns");
+
+			EXPECT_EQ(cached.GetUsedMemory(), 0);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,175 @@
+#ifndef THREAD_CACHING_ALLOCATOR_TEST_H
+#define THREAD_CACHING_ALLOCATOR_TEST_H
+
+#include <thread>
+#include <vector>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Memory/FreeListAllocator.h"
+#include "Core/Public/Memory/ThreadCachingAllocator.h"
+
+using namespace Forge::Memory;
+
+namespace ThreadCachingAllocatorTest
+{
+	/**
+	 * Tests that cached and large allocations honour the requested alignment
+	 * and that freed blocks are reused by the same thread.
+	 */
+	TEST(ThreadCachingAllocatorTest, AlignmentAndReuse)
+	{
+		FreeListAllocator backing(1 << 20, FreeListPolicy::FORGE_SEGREGATED_FIT);
+		ThreadCachingAllocator allocator(&backing);
+
+		for (int alignment = 1; alignment <= 128; alignment <<= 1)
+		{
+			void* address = allocator.Allocate(48, alignment);
+
+			EXPECT_NE(address, nullptr);
+			EXPECT_EQ(reinterpret_cast<unsigned long long>(address) % alignment, 0);
+
+			allocator.Deallocate(address);
+		}
+
+		void* first = allocator.Allocate(100);
+		allocator.Deallocate(first);
+
+		EXPECT_EQ(allocator.Allocate(100), first);
+
+		void* large = allocator.Allocate(64 * 1024);
+
+		EXPECT_NE(large, nullptr);
+
+		allocator.Deallocate(large);
+		allocator.Deallocate(first);
+
+		EXPECT_EQ(allocator.GetUsedMemory(), 0);
+	}
+
+	/**
+	 * Tests that reallocation preserves the content of the original block
+	 * across size classes.
+	 */
+	TEST(ThreadCachingAllocatorTest, Reallocate)
+	{
+		FreeListAllocator backing(1 << 20, FreeListPolicy::FORGE_SEGREGATED_FIT);
+		ThreadCachingAllocator allocator(&backing);
+
+		unsigned char* address = static_cast<unsigned char*>(allocator.Allocate(32));
+
+		for (int i = 0; i < 32; i++)
+			address[i] = static_cast<unsigned char>(i);
+
+		address = static_cast<unsigned char*>(allocator.Reallocate(address, 8192));
+
+		for (int i = 0; i < 32; i++)
+			EXPECT_EQ(address[i], i);
+
+		allocator.Deallocate(address);
+
+		EXPECT_EQ(allocator.GetUsedMemory(), 0);
+	}
+
+	/**
+	 * Tests that exiting threads drain their magazines to the backing
+	 * allocator and return their slot, so threads created afterwards keep
+	 * getting a cache.
+	 */
+	TEST(ThreadCachingAllocatorTest, ThreadExitRecyclesSlots)
+	{
+		FreeListAllocator backing(1 << 20, FreeListPolicy::FORGE_SEGREGATED_FIT);
+		ThreadCachingAllocator allocator(&backing);
+
+		for (int t = 0; t < 256; t++)
+		{
+			size_t backing_allocs = 0;
+
+			std::thread thread([&]()
+			{
+				size_t first_backing_allocs = backing.GetNumOfAllocs();
+
+				allocator.Deallocate(allocator.Allocate(100));
+
+				backing_allocs = backing.GetNumOfAllocs() - first_backing_allocs;
+			});
+
+			thread.join();
+
+			/// A cached allocation refills a whole magazine at once.
+			EXPECT_GT(backing_allocs, 1);
+			EXPECT_EQ(backing.GetUsedMemory(), 0);
+		}
+
+		EXPECT_EQ(allocator.GetUsedMemory(), 0);
+		EXPECT_EQ(allocator.GetNumOfAllocs(), 256);
+	}
+
+	/**
+	 * Tests that several threads allocating, writing and freeing blocks of
+	 * random sizes never receive overlapping memory.
+	 */
+	TEST(ThreadCachingAllocatorTest, MultiThreadedStress)
+	{
+		FreeListAllocator backing(32 * 1024 * 1024, FreeListPolicy::FORGE_SEGREGATED_FIT);
+		ThreadCachingAllocator allocator(&backing);
+
+		const int thread_count = 8;
+		const int iterations   = 20000;
+
+		std::vector<int> corruptions(thread_count, 0);
+		std::vector<std::thread> threads;
+
+		for (int t = 0; t < thread_count; t++)
+		{
+			threads.emplace_back([&, t]()
+			{
+				unsigned int seed = 1234 + t;
+				void* addresses[128] = {};
+				int sizes[128] = {};
+
+				for (int i = 0; i < iterations; i++)
+				{
+					seed = seed * 1664525u + 1013904223u;
+
+					int slot = (seed >> 8) % 128;
+					unsigned char tag = static_cast<unsigned char>(t + 1);
+
+					if (addresses[slot])
+					{
+						unsigned char* bytes = static_cast<unsigned char*>(addresses[slot]);
+
+						for (int j = 0; j < sizes[slot]; j++)
+							if (bytes[j] != tag)
+							{
+								corruptions[t]++;
+								break;
+							}
+
+						allocator.Deallocate(addresses[slot]);
+					}
+
+					sizes[slot] = 1 + (seed >> 16) % 2048;
+					addresses[slot] = allocator.Allocate(sizes[slot], 8);
+
+					std::memset(addresses[slot], tag, sizes[slot]);
+				}
+
+				for (void* address : addresses)
+					allocator.Deallocate(address);
+			});
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		for (int t = 0; t < thread_count; t++)
+			EXPECT_EQ(corruptions[t], 0);
+
+		EXPECT_EQ(allocator.GetUsedMemory(), 0);
+		EXPECT_EQ(allocator.GetNumOfAllocs(), allocator.GetNumOfDeallocs());
+	}
+}
+
+#endif
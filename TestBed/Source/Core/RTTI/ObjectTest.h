@@ -0,0 +1,99 @@
+#ifndef OBJECT_TEST_H
+#define OBJECT_TEST_H
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/RTTI/Object.h"
+#include "Core/Public/Types/SmartPointer.h"
+
+using namespace Forge::RTTI;
+
+namespace ObjectTest
+{
+	namespace Internal
+	{
+		class Shape : public Object
+		{
+		public:
+			FORGE_DECLARE_TYPEINFO(Shape, Object)
+
+		public:
+			static int s_live;
+
+		public:
+			Shape() { s_live++; }
+		   ~Shape() { s_live--; }
+
+		public:
+			TSharedPtr<Object> Clone(void) override { return Forge::Common::MakeShared<Shape>(nullptr); }
+			TSharedPtr<Object> Clone(AbstractAllocator* allocator) override { return Forge::Common::MakeShared<Shape>(allocator); }
+		};
+
+		inline int Shape::s_live = 0;
+
+		class Circle : public Shape
+		{
+		public:
+			FORGE_DECLARE_TYPEINFO(Circle, Shape)
+		};
+	}
+
+	/**
+	 * Tests that casting an object created with MakeShared shares ownership
+	 * with its pointer, so the object is destroyed once by the last owner.
+	 */
+	TEST(ObjectTest, CastsShareOwnership)
+	{
+		{
+			TSharedPtr<Object> object = Forge::Common::MakeShared<Internal::Circle>(nullptr);
+
+			TSharedPtr<Internal::Circle> circle = object->DynamicCast<Internal::Circle>();
+			TSharedPtr<Internal::Shape> shape = object->StaticCast<Internal::Shape>();
+
+			ASSERT_TRUE(static_cast<bool>(circle));
+			EXPECT_EQ(circle, object);
+			EXPECT_EQ(shape, object);
+			EXPECT_EQ(object.GetRefCount(), 3);
+
+			object.Reset();
+
+			EXPECT_EQ(Internal::Shape::s_live, 1);
+			EXPECT_EQ(circle.GetRefCount(), 2);
+		}
+
+		EXPECT_EQ(Internal::Shape::s_live, 0);
+	}
+
+	/**
+	 * Tests that casts of adopted objects share the adopting pointer, and
+	 * that a failed dynamic cast returns an empty pointer.
+	 */
+	TEST(ObjectTest, CastsOfAdoptedObjects)
+	{
+		{
+			TSharedPtr<Internal::Shape> shape(new Internal::Shape());
+
+			EXPECT_TRUE(shape->DynamicCast<Internal::Circle>().IsNull());
+			EXPECT_EQ(shape->DynamicCast<Internal::Shape>(), shape);
+			EXPECT_EQ(shape.GetRefCount(), 1);
+		}
+
+		EXPECT_EQ(Internal::Shape::s_live, 0);
+
+		/// Objects no pointer manages can not be cast to a shared pointer.
+		Internal::Shape shape;
+
+		EXPECT_TRUE(shape.StaticCast<Internal::Shape>().IsNull());
+	}
+
+	/**
+	 * Tests that objects carry no reference counts of their own, only the
+	 * link to the control block of their TSharedPtr.
+	 */
+	TEST(ObjectTest, CarriesNoCounts)
+	{
+		EXPECT_EQ(sizeof(Object), 2 * sizeof(void*));
+	}
+}
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef REF_COUNTED_BENCHMARK_H
+#define REF_COUNTED_BENCHMARK_H
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Source/Benchmark/BenchmarkUtilities.h"
+
+#include "Core/Public/RTTI/RefCounter.h"
+
+using namespace Forge::RTTI;
+
+/**
+ * Measures reference churn, one reference taken and released on every
+ * object of a large array, for the atomic and non-atomic counts stored
+ * inline as MakeShared() does, for counts stored in a separately allocated
+ * block as RefCounted used to do, and for copies of std::shared_ptr.
+ */
+namespace RefCountedBenchmark
+{
+	namespace Internal
+	{
+		const size_t OBJECT_COUNT = 1 << 16;
+		const size_t REPETITIONS = 64;
+
+		struct SharedObject : public TRefCount<AtomicRefCountPolicy> { virtual ~SharedObject() = default; };
+		struct LocalObject : public TRefCount<NonAtomicRefCountPolicy> { virtual ~LocalObject() = default; };
+
+		struct HeapCountedObject
+		{
+			struct Counter
+			{
+				size_t m_ref = 0;
+				size_t m_weak_ref = 0;
+			};
+
+			Counter* m_counter = new Counter();
+
+			virtual ~HeapCountedObject() { delete m_counter; }
+
+			void IncrementRef() { m_counter->m_ref++; }
+			size_t DecrementRef() { return --m_counter->m_ref; }
+		};
+
+		template<typename InObject>
+		void Run(const char* name)
+		{
+			std::vector<InObject*> objects;
+
+			for (size_t i = 0; i < OBJECT_COUNT; i++)
+			{
+				objects.push_back(new InObject());
+				objects.back()->IncrementRef();
+			}
+
+			size_t remaining = 0;
+
+			double elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t r = 0; r < REPETITIONS; r++)
+					for (InObject* object : objects)
+					{
+						object->IncrementRef();
+						remaining += object->DecrementRef();
+					}
+			});
+
+			EXPECT_EQ(remaining, OBJECT_COUNT * REPETITIONS);
+
+			BenchmarkUtilities::RecordMeasurement(name, elapsed / (OBJECT_COUNT * REPETITIONS), "ns/op");
+
+			for (InObject* object : objects)
+				delete object;
+		}
+	}
+
+	TEST(RefCountedBenchmark, DISABLED_RefChurn)
+	{
+		Internal::Run<Internal::SharedObject>("RefCounted/Atomic");
+		Internal::Run<Internal::LocalObject>("RefCounted/NonAtomic");
+		Internal::Run<Internal::HeapCountedObject>("RefCounted/HeapCounter");
+
+		std::vector<std::shared_ptr<int>> pointers;
+
+		for (size_t i = 0; i < Internal::OBJECT_COUNT; i++)
+			pointers.push_back(std::make_shared<int>(0));
+
+		size_t remaining = 0;
+
+		double elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+		{
+			for (size_t r = 0; r < Internal::REPETITIONS; r++)
+				for (const std::shared_ptr<int>& pointer : pointers)
+				{
+					std::shared_ptr<int> copy = pointer;
+					remaining += copy.use_count() - 1;
+				}
+		});
+
+		EXPECT_EQ(remaining, Internal::OBJECT_COUNT * Internal::REPETITIONS);
+
+		BenchmarkUtilities::RecordMeasurement("std::shared_ptr", elapsed / (Internal::OBJECT_COUNT * Internal::REPETITIONS), "ns/op");
+	}
+}
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef REF_COUNTED_TEST_H
+#define REF_COUNTED_TEST_H
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/RTTI/RefCounter.h"
+
+using namespace Forge::RTTI;
+
+namespace RefCountedTest
+{
+	namespace Internal
+	{
+		using SharedObject = TRefCount<AtomicRefCountPolicy>;
+		using LocalObject  = TRefCount<NonAtomicRefCountPolicy>;
+
+		template<typename InObject>
+		void CheckCounts()
+		{
+			InObject object;
+
+			EXPECT_EQ(object.GetRefCount(), 0);
+			EXPECT_EQ(object.GetWeakRefCount(), 0);
+
+			object.IncrementRef();
+			object.IncrementRef();
+			object.IncrementWeakRef();
+
+			EXPECT_EQ(object.GetRefCount(), 2);
+			EXPECT_EQ(object.GetWeakRefCount(), 1);
+
+			EXPECT_EQ(object.DecrementRef(), 1);
+			EXPECT_EQ(object.DecrementRef(), 0);
+			EXPECT_EQ(object.DecrementWeakRef(), 0);
+		}
+	}
+
+	TEST(RefCountedTest, AtomicCounts)
+	{
+		Internal::CheckCounts<Internal::SharedObject>();
+	}
+
+	TEST(RefCountedTest, NonAtomicCounts)
+	{
+		Internal::CheckCounts<Internal::LocalObject>();
+	}
+
+	TEST(RefCountedTest, CountsAreStoredInline)
+	{
+		EXPECT_EQ(sizeof(Internal::SharedObject), 2 * sizeof(size_t));
+		EXPECT_EQ(sizeof(Internal::LocalObject), 2 * sizeof(size_t));
+	}
+
+	TEST(RefCountedTest, ConcurrentChurn)
+	{
+		const size_t THREAD_COUNT = 4;
+		const size_t ITERATIONS = 100000;
+
+		Internal::SharedObject object;
+		object.IncrementRef();
+
+		std::vector<std::thread> threads;
+
+		for (size_t t = 0; t < THREAD_COUNT; t++)
+		{
+			threads.emplace_back([&object]()
+			{
+				for (size_t i = 0; i < ITERATIONS; i++)
+				{
+					object.IncrementRef();
+					object.IncrementWeakRef();
+					object.DecrementWeakRef();
+					object.DecrementRef();
+				}
+			});
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		EXPECT_EQ(object.GetRefCount(), 1);
+		EXPECT_EQ(object.GetWeakRefCount(), 0);
+		EXPECT_EQ(object.DecrementRef(), 0);
+	}
+}
+
+#endif
@@ -0,0 +1,168 @@
+#ifndef TYPE_INFO_BENCHMARK_H
+#define TYPE_INFO_BENCHMARK_H
+
+#include <vector>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "Source/Benchmark/BenchmarkUtilities.h"
+
+#include "Core/Public/RTTI/TypeInfo.h"
+#include "Core/Public/RTTI/TypeRegistry.h"
+
+using namespace Forge::RTTI;
+
+/**
+ * Measures derivation checks on objects of a single inheritance chain
+ * eight classes deep, checking every object against a class in the middle
+ * of the chain. Three checks are compared: dynamic_cast, a walk of the base
+ * type chain, and TypeInfo::IsDerivedFrom() on a hierarchy numbered by the
+ * TypeRegistry. The checks are measured once through the virtual call
+ * returning the type info of an object, and once on type infos gathered
+ * beforehand to isolate the cost of the check itself.
+ */
+namespace TypeInfoBenchmark
+{
+	namespace Internal
+	{
+		const size_t OBJECT_COUNT = 1 << 16;
+		const size_t REPETITIONS = 64;
+
+		const char* const NAMES[] =
+		{
+			"TypeInfoBenchmark::Level0", "TypeInfoBenchmark::Level1", "TypeInfoBenchmark::Level2", "TypeInfoBenchmark::Level3",
+			"TypeInfoBenchmark::Level4", "TypeInfoBenchmark::Level5", "TypeInfoBenchmark::Level6", "TypeInfoBenchmark::Level7"
+		};
+
+		template<int Depth>
+		struct Level;
+
+		template<>
+		struct Level<0>
+		{
+			static ConstTypeInfoPtr GetTypeInfo()
+			{
+				static TypeInfo type_info(NAMES[0], sizeof(Level<0>), nullptr);
+				return &type_info;
+			}
+
+			virtual ~Level() = default;
+			virtual ConstTypeInfoPtr GetInstanceTypeInfo() const { return GetTypeInfo(); }
+		};
+
+		template<int Depth>
+		struct Level : Level<Depth - 1>
+		{
+			static ConstTypeInfoPtr GetTypeInfo()
+			{
+				static TypeInfo type_info(NAMES[Depth], sizeof(Level<Depth>), Level<Depth - 1>::GetTypeInfo());
+				return &type_info;
+			}
+
+			ConstTypeInfoPtr GetInstanceTypeInfo() const override { return GetTypeInfo(); }
+		};
+
+		using Target = Level<4>;
+
+		template<int Depth>
+		Level<0>* MakeObject(int depth)
+		{
+			if (depth == Depth)
+				return new Level<Depth>();
+
+			return MakeObject<Depth + 1>(depth);
+		}
+
+		template<>
+		inline Level<0>* MakeObject<8>(int depth)
+		{
+			return nullptr;
+		}
+
+		inline bool IsDerivedFromBaseChain(ConstTypeInfoPtr type_info, ConstTypeInfoPtr base_type_info)
+		{
+			for (; type_info; type_info = type_info->GetBaseTypeInfo())
+				if (type_info == base_type_info)
+					return true;
+
+			return false;
+		}
+
+		template<typename InItem, typename InCheck>
+		void Run(const char* name, const std::vector<InItem>& items, size_t expected, InCheck check)
+		{
+			size_t matches = 0;
+
+			double elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t r = 0; r < REPETITIONS; r++)
+					for (const InItem& item : items)
+						matches += check(item);
+			});
+
+			EXPECT_EQ(matches, expected * REPETITIONS);
+
+			BenchmarkUtilities::RecordMeasurement(name, elapsed / (items.size() * REPETITIONS), "ns/op");
+		}
+	}
+
+	/**
+	 * Checks objects of random depth against the class at depth four.
+	 */
+	TEST(TypeInfoBenchmark, DISABLED_IsDerivedFrom)
+	{
+		std::mt19937 generator(7);
+		std::uniform_int_distribution<int> depths(0, 7);
+
+		std::vector<Internal::Level<0>*> objects;
+		size_t expected = 0;
+
+		for (size_t i = 0; i < Internal::OBJECT_COUNT; i++)
+		{
+			int depth = depths(generator);
+
+			objects.push_back(Internal::MakeObject<0>(depth));
+			expected += depth >= 4;
+		}
+
+		ConstTypeInfoPtr target = Internal::Target::GetTypeInfo();
+
+		Internal::Run("dynamic_cast", objects, expected, [](Internal::Level<0>* object)
+		{
+			return dynamic_cast<Internal::Target*>(object) != nullptr;
+		});
+
+		Internal::Run("BaseChainWalk", objects, expected, [target](Internal::Level<0>* object)
+		{
+			return Internal::IsDerivedFromBaseChain(object->GetInstanceTypeInfo(), target);
+		});
+
+		TypeRegistry::GetInstance().Build();
+
+		Internal::Run("TypeInfo::IsDerivedFrom", objects, expected, [target](Internal::Level<0>* object)
+		{
+			return object->GetInstanceTypeInfo()->IsDerivedFrom(target);
+		});
+
+		std::vector<ConstTypeInfoPtr> type_infos;
+
+		for (Internal::Level<0>* object : objects)
+			type_infos.push_back(object->GetInstanceTypeInfo());
+
+		Internal::Run("BaseChainWalk/TypeInfoOnly", type_infos, expected, [target](ConstTypeInfoPtr type_info)
+		{
+			return Internal::IsDerivedFromBaseChain(type_info, target);
+		});
+
+		Internal::Run("TypeInfo::IsDerivedFrom/TypeInfoOnly", type_infos, expected, [target](ConstTypeInfoPtr type_info)
+		{
+			return type_info->IsDerivedFrom(target);
+		});
+
+		for (Internal::Level<0>* object : objects)
+			delete object;
+	}
+}
+
+#endif
@@ -0,0 +1,151 @@
+#ifndef TYPE_INFO_TEST_H
+#define TYPE_INFO_TEST_H
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/RTTI/TypeInfo.h"
+#include "Core/Public/RTTI/TypeRegistry.h"
+
+using namespace Forge::RTTI;
+
+namespace TypeInfoTest
+{
+	/**
+	 * Tests that type infos are identified by the hash of their name.
+	 */
+	TEST(TypeInfoTest, TypeId)
+	{
+		TypeInfo base("TypeInfoTest::Base", 8, nullptr);
+		TypeInfo derived("TypeInfoTest::Derived", 16, &base);
+
+		EXPECT_STREQ(derived.GetTypeName(), "TypeInfoTest::Derived");
+		EXPECT_EQ(derived.GetTypeSize(), 16);
+		EXPECT_EQ(derived.GetTypeId(), ConstStringHash("TypeInfoTest::Derived"));
+
+		EXPECT_EQ(derived.IsSameAs(ConstStringHash("TypeInfoTest::Derived")), true);
+		EXPECT_EQ(derived.IsSameAs(ConstStringHash("TypeInfoTest::Base")), false);
+	}
+
+	/**
+	 * Tests the derivation checks by type ID and by type info.
+	 */
+	TEST(TypeInfoTest, IsDerivedFrom)
+	{
+		TypeInfo base("TypeInfoTest::Base", 8, nullptr);
+		TypeInfo derived("TypeInfoTest::Derived", 16, &base);
+		TypeInfo other("TypeInfoTest::Other", 8, nullptr);
+
+		EXPECT_EQ(derived.IsDerivedFrom(ConstStringHash("TypeInfoTest::Base")), true);
+		EXPECT_EQ(derived.IsDerivedFrom(ConstStringHash("TypeInfoTest::Derived")), true);
+		EXPECT_EQ(base.IsDerivedFrom(ConstStringHash("TypeInfoTest::Derived")), false);
+		EXPECT_EQ(other.IsDerivedFrom(ConstStringHash("TypeInfoTest::Base")), false);
+
+		EXPECT_EQ(derived.IsDerivedFrom(&base), true);
+		EXPECT_EQ(base.IsDerivedFrom(&derived), false);
+		EXPECT_EQ(derived.IsDerivedFrom(&other), false);
+	}
+
+	/**
+	 * Tests that derivation checks give the same answers before and after
+	 * the registry numbers the hierarchy, including for types created
+	 * after it was numbered.
+	 */
+	TEST(TypeInfoTest, TypeRegistry)
+	{
+		TypeInfo root("TypeInfoTest::Root", 8, nullptr);
+		TypeInfo a("TypeInfoTest::A", 8, &root);
+		TypeInfo b("TypeInfoTest::B", 8, &root);
+		TypeInfo a1("TypeInfoTest::A1", 8, &a);
+		TypeInfo a2("TypeInfoTest::A2", 8, &a);
+		TypeInfo a11("TypeInfoTest::A11", 8, &a1);
+		TypeInfo other("TypeInfoTest::Other", 8, nullptr);
+
+		const TypeInfo* types[] = { &root, &a, &b, &a1, &a2, &a11, &other };
+
+		bool expected[7][7];
+
+		for (int i = 0; i < 7; i++)
+			for (int j = 0; j < 7; j++)
+				expected[i][j] = types[i]->IsDerivedFrom(types[j]);
+
+		EXPECT_EQ(a11.IsDerivedFrom(&root), true);
+		EXPECT_EQ(a11.IsDerivedFrom(&b), false);
+
+		TypeRegistry::GetInstance().Build();
+
+		for (int i = 0; i < 7; i++)
+			for (int j = 0; j < 7; j++)
+				EXPECT_EQ(types[i]->IsDerivedFrom(types[j]), expected[i][j]) << types[i]->GetTypeName() << " " << types[j]->GetTypeName();
+
+		TypeInfo b1("TypeInfoTest::B1", 8, &b);
+
+		EXPECT_EQ(b1.IsDerivedFrom(&root), true);
+		EXPECT_EQ(b1.IsDerivedFrom(&a), false);
+		EXPECT_EQ(a1.IsDerivedFrom(&b1), false);
+
+		EXPECT_EQ(TypeRegistry::GetInstance().FindType(ConstStringHash("TypeInfoTest::A2")), &a2);
+		EXPECT_EQ(TypeRegistry::GetInstance().FindType(ConstStringHash("TypeInfoTest::Missing")), nullptr);
+	}
+
+	/**
+	 * Tests that derivation checks stay correct on other threads while the
+	 * registry renumbers a hierarchy whose numbers shift between builds.
+	 */
+	TEST(TypeInfoTest, ConcurrentBuild)
+	{
+		TypeInfo root("TypeInfoTest::Root", 8, nullptr);
+		TypeInfo a("TypeInfoTest::A", 8, &root);
+		TypeInfo b("TypeInfoTest::B", 8, &root);
+		TypeInfo a1("TypeInfoTest::A1", 8, &a);
+		TypeInfo b1("TypeInfoTest::B1", 8, &b);
+
+		const TypeInfo* types[] = { &root, &a, &b, &a1, &b1 };
+
+		bool expected[5][5];
+
+		for (int i = 0; i < 5; i++)
+			for (int j = 0; j < 5; j++)
+				expected[i][j] = types[i]->IsDerivedFrom(types[j]->GetTypeId());
+
+		TypeRegistry::GetInstance().Build();
+
+		std::atomic<bool> is_building(true);
+		std::atomic<int> mismatches(0);
+		std::vector<std::thread> threads;
+
+		for (int t = 0; t < 4; t++)
+		{
+			threads.emplace_back([&]()
+			{
+				while (is_building.load())
+					for (int i = 0; i < 5; i++)
+						for (int j = 0; j < 5; j++)
+							if (types[i]->IsDerivedFrom(types[j]) != expected[i][j])
+								mismatches++;
+			});
+		}
+
+		/// Types added under A shift the numbers of B and its child.
+		for (int i = 0; i < 200; i++)
+		{
+			TypeInfo a2("TypeInfoTest::A2", 8, &a);
+
+			TypeRegistry::GetInstance().Build();
+		}
+
+		TypeRegistry::GetInstance().Build();
+
+		is_building.store(false);
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		EXPECT_EQ(mismatches.load(), 0);
+	}
+}
+
+#endif
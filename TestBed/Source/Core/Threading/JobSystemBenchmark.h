@@ -0,0 +1,93 @@
+#ifndef JOB_SYSTEM_BENCHMARK_H
+#define JOB_SYSTEM_BENCHMARK_H
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Source/Benchmark/BenchmarkUtilities.h"
+
+#include "Core/Public/Threading/JobSystem.h"
+
+/**
+ * Measures a simulation step integrating 256K particles with ParallelFor,
+ * on job systems of one worker up to one worker per hardware thread. Each
+ * count reports the time per frame and the speedup over a single worker.
+ */
+namespace JobSystemBenchmark
+{
+	namespace Internal
+	{
+		const size_t PARTICLE_COUNT = 1 << 18;
+		const size_t BATCH_SIZE = 1024;
+		const size_t FRAMES = 32;
+
+		struct Particle
+		{
+			float m_position[3];
+			float m_velocity[3];
+		};
+
+		inline void Integrate(Particle& particle, float delta)
+		{
+			for (int step = 0; step < 8; step++)
+			{
+				for (int axis = 0; axis < 3; axis++)
+				{
+					particle.m_velocity[axis] -= particle.m_position[axis] * delta + std::sin(particle.m_velocity[axis]) * 0.001f;
+					particle.m_position[axis] += particle.m_velocity[axis] * delta;
+				}
+			}
+		}
+	}
+
+	TEST(JobSystemBenchmark, DISABLED_ParallelForScaling)
+	{
+		using Forge::Threading::JobSystem;
+
+		size_t max_workers = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+		std::vector<size_t> worker_counts;
+		double single_worker = 0.0;
+
+		for (size_t workers = 1; workers < max_workers; workers *= 2)
+			worker_counts.push_back(workers);
+
+		worker_counts.push_back(max_workers);
+
+		for (size_t workers : worker_counts)
+		{
+			JobSystem job_system(workers);
+			std::vector<Internal::Particle> particles(Internal::PARTICLE_COUNT, Internal::Particle{ { 1.0f, 2.0f, 3.0f }, { 0.0f, 0.0f, 0.0f } });
+
+			double elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t frame = 0; frame < Internal::FRAMES; frame++)
+				{
+					job_system.ParallelFor(particles.size(), Internal::BATCH_SIZE, [&particles](size_t begin, size_t end)
+					{
+						for (size_t i = begin; i < end; i++)
+							Internal::Integrate(particles[i], 0.016f);
+					});
+
+					job_system.NextFrame();
+				}
+			});
+
+			EXPECT_TRUE(std::isfinite(particles[0].m_position[0]));
+
+			double per_frame = elapsed / Internal::FRAMES;
+
+			if (workers == 1)
+				single_worker = per_frame;
+
+			BenchmarkUtilities::RecordMeasurement("ParallelFor/Workers:" + std::to_string(workers), per_frame / 1000.0, "us/frame");
+			BenchmarkUtilities::RecordMeasurement("ParallelFor/Workers:" + std::to_string(workers) + "/Speedup", single_worker / per_frame, "x");
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,263 @@
+#ifndef JOB_SYSTEM_TEST_H
+#define JOB_SYSTEM_TEST_H
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Threading/JobSystem.h"
+#include "Core/Public/Threading/TWorkStealingQueue.h"
+
+using namespace Forge::Threading;
+
+namespace JobSystemTest
+{
+	/**
+	 * Tests that the owner pops the newest element and thieves steal the
+	 * oldest, and that a full deque rejects pushes.
+	 */
+	TEST(WorkStealingQueueTest, PushPopSteal)
+	{
+		TWorkStealingQueue<int, 4> queue;
+		int values[5] = { 0, 1, 2, 3, 4 };
+
+		EXPECT_EQ(queue.Pop(), nullptr);
+		EXPECT_EQ(queue.Steal(), nullptr);
+
+		for (int i = 0; i < 4; i++)
+			EXPECT_TRUE(queue.Push(&values[i]));
+
+		EXPECT_FALSE(queue.Push(&values[4]));
+		EXPECT_EQ(queue.GetCount(), 4);
+
+		EXPECT_EQ(queue.Pop(), &values[3]);
+		EXPECT_EQ(queue.Steal(), &values[0]);
+		EXPECT_EQ(queue.Steal(), &values[1]);
+		EXPECT_EQ(queue.Pop(), &values[2]);
+		EXPECT_EQ(queue.Pop(), nullptr);
+
+		EXPECT_TRUE(queue.Push(&values[4]));
+		EXPECT_EQ(queue.Steal(), &values[4]);
+	}
+
+	/**
+	 * Tests that every element pushed while thieves steal concurrently is
+	 * taken exactly once.
+	 */
+	TEST(WorkStealingQueueTest, ConcurrentSteal)
+	{
+		const int count = 100000;
+		const int thief_count = 3;
+
+		TWorkStealingQueue<int, 256> queue;
+		std::vector<int> values(count, 0);
+		std::vector<std::atomic<int>> taken(count);
+		std::atomic<bool> is_done(false);
+		std::vector<std::thread> thieves;
+
+		for (int t = 0; t < thief_count; t++)
+		{
+			thieves.emplace_back([&]()
+			{
+				while (!is_done.load())
+					if (int* value = queue.Steal())
+						taken[value - values.data()]++;
+			});
+		}
+
+		for (int i = 0; i < count; i++)
+		{
+			while (!queue.Push(&values[i]))
+				if (int* value = queue.Pop())
+					taken[value - values.data()]++;
+
+			if (i % 3 == 0)
+				if (int* value = queue.Pop())
+					taken[value - values.data()]++;
+		}
+
+		while (int* value = queue.Pop())
+			taken[value - values.data()]++;
+
+		is_done.store(true);
+
+		for (std::thread& thief : thieves)
+			thief.join();
+
+		int mistakes = 0;
+
+		for (int i = 0; i < count; i++)
+			mistakes += taken[i].load() != 1;
+
+		EXPECT_EQ(mistakes, 0);
+	}
+
+	/**
+	 * Tests that waiting on a counter runs every job run with it.
+	 */
+	TEST(JobSystemTest, RunAndWait)
+	{
+		JobSystem job_system(4);
+		JobCounter counter;
+		std::atomic<int> sum(0);
+
+		EXPECT_EQ(job_system.GetWorkerCount(), 4);
+
+		for (int i = 1; i <= 1000; i++)
+			job_system.Run([&sum, i]() { sum += i; }, &counter);
+
+		job_system.Wait(&counter);
+
+		EXPECT_TRUE(counter.IsDone());
+		EXPECT_EQ(sum.load(), 500500);
+	}
+
+	/**
+	 * Tests that jobs depending on a counter only run once every job of the
+	 * counter finished.
+	 */
+	TEST(JobSystemTest, Dependencies)
+	{
+		JobSystem job_system(4);
+		JobCounter first, second, third;
+		std::atomic<int> first_done(0);
+		std::atomic<int> ordering_errors(0);
+		std::atomic<int> second_done(0);
+		int result = 0;
+
+		for (int i = 0; i < 64; i++)
+			job_system.Run([&]() { std::this_thread::yield(); first_done++; }, &first);
+
+		for (int i = 0; i < 64; i++)
+			job_system.Run([&]()
+			{
+				if (first_done.load() != 64)
+					ordering_errors++;
+
+				second_done++;
+			}, &second, &first);
+
+		job_system.Run([&]()
+		{
+			if (second_done.load() != 64)
+				ordering_errors++;
+
+			result = 1;
+		}, &third, &second);
+
+		job_system.Wait(&third);
+
+		EXPECT_EQ(result, 1);
+		EXPECT_EQ(ordering_errors.load(), 0);
+
+		job_system.Wait(&first);
+		job_system.Wait(&second);
+
+		JobCounter done;
+		bool ran = false;
+
+		job_system.Run([&ran]() { ran = true; }, &done, &first);
+		job_system.Wait(&done);
+
+		EXPECT_TRUE(ran);
+	}
+
+	/**
+	 * Tests that ParallelFor calls the function exactly once on every
+	 * element, with batches no larger than the batch size.
+	 */
+	TEST(JobSystemTest, ParallelFor)
+	{
+		JobSystem job_system(4);
+
+		const size_t count = 100003;
+		std::vector<int> visits(count, 0);
+		std::atomic<int> oversized(0);
+
+		job_system.ParallelFor(count, 64, [&](size_t begin, size_t end)
+		{
+			if (end - begin > 64)
+				oversized++;
+
+			for (size_t i = begin; i < end; i++)
+				visits[i]++;
+		});
+
+		int mistakes = 0;
+
+		for (size_t i = 0; i < count; i++)
+			mistakes += visits[i] != 1;
+
+		EXPECT_EQ(mistakes, 0);
+		EXPECT_EQ(oversized.load(), 0);
+
+		job_system.ParallelFor(0, 64, [&](size_t begin, size_t end) { oversized++; });
+
+		EXPECT_EQ(oversized.load(), 0);
+	}
+
+	/**
+	 * Tests jobs that create jobs and wait on them, including parallel loops
+	 * nested in parallel loops.
+	 */
+	TEST(JobSystemTest, NestedJobs)
+	{
+		JobSystem job_system(4);
+		std::atomic<size_t> sum(0);
+
+		job_system.ParallelFor(16, 1, [&](size_t begin, size_t end)
+		{
+			job_system.ParallelFor(1000, 10, [&](size_t inner_begin, size_t inner_end)
+			{
+				sum += inner_end - inner_begin;
+			});
+		});
+
+		EXPECT_EQ(sum.load(), 16000);
+	}
+
+	/**
+	 * Tests that jobs keep running once the frame allocators are full, and
+	 * after frames are advanced.
+	 */
+	TEST(JobSystemTest, FrameOverflow)
+	{
+		JobSystem job_system(2, 1024);
+		std::atomic<int> count(0);
+
+		for (int frame = 0; frame < 4; frame++)
+		{
+			JobCounter counter;
+
+			for (int i = 0; i < 500; i++)
+				job_system.Run([&count]() { count++; }, &counter);
+
+			job_system.Wait(&counter);
+			job_system.NextFrame();
+		}
+
+		EXPECT_EQ(count.load(), 2000);
+	}
+
+	/**
+	 * Tests that a job system with a single worker runs its jobs on the
+	 * waiting thread.
+	 */
+	TEST(JobSystemTest, SingleWorker)
+	{
+		JobSystem job_system(1);
+		std::thread::id id = std::this_thread::get_id();
+		int wrong_thread = 0;
+
+		job_system.ParallelFor(100, 7, [&](size_t begin, size_t end)
+		{
+			wrong_thread += std::this_thread::get_id() != id;
+		});
+
+		EXPECT_EQ(wrong_thread, 0);
+	}
+}
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef SMART_POINTER_BENCHMARK_H
+#define SMART_POINTER_BENCHMARK_H
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Source/Benchmark/BenchmarkUtilities.h"
+
+#include "Core/Public/Types/SmartPointer.h"
+#include "Core/Public/Memory/FreeListAllocator.h"
+
+/**
+ * Measures creating shared objects, adopting a pointer or allocating the
+ * object with its counts in one block, and copying shared pointers, against
+ * std::shared_ptr.
+ */
+namespace SmartPointerBenchmark
+{
+	namespace Internal
+	{
+		const size_t OBJECT_COUNT = 1 << 16;
+		const size_t REPETITIONS = 16;
+
+		struct Payload
+		{
+			size_t m_value[4];
+
+			Payload(size_t value) : m_value{ value, value, value, value } {}
+		};
+
+		template<typename InPointer, typename InMake>
+		void Run(const char* name, InMake make)
+		{
+			std::vector<InPointer> pointers;
+			pointers.reserve(OBJECT_COUNT);
+
+			double create = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t i = 0; i < OBJECT_COUNT; i++)
+					pointers.push_back(make(i));
+			});
+
+			size_t sum = 0;
+
+			double copy = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t r = 0; r < REPETITIONS; r++)
+					for (const InPointer& pointer : pointers)
+					{
+						InPointer other = pointer;
+						sum += other->m_value[0];
+					}
+			});
+
+			EXPECT_EQ(sum, REPETITIONS * (OBJECT_COUNT * (OBJECT_COUNT - 1) / 2));
+
+			double release = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				pointers.clear();
+			});
+
+			BenchmarkUtilities::RecordMeasurement(std::string(name) + "/Create", create / OBJECT_COUNT, "ns/op");
+			BenchmarkUtilities::RecordMeasurement(std::string(name) + "/Copy", copy / (OBJECT_COUNT * REPETITIONS), "ns/op");
+			BenchmarkUtilities::RecordMeasurement(std::string(name) + "/Release", release / OBJECT_COUNT, "ns/op");
+		}
+	}
+
+	TEST(SmartPointerBenchmark, DISABLED_CreateCopyRelease)
+	{
+		using Forge::Common::TSharedPtr;
+		using Forge::Common::MakeShared;
+
+		Internal::Run<TSharedPtr<Internal::Payload>>("TSharedPtr(new)", [](size_t i)
+		{
+			return TSharedPtr<Internal::Payload>(new Internal::Payload(i));
+		});
+
+		Internal::Run<TSharedPtr<Internal::Payload>>("MakeShared/Heap", [](size_t i)
+		{
+			return MakeShared<Internal::Payload>(nullptr, i);
+		});
+
+		Forge::Memory::FreeListAllocator allocator(Internal::OBJECT_COUNT * 128, Forge::Memory::FreeListPolicy::FORGE_SEGREGATED_FIT);
+
+		Internal::Run<TSharedPtr<Internal::Payload>>("MakeShared/FreeListAllocator", [&allocator](size_t i)
+		{
+			return MakeShared<Internal::Payload>(&allocator, i);
+		});
+
+		Internal::Run<std::shared_ptr<Internal::Payload>>("std::make_shared", [](size_t i)
+		{
+			return std::make_shared<Internal::Payload>(i);
+		});
+	}
+}
+
+#endif
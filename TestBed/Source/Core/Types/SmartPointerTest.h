@@ -0,0 +1,185 @@
+#ifndef SMART_POINTER_TEST_H
+#define SMART_POINTER_TEST_H
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Types/SmartPointer.h"
+#include "Core/Public/Memory/FreeListAllocator.h"
+
+using Forge::Common::TSharedPtr;
+using Forge::Common::TWeakPtr;
+using Forge::Common::MakeShared;
+using Forge::Memory::FreeListAllocator;
+using Forge::Memory::FreeListPolicy;
+
+namespace SmartPointerTest
+{
+	namespace Internal
+	{
+		struct Tracked
+		{
+			static int s_live;
+
+			int m_value;
+
+			Tracked(int value = 0) : m_value(value) { s_live++; }
+			virtual ~Tracked() { s_live--; }
+		};
+
+		inline int Tracked::s_live = 0;
+
+		struct DerivedTracked : Tracked
+		{
+			DerivedTracked(int value) : Tracked(value) {}
+		};
+	}
+
+	TEST(SmartPointerTest, PointerIsTwoWords)
+	{
+		EXPECT_EQ(sizeof(TSharedPtr<Internal::Tracked>), 2 * sizeof(void*));
+		EXPECT_EQ(sizeof(TWeakPtr<Internal::Tracked>), 2 * sizeof(void*));
+	}
+
+	TEST(SmartPointerTest, CopiesShareOwnership)
+	{
+		{
+			TSharedPtr<Internal::Tracked> first(new Internal::Tracked(7));
+			EXPECT_TRUE(first.IsUnique());
+
+			{
+				TSharedPtr<Internal::Tracked> second = first;
+				TSharedPtr<Internal::Tracked> third;
+
+				third = second;
+
+				EXPECT_EQ(first.GetRefCount(), 3);
+				EXPECT_EQ(third->m_value, 7);
+				EXPECT_TRUE(third == first);
+			}
+
+			EXPECT_EQ(first.GetRefCount(), 1);
+			EXPECT_EQ(Internal::Tracked::s_live, 1);
+
+			TSharedPtr<Internal::Tracked> moved = Forge::Algorithm::Move(first);
+
+			EXPECT_TRUE(first.IsNull());
+			EXPECT_EQ(moved.GetRefCount(), 1);
+		}
+
+		EXPECT_EQ(Internal::Tracked::s_live, 0);
+	}
+
+	TEST(SmartPointerTest, CustomDeleterIsCalledOnce)
+	{
+		int deletions = 0;
+
+		{
+			TSharedPtr<Internal::Tracked> first(new Internal::Tracked(), [&deletions](Internal::Tracked* ptr)
+			{
+				deletions++;
+				delete ptr;
+			});
+
+			TSharedPtr<Internal::Tracked> second = first;
+			first.Reset();
+
+			EXPECT_EQ(deletions, 0);
+		}
+
+		EXPECT_EQ(deletions, 1);
+		EXPECT_EQ(Internal::Tracked::s_live, 0);
+	}
+
+	TEST(SmartPointerTest, ConvertsToBase)
+	{
+		TSharedPtr<Internal::DerivedTracked> derived = MakeShared<Internal::DerivedTracked>(nullptr, 3);
+		TSharedPtr<Internal::Tracked> base = derived;
+
+		EXPECT_EQ(base.GetRefCount(), 2);
+		EXPECT_EQ(base->m_value, 3);
+
+		derived.Reset();
+		base.Reset();
+
+		EXPECT_EQ(Internal::Tracked::s_live, 0);
+	}
+
+	TEST(SmartPointerTest, WeakPointerExpires)
+	{
+		TWeakPtr<Internal::Tracked> weak;
+
+		{
+			TSharedPtr<Internal::Tracked> shared = MakeShared<Internal::Tracked>(nullptr, 5);
+			weak = shared;
+
+			EXPECT_FALSE(weak.IsExpired());
+			EXPECT_EQ(weak.Lock()->m_value, 5);
+			EXPECT_EQ(shared.GetRefCount(), 1);
+		}
+
+		EXPECT_TRUE(weak.IsExpired());
+		EXPECT_TRUE(weak.Lock().IsNull());
+		EXPECT_EQ(Internal::Tracked::s_live, 0);
+	}
+
+	TEST(SmartPointerTest, MakeSharedUsesOneAllocation)
+	{
+		FreeListAllocator allocator(1 << 12, FreeListPolicy::FORGE_SEGREGATED_FIT);
+
+		{
+			TSharedPtr<Internal::Tracked> shared = MakeShared<Internal::Tracked>(&allocator, 9);
+			TWeakPtr<Internal::Tracked> weak = shared;
+
+			EXPECT_EQ(allocator.GetNumOfAllocs(), 1);
+			EXPECT_EQ(shared->m_value, 9);
+
+			shared.Reset();
+
+			EXPECT_EQ(Internal::Tracked::s_live, 0);
+			EXPECT_EQ(allocator.GetNumOfDeallocs(), 0);
+		}
+
+		EXPECT_EQ(allocator.GetNumOfDeallocs(), 1);
+		EXPECT_EQ(allocator.GetUsedMemory(), 0);
+	}
+
+	TEST(SmartPointerTest, ConcurrentCopies)
+	{
+		const size_t THREAD_COUNT = 4;
+		const size_t ITERATIONS = 20000;
+
+		TSharedPtr<Internal::Tracked> shared = MakeShared<Internal::Tracked>(nullptr, 1);
+		TWeakPtr<Internal::Tracked> weak = shared;
+
+		std::vector<std::thread> threads;
+
+		for (size_t t = 0; t < THREAD_COUNT; t++)
+		{
+			threads.emplace_back([&shared, &weak]()
+			{
+				for (size_t i = 0; i < ITERATIONS; i++)
+				{
+					TSharedPtr<Internal::Tracked> copy = shared;
+					TSharedPtr<Internal::Tracked> locked = weak.Lock();
+
+					EXPECT_FALSE(locked.IsNull());
+				}
+			});
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		EXPECT_EQ(shared.GetRefCount(), 1);
+
+		shared.Reset();
+
+		EXPECT_TRUE(weak.IsExpired());
+		EXPECT_EQ(Internal::Tracked::s_live, 0);
+	}
+}
+
+#endif
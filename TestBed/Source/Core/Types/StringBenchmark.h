@@ -0,0 +1,140 @@
+#ifndef STRING_BENCHMARK_H
+#define STRING_BENCHMARK_H
+
+#include <string>
+#include <vector>
+#include <cstdio>
+
+#include <gtest/gtest.h>
+
+#include "Source/Benchmark/BenchmarkUtilities.h"
+
+#include "Core/Public/Types/String/String.h"
+
+/**
+ * Measures String against std::string on a log-parsing workload: every line
+ * is copied into a string object, split on its separators, checked for a
+ * severity prefix and searched for a keyword. Most fields are shorter than
+ * String::INLINE_CAPACITY, so the workload also covers small string copies.
+ */
+namespace StringBenchmark
+{
+	namespace Internal
+	{
+		const size_t LINE_COUNT = 200000;
+
+		const char* const LEVELS[] = { "INFO", "WARN", "ERROR", "DEBUG" };
+		const char* const MODULES[] = { "Renderer", "Audio", "Physics", "Streaming", "Input" };
+
+		inline std::vector<std::string> MakeLines(void)
+		{
+			std::vector<std::string> lines;
+			lines.reserve(LINE_COUNT);
+
+			char line[256];
+
+			for (size_t i = 0; i < LINE_COUNT; i++)
+			{
+				std::snprintf(line, sizeof(line), "2024-05-%02zu 12:%02zu:%02zu.%03zu [%s] %s: frame %zu took %zu us, %s",
+					i % 28 + 1, i % 60, (i * 7) % 60, i % 1000, LEVELS[i % 4], MODULES[i % 5], i, (i * 31) % 20000,
+					i % 97 == 0 ? "device lost while presenting swap chain" : "no errors reported by the backend");
+
+				lines.emplace_back(line);
+			}
+
+			return lines;
+		}
+
+		struct ParseResult
+		{
+			size_t errors;
+			size_t device_lost;
+			size_t field_length;
+		};
+
+		inline ParseResult ParseForge(const std::vector<std::string>& lines)
+		{
+			using Forge::Type::String;
+
+			ParseResult result = {};
+
+			for (const std::string& line : lines)
+			{
+				String text(line.c_str());
+
+				size_t level_begin = text.FindFirstOf('[') + 1;
+				size_t level_end = text.FindFirstOf(']', level_begin);
+
+				String level;
+				level.Append(text.GetRawData() + level_begin, level_end - level_begin);
+
+				if (level.StartsWith("ERROR", Forge::Type::CASE_SENSETIVE))
+					result.errors++;
+
+				size_t module_end = text.FindFirstOf(':', level_end);
+
+				String module;
+				module.Append(text.GetRawData() + level_end + 2, module_end - level_end - 2);
+
+				result.field_length += module.GetCount() + text.FindLastNotOf(" abcdefghijklmnopqrstuvwxyz,") ;
+
+				if (text.FindSubString("device lost") != static_cast<size_t>(-1))
+					result.device_lost++;
+			}
+
+			return result;
+		}
+
+		inline ParseResult ParseStd(const std::vector<std::string>& lines)
+		{
+			ParseResult result = {};
+
+			for (const std::string& line : lines)
+			{
+				std::string text(line.c_str());
+
+				size_t level_begin = text.find('[') + 1;
+				size_t level_end = text.find(']', level_begin);
+
+				std::string level(text.data() + level_begin, level_end - level_begin);
+
+				if (level.compare(0, 5, "ERROR") == 0)
+					result.errors++;
+
+				size_t module_end = text.find(':', level_end);
+
+				std::string module(text.data() + level_end + 2, module_end - level_end - 2);
+
+				result.field_length += module.size() + text.find_last_not_of(" abcdefghijklmnopqrstuvwxyz,");
+
+				if (text.find("device lost") != std::string::npos)
+					result.device_lost++;
+			}
+
+			return result;
+		}
+	}
+
+	/**
+	 * Parses the same synthetic log with both string types.
+	 */
+	TEST(StringBenchmark, DISABLED_LogParsing)
+	{
+		const std::vector<std::string> lines = Internal::MakeLines();
+
+		Internal::ParseResult forge_result;
+		Internal::ParseResult std_result;
+
+		double forge_elapsed = BenchmarkUtilities::MeasureNanoseconds([&]() { forge_result = Internal::ParseForge(lines); });
+		double std_elapsed = BenchmarkUtilities::MeasureNanoseconds([&]() { std_result = Internal::ParseStd(lines); });
+
+		EXPECT_EQ(forge_result.errors, std_result.errors);
+		EXPECT_EQ(forge_result.device_lost, std_result.device_lost);
+		EXPECT_EQ(forge_result.field_length, std_result.field_length);
+
+		BenchmarkUtilities::RecordMeasurement("String/LogParsing", forge_elapsed / Internal::LINE_COUNT, "ns/line");
+		BenchmarkUtilities::RecordMeasurement("std::string/LogParsing", std_elapsed / Internal::LINE_COUNT, "ns/line");
+	}
+}
+
+#endif
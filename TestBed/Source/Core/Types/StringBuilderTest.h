@@ -0,0 +1,152 @@
+#ifndef STRING_BUILDER_TEST_H
+#define STRING_BUILDER_TEST_H
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Types/String/StringBuilder.h"
+#include "Core/Public/Memory/CAllocator.h"
+#include "Core/Public/Memory/LinearAllocator.h"
+#include "Core/Public/Memory/StackAllocator.h"
+
+namespace StringBuilderTest
+{
+	using Forge::Type::String;
+	using Forge::Type::StringView;
+	using Forge::Type::StringBuilder;
+
+	/**
+	 * Tests appending pieces spanning several chunks.
+	 */
+	TEST(StringBuilderTest, Append)
+	{
+		Forge::Memory::LinearAllocator allocator(1 << 16);
+
+		StringBuilder builder(&allocator, 16);
+		std::string reference;
+
+		for (int i = 0; i < 50; i++)
+		{
+			builder += "frame ";
+			builder.AppendInteger(i);
+			builder += ',';
+			builder += StringView("a piece longer than a single chunk;");
+
+			reference += "frame " + std::to_string(i) + ",a piece longer than a single chunk;";
+		}
+
+		String result = builder.ToString();
+
+		EXPECT_EQ(builder.GetCount(), reference.size());
+		EXPECT_EQ(result.GetCount(), reference.size());
+		EXPECT_STREQ(result.GetRawData(), reference.c_str());
+	}
+
+	/**
+	 * Tests the decimal representation of integers.
+	 */
+	TEST(StringBuilderTest, AppendInteger)
+	{
+		Forge::Memory::LinearAllocator allocator(1024);
+
+		StringBuilder builder(&allocator);
+
+		builder.AppendInteger(0);
+		builder += ' ';
+		builder.AppendInteger(-42);
+		builder += ' ';
+		builder.AppendInteger(9223372036854775807LL);
+		builder += ' ';
+		builder.AppendInteger(-9223372036854775807LL - 1);
+
+		EXPECT_STREQ(builder.ToString().GetRawData(), "0 -42 9223372036854775807 -9223372036854775808");
+	}
+
+	/**
+	 * Tests that building a string allocates once, and not at all when the
+	 * result fits inline.
+	 */
+	TEST(StringBuilderTest, SingleAllocation)
+	{
+		Forge::Memory::LinearAllocator chunks(1 << 16);
+		Forge::Memory::CAllocator allocator;
+
+		StringBuilder builder(&chunks, 32);
+
+		builder += "short";
+
+		{
+			String result = builder.ToString(&allocator);
+
+			EXPECT_EQ(result.IsInline(), true);
+			EXPECT_EQ(allocator.GetNumOfAllocs(), 0);
+		}
+
+		for (int i = 0; i < 100; i++)
+			builder += "assets/textures/";
+
+		{
+			String result = builder.ToString(&allocator);
+
+			EXPECT_EQ(result.GetCount(), 5 + 100 * 16);
+			EXPECT_EQ(result.GetAllocator(), &allocator);
+			EXPECT_EQ(allocator.GetNumOfAllocs(), 1);
+		}
+	}
+
+	/**
+	 * Tests that chunks taken from a stack allocator are released in the
+	 * order it requires.
+	 */
+	TEST(StringBuilderTest, StackAllocator)
+	{
+		Forge::Memory::StackAllocator allocator(1 << 12);
+
+		{
+			StringBuilder builder(&allocator, 8);
+
+			for (int i = 0; i < 20; i++)
+				builder += "0123456789";
+
+			EXPECT_STREQ(builder.ToString().GetRawData() + 190, "0123456789");
+
+			builder.Clear();
+
+			EXPECT_EQ(builder.IsEmpty(), true);
+			EXPECT_EQ(allocator.GetUsedMemory(), 0);
+
+			builder += "reused";
+
+			EXPECT_STREQ(builder.ToString().GetRawData(), "reused");
+		}
+
+		EXPECT_EQ(allocator.GetUsedMemory(), 0);
+	}
+
+	/**
+	 * Tests that appending past an exhausted allocator throws and keeps only
+	 * the characters which were stored.
+	 */
+	TEST(StringBuilderTest, ExhaustedAllocator)
+	{
+		Forge::Memory::LinearAllocator allocator(256);
+
+		StringBuilder builder(&allocator, 64);
+
+		EXPECT_THROW(
+			for (int i = 0; i < 100; i++)
+				builder += "0123456789";
+		, Forge::Debug::BadAllocationException);
+
+		String result = builder.ToString();
+
+		EXPECT_GT(builder.GetCount(), 0);
+		EXPECT_EQ(result.GetCount(), builder.GetCount());
+
+		for (size_t i = 0; i < result.GetCount(); i++)
+			EXPECT_EQ(result.GetRawData()[i], '0' + i % 10);
+	}
+}
+
+#endif
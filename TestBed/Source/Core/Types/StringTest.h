@@ -0,0 +1,306 @@
+#ifndef STRING_TEST_H
+#define STRING_TEST_H
+
+#include <string>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Types/String/String.h"
+#include "Core/Public/Memory/CAllocator.h"
+#include "Core/Public/Memory/LinearAllocator.h"
+
+namespace StringTest
+{
+	using Forge::Type::String;
+	using Forge::Type::CASE_SENSETIVE;
+	using Forge::Type::CASE_INSENSITIVE;
+
+	/**
+	 * Tests the default constructor of a string object.
+	 */
+	TEST(StringTest, DefaultConstructor)
+	{
+		String s;
+
+		EXPECT_EQ(s.GetCount(), 0);
+		EXPECT_EQ(s.IsEmpty(), true);
+		EXPECT_STREQ(s.GetRawData(), "");
+	}
+
+	/**
+	 * Tests the character array constructor of a string object.
+	 */
+	TEST(StringTest, CharArrayConstructor)
+	{
+		String s("Forge");
+
+		EXPECT_EQ(s.GetCount(), 5);
+		EXPECT_STREQ(s.GetRawData(), "Forge");
+	}
+
+	/**
+	 * Tests the copy and move constructors of a string object.
+	 */
+	TEST(StringTest, CopyAndMoveConstructors)
+	{
+		String s1("Forge");
+		String s2 = s1;
+		String s3 = std::move(s1);
+
+		EXPECT_EQ(s1.GetCount(), 0);
+		EXPECT_STREQ(s2.GetRawData(), "Forge");
+		EXPECT_STREQ(s3.GetRawData(), "Forge");
+		EXPECT_EQ(s2 == s3, true);
+	}
+
+	/**
+	 * Tests the assignment operators of a string object.
+	 */
+	TEST(StringTest, Assignment)
+	{
+		String s1("a short string");
+		String s2("a string long enough to need a larger buffer");
+
+		s1 = s2;
+
+		EXPECT_STREQ(s1.GetRawData(), s2.GetRawData());
+
+		s2 = "tiny";
+
+		EXPECT_EQ(s2.GetCount(), 4);
+		EXPECT_STREQ(s2.GetRawData(), "tiny");
+
+		s1 = std::move(s2);
+
+		EXPECT_STREQ(s1.GetRawData(), "tiny");
+	}
+
+	/**
+	 * Tests the append operators of a string object.
+	 */
+	TEST(StringTest, Append)
+	{
+		String s;
+
+		s += "Forge";
+		s += ' ';
+		s += String("Engine");
+
+		EXPECT_EQ(s.GetCount(), 12);
+		EXPECT_STREQ(s.GetRawData(), "Forge Engine");
+
+		s += s;
+
+		EXPECT_STREQ(s.GetRawData(), "Forge EngineForge Engine");
+	}
+
+	/**
+	 * Tests that a string grows through the allocator it was constructed
+	 * with, including allocators that do not support reallocation.
+	 */
+	TEST(StringTest, Allocator)
+	{
+		Forge::Memory::CAllocator c_allocator;
+		Forge::Memory::LinearAllocator linear_allocator(1 << 16);
+
+		{
+			String s1(&c_allocator);
+			String s2(&linear_allocator);
+
+			for (int i = 0; i < 1000; i++)
+			{
+				s1 += static_cast<char>('a' + i % 26);
+				s2 += static_cast<char>('a' + i % 26);
+			}
+
+			EXPECT_EQ(s1.GetAllocator(), &c_allocator);
+			EXPECT_EQ(s2.GetAllocator(), &linear_allocator);
+
+			EXPECT_EQ(s1.GetCount(), 1000);
+			EXPECT_EQ(std::strlen(s1.GetRawData()), 1000);
+			EXPECT_EQ(s1 == s2, true);
+		}
+
+		EXPECT_EQ(c_allocator.GetNumOfAllocs(), 0);
+	}
+
+	/**
+	 * Tests the Resize member function of a string object.
+	 */
+	TEST(StringTest, Resize)
+	{
+		String s("Forge Engine, a string stored outside the object");
+
+		s.Resize(30);
+
+		EXPECT_EQ(s.GetCapacity(), 30);
+		EXPECT_STREQ(s.GetRawData(), "Forge Engine, a string stored ");
+
+		s.Resize(5);
+
+		EXPECT_EQ(s.IsInline(), true);
+		EXPECT_EQ(s.GetCapacity(), String::INLINE_CAPACITY);
+		EXPECT_STREQ(s.GetRawData(), "Forge");
+
+		s.Clear();
+
+		EXPECT_EQ(s.IsEmpty(), true);
+		EXPECT_STREQ(s.GetRawData(), "");
+	}
+
+	/**
+	 * Tests that short strings are stored inline and long strings move to
+	 * an allocation.
+	 */
+	TEST(StringTest, SmallStringOptimization)
+	{
+		Forge::Memory::CAllocator allocator;
+
+		String s(&allocator);
+
+		for (size_t i = 0; i < String::INLINE_CAPACITY; i++)
+			s += 'a';
+
+		EXPECT_EQ(s.IsInline(), true);
+		EXPECT_EQ(allocator.GetNumOfAllocs(), 0);
+
+		String inline_copy = s;
+		String inline_moved = std::move(inline_copy);
+
+		EXPECT_EQ(inline_moved.IsInline(), true);
+		EXPECT_EQ(inline_moved == s, true);
+		EXPECT_EQ(inline_copy.IsEmpty(), true);
+
+		s += 'a';
+
+		EXPECT_EQ(s.IsInline(), false);
+		EXPECT_EQ(allocator.GetNumOfAllocs(), 1);
+
+		String moved = std::move(s);
+
+		EXPECT_EQ(moved.GetCount(), String::INLINE_CAPACITY + 1);
+		EXPECT_EQ(s.IsInline(), true);
+		EXPECT_STREQ(s.GetRawData(), "");
+	}
+
+	/**
+	 * Tests the single character searches of a string object against
+	 * std::string on strings crossing several SIMD blocks.
+	 */
+	TEST(StringTest, FindCharacter)
+	{
+		std::string reference;
+
+		for (int i = 0; i < 200; i++)
+			reference += static_cast<char>('a' + (i * 7) % 26);
+
+		String s(reference.c_str());
+
+		for (char ch = 'a'; ch <= 'z'; ch++)
+		{
+			for (size_t pos = 0; pos < reference.size(); pos += 13)
+			{
+				EXPECT_EQ(s.FindFirstOf(ch, pos), reference.find(ch, pos));
+				EXPECT_EQ(s.FindFirstNotOf(ch, pos), reference.find_first_not_of(ch, pos));
+				EXPECT_EQ(s.FindLastOf(ch, pos), reference.rfind(ch, reference.size() - 1 - pos));
+				EXPECT_EQ(s.FindLastNotOf(ch, pos), reference.find_last_not_of(ch, reference.size() - 1 - pos));
+			}
+		}
+
+		EXPECT_EQ(String("aaaa").FindFirstNotOf('a'), static_cast<size_t>(-1));
+		EXPECT_EQ(String("abc").FindFirstOf('a', 3), static_cast<size_t>(-1));
+	}
+
+	/**
+	 * Tests the character set searches of a string object against
+	 * std::string, for sets small enough for SSE4.2, large ASCII sets and
+	 * sets with non-ASCII characters.
+	 */
+	TEST(StringTest, FindCharacterSet)
+	{
+		std::string reference;
+
+		for (int i = 0; i < 200; i++)
+			reference += i % 37 == 0 ? '\xE9' : static_cast<char>(' ' + (i * 11) % 90);
+
+		String s(reference.c_str());
+
+		const char* sets[] = { "", "xyz", "0123456789", "abcdefghijklmnopqrstuvwxyz", "!@#$%^&*()", "\xE9" "0123456789ABCDEFGHIJ" };
+
+		for (const char* set : sets)
+		{
+			for (size_t pos = 0; pos < reference.size(); pos += 7)
+			{
+				EXPECT_EQ(s.FindFirstOf(set, pos), reference.find_first_of(set, pos));
+				EXPECT_EQ(s.FindFirstNotOf(set, pos), reference.find_first_not_of(set, pos));
+				EXPECT_EQ(s.FindLastOf(set, pos), reference.find_last_of(set, reference.size() - 1 - pos));
+				EXPECT_EQ(s.FindLastNotOf(set, pos), reference.find_last_not_of(set, reference.size() - 1 - pos));
+			}
+		}
+	}
+
+	/**
+	 * Tests the sub-string search of a string object against std::string.
+	 */
+	TEST(StringTest, FindSubString)
+	{
+		std::string reference;
+
+		for (int i = 0; i < 300; i++)
+			reference += static_cast<char>('a' + (i * i) % 5);
+
+		String s(reference.c_str());
+
+		for (size_t length = 1; length < 40; length += 3)
+		{
+			for (size_t start = 0; start + length <= reference.size(); start += 17)
+			{
+				std::string needle = reference.substr(start, length);
+
+				for (size_t pos = 0; pos < reference.size(); pos += 29)
+				{
+					EXPECT_EQ(s.FindSubString(needle.c_str(), pos), reference.find(needle, pos));
+					EXPECT_EQ(s.FindSubString(String(needle.c_str()), pos), reference.find(needle, pos));
+				}
+			}
+		}
+
+		EXPECT_EQ(s.FindSubString("eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"), static_cast<size_t>(-1));
+		EXPECT_EQ(String("short").FindSubString("longer than the string"), static_cast<size_t>(-1));
+		EXPECT_EQ(String("needle at the end").FindSubString("end"), 14);
+	}
+
+	/**
+	 * Tests the prefix and suffix checks of a string object.
+	 */
+	TEST(StringTest, StartsWithEndsWith)
+	{
+		String s("Forge Engine");
+
+		EXPECT_EQ(s.StartsWith("Forge", CASE_SENSETIVE), true);
+		EXPECT_EQ(s.StartsWith("forge", CASE_SENSETIVE), false);
+		EXPECT_EQ(s.StartsWith("forge", CASE_INSENSITIVE), true);
+		EXPECT_EQ(s.StartsWith(String("Engine"), CASE_SENSETIVE), false);
+
+		EXPECT_EQ(s.EndsWith("Engine", CASE_SENSETIVE), true);
+		EXPECT_EQ(s.EndsWith("ENGINE", CASE_INSENSITIVE), true);
+		EXPECT_EQ(s.EndsWith(String("Forge"), CASE_SENSETIVE), false);
+		EXPECT_EQ(s.EndsWith("A much longer suffix than the string", CASE_SENSETIVE), false);
+	}
+
+	/**
+	 * Tests the LexicographicalCompare member function of a string object.
+	 */
+	TEST(StringTest, LexicographicalCompare)
+	{
+		String s("apple");
+
+		EXPECT_EQ(s.LexicographicalCompare("banana"), true);
+		EXPECT_EQ(s.LexicographicalCompare("apples"), true);
+		EXPECT_EQ(s.LexicographicalCompare("apple"), false);
+		EXPECT_EQ(s.LexicographicalCompare(String("aardvark")), false);
+	}
+}
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef STRING_VIEW_TEST_H
+#define STRING_VIEW_TEST_H
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "Core/Public/Types/String/String.h"
+#include "Core/Public/Types/String/StringView.h"
+
+namespace StringViewTest
+{
+	using Forge::Type::String;
+	using Forge::Type::StringView;
+	using Forge::Type::CASE_SENSETIVE;
+	using Forge::Type::CASE_INSENSITIVE;
+
+	/**
+	 * Tests the constructors of a string view object.
+	 */
+	TEST(StringViewTest, Constructors)
+	{
+		const char* text = "Forge Engine";
+
+		StringView empty;
+		StringView whole(text);
+		StringView prefix(text, 5);
+
+		String s("Forge");
+		StringView of_string(s);
+
+		EXPECT_EQ(empty.IsEmpty(), true);
+		EXPECT_EQ(whole.GetCount(), 12);
+		EXPECT_EQ(whole.GetRawData(), text);
+		EXPECT_EQ(prefix.GetCount(), 5);
+		EXPECT_EQ(of_string.GetRawData(), s.GetRawData());
+		EXPECT_EQ(of_string == prefix, true);
+	}
+
+	/**
+	 * Tests that sub-views and trimmed views refer to the original
+	 * characters.
+	 */
+	TEST(StringViewTest, SubViews)
+	{
+		const char* text = "assets/textures/stone.dds";
+
+		StringView path(text);
+		StringView directory = path.GetSubView(0, path.FindLastOf('/'));
+		StringView extension = path.GetSubView(path.FindLastOf('.') + 1);
+
+		EXPECT_EQ(directory == StringView("assets/textures"), true);
+		EXPECT_EQ(extension == StringView("dds"), true);
+		EXPECT_EQ(extension.GetRawData(), text + 22);
+		EXPECT_EQ(path.GetSubView(100).IsEmpty(), true);
+
+		path.RemovePrefix(7);
+		path.RemoveSuffix(4);
+
+		EXPECT_EQ(path == StringView("textures/stone"), true);
+
+		path.RemoveSuffix(100);
+
+		EXPECT_EQ(path.IsEmpty(), true);
+	}
+
+	/**
+	 * Tests the search functions on a view whose characters are not followed
+	 * by a null terminator.
+	 */
+	TEST(StringViewTest, Search)
+	{
+		std::string reference;
+
+		for (int i = 0; i < 100; i++)
+			reference += static_cast<char>('a' + (i * 7) % 26);
+
+		std::string text = reference + "zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz";
+
+		StringView view(text.c_str(), reference.size());
+
+		EXPECT_EQ(view.FindFirstOf('z'), reference.find('z'));
+		EXPECT_EQ(view.FindLastOf('z'), reference.rfind('z'));
+		EXPECT_EQ(view.FindFirstNotOf('a'), reference.find_first_not_of('a'));
+		EXPECT_EQ(view.FindLastNotOf('z'), reference.find_last_not_of('z'));
+		EXPECT_EQ(view.FindFirstOf("xyz"), reference.find_first_of("xyz"));
+		EXPECT_EQ(view.FindLastOf("xyz"), reference.find_last_of("xyz"));
+		EXPECT_EQ(view.FindFirstNotOf("abcdefghijklmnopqrstuvwxy"), reference.find_first_not_of("abcdefghijklmnopqrstuvwxy"));
+		EXPECT_EQ(view.FindLastNotOf("abcdefghijklmnopqrstuvwxy"), reference.find_last_not_of("abcdefghijklmnopqrstuvwxy"));
+		EXPECT_EQ(view.FindSubString("zzz"), reference.find("zzz"));
+		EXPECT_EQ(view.FindSubString(StringView(reference.c_str() + 40, 20)), reference.find(reference.substr(40, 20)));
+		EXPECT_EQ(view.EndsWith(StringView(reference.c_str() + 90, 10), CASE_SENSETIVE), true);
+		EXPECT_EQ(view.StartsWith(StringView("AHOV"), CASE_INSENSITIVE), true);
+
+		String s(text.c_str());
+
+		EXPECT_EQ(s.FindSubString(view), 0);
+		EXPECT_EQ(s.StartsWith(view, CASE_SENSETIVE), true);
+		EXPECT_EQ(s == view, false);
+		EXPECT_EQ(view.LexicographicalCompare(s), true);
+	}
+}
+
+#endif
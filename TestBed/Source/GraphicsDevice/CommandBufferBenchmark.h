@@ -0,0 +1,140 @@
+#ifndef COMMAND_BUFFER_BENCHMARK_H
+#define COMMAND_BUFFER_BENCHMARK_H
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Source/Benchmark/BenchmarkUtilities.h"
+
+#include "GraphicsDevice/Public/Base/CommandQueue.h"
+#include "GraphicsDevice/Public/Base/CommandBuffer.h"
+#include "GraphicsDevice/Public/Null/NullHardwareBuffer.h"
+#include "GraphicsDevice/Public/Null/NullGraphicsContextState.h"
+
+/**
+ * Measures a frame of 16K objects, each setting its blend function and
+ * binding its buffer before an indexed draw, through the null context
+ * state. The frame is called directly on the context state, recorded into
+ * a single command buffer and executed, and recorded into one command
+ * buffer per hardware thread in parallel and executed through a command
+ * queue, including starting the recording threads every frame. Every
+ * variant reports the time per command.
+ */
+namespace CommandBufferBenchmark
+{
+	namespace Internal
+	{
+		using namespace Forge::Graphics;
+
+		const unsigned OBJECT_COUNT = 1 << 14;
+		const unsigned COMMANDS_PER_OBJECT = 3;
+		const size_t FRAMES = 32;
+		const size_t BUFFER_COUNT = 16;
+
+		template<typename InTarget>
+		void SubmitObjects(InTarget& target, const std::vector<std::unique_ptr<NullHardwareBuffer>>& buffers, unsigned begin, unsigned end)
+		{
+			for (unsigned i = begin; i < end; i++)
+			{
+				target.SetColorBlendingFunction((i & 1) ? BlendFuncMask::FORGE_ONE : BlendFuncMask::FORGE_SRC_ALPHA, BlendFuncMask::FORGE_ONE_MINUS_SRC_ALPHA);
+				target.BindHardwareBuffer(buffers[i % BUFFER_COUNT].get());
+				target.DrawIndexed(PrimitiveTopologyMask::FORGE_TRIANGLE, ValueTypeMask::FORGE_USHORT, i * 36, 36, 0);
+			}
+		}
+	}
+
+	TEST(CommandBufferBenchmark, DISABLED_RecordAndExecute)
+	{
+		using namespace Forge::Graphics;
+
+		const double command_count = (double)Internal::OBJECT_COUNT * Internal::COMMANDS_PER_OBJECT * Internal::FRAMES;
+		const unsigned thread_count = std::max<unsigned>(std::thread::hardware_concurrency(), 1);
+
+		std::vector<std::unique_ptr<NullHardwareBuffer>> buffers;
+
+		for (size_t i = 0; i < Internal::BUFFER_COUNT; i++)
+			buffers.emplace_back(new NullHardwareBuffer(256));
+
+		NullGraphicsContextState context_state(nullptr, false);
+		Forge::Memory::ConcurrentPoolAllocator page_allocator(COMMAND_PAGE_SIZE, COMMAND_PAGE_SIZE * 256);
+
+		double direct = BenchmarkUtilities::MeasureNanoseconds([&]()
+		{
+			for (size_t frame = 0; frame < Internal::FRAMES; frame++)
+				Internal::SubmitObjects(context_state, buffers, 0, Internal::OBJECT_COUNT);
+		});
+
+		CommandBuffer command_buffer(page_allocator);
+		double record = 0.0;
+		double execute = 0.0;
+
+		for (size_t frame = 0; frame < Internal::FRAMES; frame++)
+		{
+			command_buffer.Reset();
+
+			record += BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				Internal::SubmitObjects(command_buffer, buffers, 0, Internal::OBJECT_COUNT);
+			});
+
+			execute += BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				command_buffer.Execute(context_state);
+			});
+		}
+
+		EXPECT_FALSE(command_buffer.IsOverflowed());
+		EXPECT_EQ(command_buffer.GetNumOfCommands(), Internal::OBJECT_COUNT * Internal::COMMANDS_PER_OBJECT);
+
+		command_buffer.Reset();
+
+		std::vector<CommandBuffer*> command_buffers;
+		CommandQueue command_queue;
+
+		for (unsigned t = 0; t < thread_count; t++)
+			command_buffers.push_back(new CommandBuffer(page_allocator));
+
+		double parallel = BenchmarkUtilities::MeasureNanoseconds([&]()
+		{
+			for (size_t frame = 0; frame < Internal::FRAMES; frame++)
+			{
+				std::vector<std::thread> threads;
+
+				for (unsigned t = 0; t < thread_count; t++)
+				{
+					threads.emplace_back([&, t]()
+					{
+						unsigned begin = Internal::OBJECT_COUNT * t / thread_count;
+						unsigned end = Internal::OBJECT_COUNT * (t + 1) / thread_count;
+
+						command_buffers[t]->Reset();
+
+						Internal::SubmitObjects(*command_buffers[t], buffers, begin, end);
+
+						command_queue.Submit(*command_buffers[t], t);
+					});
+				}
+
+				for (std::thread& thread : threads)
+					thread.join();
+
+				command_queue.Execute(context_state);
+			}
+		});
+
+		for (CommandBuffer* buffer : command_buffers)
+			delete buffer;
+
+		BenchmarkUtilities::RecordMeasurement("CommandBuffer/Direct", direct / command_count, "ns/command");
+		BenchmarkUtilities::RecordMeasurement("CommandBuffer/Record", record / command_count, "ns/command");
+		BenchmarkUtilities::RecordMeasurement("CommandBuffer/Execute", execute / command_count, "ns/command");
+		BenchmarkUtilities::RecordMeasurement("CommandBuffer/ParallelRecordAndExecute/Threads:" + std::to_string(thread_count), parallel / command_count, "ns/command");
+	}
+}
+
+#endif
@@ -0,0 +1,293 @@
+#ifndef COMMAND_BUFFER_TEST_H
+#define COMMAND_BUFFER_TEST_H
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "GraphicsDevice/Public/Base/CommandQueue.h"
+#include "GraphicsDevice/Public/Base/CommandBuffer.h"
+#include "GraphicsDevice/Public/Null/NullHardwareBuffer.h"
+#include "GraphicsDevice/Public/Null/NullGraphicsContextState.h"
+
+using namespace Forge::Graphics;
+
+namespace CommandBufferTest
+{
+	/**
+	 * Tests that executing a command buffer replays every recorded command
+	 * with its arguments, in recording order.
+	 */
+	TEST(CommandBufferTest, RecordAndExecute)
+	{
+		Forge::Memory::ConcurrentPoolAllocator page_allocator(COMMAND_PAGE_SIZE, COMMAND_PAGE_SIZE * 4);
+		NullHardwareBuffer vertex_buffer(1024);
+		NullGraphicsContextState context_state;
+		CommandBuffer command_buffer(page_allocator);
+
+		command_buffer.SetColorClear(0.25f, 0.5f, 0.75f, 1.0f);
+		command_buffer.Clear(ClearFlags::FORGE_COLOR_BUFFER | ClearFlags::FORGE_DEPTH_BUFFER);
+		command_buffer.EnableStencilTest(true);
+		command_buffer.SetStencilComparisonFunction(ComparisonFuncMask::FORGE_EQUAL, -3, 0xF0);
+		command_buffer.SetScissorBoundingRegion(1, 2, 3, 4);
+		command_buffer.SetColorBlendingFunction(BlendFuncMask::FORGE_ONE, BlendFuncMask::FORGE_ZERO);
+		command_buffer.BindHardwareBuffer(&vertex_buffer);
+		command_buffer.Draw(PrimitiveTopologyMask::FORGE_TRIANGLE, 3, 36);
+		command_buffer.DrawIndexed(PrimitiveTopologyMask::FORGE_LINE, ValueTypeMask::FORGE_USHORT, 6, 12, -2);
+
+		EXPECT_EQ(command_buffer.GetNumOfCommands(), 9);
+		EXPECT_FALSE(command_buffer.IsOverflowed());
+
+		command_buffer.Execute(context_state);
+
+		ASSERT_EQ(context_state.GetNumOfCalls(), 9);
+
+		EXPECT_EQ(context_state.GetCall(0).m_type, NullGraphicsCallType::FORGE_SET_COLOR_CLEAR);
+		EXPECT_EQ(context_state.GetCall(0).m_arguments[2], 0.75);
+
+		EXPECT_EQ(context_state.GetCall(1).m_type, NullGraphicsCallType::FORGE_CLEAR);
+		EXPECT_EQ(context_state.GetCall(1).m_arguments[0], 3.0);
+
+		EXPECT_EQ(context_state.GetCall(2).m_type, NullGraphicsCallType::FORGE_ENABLE_STENCIL_TEST);
+		EXPECT_EQ(context_state.GetCall(2).m_arguments[0], 1.0);
+
+		EXPECT_EQ(context_state.GetCall(3).m_type, NullGraphicsCallType::FORGE_SET_STENCIL_COMPARISON_FUNCTION);
+		EXPECT_EQ(context_state.GetCall(3).m_arguments[0], (double)ComparisonFuncMask::FORGE_EQUAL);
+		EXPECT_EQ(context_state.GetCall(3).m_arguments[1], -3.0);
+		EXPECT_EQ(context_state.GetCall(3).m_arguments[2], 240.0);
+
+		EXPECT_EQ(context_state.GetCall(4).m_type, NullGraphicsCallType::FORGE_SET_SCISSOR_BOUNDING_REGION);
+		EXPECT_EQ(context_state.GetCall(4).m_arguments[3], 4.0);
+
+		EXPECT_EQ(context_state.GetCall(5).m_type, NullGraphicsCallType::FORGE_SET_COLOR_BLENDING_FUNCTION);
+		EXPECT_EQ(context_state.GetCall(5).m_arguments[0], (double)BlendFuncMask::FORGE_ONE);
+		EXPECT_EQ(context_state.GetCall(5).m_arguments[1], (double)BlendFuncMask::FORGE_ZERO);
+
+		EXPECT_EQ(context_state.GetCall(6).m_type, NullGraphicsCallType::FORGE_BIND_HARDWARE_BUFFER);
+		EXPECT_EQ(context_state.GetCall(6).m_hardware_buffer, &vertex_buffer);
+
+		EXPECT_EQ(context_state.GetCall(7).m_type, NullGraphicsCallType::FORGE_DRAW);
+		EXPECT_EQ(context_state.GetCall(7).m_arguments[1], 3.0);
+		EXPECT_EQ(context_state.GetCall(7).m_arguments[2], 36.0);
+
+		EXPECT_EQ(context_state.GetCall(8).m_type, NullGraphicsCallType::FORGE_DRAW_INDEXED);
+		EXPECT_EQ(context_state.GetCall(8).m_arguments[1], (double)ValueTypeMask::FORGE_USHORT);
+		EXPECT_EQ(context_state.GetCall(8).m_arguments[4], -2.0);
+
+		/// Executing again replays the same commands.
+		context_state.ClearCalls();
+		command_buffer.Execute(context_state);
+
+		EXPECT_EQ(context_state.GetNumOfCalls(), 9);
+	}
+
+	/**
+	 * Tests that data written to a hardware buffer is copied at recording,
+	 * and split over several pages when larger than one.
+	 */
+	TEST(CommandBufferTest, WriteHardwareBuffer)
+	{
+		const size_t page_size = 1024;
+		const size_t length = 5000;
+
+		Forge::Memory::ConcurrentPoolAllocator page_allocator(page_size, page_size * 16);
+		NullHardwareBuffer hardware_buffer(length + 100);
+		NullGraphicsContextState context_state;
+		CommandBuffer command_buffer(page_allocator);
+
+		std::vector<unsigned char> data(length);
+
+		for (size_t i = 0; i < length; i++)
+			data[i] = (unsigned char)(i * 7 + 1);
+
+		command_buffer.WriteHardwareBuffer(&hardware_buffer, data.data(), 100, length);
+
+		EXPECT_GT(command_buffer.GetNumOfCommands(), length / page_size);
+		EXPECT_LE(command_buffer.GetUsedMemory(), page_allocator.GetUsedMemory());
+
+		/// The source can be reused once recorded.
+		std::fill(data.begin(), data.end(), 0);
+
+		command_buffer.Execute(context_state);
+
+		std::vector<unsigned char> result(length + 100);
+
+		hardware_buffer.ReadData(result.data(), 0, result.size());
+
+		int mistakes = 0;
+
+		for (size_t i = 0; i < 100; i++)
+			mistakes += result[i] != 0;
+
+		for (size_t i = 0; i < length; i++)
+			mistakes += result[100 + i] != (unsigned char)(i * 7 + 1);
+
+		EXPECT_EQ(mistakes, 0);
+
+		command_buffer.Reset();
+
+		EXPECT_EQ(command_buffer.GetNumOfCommands(), 0);
+		EXPECT_EQ(page_allocator.GetUsedMemory(), 0);
+	}
+
+	/**
+	 * Tests that a command buffer overflows once the page allocator is
+	 * exhausted, keeping the commands recorded before, and recovers once
+	 * reset.
+	 */
+	TEST(CommandBufferTest, Overflow)
+	{
+		const size_t page_size = 256;
+
+		Forge::Memory::ConcurrentPoolAllocator page_allocator(page_size, page_size * 2);
+		NullHardwareBuffer hardware_buffer(64);
+		NullGraphicsContextState context_state;
+		CommandBuffer command_buffer(page_allocator);
+
+		command_buffer.BindHardwareBuffer(&hardware_buffer);
+
+		size_t draws = 0;
+
+		while (!command_buffer.IsOverflowed())
+			command_buffer.Draw(PrimitiveTopologyMask::FORGE_POINT, (unsigned)draws++, 1);
+
+		/// Small commands recorded after the overflow do not fill the tail of
+		/// the last page.
+		command_buffer.SetLineWidth(2.0f);
+
+		EXPECT_EQ(command_buffer.GetNumOfCommands(), draws);
+		EXPECT_EQ(page_allocator.GetUsedMemory(), page_size * 2);
+
+		command_buffer.Reset();
+
+		EXPECT_FALSE(command_buffer.IsOverflowed());
+		EXPECT_EQ(page_allocator.GetUsedMemory(), 0);
+
+		command_buffer.BindHardwareBuffer(&hardware_buffer);
+		command_buffer.Draw(PrimitiveTopologyMask::FORGE_POINT, 0, 1);
+		command_buffer.Execute(context_state);
+
+		EXPECT_EQ(context_state.GetNumOfCalls(), 2);
+	}
+
+	/**
+	 * Tests that the null context state rejects invalid command streams.
+	 */
+	TEST(CommandBufferTest, Validation)
+	{
+		Forge::Memory::ConcurrentPoolAllocator page_allocator(COMMAND_PAGE_SIZE, COMMAND_PAGE_SIZE * 4);
+		NullHardwareBuffer hardware_buffer(16);
+		NullGraphicsContextState context_state;
+
+		{
+			CommandBuffer command_buffer(page_allocator);
+			command_buffer.Draw(PrimitiveTopologyMask::FORGE_TRIANGLE, 0, 3);
+
+			EXPECT_THROW(command_buffer.Execute(context_state), Forge::Debug::InvalidOperationException);
+		}
+
+		{
+			CommandBuffer command_buffer(page_allocator);
+			command_buffer.BindHardwareBuffer(&hardware_buffer);
+			command_buffer.DrawIndexed(PrimitiveTopologyMask::FORGE_TRIANGLE, ValueTypeMask::FORGE_FLOAT, 0, 3, 0);
+
+			EXPECT_THROW(command_buffer.Execute(context_state), Forge::Debug::InvalidOperationException);
+		}
+
+		{
+			unsigned char data[8] = {};
+
+			CommandBuffer command_buffer(page_allocator);
+			command_buffer.WriteHardwareBuffer(&hardware_buffer, data, 12, sizeof(data));
+
+			EXPECT_THROW(command_buffer.Execute(context_state), Forge::Debug::MemoryOutOfBoundsException);
+		}
+
+		EXPECT_EQ(page_allocator.GetUsedMemory(), 0);
+	}
+
+	/**
+	 * Tests that command buffers recorded and submitted by several threads
+	 * execute in the order they were submitted with, whichever thread
+	 * finishes first.
+	 */
+	TEST(CommandQueueTest, ParallelRecording)
+	{
+		const unsigned thread_count = 4;
+		const unsigned draw_count = 2000;
+
+		Forge::Memory::ConcurrentPoolAllocator page_allocator(4096, 4096 * 64);
+		NullHardwareBuffer hardware_buffer(64);
+		NullGraphicsContextState context_state;
+		CommandQueue command_queue;
+
+		std::vector<CommandBuffer*> command_buffers;
+		std::vector<std::thread> threads;
+
+		for (unsigned t = 0; t < thread_count; t++)
+			command_buffers.push_back(new CommandBuffer(page_allocator));
+
+		for (int frame = 0; frame < 3; frame++)
+		{
+			for (unsigned t = 0; t < thread_count; t++)
+			{
+				threads.emplace_back([&, t]()
+				{
+					CommandBuffer& command_buffer = *command_buffers[t];
+
+					command_buffer.Reset();
+					command_buffer.BindHardwareBuffer(&hardware_buffer);
+
+					for (unsigned i = 0; i < draw_count; i++)
+						command_buffer.Draw(PrimitiveTopologyMask::FORGE_TRIANGLE, t * draw_count + i, 3);
+
+					/// The last part is submitted first.
+					std::this_thread::sleep_for(std::chrono::milliseconds(thread_count - t));
+
+					command_queue.Submit(command_buffer, t);
+				});
+			}
+
+			for (std::thread& thread : threads)
+				thread.join();
+
+			threads.clear();
+
+			for (unsigned t = 0; t < thread_count; t++)
+				EXPECT_TRUE(command_buffers[t]->IsPending());
+
+			context_state.ClearCalls();
+
+			EXPECT_EQ(command_queue.Execute(context_state), thread_count);
+			EXPECT_EQ(command_queue.GetNumOfSubmissions(), 0);
+
+			ASSERT_EQ(context_state.GetNumOfCalls(), thread_count * (draw_count + 1));
+
+			int mistakes = 0;
+			unsigned expected = 0;
+
+			for (size_t i = 0; i < context_state.GetNumOfCalls(); i++)
+			{
+				const NullGraphicsCall& call = context_state.GetCall(i);
+
+				if (call.m_type == NullGraphicsCallType::FORGE_BIND_HARDWARE_BUFFER)
+					continue;
+
+				mistakes += call.m_arguments[1] != (double)expected++;
+			}
+
+			EXPECT_EQ(mistakes, 0);
+
+			for (unsigned t = 0; t < thread_count; t++)
+				EXPECT_FALSE(command_buffers[t]->IsPending());
+		}
+
+		for (CommandBuffer* command_buffer : command_buffers)
+			delete command_buffer;
+
+		EXPECT_EQ(page_allocator.GetUsedMemory(), 0);
+	}
+}
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef DRAW_QUEUE_BENCHMARK_H
+#define DRAW_QUEUE_BENCHMARK_H
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Source/Benchmark/BenchmarkUtilities.h"
+
+#include "GraphicsDevice/Public/Base/DrawQueue.h"
+#include "GraphicsDevice/Public/Null/NullHardwareBuffer.h"
+#include "GraphicsDevice/Public/Null/NullGraphicsContextState.h"
+
+/**
+ * Measures a frame of 16K draws spread over 16 pipeline states, 256
+ * materials and 64 hardware buffers in random order, submitted to a draw
+ * queue and executed on the null context state. The frame is replayed in
+ * submission order and sorted by key. Every variant reports the time per
+ * draw, including the submission, and the context state calls per frame
+ * besides the draws.
+ */
+namespace DrawQueueBenchmark
+{
+	TEST(DrawQueueBenchmark, DISABLED_SortedAndUnsorted)
+	{
+		using namespace Forge::Graphics;
+
+		const unsigned draw_count = 1 << 14;
+		const unsigned pipeline_count = 16;
+		const unsigned material_count = 256;
+		const unsigned buffer_count = 64;
+		const size_t frames = 32;
+
+		struct Submission { unsigned pipeline, material, buffer; float depth; };
+
+		std::vector<std::unique_ptr<NullHardwareBuffer>> buffers;
+		std::vector<Submission> submissions;
+		std::mt19937 random(42);
+
+		for (unsigned i = 0; i < buffer_count; i++)
+			buffers.emplace_back(new NullHardwareBuffer(256));
+
+		for (unsigned i = 0; i < draw_count; i++)
+			submissions.push_back(Submission{ (unsigned)random() % pipeline_count, (unsigned)random() % material_count, (unsigned)random() % buffer_count, (random() % 4096) / 4096.0f });
+
+		for (bool sort_by_key : { false, true })
+		{
+			PipelineStateCache state_cache;
+			DrawQueue draw_queue;
+			NullGraphicsContextState context_state(nullptr, false);
+
+			for (unsigned i = 0; i < pipeline_count; i++)
+			{
+				RasterizerStateDesc rasterizer_desc;
+				rasterizer_desc.is_face_culling_enabled = (i & 4) == 0;
+				rasterizer_desc.polygon_fill_mode = (i & 8) ? PolygonFillMask::FORGE_WIREFRAME : PolygonFillMask::FORGE_SOLID;
+
+				BlendStateDesc blend_desc;
+				blend_desc.is_enabled = (i & 2) != 0;
+
+				DepthStencilStateDesc depth_stencil_desc;
+				depth_stencil_desc.depth_comparison_function = (i & 1) ? ComparisonFuncMask::FORGE_LEQUAL : ComparisonFuncMask::FORGE_LESS;
+				depth_stencil_desc.depth_write_mask = (i & 2) == 0;
+
+				DrawPipelineState pipeline_state;
+				pipeline_state.rasterizer_state = state_cache.GetRasterizerState(rasterizer_desc);
+				pipeline_state.blend_state = state_cache.GetBlendState(blend_desc);
+				pipeline_state.depth_stencil_state = state_cache.GetDepthStencilState(depth_stencil_desc);
+
+				draw_queue.AddPipelineState(pipeline_state);
+			}
+
+			for (unsigned i = 0; i < material_count; i++)
+				draw_queue.AddMaterial([i](AbstractGraphicsContextState& state) { state.SetActiveTexture(i % 16); });
+
+			double elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t frame = 0; frame < frames; frame++)
+				{
+					for (unsigned i = 0; i < draw_count; i++)
+					{
+						const Submission& submission = submissions[i];
+
+						draw_queue.SubmitIndexed(submission.pipeline, submission.material, buffers[submission.buffer].get(), submission.depth, PrimitiveTopologyMask::FORGE_TRIANGLE, ValueTypeMask::FORGE_USHORT, 0, 36, 0);
+					}
+
+					draw_queue.Execute(context_state, sort_by_key);
+				}
+			});
+
+			const NullGraphicsContextStateStatistics& statistics = context_state.GetStatistics();
+
+			EXPECT_EQ(statistics.m_num_of_draws, draw_count * frames);
+
+			std::string name = sort_by_key ? "DrawQueue/Sorted" : "DrawQueue/Unsorted";
+
+			BenchmarkUtilities::RecordMeasurement(name, elapsed / (draw_count * frames), "ns/draw");
+			BenchmarkUtilities::RecordMeasurement(name + "/StateCallsPerFrame", (double)(statistics.m_num_of_calls - statistics.m_num_of_draws) / frames, "calls");
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,269 @@
+#ifndef DRAW_QUEUE_TEST_H
+#define DRAW_QUEUE_TEST_H
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "GraphicsDevice/Public/Base/DrawQueue.h"
+#include "GraphicsDevice/Public/Null/NullHardwareBuffer.h"
+#include "GraphicsDevice/Public/Null/NullGraphicsContextState.h"
+
+using namespace Forge::Graphics;
+
+namespace DrawQueueTest
+{
+	/**
+	 * Tests that sort keys order draws by pipeline state, then material,
+	 * then depth, and clamp the depth.
+	 */
+	TEST(DrawQueueTest, SortKey)
+	{
+		NullHardwareBuffer hardware_buffer(16);
+
+		EXPECT_LT(DrawQueue::MakeSortKey(0, 9, &hardware_buffer, 1.0f), DrawQueue::MakeSortKey(1, 0, &hardware_buffer, 0.0f));
+		EXPECT_LT(DrawQueue::MakeSortKey(1, 0, &hardware_buffer, 1.0f), DrawQueue::MakeSortKey(1, 1, &hardware_buffer, 0.0f));
+		EXPECT_LT(DrawQueue::MakeSortKey(1, 1, &hardware_buffer, 0.25f), DrawQueue::MakeSortKey(1, 1, &hardware_buffer, 0.5f));
+
+		EXPECT_EQ(DrawQueue::MakeSortKey(2, 3, &hardware_buffer, -1.0f), DrawQueue::MakeSortKey(2, 3, &hardware_buffer, 0.0f));
+		EXPECT_EQ(DrawQueue::MakeSortKey(2, 3, &hardware_buffer, 7.0f), DrawQueue::MakeSortKey(2, 3, &hardware_buffer, 1.0f));
+		EXPECT_EQ(DrawQueue::MakeSortKey(2, 3, &hardware_buffer, std::nanf("")), DrawQueue::MakeSortKey(2, 3, &hardware_buffer, 0.0f));
+
+		EXPECT_EQ(DrawQueue::MakeSortKey(MAX_DRAW_PIPELINE_STATES - 1, 0, nullptr, 0.0f) >> 52, MAX_DRAW_PIPELINE_STATES - 1);
+	}
+
+	/**
+	 * Tests that executing the queue replays draws grouped by pipeline state,
+	 * material and hardware buffer, front to back within a group, and that
+	 * the reported transitions match the calls reaching the context state.
+	 */
+	TEST(DrawQueueTest, SortedReplay)
+	{
+		const unsigned draw_count = 3000;
+		const unsigned pipeline_count = 3;
+		const unsigned material_count = 5;
+		const unsigned buffer_count = 4;
+
+		PipelineStateCache state_cache;
+		DrawQueue draw_queue;
+		NullGraphicsContextState context_state;
+		std::vector<NullHardwareBuffer*> buffers;
+
+		for (unsigned i = 0; i < buffer_count; i++)
+			buffers.push_back(new NullHardwareBuffer(16));
+
+		for (unsigned i = 0; i < pipeline_count; i++)
+		{
+			RasterizerStateDesc rasterizer_desc;
+			rasterizer_desc.polygon_fill_mode = i == 1 ? PolygonFillMask::FORGE_WIREFRAME : PolygonFillMask::FORGE_SOLID;
+
+			BlendStateDesc blend_desc;
+			blend_desc.is_enabled = i == 2;
+
+			DrawPipelineState pipeline_state;
+			pipeline_state.rasterizer_state = state_cache.GetRasterizerState(rasterizer_desc);
+			pipeline_state.blend_state = state_cache.GetBlendState(blend_desc);
+			pipeline_state.depth_stencil_state = state_cache.GetDepthStencilState(DepthStencilStateDesc());
+
+			EXPECT_EQ(draw_queue.AddPipelineState(pipeline_state), i);
+		}
+
+		for (unsigned i = 0; i < material_count; i++)
+			EXPECT_EQ(draw_queue.AddMaterial([i](AbstractGraphicsContextState& state) { state.SetActiveTexture(i); }), i);
+
+		struct Submission { unsigned pipeline, material, buffer; float depth; };
+
+		std::vector<Submission> submissions;
+		std::mt19937 random(7);
+
+		for (unsigned i = 0; i < draw_count; i++)
+		{
+			Submission submission{ (unsigned)random() % pipeline_count, (unsigned)random() % material_count, (unsigned)random() % buffer_count, (random() % 1000) / 1000.0f };
+			submissions.push_back(submission);
+
+			draw_queue.Submit(submission.pipeline, submission.material, buffers[submission.buffer], submission.depth, PrimitiveTopologyMask::FORGE_TRIANGLE, i, 3);
+		}
+
+		EXPECT_EQ(draw_queue.GetNumOfDraws(), draw_count);
+
+		const DrawQueueStatistics& statistics = draw_queue.Execute(context_state);
+
+		EXPECT_EQ(draw_queue.GetNumOfDraws(), 0);
+		EXPECT_EQ(statistics.m_num_of_draws, draw_count);
+		EXPECT_EQ(statistics.m_num_of_pipeline_changes, pipeline_count);
+		EXPECT_EQ(statistics.m_num_of_material_changes, pipeline_count * material_count);
+		EXPECT_LE(statistics.m_num_of_buffer_changes, pipeline_count * material_count * buffer_count);
+
+		const NullGraphicsContextStateStatistics& calls = context_state.GetStatistics();
+
+		EXPECT_EQ(calls.m_num_of_draws, draw_count);
+		EXPECT_EQ(calls.m_num_of_calls_by_type[(size_t)NullGraphicsCallType::FORGE_SET_ACTIVE_TEXTURE], statistics.m_num_of_material_changes);
+		EXPECT_EQ(calls.m_num_of_calls_by_type[(size_t)NullGraphicsCallType::FORGE_BIND_HARDWARE_BUFFER], statistics.m_num_of_buffer_changes);
+		EXPECT_EQ(calls.m_num_of_calls, statistics.m_num_of_draws + statistics.m_num_of_material_changes + statistics.m_num_of_buffer_changes + statistics.m_num_of_state_binds);
+
+		/// Walks the replayed calls, checking every draw against its
+		/// submission and the draws are ordered by their group then depth.
+		int mistakes = 0;
+		unsigned material = ~0u;
+		NullHardwareBuffer* buffer = nullptr;
+		const Submission* previous = nullptr;
+
+		for (size_t i = 0; i < context_state.GetNumOfCalls(); i++)
+		{
+			const NullGraphicsCall& call = context_state.GetCall(i);
+
+			if (call.m_type == NullGraphicsCallType::FORGE_SET_ACTIVE_TEXTURE)
+				material = (unsigned)call.m_arguments[0];
+			else if (call.m_type == NullGraphicsCallType::FORGE_BIND_HARDWARE_BUFFER)
+				buffer = (NullHardwareBuffer*)call.m_hardware_buffer;
+			else if (call.m_type == NullGraphicsCallType::FORGE_DRAW)
+			{
+				const Submission& submission = submissions[(size_t)call.m_arguments[1]];
+
+				mistakes += submission.material != material;
+				mistakes += buffers[submission.buffer] != buffer;
+
+				if (previous)
+				{
+					if (previous->pipeline == submission.pipeline && previous->material == submission.material && previous->buffer == submission.buffer)
+						mistakes += previous->depth > submission.depth;
+					else
+						mistakes += previous->pipeline > submission.pipeline || (previous->pipeline == submission.pipeline && previous->material > submission.material);
+				}
+
+				previous = &submission;
+			}
+		}
+
+		EXPECT_EQ(mistakes, 0);
+
+		/// Replaying the same frame in submission order changes far more.
+		for (unsigned i = 0; i < draw_count; i++)
+			draw_queue.Submit(submissions[i].pipeline, submissions[i].material, buffers[submissions[i].buffer], submissions[i].depth, PrimitiveTopologyMask::FORGE_TRIANGLE, i, 3);
+
+		const DrawQueueStatistics& unsorted = draw_queue.Execute(context_state, false);
+
+		EXPECT_EQ(unsorted.m_num_of_draws, draw_count);
+		EXPECT_GT(unsorted.m_num_of_pipeline_changes, draw_count / 2);
+		EXPECT_GT(unsorted.m_num_of_material_changes, draw_count / 2);
+
+		for (NullHardwareBuffer* hardware_buffer : buffers)
+			delete hardware_buffer;
+	}
+
+	/**
+	 * Tests that pipeline state transitions only bind the state objects
+	 * which differ, and that the context state only applies their differing
+	 * fields.
+	 */
+	TEST(DrawQueueTest, PipelineStateTransitions)
+	{
+		PipelineStateCache state_cache;
+		DrawQueue draw_queue;
+		NullGraphicsContextState context_state;
+		NullHardwareBuffer hardware_buffer(16);
+
+		DepthStencilStateDesc opaque_depth;
+		opaque_depth.depth_comparison_function = ComparisonFuncMask::FORGE_LEQUAL;
+
+		DepthStencilStateDesc overlay_depth = opaque_depth;
+		overlay_depth.is_depth_test_enabled = false;
+		overlay_depth.depth_comparison_function = ComparisonFuncMask::FORGE_ALWAYS;
+
+		DepthStencilStateDesc translucent_depth = opaque_depth;
+		translucent_depth.depth_write_mask = false;
+
+		BlendStateDesc translucent_blend;
+		translucent_blend.is_enabled = true;
+
+		DrawPipelineState opaque;
+		opaque.rasterizer_state = state_cache.GetRasterizerState(RasterizerStateDesc());
+		opaque.blend_state = state_cache.GetBlendState(BlendStateDesc());
+		opaque.depth_stencil_state = state_cache.GetDepthStencilState(opaque_depth);
+
+		DrawPipelineState overlay = opaque;
+		overlay.depth_stencil_state = state_cache.GetDepthStencilState(overlay_depth);
+
+		DrawPipelineState translucent = opaque;
+		translucent.blend_state = state_cache.GetBlendState(translucent_blend);
+		translucent.depth_stencil_state = state_cache.GetDepthStencilState(translucent_depth);
+
+		unsigned opaque_index = draw_queue.AddPipelineState(opaque);
+		unsigned overlay_index = draw_queue.AddPipelineState(overlay);
+		unsigned translucent_index = draw_queue.AddPipelineState(translucent);
+		unsigned material = draw_queue.AddMaterial([](AbstractGraphicsContextState&) {});
+
+		/// Submitted in reverse, the sort restores the pipeline state order.
+		draw_queue.Submit(translucent_index, material, &hardware_buffer, 0.0f, PrimitiveTopologyMask::FORGE_TRIANGLE, 0, 3);
+		draw_queue.Submit(overlay_index, material, &hardware_buffer, 0.0f, PrimitiveTopologyMask::FORGE_TRIANGLE, 0, 3);
+		draw_queue.Submit(opaque_index, material, &hardware_buffer, 0.0f, PrimitiveTopologyMask::FORGE_TRIANGLE, 0, 3);
+
+		draw_queue.Execute(context_state);
+
+		std::vector<NullGraphicsCallType> expected =
+		{
+			/// The first pipeline state binds every state object.
+			NullGraphicsCallType::FORGE_APPLY_RASTERIZER_STATE,
+			NullGraphicsCallType::FORGE_APPLY_BLEND_STATE,
+			NullGraphicsCallType::FORGE_APPLY_DEPTH_STENCIL_STATE,
+			NullGraphicsCallType::FORGE_BIND_HARDWARE_BUFFER,
+			NullGraphicsCallType::FORGE_DRAW,
+
+			/// The overlay only changes the depth stencil state.
+			NullGraphicsCallType::FORGE_APPLY_DEPTH_STENCIL_STATE,
+			NullGraphicsCallType::FORGE_DRAW,
+
+			/// The translucent state shares the rasterizer state.
+			NullGraphicsCallType::FORGE_APPLY_BLEND_STATE,
+			NullGraphicsCallType::FORGE_APPLY_DEPTH_STENCIL_STATE,
+			NullGraphicsCallType::FORGE_DRAW,
+		};
+
+		ASSERT_EQ(context_state.GetNumOfCalls(), expected.size());
+
+		for (size_t i = 0; i < expected.size(); i++)
+			EXPECT_EQ(context_state.GetCall(i).m_type, expected[i]) << "at call " << i;
+
+		EXPECT_EQ(context_state.GetCall(0).m_arguments[0], (double)RasterizerStateDelta::FORGE_ALL);
+		EXPECT_EQ(context_state.GetCall(5).m_arguments[0], (double)(DepthStencilStateDelta::FORGE_DEPTH_TEST | DepthStencilStateDelta::FORGE_DEPTH_FUNCTION));
+		EXPECT_EQ(context_state.GetCall(7).m_arguments[0], (double)BlendStateDelta::FORGE_BLENDING);
+		EXPECT_EQ(context_state.GetCall(8).m_arguments[0], (double)(DepthStencilStateDelta::FORGE_DEPTH_TEST | DepthStencilStateDelta::FORGE_DEPTH_WRITE_MASK | DepthStencilStateDelta::FORGE_DEPTH_FUNCTION));
+
+		EXPECT_EQ(draw_queue.GetStatistics().m_num_of_state_binds, 6);
+		EXPECT_EQ(draw_queue.GetStatistics().m_num_of_pipeline_changes, 3);
+		EXPECT_EQ(draw_queue.GetStatistics().m_num_of_material_changes, 1);
+	}
+
+	/**
+	 * Tests that pipeline states need every state object, and that draws can
+	 * only be submitted with added pipeline states and materials.
+	 */
+	TEST(DrawQueueTest, Validation)
+	{
+		PipelineStateCache state_cache;
+		DrawQueue draw_queue;
+		NullGraphicsContextState context_state;
+
+		EXPECT_THROW(draw_queue.Submit(0, 0, nullptr, 0.0f, PrimitiveTopologyMask::FORGE_POINT, 0, 1), Forge::Debug::InvalidOperationException);
+
+		DrawPipelineState pipeline_state;
+		pipeline_state.rasterizer_state = state_cache.GetRasterizerState(RasterizerStateDesc());
+		pipeline_state.blend_state = state_cache.GetBlendState(BlendStateDesc());
+
+		EXPECT_THROW(draw_queue.AddPipelineState(pipeline_state), Forge::Debug::InvalidOperationException);
+
+		pipeline_state.depth_stencil_state = state_cache.GetDepthStencilState(DepthStencilStateDesc());
+
+		EXPECT_EQ(draw_queue.AddPipelineState(pipeline_state), 0);
+
+		EXPECT_THROW(draw_queue.SubmitIndexed(0, 0, nullptr, 0.0f, PrimitiveTopologyMask::FORGE_POINT, ValueTypeMask::FORGE_UINT, 0, 1, 0), Forge::Debug::InvalidOperationException);
+		EXPECT_EQ(draw_queue.GetNumOfDraws(), 0);
+
+		EXPECT_EQ(draw_queue.Execute(context_state).m_num_of_draws, 0);
+		EXPECT_EQ(context_state.GetNumOfCalls(), 0);
+	}
+}
+
+#endif
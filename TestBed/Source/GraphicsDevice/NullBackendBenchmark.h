@@ -0,0 +1,79 @@
+#ifndef NULL_BACKEND_BENCHMARK_H
+#define NULL_BACKEND_BENCHMARK_H
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Source/Benchmark/BenchmarkUtilities.h"
+
+#include "GraphicsDevice/Public/Null/NullHardwareBuffer.h"
+#include "GraphicsDevice/Public/Null/NullGraphicsContext.h"
+#include "GraphicsDevice/Public/Null/NullGraphicsContextState.h"
+
+/**
+ * Measures the cost of the null backend itself, the floor under every
+ * render front-end benchmark running on it. A frame of 16K objects, each
+ * writing its constants to a hardware buffer, binding it and drawing, is
+ * submitted without recording and without latency, then presented. The
+ * time per call and the counters of a frame are reported.
+ */
+namespace NullBackendBenchmark
+{
+	TEST(NullBackendBenchmark, DISABLED_Frame)
+	{
+		using namespace Forge::Graphics;
+
+		const unsigned object_count = 1 << 14;
+		const size_t frames = 32;
+		const size_t buffer_count = 16;
+
+		NullGraphicsContext context;
+		NullGraphicsContextState context_state(&context, false);
+
+		std::vector<std::unique_ptr<NullHardwareBuffer>> buffers;
+
+		for (size_t i = 0; i < buffer_count; i++)
+			buffers.emplace_back(new NullHardwareBuffer(64 * 1024));
+
+		float constants[16] = {};
+
+		context.Initialize();
+		context.SetCurrent();
+
+		double elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+		{
+			for (size_t frame = 0; frame < frames; frame++)
+			{
+				for (unsigned i = 0; i < object_count; i++)
+				{
+					NullHardwareBuffer* buffer = buffers[i % buffer_count].get();
+
+					buffer->WriteData(constants, (i / buffer_count) % 1024 * sizeof(constants), sizeof(constants));
+
+					context_state.BindHardwareBuffer(buffer);
+					context_state.DrawIndexed(PrimitiveTopologyMask::FORGE_TRIANGLE, ValueTypeMask::FORGE_USHORT, 0, 36, 0);
+				}
+
+				context.SwapBuffers();
+			}
+		});
+
+		size_t bytes = 0;
+
+		for (const std::unique_ptr<NullHardwareBuffer>& buffer : buffers)
+			bytes += buffer->GetStatistics().m_num_of_bytes_written;
+
+		const double calls = (double)context_state.GetStatistics().m_num_of_calls + object_count * frames;
+
+		EXPECT_EQ(context.GetStatistics().m_num_of_swaps, frames);
+		EXPECT_EQ(context_state.GetStatistics().m_num_of_draws, object_count * frames);
+
+		BenchmarkUtilities::RecordMeasurement("NullBackend/Call", elapsed / calls, "ns/call");
+		BenchmarkUtilities::RecordMeasurement("NullBackend/CallsPerFrame", calls / frames, "calls");
+		BenchmarkUtilities::RecordMeasurement("NullBackend/BytesPerFrame", (double)bytes / frames, "bytes");
+	}
+}
+
+#endif
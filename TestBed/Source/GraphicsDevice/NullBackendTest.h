@@ -0,0 +1,170 @@
+#ifndef NULL_BACKEND_TEST_H
+#define NULL_BACKEND_TEST_H
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include "GraphicsDevice/Public/Null/NullHardwareBuffer.h"
+#include "GraphicsDevice/Public/Null/NullGraphicsContext.h"
+#include "GraphicsDevice/Public/Null/NullGraphicsContextState.h"
+
+using namespace Forge::Graphics;
+
+namespace NullBackendTest
+{
+	/**
+	 * Tests that the null context follows the life cycle of a real context
+	 * and counts its calls.
+	 */
+	TEST(NullBackendTest, ContextLifeCycle)
+	{
+		NullGraphicsContext context;
+
+		EXPECT_EQ(context.GetWindow(), nullptr);
+		EXPECT_THROW(context.SetCurrent(), Forge::Debug::InvalidOperationException);
+		EXPECT_FALSE(context.SwapBuffers());
+
+		EXPECT_TRUE(context.Initialize());
+		context.SetCurrent();
+
+		for (int i = 0; i < 3; i++)
+			EXPECT_TRUE(context.SwapBuffers(1));
+
+		context.EndCurrent();
+
+		EXPECT_FALSE(context.SwapBuffers());
+
+		context.SetCurrent();
+		context.Terminate();
+
+		EXPECT_FALSE(context.IsInitialized());
+		EXPECT_FALSE(context.IsCurrent());
+
+		const NullGraphicsContextStatistics& statistics = context.GetStatistics();
+
+		EXPECT_EQ(statistics.m_num_of_initializations, 1);
+		EXPECT_EQ(statistics.m_num_of_terminations, 1);
+		EXPECT_EQ(statistics.m_num_of_set_currents, 2);
+		EXPECT_EQ(statistics.m_num_of_end_currents, 1);
+		EXPECT_EQ(statistics.m_num_of_swaps, 3);
+
+		context.ResetStatistics();
+
+		EXPECT_EQ(context.GetStatistics().m_num_of_swaps, 0);
+	}
+
+	/**
+	 * Tests that the null context state counts every call by function,
+	 * whether recording or not, along with the draws and their vertices.
+	 */
+	TEST(NullBackendTest, ContextStateStatistics)
+	{
+		NullGraphicsContext context;
+		NullGraphicsContextState context_state(&context, false);
+		NullHardwareBuffer hardware_buffer(64);
+
+		context_state.BindHardwareBuffer(&hardware_buffer);
+		context_state.SetDepthComparisonFunction(ComparisonFuncMask::FORGE_LEQUAL);
+		context_state.Draw(PrimitiveTopologyMask::FORGE_TRIANGLE, 0, 36);
+		context_state.Draw(PrimitiveTopologyMask::FORGE_TRIANGLE, 36, 6);
+		context_state.DrawIndexed(PrimitiveTopologyMask::FORGE_LINE, ValueTypeMask::FORGE_UINT, 0, 100, 0);
+
+		/// Rejected calls are not counted.
+		EXPECT_THROW(context_state.SetLineWidth(0.0f), Forge::Debug::InvalidOperationException);
+
+		const NullGraphicsContextStateStatistics& statistics = context_state.GetStatistics();
+
+		EXPECT_EQ(context_state.GetNumOfCalls(), 0);
+		EXPECT_EQ(statistics.m_num_of_calls, 5);
+		EXPECT_EQ(statistics.m_num_of_draws, 3);
+		EXPECT_EQ(statistics.m_num_of_vertices, 142);
+		EXPECT_EQ(statistics.m_num_of_calls_by_type[(size_t)NullGraphicsCallType::FORGE_BIND_HARDWARE_BUFFER], 1);
+		EXPECT_EQ(statistics.m_num_of_calls_by_type[(size_t)NullGraphicsCallType::FORGE_DRAW], 2);
+		EXPECT_EQ(statistics.m_num_of_calls_by_type[(size_t)NullGraphicsCallType::FORGE_DRAW_INDEXED], 1);
+		EXPECT_EQ(statistics.m_num_of_calls_by_type[(size_t)NullGraphicsCallType::FORGE_SET_LINE_WIDTH], 0);
+
+		context_state.ResetStatistics();
+
+		EXPECT_EQ(context_state.GetStatistics().m_num_of_calls, 0);
+		EXPECT_EQ(context_state.GetStatistics().m_num_of_calls_by_type[(size_t)NullGraphicsCallType::FORGE_DRAW], 0);
+	}
+
+	/**
+	 * Tests that the null hardware buffer counts its accesses and the bytes
+	 * they transfer.
+	 */
+	TEST(NullBackendTest, HardwareBufferStatistics)
+	{
+		NullHardwareBuffer src(256);
+		NullHardwareBuffer dst(256);
+
+		unsigned char data[100] = {};
+
+		dst.WriteData(data, 0, 100);
+		dst.WriteData(data, 100, 50);
+		dst.ReadData(data, 10, 20);
+		dst.CopyData(src, 0, 0, 128);
+
+		dst.Lock(64, 32, LockModeFlags::FORGE_WRITE_ONLY);
+		dst.Unlock();
+
+		EXPECT_THROW(dst.WriteData(data, 200, 100), Forge::Debug::MemoryOutOfBoundsException);
+
+		const NullHardwareBufferStatistics& statistics = dst.GetStatistics();
+
+		EXPECT_EQ(statistics.m_num_of_writes, 2);
+		EXPECT_EQ(statistics.m_num_of_bytes_written, 150);
+		EXPECT_EQ(statistics.m_num_of_reads, 1);
+		EXPECT_EQ(statistics.m_num_of_bytes_read, 20);
+		EXPECT_EQ(statistics.m_num_of_copies, 1);
+		EXPECT_EQ(statistics.m_num_of_bytes_copied, 128);
+		EXPECT_EQ(statistics.m_num_of_locks, 1);
+		EXPECT_EQ(statistics.m_num_of_bytes_locked, 32);
+
+		EXPECT_EQ(src.GetStatistics().m_num_of_copies, 0);
+	}
+
+	/**
+	 * Tests that the simulated driver latency is spent on the calling
+	 * thread.
+	 */
+	TEST(NullBackendTest, SimulatedLatency)
+	{
+		NullGraphicsContext context;
+		NullGraphicsContextState context_state(&context, false);
+		NullHardwareBuffer hardware_buffer(1 << 20);
+
+		NullDriverLatency latency;
+		latency.m_call_latency = 100000;
+		latency.m_draw_latency = 400000;
+		latency.m_byte_latency = 1.0;
+		latency.m_swap_latency = 2000000;
+
+		context.SetLatency(latency);
+		context_state.SetLatency(latency);
+		hardware_buffer.SetLatency(latency);
+
+		EXPECT_EQ(context_state.GetLatency().m_draw_latency, 400000);
+
+		context.Initialize();
+		context.SetCurrent();
+
+		auto measure = [](auto function)
+		{
+			auto begin = std::chrono::steady_clock::now();
+			function();
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+		};
+
+		/// Latencies are lower bounds, the calling thread may be preempted.
+		EXPECT_GE(measure([&]() { context_state.SetActiveTexture(0); }), 100000);
+		EXPECT_GE(measure([&]() { context_state.BindHardwareBuffer(&hardware_buffer); context_state.Draw(PrimitiveTopologyMask::FORGE_POINT, 0, 1); }), 600000);
+		EXPECT_GE(measure([&]() { hardware_buffer.Lock(LockModeFlags::FORGE_READ_ONLY); }), 100000 + (1 << 20));
+		EXPECT_GE(measure([&]() { context.SwapBuffers(); }), 2000000);
+
+		hardware_buffer.Unlock();
+	}
+}
+
+#endif
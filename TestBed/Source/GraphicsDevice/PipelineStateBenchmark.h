@@ -0,0 +1,126 @@
+#ifndef PIPELINE_STATE_BENCHMARK_H
+#define PIPELINE_STATE_BENCHMARK_H
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Source/Benchmark/BenchmarkUtilities.h"
+
+#include "GraphicsDevice/Public/Base/PipelineState.h"
+#include "GraphicsDevice/Public/Null/NullHardwareBuffer.h"
+#include "GraphicsDevice/Public/Null/NullGraphicsContextState.h"
+
+/**
+ * Measures a frame of 16K draws switching between 64 material pipeline
+ * states in random order, on the null context state. The per-field
+ * variant sets the whole fixed function state through the setters before
+ * every draw, the state object variant binds the three state objects of
+ * the material. Every variant reports the time per draw and the context
+ * state calls per frame besides the draws.
+ */
+namespace PipelineStateBenchmark
+{
+	TEST(PipelineStateBenchmark, DISABLED_SettersAndStateObjects)
+	{
+		using namespace Forge::Graphics;
+
+		const unsigned draw_count = 1 << 14;
+		const unsigned material_count = 64;
+		const size_t frames = 32;
+
+		struct Material
+		{
+			RasterizerStateDesc rasterizer;
+			BlendStateDesc blend;
+			DepthStencilStateDesc depth_stencil;
+
+			const RasterizerStateObject* rasterizer_state;
+			const BlendStateObject* blend_state;
+			const DepthStencilStateObject* depth_stencil_state;
+		};
+
+		PipelineStateCache state_cache;
+		NullHardwareBuffer hardware_buffer(256);
+		std::vector<Material> materials(material_count);
+		std::vector<unsigned> draws;
+		std::mt19937 random(42);
+
+		for (unsigned i = 0; i < material_count; i++)
+		{
+			Material& material = materials[i];
+			material.rasterizer.is_face_culling_enabled = (i & 1) == 0;
+			material.rasterizer.polygon_fill_mode = (i & 32) ? PolygonFillMask::FORGE_WIREFRAME : PolygonFillMask::FORGE_SOLID;
+			material.blend.is_enabled = (i & 2) != 0;
+			material.blend.dst_function = (i & 4) ? BlendFuncMask::FORGE_ONE : BlendFuncMask::FORGE_ONE_MINUS_SRC_ALPHA;
+			material.depth_stencil.depth_write_mask = (i & 2) == 0;
+			material.depth_stencil.depth_comparison_function = (i & 8) ? ComparisonFuncMask::FORGE_LEQUAL : ComparisonFuncMask::FORGE_LESS;
+			material.depth_stencil.is_stencil_test_enabled = (i & 16) != 0;
+
+			material.rasterizer_state = state_cache.GetRasterizerState(material.rasterizer);
+			material.blend_state = state_cache.GetBlendState(material.blend);
+			material.depth_stencil_state = state_cache.GetDepthStencilState(material.depth_stencil);
+		}
+
+		for (unsigned i = 0; i < draw_count; i++)
+			draws.push_back((unsigned)random() % material_count);
+
+		for (bool use_state_objects : { false, true })
+		{
+			NullGraphicsContextState context_state(nullptr, false);
+
+			context_state.BindHardwareBuffer(&hardware_buffer);
+
+			double elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+			{
+				for (size_t frame = 0; frame < frames; frame++)
+				{
+					for (unsigned i = 0; i < draw_count; i++)
+					{
+						const Material& material = materials[draws[i]];
+
+						if (use_state_objects)
+						{
+							context_state.BindRasterizerState(material.rasterizer_state);
+							context_state.BindBlendState(material.blend_state);
+							context_state.BindDepthStencilState(material.depth_stencil_state);
+						}
+						else
+						{
+							context_state.SetLineWidth(material.rasterizer.line_width);
+							context_state.SetFrontFace(material.rasterizer.front_face_mode);
+							context_state.SetFillMode(material.rasterizer.polygon_fill_mode);
+							context_state.EnableFaceCulling(material.rasterizer.is_face_culling_enabled);
+							context_state.SetFaceCullingMode(material.rasterizer.face_culling_mode);
+							context_state.EnableScissorTest(material.rasterizer.is_scissor_test_enabled);
+							context_state.EnableColorBlending(material.blend.is_enabled);
+							context_state.SetColorBlendingFunction(material.blend.src_function, material.blend.dst_function);
+							context_state.SetColorWriteMask(material.blend.color_write_mask[0], material.blend.color_write_mask[1], material.blend.color_write_mask[2], material.blend.color_write_mask[3]);
+							context_state.EnableDepthTest(material.depth_stencil.is_depth_test_enabled);
+							context_state.SetDepthWriteMask(material.depth_stencil.depth_write_mask);
+							context_state.SetDepthComparisonFunction(material.depth_stencil.depth_comparison_function);
+							context_state.EnableStencilTest(material.depth_stencil.is_stencil_test_enabled);
+							context_state.SetStencilWriteMask(material.depth_stencil.stencil_write_mask);
+							context_state.SetStencilComparisonFunction(material.depth_stencil.stencil_comparison_function, material.depth_stencil.stencil_reference, material.depth_stencil.stencil_mask);
+						}
+
+						context_state.DrawIndexed(PrimitiveTopologyMask::FORGE_TRIANGLE, ValueTypeMask::FORGE_USHORT, 0, 36, 0);
+					}
+				}
+			});
+
+			const NullGraphicsContextStateStatistics& statistics = context_state.GetStatistics();
+
+			EXPECT_EQ(statistics.m_num_of_draws, draw_count * frames);
+
+			std::string name = use_state_objects ? "PipelineState/StateObjects" : "PipelineState/Setters";
+
+			BenchmarkUtilities::RecordMeasurement(name, elapsed / (draw_count * frames), "ns/draw");
+			BenchmarkUtilities::RecordMeasurement(name + "/StateCallsPerFrame", (double)(statistics.m_num_of_calls - statistics.m_num_of_draws - 1) / frames, "calls");
+		}
+	}
+}
+
+#endif
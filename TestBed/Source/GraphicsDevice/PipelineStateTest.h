@@ -0,0 +1,245 @@
+#ifndef PIPELINE_STATE_TEST_H
+#define PIPELINE_STATE_TEST_H
+
+#include <gtest/gtest.h>
+
+#include "GraphicsDevice/Public/Base/CommandBuffer.h"
+#include "GraphicsDevice/Public/Base/PipelineState.h"
+#include "GraphicsDevice/Public/Null/NullGraphicsContextState.h"
+
+using namespace Forge::Graphics;
+
+namespace PipelineStateTest
+{
+	/**
+	 * Tests that the cache creates one state object per unique description
+	 * and returns it for every equal description.
+	 */
+	TEST(PipelineStateTest, Cache)
+	{
+		PipelineStateCache state_cache;
+
+		RasterizerStateDesc solid;
+		RasterizerStateDesc wireframe;
+		wireframe.polygon_fill_mode = PolygonFillMask::FORGE_WIREFRAME;
+
+		const RasterizerStateObject* solid_state = state_cache.GetRasterizerState(solid);
+		const RasterizerStateObject* wireframe_state = state_cache.GetRasterizerState(wireframe);
+
+		EXPECT_NE(solid_state, wireframe_state);
+		EXPECT_EQ(state_cache.GetRasterizerState(RasterizerStateDesc()), solid_state);
+		EXPECT_EQ(state_cache.GetRasterizerState(wireframe), wireframe_state);
+		EXPECT_EQ(state_cache.GetNumOfRasterizerStates(), 2);
+
+		EXPECT_TRUE(solid_state->GetDesc() == solid);
+		EXPECT_EQ(solid_state->GetHash(), solid.GetHash());
+		EXPECT_EQ(solid_state->GetID(), 0);
+		EXPECT_EQ(wireframe_state->GetID(), 1);
+
+		/// Negative zero compares equal to zero, so it must hash the same.
+		RasterizerStateDesc zero_width;
+		zero_width.line_width = 0.0f;
+
+		RasterizerStateDesc negative_zero_width;
+		negative_zero_width.line_width = -0.0f;
+
+		EXPECT_EQ(zero_width.GetHash(), negative_zero_width.GetHash());
+		EXPECT_EQ(state_cache.GetRasterizerState(zero_width), state_cache.GetRasterizerState(negative_zero_width));
+
+		/// Every field takes part in the hash and the equality.
+		DepthStencilStateDesc stencil;
+		DepthStencilStateDesc other_mask;
+		other_mask.stencil_mask = 0x0F;
+
+		DepthStencilStateDesc other_reference;
+		other_reference.stencil_reference = 1;
+
+		EXPECT_NE(stencil.GetHash(), other_mask.GetHash());
+		EXPECT_NE(stencil.GetHash(), other_reference.GetHash());
+		EXPECT_NE(state_cache.GetDepthStencilState(stencil), state_cache.GetDepthStencilState(other_mask));
+		EXPECT_NE(state_cache.GetDepthStencilState(stencil), state_cache.GetDepthStencilState(other_reference));
+		EXPECT_EQ(state_cache.GetNumOfDepthStencilStates(), 3);
+
+		BlendStateDesc opaque;
+		BlendStateDesc no_alpha;
+		no_alpha.color_write_mask[3] = false;
+
+		EXPECT_NE(state_cache.GetBlendState(opaque), state_cache.GetBlendState(no_alpha));
+		EXPECT_EQ(state_cache.GetNumOfBlendStates(), 2);
+	}
+
+	/**
+	 * Tests that the delta of two descriptions holds exactly the fields
+	 * which differ.
+	 */
+	TEST(PipelineStateTest, StateDelta)
+	{
+		RasterizerStateDesc rasterizer;
+		RasterizerStateDesc other_rasterizer;
+		other_rasterizer.line_width = 2.0f;
+		other_rasterizer.face_culling_mode = FaceCullMask::FORGE_FRONT;
+
+		EXPECT_EQ(ComputeStateDelta(rasterizer, rasterizer), RasterizerStateDelta::FORGE_NONE);
+		EXPECT_EQ(ComputeStateDelta(rasterizer, other_rasterizer), RasterizerStateDelta::FORGE_LINE_WIDTH | RasterizerStateDelta::FORGE_FACE_CULLING_MODE);
+
+		BlendStateDesc blend;
+		BlendStateDesc other_blend;
+		other_blend.dst_function = BlendFuncMask::FORGE_ONE;
+		other_blend.color_write_mask[0] = false;
+
+		EXPECT_EQ(ComputeStateDelta(blend, other_blend), BlendStateDelta::FORGE_FUNCTION | BlendStateDelta::FORGE_COLOR_WRITE_MASK);
+
+		DepthStencilStateDesc depth_stencil;
+		DepthStencilStateDesc other_depth_stencil;
+		other_depth_stencil.is_stencil_test_enabled = true;
+		other_depth_stencil.stencil_reference = 4;
+
+		EXPECT_EQ(ComputeStateDelta(depth_stencil, other_depth_stencil), DepthStencilStateDelta::FORGE_STENCIL_TEST | DepthStencilStateDelta::FORGE_STENCIL_FUNCTION);
+	}
+
+	/**
+	 * Tests that binding the bound state reaches nothing, that binding
+	 * another state applies only its delta, and that forgetting the bound
+	 * state makes the next bind apply every field.
+	 */
+	TEST(PipelineStateTest, Binding)
+	{
+		PipelineStateCache state_cache;
+		NullGraphicsContextState context_state;
+
+		DepthStencilStateDesc less;
+		DepthStencilStateDesc equal;
+		equal.depth_comparison_function = ComparisonFuncMask::FORGE_EQUAL;
+
+		const DepthStencilStateObject* less_state = state_cache.GetDepthStencilState(less);
+		const DepthStencilStateObject* equal_state = state_cache.GetDepthStencilState(equal);
+
+		context_state.BindDepthStencilState(less_state);
+		context_state.BindDepthStencilState(less_state);
+		context_state.BindDepthStencilState(equal_state);
+
+		ASSERT_EQ(context_state.GetNumOfCalls(), 2);
+
+		EXPECT_EQ(context_state.GetCall(0).m_type, NullGraphicsCallType::FORGE_APPLY_DEPTH_STENCIL_STATE);
+		EXPECT_EQ(context_state.GetCall(0).m_arguments[0], (double)DepthStencilStateDelta::FORGE_ALL);
+		EXPECT_EQ(context_state.GetCall(1).m_arguments[0], (double)DepthStencilStateDelta::FORGE_DEPTH_FUNCTION);
+
+		context_state.BindDepthStencilState(nullptr);
+		context_state.BindDepthStencilState(equal_state);
+
+		ASSERT_EQ(context_state.GetNumOfCalls(), 3);
+		EXPECT_EQ(context_state.GetCall(2).m_arguments[0], (double)DepthStencilStateDelta::FORGE_ALL);
+
+		context_state.InvalidateCache();
+		context_state.BindDepthStencilState(equal_state);
+
+		ASSERT_EQ(context_state.GetNumOfCalls(), 4);
+		EXPECT_EQ(context_state.GetCall(3).m_arguments[0], (double)DepthStencilStateDelta::FORGE_ALL);
+
+		/// Command buffers replay the binds through the same tracking.
+		Forge::Memory::ConcurrentPoolAllocator page_allocator(COMMAND_PAGE_SIZE, COMMAND_PAGE_SIZE * 2);
+		CommandBuffer command_buffer(page_allocator);
+
+		BlendStateDesc additive;
+		additive.is_enabled = true;
+		additive.src_function = BlendFuncMask::FORGE_ONE;
+		additive.dst_function = BlendFuncMask::FORGE_ONE;
+
+		command_buffer.BindRasterizerState(state_cache.GetRasterizerState(RasterizerStateDesc()));
+		command_buffer.BindBlendState(state_cache.GetBlendState(additive));
+		command_buffer.BindDepthStencilState(equal_state);
+
+		context_state.ClearCalls();
+		command_buffer.Execute(context_state);
+
+		ASSERT_EQ(context_state.GetNumOfCalls(), 2);
+		EXPECT_EQ(context_state.GetCall(0).m_type, NullGraphicsCallType::FORGE_APPLY_RASTERIZER_STATE);
+		EXPECT_EQ(context_state.GetCall(1).m_type, NullGraphicsCallType::FORGE_APPLY_BLEND_STATE);
+	}
+
+	/**
+	 * Tests that a per-field setter forgets the bound state of its group
+	 * only, so rebinding that state applies every field.
+	 */
+	TEST(PipelineStateTest, MixingSettersAndStates)
+	{
+		PipelineStateCache state_cache;
+		NullGraphicsContextState context_state;
+
+		DepthStencilStateDesc depth_stencil;
+		BlendStateDesc blend;
+
+		const DepthStencilStateObject* depth_stencil_state = state_cache.GetDepthStencilState(depth_stencil);
+		const BlendStateObject* blend_state = state_cache.GetBlendState(blend);
+
+		context_state.BindDepthStencilState(depth_stencil_state);
+		context_state.BindBlendState(blend_state);
+
+		context_state.EnableDepthTest(false);
+
+		context_state.ClearCalls();
+		context_state.BindDepthStencilState(depth_stencil_state);
+		context_state.BindBlendState(blend_state);
+
+		ASSERT_EQ(context_state.GetNumOfCalls(), 1);
+		EXPECT_EQ(context_state.GetCall(0).m_type, NullGraphicsCallType::FORGE_APPLY_DEPTH_STENCIL_STATE);
+		EXPECT_EQ(context_state.GetCall(0).m_arguments[0], (double)DepthStencilStateDelta::FORGE_ALL);
+	}
+
+	/**
+	 * Tests that destroying the cache of the bound state is safe, and that a
+	 * state of a newer cache with the same ID is applied against the
+	 * description of the destroyed state.
+	 */
+	TEST(PipelineStateTest, CacheOutlivedByContextState)
+	{
+		NullGraphicsContextState context_state;
+
+		DepthStencilStateDesc less;
+		DepthStencilStateDesc equal;
+		equal.depth_comparison_function = ComparisonFuncMask::FORGE_EQUAL;
+
+		{
+			PipelineStateCache state_cache;
+
+			context_state.BindDepthStencilState(state_cache.GetDepthStencilState(less));
+		}
+
+		PipelineStateCache state_cache;
+
+		const DepthStencilStateObject* equal_state = state_cache.GetDepthStencilState(equal);
+
+		EXPECT_EQ(equal_state->GetID(), 0);
+
+		context_state.BindDepthStencilState(equal_state);
+		context_state.BindDepthStencilState(equal_state);
+
+		ASSERT_EQ(context_state.GetNumOfCalls(), 2);
+		EXPECT_EQ(context_state.GetCall(1).m_arguments[0], (double)DepthStencilStateDelta::FORGE_DEPTH_FUNCTION);
+	}
+
+	/**
+	 * Tests that binding a state with invalid fields throws and keeps the
+	 * bound state.
+	 */
+	TEST(PipelineStateTest, Validation)
+	{
+		PipelineStateCache state_cache;
+		NullGraphicsContextState context_state;
+
+		RasterizerStateDesc invalid;
+		invalid.line_width = 0.0f;
+
+		const RasterizerStateObject* valid_state = state_cache.GetRasterizerState(RasterizerStateDesc());
+
+		context_state.BindRasterizerState(valid_state);
+
+		EXPECT_THROW(context_state.BindRasterizerState(state_cache.GetRasterizerState(invalid)), Forge::Debug::InvalidOperationException);
+
+		context_state.BindRasterizerState(valid_state);
+
+		EXPECT_EQ(context_state.GetNumOfCalls(), 1);
+	}
+}
+
+#endif
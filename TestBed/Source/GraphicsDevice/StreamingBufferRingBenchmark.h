@@ -0,0 +1,83 @@
+#ifndef STREAMING_BUFFER_RING_BENCHMARK_H
+#define STREAMING_BUFFER_RING_BENCHMARK_H
+
+#include <cstring>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "Source/Benchmark/BenchmarkUtilities.h"
+
+#include "GraphicsDevice/Public/Base/StreamingBufferRing.h"
+#include "GraphicsDevice/Public/Null/NullHardwareBuffer.h"
+
+/**
+ * Measures a frame of 16K draws, each streaming 256 bytes of dynamic
+ * vertices, into a null hardware buffer with a simulated driver latency
+ * of 200ns per call. The write variant calls WriteData once per draw, the
+ * ring variant copies into allocations of a streaming buffer ring over a
+ * buffer holding three frames. Every variant reports the time per draw.
+ */
+namespace StreamingBufferRingBenchmark
+{
+	TEST(StreamingBufferRingBenchmark, DISABLED_WriteDataAndRing)
+	{
+		using namespace Forge::Graphics;
+
+		const unsigned draw_count = 1 << 14;
+		const size_t vertex_size = 256;
+		const size_t frames = 32;
+
+		unsigned char vertices[vertex_size] = {};
+
+		NullDriverLatency latency;
+		latency.m_call_latency = 200;
+
+		for (bool use_ring : { false, true })
+		{
+			NullHardwareBuffer hardware_buffer(draw_count * vertex_size * 3, UsageModeMask::FORGE_CPU_TO_GPU_STREAM);
+			hardware_buffer.SetLatency(latency);
+
+			double elapsed = 0.0;
+
+			if (use_ring)
+			{
+				StreamingBufferRing ring(&hardware_buffer);
+
+				elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+				{
+					for (size_t frame = 0; frame < frames; frame++)
+					{
+						ring.BeginFrame();
+
+						for (unsigned i = 0; i < draw_count; i++)
+						{
+							size_t offset = 0;
+
+							std::memcpy(ring.Allocate(vertex_size, 16, offset), vertices, vertex_size);
+						}
+
+						ring.EndFrame();
+					}
+				});
+
+				EXPECT_EQ(ring.GetStatistics().m_num_of_stalls, 0);
+			}
+			else
+			{
+				elapsed = BenchmarkUtilities::MeasureNanoseconds([&]()
+				{
+					for (size_t frame = 0; frame < frames; frame++)
+						for (unsigned i = 0; i < draw_count; i++)
+							hardware_buffer.WriteData(vertices, i * vertex_size, vertex_size);
+				});
+			}
+
+			std::string name = use_ring ? "StreamingBufferRing/Ring" : "StreamingBufferRing/WriteData";
+
+			BenchmarkUtilities::RecordMeasurement(name, elapsed / (draw_count * frames), "ns/draw");
+		}
+	}
+}
+
+#endif
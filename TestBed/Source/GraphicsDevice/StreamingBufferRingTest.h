@@ -0,0 +1,209 @@
+#ifndef STREAMING_BUFFER_RING_TEST_H
+#define STREAMING_BUFFER_RING_TEST_H
+
+#include <gtest/gtest.h>
+
+#include "GraphicsDevice/Public/Base/StreamingBufferRing.h"
+#include "GraphicsDevice/Public/Null/NullHardwareBuffer.h"
+
+using namespace Forge::Graphics;
+
+namespace StreamingBufferRingTest
+{
+	/**
+	 * Tests that allocations are aligned, written straight into the locked
+	 * buffer, and that the buffer stays locked for the life of the ring.
+	 */
+	TEST(StreamingBufferRingTest, Allocation)
+	{
+		NullHardwareBuffer hardware_buffer(1024, UsageModeMask::FORGE_CPU_TO_GPU_STREAM);
+
+		{
+			StreamingBufferRing ring(&hardware_buffer);
+
+			EXPECT_TRUE(hardware_buffer.IsLocked());
+
+			ring.BeginFrame();
+
+			size_t first_offset = 0;
+			size_t second_offset = 0;
+
+			unsigned char* first = (unsigned char*)ring.Allocate(10, 4, first_offset);
+			unsigned char* second = (unsigned char*)ring.Allocate(16, 16, second_offset);
+
+			EXPECT_EQ(first_offset, 0);
+			EXPECT_EQ(second_offset, 16);
+
+			first[0] = 0xAB;
+			second[15] = 0xCD;
+
+			ring.EndFrame();
+
+			EXPECT_EQ(hardware_buffer.GetShadowBuffer().GetPointer()[0], 0xAB);
+			EXPECT_EQ(hardware_buffer.GetShadowBuffer().GetPointer()[31], 0xCD);
+
+			EXPECT_EQ(ring.GetStatistics().m_num_of_allocations, 2);
+			EXPECT_EQ(ring.GetStatistics().m_num_of_bytes_allocated, 26);
+			EXPECT_EQ(ring.GetUsedSize(), 32);
+			EXPECT_EQ(ring.GetNumOfFramesInFlight(), 1);
+
+			/// The fence of the frame was signaled when inserted.
+			ring.BeginFrame();
+
+			EXPECT_EQ(ring.GetUsedSize(), 0);
+			EXPECT_EQ(ring.GetNumOfFramesInFlight(), 0);
+
+			ring.EndFrame();
+		}
+
+		EXPECT_FALSE(hardware_buffer.IsLocked());
+
+		/// Frames without allocations insert no fences.
+		EXPECT_EQ(hardware_buffer.GetStatistics().m_num_of_fences, 1);
+		EXPECT_EQ(hardware_buffer.GetStatistics().m_num_of_fence_stalls, 0);
+		EXPECT_EQ(hardware_buffer.GetStatistics().m_num_of_locks, 1);
+	}
+
+	/**
+	 * Tests that the bytes of a frame the GPU did not finish are only reused
+	 * after waiting for its fence, and that allocations wrap around the end
+	 * of the buffer.
+	 */
+	TEST(StreamingBufferRingTest, FencedReuse)
+	{
+		NullHardwareBuffer hardware_buffer(1024, UsageModeMask::FORGE_CPU_TO_GPU_STREAM);
+		hardware_buffer.SetSignalingFences(false);
+
+		StreamingBufferRing ring(&hardware_buffer);
+
+		size_t offset = 0;
+
+		for (size_t i = 0; i < 2; i++)
+		{
+			ring.BeginFrame();
+			ring.Allocate(400, 4, offset);
+			ring.EndFrame();
+
+			EXPECT_EQ(offset, i * 400);
+		}
+
+		EXPECT_EQ(ring.GetNumOfFramesInFlight(), 2);
+
+		/// The third frame fits only by wrapping over the first one.
+		ring.BeginFrame();
+		ring.Allocate(400, 4, offset);
+
+		EXPECT_EQ(offset, 0);
+		EXPECT_EQ(ring.GetStatistics().m_num_of_wraps, 1);
+		EXPECT_EQ(ring.GetStatistics().m_num_of_stalls, 1);
+		EXPECT_EQ(hardware_buffer.GetStatistics().m_num_of_fence_stalls, 1);
+
+		/// The skipped end of the buffer is in use until the frame retires.
+		EXPECT_EQ(ring.GetUsedSize(), 400 + 224 + 400);
+
+		ring.EndFrame();
+
+		/// Once the GPU finished, the next frame retires every frame without
+		/// waiting.
+		hardware_buffer.SignalFences();
+
+		ring.BeginFrame();
+
+		EXPECT_EQ(ring.GetNumOfFramesInFlight(), 0);
+		EXPECT_EQ(ring.GetUsedSize(), 0);
+
+		ring.Allocate(1024, 4, offset);
+		ring.EndFrame();
+
+		EXPECT_EQ(offset, 0);
+		EXPECT_EQ(ring.GetStatistics().m_num_of_stalls, 1);
+	}
+
+	/**
+	 * Tests that a frame waits for the oldest frame once the most frames are
+	 * in flight.
+	 */
+	TEST(StreamingBufferRingTest, FramesInFlight)
+	{
+		NullHardwareBuffer hardware_buffer(1024, UsageModeMask::FORGE_CPU_TO_GPU_STREAM);
+		hardware_buffer.SetSignalingFences(false);
+
+		StreamingBufferRing ring(&hardware_buffer, 2);
+
+		size_t offset = 0;
+
+		for (size_t i = 0; i < 3; i++)
+		{
+			ring.BeginFrame();
+			ring.Allocate(16, 4, offset);
+			ring.EndFrame();
+		}
+
+		EXPECT_EQ(ring.GetStatistics().m_num_of_stalls, 1);
+		EXPECT_EQ(ring.GetNumOfFramesInFlight(), 2);
+		EXPECT_EQ(ring.GetUsedSize(), 32);
+	}
+
+	/**
+	 * Tests that a failed fence wait throws instead of waiting forever, and
+	 * that the ring still unlocks the buffer once destroyed.
+	 */
+	TEST(StreamingBufferRingTest, FailedFenceWait)
+	{
+		NullHardwareBuffer hardware_buffer(1024, UsageModeMask::FORGE_CPU_TO_GPU_STREAM);
+		hardware_buffer.SetSignalingFences(false);
+
+		{
+			StreamingBufferRing ring(&hardware_buffer, 1);
+
+			size_t offset = 0;
+
+			ring.BeginFrame();
+			ring.Allocate(16, 4, offset);
+			ring.EndFrame();
+
+			hardware_buffer.SetFailingFences(true);
+
+			EXPECT_THROW(ring.BeginFrame(), Forge::Debug::InvalidOperationException);
+			EXPECT_EQ(ring.GetNumOfFramesInFlight(), 1);
+		}
+
+		EXPECT_FALSE(hardware_buffer.IsLocked());
+	}
+
+	/**
+	 * Tests that the ring needs a stream buffer and a began frame, and that
+	 * allocations must be aligned to a power of two and fit beside the
+	 * current frame.
+	 */
+	TEST(StreamingBufferRingTest, Validation)
+	{
+		NullHardwareBuffer static_buffer(1024);
+
+		EXPECT_THROW(StreamingBufferRing ring(&static_buffer), Forge::Debug::InvalidOperationException);
+		EXPECT_FALSE(static_buffer.IsLocked());
+
+		NullHardwareBuffer hardware_buffer(1024, UsageModeMask::FORGE_CPU_TO_GPU_STREAM);
+		StreamingBufferRing ring(&hardware_buffer);
+
+		size_t offset = 0;
+
+		EXPECT_THROW(ring.Allocate(16, 4, offset), Forge::Debug::InvalidOperationException);
+		EXPECT_THROW(ring.EndFrame(), Forge::Debug::InvalidOperationException);
+
+		ring.BeginFrame();
+
+		EXPECT_THROW(ring.BeginFrame(), Forge::Debug::InvalidOperationException);
+		EXPECT_THROW(ring.Allocate(2048, 4, offset), Forge::Debug::InvalidOperationException);
+		EXPECT_THROW(ring.Allocate(16, 0, offset), Forge::Debug::InvalidOperationException);
+		EXPECT_THROW(ring.Allocate(16, 3, offset), Forge::Debug::InvalidOperationException);
+
+		ring.Allocate(1000, 4, offset);
+
+		EXPECT_THROW(ring.Allocate(32, 4, offset), Forge::Debug::InvalidOperationException);
+
+		ring.EndFrame();
+	}
+}
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef LINUX_PLATFORM_TEST_H
+#define LINUX_PLATFORM_TEST_H
+
+#include <gtest/gtest.h>
+
+#include <sys/wait.h>
+
+#include "Platform/Public/Platform.h"
+
+#if defined(FORGE_PLATFORM_LINUX)
+
+using namespace Forge::Platform;
+
+namespace LinuxPlatformTest
+{
+	/**
+	 * Tests that the timing routines are monotonic and that the system and
+	 * process memory statistics are populated.
+	 */
+	TEST(LinuxPlatformTest, TimingAndMemoryStats)
+	{
+		LinuxPlatform& platform = LinuxPlatform::GetInstance();
+
+		unsigned long long cycles = platform.GetSystemTimeCycles();
+		double seconds = platform.GetSystemTimeSeconds();
+
+		platform.Sleep(2);
+
+		EXPECT_GT(platform.GetSystemTimeCycles(), cycles);
+		EXPECT_GE(platform.GetSystemTimeSeconds() - seconds, 0.002);
+
+		/// Negative intervals return right away instead of failing forever.
+		platform.Sleep(-5);
+
+		AbstractPlatform::MemoryStats memory_stats = platform.GetMemoryStats();
+
+		EXPECT_GT(memory_stats.total_physical_memory, 0);
+		EXPECT_LE(memory_stats.used_physical_memory, memory_stats.total_physical_memory);
+
+		AbstractPlatform::ProcessMemoryStats process_memory_stats = platform.GetProcessMemoryStats();
+
+		EXPECT_GT(process_memory_stats.used_physical_memory, 0);
+		EXPECT_GE(process_memory_stats.used_virtual_memory, process_memory_stats.used_physical_memory);
+
+		EXPECT_NE(platform.GetCurrentThreadID(), 0);
+		EXPECT_NE(platform.GetCurrentProcessID(), 0);
+	}
+
+	/**
+	 * Tests that reserved pages can be committed, written, decommitted and
+	 * committed again zeroed.
+	 */
+	TEST(LinuxPlatformTest, PageCommitAndDecommit)
+	{
+		LinuxPlatform& platform = LinuxPlatform::GetInstance();
+
+		size_t page_size = platform.GetPageSize();
+
+		unsigned char* pages = static_cast<unsigned char*>(platform.AllocatePages(16, page_size));
+
+		ASSERT_NE(pages, nullptr);
+		ASSERT_TRUE(platform.CommitPages(pages, 4, page_size));
+
+		pages[0] = 0xAB;
+		pages[4 * page_size - 1] = 0xCD;
+
+		platform.DecommitPages(pages, 4, page_size);
+
+		ASSERT_TRUE(platform.CommitPages(pages, 4, page_size));
+
+		EXPECT_EQ(pages[0], 0);
+		EXPECT_EQ(pages[4 * page_size - 1], 0);
+
+		platform.DeallocatePages(pages, 16, page_size);
+	}
+
+	/**
+	 * Tests that processes run with their arguments and working directory,
+	 * report their exit status, and that failing to create one is reported.
+	 */
+	TEST(LinuxPlatformTest, Processes)
+	{
+		LinuxPlatform& platform = LinuxPlatform::GetInstance();
+
+		EXPECT_EQ(platform.ExecuteProcess("sh", "-c \"exit 3\"", nullptr), 3);
+		EXPECT_EQ(platform.ExecuteProcess("sh", "-c \"test $(pwd) = /\"", "/"), 0);
+		EXPECT_EQ(platform.ExecuteProcess("forge-missing-process", nullptr, nullptr), -1);
+		EXPECT_EQ(platform.ExecuteProcess("sh", nullptr, "/forge-missing-directory"), -1);
+
+		int process_id = platform.StartProcess("sh", "-c \"exit 5\"", nullptr);
+
+		ASSERT_GT(process_id, 0);
+
+		int status = 0;
+
+		ASSERT_EQ(waitpid(process_id, &status, 0), process_id);
+		EXPECT_EQ(WEXITSTATUS(status), 5);
+	}
+
+	/**
+	 * Tests that symbols can be resolved from a dynamically loaded library.
+	 */
+	TEST(LinuxPlatformTest, ExternalLibrary)
+	{
+		LinuxPlatform& platform = LinuxPlatform::GetInstance();
+
+		void* library = platform.LoadExternalLibrary("libm.so.6");
+
+		ASSERT_NE(library, nullptr);
+
+		double (*cosine)(double) = reinterpret_cast<double (*)(double)>(platform.GetExternalLibrarySymbol(library, "cos"));
+
+		ASSERT_NE(cosine, nullptr);
+		EXPECT_DOUBLE_EQ(cosine(0.0), 1.0);
+		EXPECT_TRUE(platform.FreeExternalLibrary(library));
+	}
+}
+
+#endif
+
+#endif